@@ -0,0 +1,486 @@
+#include "wire_codec.hpp"
+#include "swarm_compression.hpp"
+#include "physics.hpp"
+#include "shared.hpp"
+#include "error.hpp"
+#include <chrono>
+#include <new>
+
+// Micro benchmark for the encoding of the messages that make up the traffic:
+// swarm states, player states and player inputs. Each codec encodes and
+// decodes the same corpus of synthetic messages, and the throughput is
+// reported in MB/s of encoded bytes and messages/s, along with the heap
+// allocations per message. The corpus only depends on the options, so the
+// numbers from different builds are of the same bytes.
+//
+// The protobuf codec does what the client and server did before the wire
+// codec: a fresh message to encode, and on the client a reused one to decode
+// into. The range codecs pack the swarm state monsters like the server does
+// with monster_compression set, so their bytes per message against the wire
+// codec's is the compression ratio. Their other messages are the wire codec's.
+//
+// usage: protocol_bench [-m 100,1000,10000] [-p 1,16,64] [-f fraction] [-s swarms] [-n messages] [-i passes] [-o result.json]
+
+using namespace swarm;
+
+namespace
+{
+  // every allocation in the process goes through the operator new below, so
+  // each codec can be charged for its own
+  atomic<u64> g_numAllocs(0);
+}
+
+void* operator new(size_t size)
+{
+  ++g_numAllocs;
+  if (void* p = malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  free(p);
+}
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock BenchClock;
+
+  enum MessageKind
+  {
+    KindSwarmState,
+    KindPlayerState,
+    KindPlayerInput,
+    NumKinds,
+  };
+
+  const char* g_kindNames[NumKinds] = { "swarm_state", "player_state", "player_input" };
+
+  struct BenchOptions
+  {
+    BenchOptions() : sendFraction(1), numSwarms(10), numMessages(32), passes(20) {}
+    vector<size_t> monsterCounts;
+    vector<size_t> playerCounts;
+    // the share of the monsters in each swarm state, as dead reckoning only
+    // sends the ones that have drifted
+    float sendFraction;
+    size_t numSwarms;
+    size_t numMessages;
+    size_t passes;
+    string outputFile;
+  };
+
+  // A stream of messages of one kind, as consecutive snapshots would give
+  struct Corpus
+  {
+    MessageKind kind;
+    // monsters, players or inputs per message
+    size_t count;
+    vector<wire::SwarmState> swarmStates;
+    vector<wire::PlayerState> playerStates;
+    vector<vector<wire::PlayerInput>> inputs;
+
+    size_t NumMessages() const
+    {
+      return kind == KindSwarmState ? swarmStates.size() : kind == KindPlayerState ? playerStates.size() : inputs.size();
+    }
+  };
+
+  // Encode writes message i of the corpus, framed. Decode takes a message
+  // without the frame.
+  struct Codec
+  {
+    const char* name;
+    void (*encode)(const Corpus& corpus, size_t i, vector<char>* buf);
+    bool (*decode)(MessageKind kind, const char* data, size_t size);
+  };
+
+  struct BenchResult
+  {
+    string kind;
+    string codec;
+    size_t count;
+    size_t messages;
+    double bytesPerMessage;
+    double encodeMBPerSec;
+    double encodeMsgsPerSec;
+    double encodeAllocsPerMsg;
+    double decodeMBPerSec;
+    double decodeMsgsPerSec;
+    double decodeAllocsPerMsg;
+    bool decodeFailed;
+  };
+
+  //-----------------------------------------------------------------------------
+  s64 ElapsedNs(const BenchClock::time_point& start)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+  }
+
+  //-----------------------------------------------------------------------------
+  template <typename T>
+  void ParseList(const char* str, vector<T>* out, T (*conv)(const string&))
+  {
+    vector<string> splits;
+    Split(str, ",", &splits);
+    out->clear();
+    for (const string& s : splits)
+    {
+      if (!s.empty())
+        out->push_back(conv(s));
+    }
+  }
+
+  size_t ToSize(const string& s) { return (size_t)strtoull(s.c_str(), nullptr, 10); }
+
+  //-----------------------------------------------------------------------------
+  void MakeSwarmStates(const BenchOptions& options, size_t numMonsters, Corpus* corpus)
+  {
+    srand(1337);
+
+    // clumps of monsters around the swarm centers, like InitLevel makes
+    vector<wire::Monster> swarm(numMonsters);
+    size_t numSwarms = max<size_t>(1, options.numSwarms);
+    for (size_t i = 0; i < numMonsters; ++i)
+    {
+      wire::Monster& m = swarm[i];
+      size_t s = i * numSwarms / max<size_t>(1, numMonsters);
+      Vector2f center((float)(50 + (s * 397) % 900), (float)(50 + (s * 613) % 900));
+      m.pos = center + Vector2f(randf(-40, 40), randf(-40, 40));
+      m.vel = Vector2f(randf(-60, 60), randf(-60, 60));
+      m.id = (u32)i;
+      m.size = randf(3, 6);
+      m.hasFixedState = false;
+    }
+
+    corpus->kind = KindSwarmState;
+    corpus->count = numMonsters;
+    corpus->swarmStates.resize(options.numMessages);
+    float snapshotInterval = 0.1f;
+    for (size_t i = 0; i < options.numMessages; ++i)
+    {
+      wire::SwarmState& state = corpus->swarmStates[i];
+      state.tick = (u32)(1000 + i * 5);
+      state.serverTime = state.tick * TIMESTEP;
+      for (wire::Monster& m : swarm)
+      {
+        m.pos += m.vel * snapshotInterval;
+        m.vel = m.vel * 0.98f + Vector2f(randf(-5, 5), randf(-5, 5));
+        if (options.sendFraction >= 1 || randf(0, 1) < options.sendFraction)
+          state.monsters.push_back(m);
+      }
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void MakePlayerStates(const BenchOptions& options, size_t numPlayers, Corpus* corpus)
+  {
+    srand(1337);
+
+    corpus->kind = KindPlayerState;
+    corpus->count = numPlayers;
+    corpus->playerStates.resize(options.numMessages);
+    for (size_t i = 0; i < options.numMessages; ++i)
+    {
+      wire::PlayerState& state = corpus->playerStates[i];
+      state.tick = (u32)(1000 + i * 5);
+      state.serverTime = state.tick * TIMESTEP;
+      for (size_t j = 0; j < numPlayers; ++j)
+      {
+        wire::Player p;
+        p.id = (u32)j;
+        p.acc = Vector2f(randf(-PLAYER_ACCELERATION, PLAYER_ACCELERATION), 0);
+        p.vel = Vector2f(randf(-100, 100), randf(-100, 100));
+        p.pos = Vector2f(randf(0, 1000), randf(0, 1000));
+        p.health = 100 - (int)(i % 100);
+        p.lastInputSeq = (u32)(i * 5 + j);
+        state.players.push_back(p);
+      }
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void MakePlayerInputs(const BenchOptions& options, Corpus* corpus)
+  {
+    srand(1337);
+
+    // each message carries the newest unacked inputs, as Game::SendInputs
+    // sends them
+    corpus->kind = KindPlayerInput;
+    corpus->count = INPUT_REDUNDANCY;
+    corpus->inputs.resize(options.numMessages);
+    for (size_t i = 0; i < options.numMessages; ++i)
+    {
+      for (int j = 0; j < INPUT_REDUNDANCY; ++j)
+      {
+        wire::PlayerInput input;
+        input.seq = (u32)(i + j + 1);
+        input.acc = Vector2f(randf(-1, 1) > 0 ? PLAYER_ACCELERATION : 0, 0);
+        corpus->inputs[i].push_back(input);
+      }
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void EncodeProtobuf(const Corpus& corpus, size_t i, vector<char>* buf)
+  {
+    if (corpus.kind == KindPlayerInput)
+    {
+      game::PlayerMessage msg;
+      msg.set_type(game::PlayerMessage_Type_PLAYER_INPUT);
+      for (const wire::PlayerInput& input : corpus.inputs[i])
+      {
+        game::PlayerInput* in = msg.add_input();
+        in->set_seq(input.seq);
+        ToProtocol(in->mutable_acc(), input.acc);
+      }
+      PackMessage(*buf, msg);
+      return;
+    }
+
+    game::ServerMessage msg;
+    if (corpus.kind == KindSwarmState)
+    {
+      msg.set_type(game::ServerMessage_Type_SWARM_STATE);
+      ToProtocol(msg.mutable_swarm_state(), corpus.swarmStates[i]);
+    }
+    else
+    {
+      msg.set_type(game::ServerMessage_Type_PLAYER_STATE);
+      ToProtocol(msg.mutable_player_state(), corpus.playerStates[i]);
+    }
+    PackMessage(*buf, msg);
+  }
+
+  //-----------------------------------------------------------------------------
+  bool DecodeProtobuf(MessageKind kind, const char* data, size_t size)
+  {
+    // the server parses each input message into a fresh message, and the
+    // client keeps one for all the states
+    if (kind == KindPlayerInput)
+    {
+      game::PlayerMessage msg;
+      return msg.ParseFromArray(data, (int)size);
+    }
+
+    static game::ServerMessage msg;
+    return msg.ParseFromArray(data, (int)size);
+  }
+
+  //-----------------------------------------------------------------------------
+  void EncodeWire(const Corpus& corpus, size_t i, vector<char>* buf)
+  {
+    switch (corpus.kind)
+    {
+      case KindSwarmState:
+        wire::EncodeSwarmState(buf, corpus.swarmStates[i]);
+        break;
+
+      case KindPlayerState:
+        wire::EncodePlayerState(buf, corpus.playerStates[i]);
+        break;
+
+      case KindPlayerInput:
+        wire::EncodePlayerInputs(buf, corpus.inputs[i].data(), corpus.inputs[i].size());
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  bool DecodeWire(MessageKind kind, const char* data, size_t size)
+  {
+    static wire::SwarmState swarmState;
+    static wire::PlayerState playerState;
+    static vector<wire::PlayerInput> inputs;
+
+    if (kind == KindPlayerInput)
+      return wire::DecodePlayerInputs(data, size, &inputs);
+
+    int type;
+    return wire::DecodeServerMessage(data, size, &type, &swarmState, &playerState);
+  }
+
+  //-----------------------------------------------------------------------------
+  template <MonsterOrder Order>
+  void EncodeRange(const Corpus& corpus, size_t i, vector<char>* buf)
+  {
+    static SwarmCompressor compressor;
+    if (corpus.kind == KindSwarmState)
+      compressor.EncodeSwarmState(buf, corpus.swarmStates[i], Order);
+    else
+      EncodeWire(corpus, i, buf);
+  }
+
+  const Codec g_codecs[] =
+  {
+    { "protobuf", EncodeProtobuf, DecodeProtobuf },
+    { "wire", EncodeWire, DecodeWire },
+    { "range_id", EncodeRange<MONSTER_ORDER_ID>, DecodeWire },
+    { "range_spatial", EncodeRange<MONSTER_ORDER_SPATIAL>, DecodeWire },
+  };
+
+  //-----------------------------------------------------------------------------
+  void RunBenchmark(const BenchOptions& options, const Corpus& corpus, const Codec& codec, BenchResult* result)
+  {
+    size_t numMessages = corpus.NumMessages();
+    result->kind = g_kindNames[corpus.kind];
+    result->codec = codec.name;
+    result->count = corpus.count;
+    result->messages = numMessages;
+    result->decodeFailed = false;
+
+    // the first pass is a warm up, which also leaves the encoded messages
+    // for the decoder
+    vector<vector<char>> encoded(numMessages);
+    for (size_t i = 0; i < numMessages; ++i)
+      codec.encode(corpus, i, &encoded[i]);
+
+    size_t totalBytes = 0;
+    for (const vector<char>& buf : encoded)
+      totalBytes += buf.size();
+
+    // encode into a reused buffer, as the server does
+    vector<char> buf = encoded.back();
+    u64 allocs = g_numAllocs;
+    BenchClock::time_point start = BenchClock::now();
+    for (size_t pass = 0; pass < options.passes; ++pass)
+    {
+      for (size_t i = 0; i < numMessages; ++i)
+        codec.encode(corpus, i, &buf);
+    }
+    double encodeSecs = ElapsedNs(start) / 1e9;
+    u64 encodeAllocs = g_numAllocs - allocs;
+
+    for (const vector<char>& msg : encoded)
+      codec.decode(corpus.kind, msg.data() + sizeof(u32), msg.size() - sizeof(u32));
+
+    allocs = g_numAllocs;
+    start = BenchClock::now();
+    for (size_t pass = 0; pass < options.passes; ++pass)
+    {
+      for (const vector<char>& msg : encoded)
+        result->decodeFailed |= !codec.decode(corpus.kind, msg.data() + sizeof(u32), msg.size() - sizeof(u32));
+    }
+    double decodeSecs = ElapsedNs(start) / 1e9;
+    u64 decodeAllocs = g_numAllocs - allocs;
+
+    double totalMessages = (double)numMessages * options.passes;
+    double totalMB = totalBytes * (double)options.passes / (1024 * 1024);
+    result->bytesPerMessage = numMessages ? totalBytes / (double)numMessages : 0;
+    result->encodeMBPerSec = encodeSecs > 0 ? totalMB / encodeSecs : 0;
+    result->encodeMsgsPerSec = encodeSecs > 0 ? totalMessages / encodeSecs : 0;
+    result->encodeAllocsPerMsg = totalMessages > 0 ? encodeAllocs / totalMessages : 0;
+    result->decodeMBPerSec = decodeSecs > 0 ? totalMB / decodeSecs : 0;
+    result->decodeMsgsPerSec = decodeSecs > 0 ? totalMessages / decodeSecs : 0;
+    result->decodeAllocsPerMsg = totalMessages > 0 ? decodeAllocs / totalMessages : 0;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool WriteJson(const char* filename, const BenchOptions& options, const vector<BenchResult>& results)
+  {
+    FILE* f = fopen(filename, "wt");
+    if (!f)
+      return false;
+
+    fprintf(f, "{\n  \"benchmark\": \"protocol\",\n  \"messages\": %d,\n  \"passes\": %d,\n  \"send_fraction\": %.3f,\n  \"results\": [\n",
+        (int)options.numMessages, (int)options.passes, options.sendFraction);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      const BenchResult& r = results[i];
+      fprintf(f, "    { \"kind\": \"%s\", \"codec\": \"%s\", \"count\": %d, \"bytes_per_message\": %.1f, "
+          "\"encode\": { \"mb_per_sec\": %.2f, \"msgs_per_sec\": %.0f, \"allocs_per_msg\": %.2f }, "
+          "\"decode\": { \"mb_per_sec\": %.2f, \"msgs_per_sec\": %.0f, \"allocs_per_msg\": %.2f, \"ok\": %s } }%s\n",
+          r.kind.c_str(), r.codec.c_str(), (int)r.count, r.bytesPerMessage,
+          r.encodeMBPerSec, r.encodeMsgsPerSec, r.encodeAllocsPerMsg,
+          r.decodeMBPerSec, r.decodeMsgsPerSec, r.decodeAllocsPerMsg, r.decodeFailed ? "false" : "true",
+          i == results.size() - 1 ? "" : ",");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+  }
+}
+
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  BenchOptions options;
+  options.monsterCounts = { 100, 1000, 10000 };
+  options.playerCounts = { 1, 16, 64 };
+  options.outputFile = "protocol_bench.json";
+
+  for (int i = 1; i < argc - 1; ++i)
+  {
+    if (strcmp(argv[i], "-m") == 0)
+      ParseList(argv[++i], &options.monsterCounts, ToSize);
+    else if (strcmp(argv[i], "-p") == 0)
+      ParseList(argv[++i], &options.playerCounts, ToSize);
+    else if (strcmp(argv[i], "-f") == 0)
+      options.sendFraction = Clamp((float)atof(argv[++i]), 0.0f, 1.0f);
+    else if (strcmp(argv[i], "-s") == 0)
+      options.numSwarms = max<size_t>(1, ToSize(argv[++i]));
+    else if (strcmp(argv[i], "-n") == 0)
+      options.numMessages = max<size_t>(1, ToSize(argv[++i]));
+    else if (strcmp(argv[i], "-i") == 0)
+      options.passes = max<size_t>(1, ToSize(argv[++i]));
+    else if (strcmp(argv[i], "-o") == 0)
+      options.outputFile = argv[++i];
+  }
+
+  vector<Corpus> corpora;
+  for (size_t numMonsters : options.monsterCounts)
+  {
+    corpora.push_back(Corpus());
+    MakeSwarmStates(options, numMonsters, &corpora.back());
+  }
+
+  for (size_t numPlayers : options.playerCounts)
+  {
+    corpora.push_back(Corpus());
+    MakePlayerStates(options, numPlayers, &corpora.back());
+  }
+
+  corpora.push_back(Corpus());
+  MakePlayerInputs(options, &corpora.back());
+
+  printf("%-13s %-13s %7s %10s | %10s %12s %8s | %10s %12s %8s\n",
+      "kind", "codec", "count", "bytes/msg", "enc MB/s", "enc msgs/s", "allocs", "dec MB/s", "dec msgs/s", "allocs");
+
+  vector<BenchResult> results;
+  for (const Corpus& corpus : corpora)
+  {
+    for (const Codec& codec : g_codecs)
+    {
+      BenchResult r;
+      RunBenchmark(options, corpus, codec, &r);
+      printf("%-13s %-13s %7d %10.1f | %10.2f %12.0f %8.2f | %10.2f %12.0f %8.2f%s\n",
+          r.kind.c_str(), r.codec.c_str(), (int)r.count, r.bytesPerMessage,
+          r.encodeMBPerSec, r.encodeMsgsPerSec, r.encodeAllocsPerMsg,
+          r.decodeMBPerSec, r.decodeMsgsPerSec, r.decodeAllocsPerMsg,
+          r.decodeFailed ? "  DECODE FAILED" : "");
+      results.push_back(r);
+    }
+  }
+
+  if (!WriteJson(options.outputFile.c_str(), options, results))
+  {
+    printf("Unable to write results: %s\n", options.outputFile.c_str());
+    return 1;
+  }
+
+  return 0;
+}
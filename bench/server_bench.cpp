@@ -0,0 +1,270 @@
+#include "swarm_server.hpp"
+#include "error.hpp"
+#include "histogram.hpp"
+#include <chrono>
+
+// Headless benchmark for the server tick. Drives the simulation phases of
+// Server directly (no sockets, no server thread) over a matrix of monster
+// counts, player counts and maps, and reports the cost of each phase in
+// nanoseconds per monster per tick (and the p99 per tick in the json output).
+// Every phase is run once per tick, so the numbers are independent of the
+// cadence the server thread uses. Snapshots are encoded for every player, as
+// each client gets its own. With -a, monsters further than the distance from
+// a player are only sent to it as aggregates. With -c, the monsters in the
+// snapshots are range coded in id or spatial order (uncompressed by default).
+//
+// usage: server_bench [-m 1000,10000] [-p 1,4] [-l data/pacman.png] [-t ticks] [-a distance] [-c none|id|spatial] [-o result.json]
+
+using namespace swarm;
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock BenchClock;
+
+  enum BenchPhase
+  {
+    PhaseAttractors,
+    PhaseIntegration,
+    PhaseCollisions,
+    PhaseSnapshotEncode,
+    NumPhases,
+  };
+
+  const char* g_phaseNames[NumPhases] = { "attractors", "integration", "collisions", "snapshot_encode" };
+
+  struct BenchOptions
+  {
+    BenchOptions()
+      : ticks(50)
+      , numSwarms(10)
+      , aggregateDistance(0)
+      , compression(game::Config_MonsterCompression_UNCOMPRESSED) {}
+    vector<size_t> monsterCounts;
+    vector<size_t> playerCounts;
+    vector<string> maps;
+    size_t ticks;
+    size_t numSwarms;
+    float aggregateDistance;
+    game::Config_MonsterCompression compression;
+    string outputFile;
+  };
+
+  struct BenchResult
+  {
+    string map;
+    size_t monsters;
+    size_t players;
+    size_t ticks;
+    size_t snapshotBytes;
+    double nsPerMonster[NumPhases];
+    u64 p99NsPerTick[NumPhases];
+  };
+
+  //-----------------------------------------------------------------------------
+  s64 ElapsedNs(const BenchClock::time_point& start)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+  }
+
+  //-----------------------------------------------------------------------------
+  template <typename T>
+  void ParseList(const char* str, vector<T>* out, T (*conv)(const string&))
+  {
+    vector<string> splits;
+    Split(str, ",", &splits);
+    out->clear();
+    for (const string& s : splits)
+    {
+      if (!s.empty())
+        out->push_back(conv(s));
+    }
+  }
+
+  size_t ToSize(const string& s) { return (size_t)strtoull(s.c_str(), nullptr, 10); }
+  string ToStr(const string& s) { return s; }
+
+  //-----------------------------------------------------------------------------
+  game::Config_MonsterCompression ToCompression(const string& s)
+  {
+    if (s == "id")
+      return game::Config_MonsterCompression_ID_ORDER;
+    if (s == "spatial")
+      return game::Config_MonsterCompression_SPATIAL_ORDER;
+    return game::Config_MonsterCompression_UNCOMPRESSED;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool RunBenchmark(const BenchOptions& options, const string& map, size_t numMonsters, size_t numPlayers, BenchResult* result)
+  {
+    srand(1337);
+
+    game::Config config;
+    config.set_map_name(map);
+    config.set_num_swarms((u32)options.numSwarms);
+    config.set_monsters_per_swarm((u32)max<size_t>(1, numMonsters / options.numSwarms));
+    config.set_aggregate_distance(options.aggregateDistance);
+    config.set_monster_compression(options.compression);
+
+    Server server;
+    if (!server.InitSimulation(config))
+      return false;
+
+    vector<u32> playerIds;
+    for (size_t i = 0; i < numPlayers; ++i)
+      playerIds.push_back(server.AddSimulatedPlayer());
+
+    result->map = map;
+    result->monsters = server.GetNumMonsters();
+    result->players = numPlayers;
+    result->ticks = options.ticks;
+    result->snapshotBytes = 0;
+
+    Histogram<> phaseNs[NumPhases];
+    double monsterTicks = 0;
+    float timestep = 1/50.0f;
+    vector<char> buf;
+
+    for (size_t tick = 0; tick < options.ticks; ++tick)
+    {
+      monsterTicks += server.GetNumMonsters();
+
+      // every player clicks each tick, which is the worst case for the attractors
+      for (size_t i = 0; i < numPlayers; ++i)
+      {
+        server.AddAttractor(Vector2f(randf(0, 400), randf(0, 400)), 50);
+      }
+
+      BenchClock::time_point start = BenchClock::now();
+      server.ApplyAttractors();
+      phaseNs[PhaseAttractors].Record(ElapsedNs(start));
+
+      start = BenchClock::now();
+      server.Integrate(timestep);
+      phaseNs[PhaseIntegration].Record(ElapsedNs(start));
+
+      start = BenchClock::now();
+      server.HandleCollisions();
+      phaseNs[PhaseCollisions].Record(ElapsedNs(start));
+
+      start = BenchClock::now();
+      size_t snapshotBytes = 0;
+      for (u32 id : playerIds)
+      {
+        server.EncodeMonsterState(id, buf);
+        snapshotBytes = max(snapshotBytes, buf.size());
+      }
+      phaseNs[PhaseSnapshotEncode].Record(ElapsedNs(start));
+      result->snapshotBytes = max(result->snapshotBytes, snapshotBytes);
+    }
+
+    for (int i = 0; i < NumPhases; ++i)
+    {
+      result->nsPerMonster[i] = monsterTicks > 0 ? phaseNs[i].GetSum() / monsterTicks : 0;
+      result->p99NsPerTick[i] = phaseNs[i].GetPercentile(0.99);
+    }
+
+    return true;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool WriteJson(const char* filename, const BenchOptions& options, const vector<BenchResult>& results)
+  {
+    FILE* f = fopen(filename, "wt");
+    if (!f)
+      return false;
+
+    fprintf(f, "{\n  \"benchmark\": \"server_sim\",\n  \"ticks\": %d,\n  \"results\": [\n", (int)options.ticks);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      const BenchResult& r = results[i];
+      fprintf(f, "    { \"map\": \"%s\", \"monsters\": %d, \"players\": %d, \"snapshot_bytes\": %d, \"ns_per_monster_tick\": { ",
+          r.map.c_str(), (int)r.monsters, (int)r.players, (int)r.snapshotBytes);
+      for (int j = 0; j < NumPhases; ++j)
+      {
+        fprintf(f, "\"%s\": %.3f%s", g_phaseNames[j], r.nsPerMonster[j], j == NumPhases - 1 ? " " : ", ");
+      }
+      fprintf(f, "}, \"p99_ns_per_tick\": { ");
+      for (int j = 0; j < NumPhases; ++j)
+      {
+        fprintf(f, "\"%s\": %llu%s", g_phaseNames[j], (unsigned long long)r.p99NsPerTick[j], j == NumPhases - 1 ? " " : ", ");
+      }
+      fprintf(f, "} }%s\n", i == results.size() - 1 ? "" : ",");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+  }
+}
+
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  BenchOptions options;
+  options.monsterCounts = { 1000, 10000, 100000, 1000000 };
+  options.playerCounts = { 1, 4, 16 };
+  options.maps = { "data/pacman.png", "data/level1.png" };
+  options.outputFile = "server_bench.json";
+
+  for (int i = 1; i < argc - 1; ++i)
+  {
+    if (strcmp(argv[i], "-m") == 0)
+      ParseList(argv[++i], &options.monsterCounts, ToSize);
+    else if (strcmp(argv[i], "-p") == 0)
+      ParseList(argv[++i], &options.playerCounts, ToSize);
+    else if (strcmp(argv[i], "-l") == 0)
+      ParseList(argv[++i], &options.maps, ToStr);
+    else if (strcmp(argv[i], "-t") == 0)
+      options.ticks = ToSize(argv[++i]);
+    else if (strcmp(argv[i], "-s") == 0)
+      options.numSwarms = max<size_t>(1, ToSize(argv[++i]));
+    else if (strcmp(argv[i], "-a") == 0)
+      options.aggregateDistance = max(0.0f, (float)atof(argv[++i]));
+    else if (strcmp(argv[i], "-c") == 0)
+      options.compression = ToCompression(argv[++i]);
+    else if (strcmp(argv[i], "-o") == 0)
+      options.outputFile = argv[++i];
+  }
+
+  if (FindAppRoot().empty())
+  {
+    printf("Unable to find app root\n");
+    return 1;
+  }
+
+  printf("%-18s %9s %7s", "map", "monsters", "players");
+  for (int i = 0; i < NumPhases; ++i)
+    printf(" %16s", g_phaseNames[i]);
+  printf("   (ns/monster/tick)\n");
+
+  vector<BenchResult> results;
+  for (const string& map : options.maps)
+  {
+    for (size_t numMonsters : options.monsterCounts)
+    {
+      for (size_t numPlayers : options.playerCounts)
+      {
+        BenchResult result;
+        if (!RunBenchmark(options, map, numMonsters, numPlayers, &result))
+        {
+          printf("Unable to run benchmark for map: %s\n", map.c_str());
+          return 1;
+        }
+
+        printf("%-18s %9d %7d", result.map.c_str(), (int)result.monsters, (int)result.players);
+        for (int i = 0; i < NumPhases; ++i)
+          printf(" %16.3f", result.nsPerMonster[i]);
+        printf("\n");
+
+        results.push_back(result);
+      }
+    }
+  }
+
+  if (!WriteJson(options.outputFile.c_str(), options, results))
+  {
+    printf("Unable to write results: %s\n", options.outputFile.c_str());
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+#include "clock_sync.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  // a few pings in quick succession to sync up, then one a second to follow
+  // any drift and keep the rtt current
+  const u32 NUM_FAST_PINGS = 5;
+  const double FAST_PING_INTERVAL = 0.1;
+  const double PING_INTERVAL = 1.0;
+
+  // the offset eases towards the filtered estimate, so the server time
+  // doesn't jump around. an error this much larger than the sample's own
+  // uncertainty (eg after the server started a new game) is taken at once.
+  const double OFFSET_SMOOTHING = 0.25;
+  const double OFFSET_STEP_THRESHOLD = 0.25;
+}
+
+//-----------------------------------------------------------------------------
+ClockSync::ClockSync()
+{
+  Reset();
+}
+
+//-----------------------------------------------------------------------------
+void ClockSync::Reset()
+{
+  _numSamples = 0;
+  _windowPos = 0;
+  _windowCount = 0;
+  _nextSeq = 1;
+  _nextPing = 0;
+  _rtt = 0;
+  _rttDeviation = 0;
+  _offset = 0;
+}
+
+//-----------------------------------------------------------------------------
+bool ClockSync::FillPing(double localTime, game::Ping* ping)
+{
+  if (localTime < _nextPing)
+    return false;
+
+  ping->set_seq(_nextSeq++);
+  ping->set_client_time(localTime);
+  if (IsSynced())
+    ping->set_rtt_ms((float)(_rtt * 1000));
+
+  // pings can be lost, so the fast ones are counted as sent, not answered
+  _nextPing = localTime + (_nextSeq <= NUM_FAST_PINGS + 1 ? FAST_PING_INTERVAL : PING_INTERVAL);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void ClockSync::HandlePong(const game::Pong& pong, double localTime)
+{
+  double t0 = pong.client_time();
+  double t1 = pong.server_receive_time();
+  double t2 = pong.server_send_time();
+  double t3 = localTime;
+
+  // a pong from before a reset, or from a ping this clock never sent
+  if (pong.seq() >= _nextSeq || t0 > t3)
+    return;
+
+  Sample sample;
+  sample.rtt = max(0.0, (t3 - t0) - (t2 - t1));
+  sample.offset = ((t1 - t0) + (t2 - t3)) / 2;
+
+  if (_numSamples++ == 0)
+  {
+    _rtt = sample.rtt;
+    _rttDeviation = sample.rtt / 2;
+  }
+  else
+  {
+    _rttDeviation += 0.25 * (fabs(sample.rtt - _rtt) - _rttDeviation);
+    _rtt += 0.125 * (sample.rtt - _rtt);
+  }
+
+  // a sample's offset is off by at most half its rtt, so anything beyond that
+  // means the server clock jumped, and the older samples are no good
+  double error = sample.offset - _offset;
+  if (_numSamples == 1 || fabs(error) > sample.rtt / 2 + OFFSET_STEP_THRESHOLD)
+  {
+    _windowCount = 0;
+    _offset = sample.offset;
+  }
+
+  _window[_windowPos] = sample;
+  _windowPos = (_windowPos + 1) % WINDOW_SIZE;
+  _windowCount = min<u32>(_windowCount + 1, WINDOW_SIZE);
+
+  // follow the recent sample with the least queuing
+  const Sample* best = nullptr;
+  for (u32 i = 0; i < _windowCount; ++i)
+  {
+    const Sample& s = _window[(_windowPos + WINDOW_SIZE - 1 - i) % WINDOW_SIZE];
+    if (!best || s.rtt < best->rtt)
+      best = &s;
+  }
+
+  _offset += OFFSET_SMOOTHING * (best->offset - _offset);
+}
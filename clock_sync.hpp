@@ -0,0 +1,63 @@
+#pragma once
+#include "protocol.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Estimates the round trip time to the server, and the offset from the local
+  // clock to the server's, from periodic pings. Each pong gives the four NTP
+  // timestamps: t0 when the ping left, t1 when the server got it, t2 when the
+  // pong left, and t3 when it arrived, so
+  //
+  //  rtt = (t3 - t0) - (t2 - t1)
+  //  offset = ((t1 - t0) + (t2 - t3)) / 2
+  //
+  // The offset is only exact if both ways took as long, and the samples with
+  // the least queuing are the least lopsided, so the offset follows the sample
+  // with the lowest rtt out of the last few. The rtt is smoothed like TCP does.
+  //
+  // All times are in seconds.
+  class ClockSync
+  {
+  public:
+    ClockSync();
+
+    void Reset();
+
+    // Fills in a ping and returns true if one is due
+    bool FillPing(double localTime, game::Ping* ping);
+    void HandlePong(const game::Pong& pong, double localTime);
+
+    bool IsSynced() const { return _numSamples > 0; }
+    u32 GetNumSamples() const { return _numSamples; }
+
+    // smoothed round trip time, and its mean deviation
+    double GetRtt() const { return _rtt; }
+    double GetRttDeviation() const { return _rttDeviation; }
+
+    // server clock - local clock
+    double GetOffset() const { return _offset; }
+    double GetServerTime(double localTime) const { return localTime + _offset; }
+
+  private:
+    enum { WINDOW_SIZE = 8 };
+
+    struct Sample
+    {
+      double rtt;
+      double offset;
+    };
+
+    // the most recent samples
+    Sample _window[WINDOW_SIZE];
+    u32 _windowPos;
+    u32 _windowCount;
+    u32 _numSamples;
+    u32 _nextSeq;
+    double _nextPing;
+
+    double _rtt;
+    double _rttDeviation;
+    double _offset;
+  };
+}
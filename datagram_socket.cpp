@@ -0,0 +1,205 @@
+#include "datagram_socket.hpp"
+#include "error.hpp"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <errno.h>
+#endif
+
+using namespace swarm;
+
+namespace
+{
+#ifdef _WIN32
+  typedef int socklen_t;
+  const SOCKET INVALID_HANDLE = INVALID_SOCKET;
+  void CloseHandle(SOCKET s) { closesocket(s); }
+#else
+  const int INVALID_HANDLE = -1;
+  void CloseHandle(int s) { close(s); }
+#endif
+
+#ifdef __linux__
+  // datagrams per sendmmsg call
+  const size_t SEND_BATCH_SIZE = 64;
+#endif
+
+  //-----------------------------------------------------------------------------
+  sockaddr_in ToSockAddr(const UdpAddress& addr)
+  {
+    sockaddr_in res;
+    memset(&res, 0, sizeof(res));
+    res.sin_family = AF_INET;
+    res.sin_addr.s_addr = htonl(addr.ip);
+    res.sin_port = htons(addr.port);
+    return res;
+  }
+}
+
+//-----------------------------------------------------------------------------
+DatagramSocket::DatagramSocket()
+  : _handle(INVALID_HANDLE)
+  , _port(0)
+  , _numSendCalls(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+DatagramSocket::~DatagramSocket()
+{
+  Close();
+}
+
+//-----------------------------------------------------------------------------
+bool DatagramSocket::Open(u16 port)
+{
+  Close();
+
+  _handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (_handle == INVALID_HANDLE)
+  {
+    LOG_WARN("Unable to create udp socket");
+    return false;
+  }
+
+  sockaddr_in addr = ToSockAddr(UdpAddress(INADDR_ANY, port));
+  if (::bind(_handle, (sockaddr*)&addr, sizeof(addr)) != 0)
+  {
+    LOG_WARN("Unable to bind udp socket" << LogKeyValue("port", port));
+    Close();
+    return false;
+  }
+
+#ifdef _WIN32
+  u_long nonBlocking = 1;
+  ioctlsocket(_handle, FIONBIO, &nonBlocking);
+#else
+  fcntl(_handle, F_SETFL, fcntl(_handle, F_GETFL) | O_NONBLOCK);
+#endif
+
+  socklen_t len = sizeof(addr);
+  getsockname(_handle, (sockaddr*)&addr, &len);
+  _port = ntohs(addr.sin_port);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void DatagramSocket::Close()
+{
+  if (_handle != INVALID_HANDLE)
+    CloseHandle(_handle);
+
+  _handle = INVALID_HANDLE;
+  _port = 0;
+}
+
+//-----------------------------------------------------------------------------
+bool DatagramSocket::IsOpen() const
+{
+  return _handle != INVALID_HANDLE;
+}
+
+//-----------------------------------------------------------------------------
+bool DatagramSocket::SendTo(const UdpAddress& addr, const char* data, size_t size)
+{
+  if (!IsOpen())
+    return false;
+
+  sockaddr_in to = ToSockAddr(addr);
+  ++_numSendCalls;
+  // a full send buffer just drops the datagram, like the network would
+  return sendto(_handle, data, (int)size, 0, (sockaddr*)&to, sizeof(to)) == (int)size;
+}
+
+//-----------------------------------------------------------------------------
+size_t DatagramSocket::SendBatch(const vector<char>& buf, const vector<Datagram>& datagrams)
+{
+  if (!IsOpen())
+    return 0;
+
+  size_t numSent = 0;
+#ifdef __linux__
+  mmsghdr msgs[SEND_BATCH_SIZE];
+  iovec iovs[SEND_BATCH_SIZE];
+  sockaddr_in addrs[SEND_BATCH_SIZE];
+
+  for (size_t first = 0; first < datagrams.size(); first += SEND_BATCH_SIZE)
+  {
+    size_t count = min(SEND_BATCH_SIZE, datagrams.size() - first);
+    for (size_t i = 0; i < count; ++i)
+    {
+      const Datagram& d = datagrams[first + i];
+      addrs[i] = ToSockAddr(d.addr);
+      iovs[i].iov_base = (void*)&buf[d.offset];
+      iovs[i].iov_len = d.size;
+      memset(&msgs[i], 0, sizeof(mmsghdr));
+      msgs[i].msg_hdr.msg_name = &addrs[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // sendmmsg stops at the first datagram that fails, so skip past it and
+    // carry on with the rest of the batch
+    size_t pos = 0;
+    while (pos < count)
+    {
+      ++_numSendCalls;
+      int res = sendmmsg(_handle, msgs + pos, (unsigned)(count - pos), 0);
+      if (res < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        // the send buffer is full, so the rest are dropped, like the network
+        // would drop them
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+          break;
+        ++pos;
+        continue;
+      }
+      numSent += res;
+      pos += res;
+    }
+  }
+#else
+  for (const Datagram& d : datagrams)
+  {
+    if (SendTo(d.addr, &buf[d.offset], d.size))
+      ++numSent;
+  }
+#endif
+  return numSent;
+}
+
+//-----------------------------------------------------------------------------
+bool DatagramSocket::ReceiveFrom(UdpAddress* addr, char* data, size_t capacity, size_t* size)
+{
+  if (!IsOpen())
+    return false;
+
+  while (true)
+  {
+    sockaddr_in from;
+    socklen_t len = sizeof(from);
+    int res = recvfrom(_handle, data, (int)capacity, 0, (sockaddr*)&from, &len);
+    if (res < 0)
+    {
+#ifdef _WIN32
+      // an icmp port unreachable from an earlier send shows up as a reset
+      if (WSAGetLastError() == WSAECONNRESET)
+        continue;
+#else
+      if (errno == EINTR)
+        continue;
+#endif
+      return false;
+    }
+
+    *addr = UdpAddress(ntohl(from.sin_addr.s_addr), ntohs(from.sin_port));
+    *size = (size_t)res;
+    return true;
+  }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+namespace swarm
+{
+  // IPv4 address and port, both in host order
+  struct UdpAddress
+  {
+    UdpAddress() : ip(0), port(0) {}
+    UdpAddress(u32 ip, u16 port) : ip(ip), port(port) {}
+    bool operator==(const UdpAddress& rhs) const { return ip == rhs.ip && port == rhs.port; }
+    bool operator!=(const UdpAddress& rhs) const { return !(*this == rhs); }
+    u32 ip;
+    u16 port;
+  };
+
+  // A datagram queued for sending. The payload lives in a buffer shared by
+  // the whole batch.
+  struct Datagram
+  {
+    UdpAddress addr;
+    u32 offset;
+    u32 size;
+  };
+
+  //-----------------------------------------------------------------------------
+  // Non blocking UDP socket. SFML's UdpSocket sends a single datagram per call,
+  // so this goes straight to the BSD sockets, which lets the server send the
+  // snapshots for all the clients with a few calls to sendmmsg.
+  class DatagramSocket
+  {
+  public:
+    DatagramSocket();
+    ~DatagramSocket();
+
+    // Binds to the given port, or any free port if it's 0
+    bool Open(u16 port);
+    void Close();
+    bool IsOpen() const;
+    u16 GetPort() const { return _port; }
+
+    bool SendTo(const UdpAddress& addr, const char* data, size_t size);
+
+    // Sends all the datagrams, in as few system calls as the platform allows.
+    // Returns the number of datagrams sent.
+    size_t SendBatch(const vector<char>& buf, const vector<Datagram>& datagrams);
+
+    // Reads the next pending datagram. Returns false if there is none.
+    bool ReceiveFrom(UdpAddress* addr, char* data, size_t capacity, size_t* size);
+
+    u64 GetNumSendCalls() const { return _numSendCalls; }
+
+  private:
+#ifdef _WIN32
+    typedef SOCKET Handle;
+#else
+    typedef int Handle;
+#endif
+    Handle _handle;
+    u16 _port;
+    u64 _numSendCalls;
+  };
+}
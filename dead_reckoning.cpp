@@ -0,0 +1,87 @@
+#include "dead_reckoning.hpp"
+
+using namespace swarm;
+
+//-----------------------------------------------------------------------------
+void swarm::ExtrapolateMonster(const Level& level, PhysicsState* state)
+{
+  state->_acc = Vector2f(0, 0);
+  UpdateState(level, MONSTER_FRICTION, TIMESTEP, state);
+}
+
+//-----------------------------------------------------------------------------
+void ReckonedSwarm::Clear()
+{
+  _monsters.clear();
+}
+
+//-----------------------------------------------------------------------------
+void ReckonedSwarm::Apply(const Level& level, const wire::SwarmState& msg)
+{
+  if (msg.full)
+    _monsters.clear();
+
+  for (u32 id : msg.removedIds)
+    RemoveMonster(id);
+
+  // both the current monsters and the ones in the message are sorted by id, so
+  // merge them into the scratch list
+  size_t numMonsters = msg.monsters.size();
+  _scratch.clear();
+  _scratch.reserve(max(_monsters.size(), numMonsters));
+
+  u32 tick = msg.tick;
+  auto it = _monsters.begin();
+  for (size_t i = 0; i <= numMonsters; ++i)
+  {
+    // the last iteration extrapolates the monsters after the last update
+    u32 nextId = i < numMonsters ? msg.monsters[i].id : ~0u;
+    for (; it != _monsters.end() && it->id < nextId; ++it)
+    {
+      _scratch.push_back(*it);
+      Monster& monster = _scratch.back();
+      for (; (s32)(tick - monster.tick) > 0; ++monster.tick)
+        ExtrapolateMonster(level, &monster.state);
+    }
+
+    if (i == numMonsters)
+      break;
+
+    if (it != _monsters.end() && it->id == nextId)
+      ++it;
+
+    const wire::Monster& m = msg.monsters[i];
+    _scratch.push_back(Monster());
+    Monster& monster = _scratch.back();
+    monster.id = m.id;
+    monster.tick = tick;
+    monster.size = m.size;
+    monster.state._vel = m.vel;
+    monster.state._pos = m.pos;
+  }
+
+  _monsters.swap(_scratch);
+}
+
+//-----------------------------------------------------------------------------
+void ReckonedSwarm::Apply(const Level& level, const game::SwarmState& msg)
+{
+  FromProtocol(&_decoded, msg);
+  Apply(level, _decoded);
+}
+
+//-----------------------------------------------------------------------------
+void ReckonedSwarm::Remove(const game::MonsterDied& msg)
+{
+  for (int i = 0; i < msg.id_size(); ++i)
+    RemoveMonster(msg.id(i));
+}
+
+//-----------------------------------------------------------------------------
+void ReckonedSwarm::RemoveMonster(u32 id)
+{
+  auto it = std::lower_bound(_monsters.begin(), _monsters.end(), id,
+      [](const Monster& m, u32 id) { return m.id < id; });
+  if (it != _monsters.end() && it->id == id)
+    _monsters.erase(it);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "physics.hpp"
+#include "protocol.hpp"
+#include "wire_codec.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Client side copy of the swarm. The server only sends the monsters whose
+  // extrapolated state has drifted too far from the real one, so every monster
+  // that isn't in a swarm state is brought forward to the state's tick the same
+  // way the server extrapolates its copy of what the clients have.
+  class ReckonedSwarm
+  {
+  public:
+    struct Monster
+    {
+      PhysicsState state;
+      u32 id;
+      u32 tick;
+      float size;
+    };
+
+    void Clear();
+
+    // Applies a full or partial swarm state. Afterwards all monsters are at the
+    // state's tick, sorted by id.
+    void Apply(const Level& level, const wire::SwarmState& msg);
+    void Apply(const Level& level, const game::SwarmState& msg);
+    void Remove(const game::MonsterDied& msg);
+
+    const vector<Monster>& GetMonsters() const { return _monsters; }
+
+  private:
+    void RemoveMonster(u32 id);
+
+    vector<Monster> _monsters;
+    vector<Monster> _scratch;
+    wire::SwarmState _decoded;
+  };
+
+  // Advances a monster one tick the way both the server and the clients
+  // extrapolate it. Attractors only act for a single tick, so they're left out.
+  void ExtrapolateMonster(const Level& level, PhysicsState* state);
+}
@@ -7,87 +7,325 @@ LogSinkFile swarm::g_logSinkFile;
 LogLevel swarm::g_logLevel = LogLevel::None;
 
 //-----------------------------------------------------------------------------
-void LogSink::Log(LogLevel level, const vector<pair<string, string> >& msg)
+void LogSink::Log(const LogRecord& record)
 {
 }
 
+namespace
+{
+  u64 NowUs()
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+  }
+
+  // writes are batched up to this size
+  const size_t MAX_BATCH_SIZE = 64 * 1024;
+}
+
 //-----------------------------------------------------------------------------
 LogSinkFile::LogSinkFile()
-    : _log(nullptr)
+    : _queue(QUEUE_SIZE)
+    , _log(nullptr)
+    , _fullPolicy(LogFullPolicy::Drop)
+    , _numDropped(0)
+    , _numWritten(0)
+    , _done(false)
+    , _prefixSecond(-1)
 {
+  _prefix[0] = 0;
+  _writerThread = thread(&LogSinkFile::WriterThread, this);
 }
 
 //-----------------------------------------------------------------------------
 LogSinkFile::~LogSinkFile()
 {
-  if (_log)
-    fclose(_log);
+  _done.store(true, std::memory_order_release);
+  if (_writerThread.joinable())
+    _writerThread.join();
+
+  if (FILE* f = _log.load())
+    fclose(f);
 }
 
 //-----------------------------------------------------------------------------
 bool LogSinkFile::Open(const char* filename)
 {
-  _log = fopen(filename, "at");
-  return !!_log;
+  FILE* f = fopen(filename, "at");
+  if (!f)
+    return false;
+
+  // write everything logged so far to the previous file
+  Flush();
+  if (FILE* prev = _log.exchange(f))
+    fclose(prev);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void LogSinkFile::SetFullPolicy(LogFullPolicy policy)
+{
+  _fullPolicy.store(policy, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+u64 LogSinkFile::GetNumDropped() const
+{
+  return _numDropped.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+void LogSinkFile::Log(const LogRecord& record)
+{
+  while (!_queue.TryPush(record))
+  {
+    if (_fullPolicy.load(std::memory_order_relaxed) == LogFullPolicy::Drop || _done.load(std::memory_order_relaxed))
+    {
+      _numDropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void LogSinkFile::Flush()
+{
+  u64 target = _queue.GetNumPushed();
+  while (_numWritten.load(std::memory_order_acquire) < target && !_done.load(std::memory_order_relaxed))
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
 }
 
 //-----------------------------------------------------------------------------
-void LogSinkFile::Log(LogLevel level, const vector<pair<string, string> >& msg)
+void LogSinkFile::WriteRecord(const LogRecord& record, string* out)
 {
   static char levelPrefix[] = { '-', 'D', 'I', 'W', 'E' };
 
-  ptime now = microsec_clock::local_time();
-  string str = toString("[%c] %s - ", levelPrefix[(int)level],
-    boost::posix_time::to_iso_extended_string(now).c_str());
+  // only redo the date formatting when the second changes
+  s64 second = (s64)(record.timestampUs / 1000000);
+  if (second != _prefixSecond)
+  {
+    time_t t = (time_t)second;
+    tm local;
+#ifdef _WIN32
+    localtime_s(&local, &t);
+#else
+    localtime_r(&t, &local);
+#endif
+    strftime(_prefix, sizeof(_prefix), "%Y-%m-%dT%H:%M:%S", &local);
+    _prefixSecond = second;
+  }
+
+  char header[64];
+  sprintf(header, "[%c] %s.%06d - ", levelPrefix[(int)record.level], _prefix, (int)(record.timestampUs % 1000000));
+  out->append(header);
+  FormatLogRecordArgs(record, out);
+  out->push_back('\n');
+}
 
-  if (_log)
-    fprintf(_log, "%s", str.c_str());
-  DebugOutput("%s", str.c_str());
+//-----------------------------------------------------------------------------
+void LogSinkFile::WriterThread()
+{
+  string batch;
+  LogRecord record;
+  u64 reportedDrops = 0;
 
-  for (size_t i = 0; i < msg.size(); ++i)
+  while (true)
   {
-    auto& p = msg[i];
-    bool last = i == msg.size() - 1;
-    str = toString("%s=%s%c", p.first.c_str(), p.second.c_str(), last ? '\n' : '|');
-    if (_log)
-      fprintf(_log, "%s", str.c_str());
-    DebugOutput("%s", str.c_str());
+    bool done = _done.load(std::memory_order_acquire);
+
+    u64 count = 0;
+    batch.clear();
+    while (batch.size() < MAX_BATCH_SIZE && _queue.TryPop(&record))
+    {
+      WriteRecord(record, &batch);
+      ++count;
+    }
+
+    u64 dropped = _numDropped.load(std::memory_order_relaxed);
+    if (dropped != reportedDrops)
+    {
+      LogStream stream(nullptr, LogLevel::Warning);
+      stream << "Log queue full, records dropped" << LogKeyValue("count", dropped - reportedDrops);
+      WriteRecord(stream.GetRecord(), &batch);
+      reportedDrops = dropped;
+    }
+
+    if (batch.empty())
+    {
+      if (done)
+        break;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      continue;
+    }
+
+    if (FILE* f = _log.load(std::memory_order_acquire))
+    {
+      fwrite(batch.data(), 1, batch.size(), f);
+      fflush(f);
+    }
+    DebugOutput("%s", batch.c_str());
+    _numWritten.fetch_add(count, std::memory_order_release);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void swarm::FormatLogRecordArgs(const LogRecord& record, string* out)
+{
+  const char* cur = record.data;
+  const char* end = record.data + record.size;
+  char buf[32];
+
+  bool first = true;
+  while (cur < end)
+  {
+    LogArgType type = (LogArgType)*cur++;
+    const char* key;
+    memcpy(&key, cur, sizeof(key));
+    cur += sizeof(key);
+
+    if (!first)
+      out->push_back('|');
+    first = false;
+    out->append(key);
+    out->push_back('=');
+
+    switch (type)
+    {
+      case LogArgType::Int:
+      {
+        s64 v;
+        memcpy(&v, cur, sizeof(v));
+        cur += sizeof(v);
+        sprintf(buf, "%lld", (long long)v);
+        out->append(buf);
+        break;
+      }
+
+      case LogArgType::UInt:
+      {
+        u64 v;
+        memcpy(&v, cur, sizeof(v));
+        cur += sizeof(v);
+        sprintf(buf, "%llu", (unsigned long long)v);
+        out->append(buf);
+        break;
+      }
+
+      case LogArgType::Double:
+      {
+        double v;
+        memcpy(&v, cur, sizeof(v));
+        cur += sizeof(v);
+        sprintf(buf, "%g", v);
+        out->append(buf);
+        break;
+      }
+
+      case LogArgType::Bool:
+        out->append(*cur++ ? "true" : "false");
+        break;
+
+      case LogArgType::String:
+      {
+        u16 len;
+        memcpy(&len, cur, sizeof(len));
+        cur += sizeof(len);
+        out->append(cur, len);
+        cur += len;
+        break;
+      }
+    }
   }
-  if (_log)
-    fflush(_log);
 }
 
 //-----------------------------------------------------------------------------
 LogStream::LogStream(LogSink* sink, LogLevel level)
     : _sink(sink)
-    , _level(level)
 {
+  _record.level = level;
+  _record.size = 0;
+  _record.timestampUs = NowUs();
 }
 
 //-----------------------------------------------------------------------------
 LogStream::~LogStream()
 {
-  if (_level < g_logLevel)
+  if (_sink)
+    _sink->Log(_record);
+}
+
+//-----------------------------------------------------------------------------
+bool LogStream::AppendHeader(LogArgType type, const char* key, size_t valueSize)
+{
+  if (_record.size + 1 + sizeof(key) + valueSize > LogRecord::MAX_SIZE)
+    return false;
+
+  _record.data[_record.size++] = (char)type;
+  memcpy(_record.data + _record.size, &key, sizeof(key));
+  _record.size += sizeof(key);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void LogStream::AppendInt(const char* key, s64 value)
+{
+  if (!AppendHeader(LogArgType::Int, key, sizeof(value)))
     return;
 
-  if (_sink)
-    _sink->Log(_level, _output);
+  memcpy(_record.data + _record.size, &value, sizeof(value));
+  _record.size += sizeof(value);
+}
+
+//-----------------------------------------------------------------------------
+void LogStream::AppendUInt(const char* key, u64 value)
+{
+  if (!AppendHeader(LogArgType::UInt, key, sizeof(value)))
+    return;
+
+  memcpy(_record.data + _record.size, &value, sizeof(value));
+  _record.size += sizeof(value);
+}
+
+//-----------------------------------------------------------------------------
+void LogStream::AppendDouble(const char* key, double value)
+{
+  if (!AppendHeader(LogArgType::Double, key, sizeof(value)))
+    return;
+
+  memcpy(_record.data + _record.size, &value, sizeof(value));
+  _record.size += sizeof(value);
+}
+
+//-----------------------------------------------------------------------------
+void LogStream::AppendBool(const char* key, bool value)
+{
+  if (!AppendHeader(LogArgType::Bool, key, 1))
+    return;
+
+  _record.data[_record.size++] = value ? 1 : 0;
 }
 
 //-----------------------------------------------------------------------------
-void LogStream::Append(const string& key, const string& value)
+void LogStream::AppendString(const char* key, const char* str, size_t len)
 {
-  if (_level < g_logLevel)
+  // long strings are truncated to fit the record
+  size_t overhead = 1 + sizeof(key) + sizeof(u16);
+  if (_record.size + overhead >= LogRecord::MAX_SIZE)
     return;
 
-  _output.push_back(make_pair(key, value));
+  u16 size = (u16)min(len, LogRecord::MAX_SIZE - _record.size - overhead);
+  AppendHeader(LogArgType::String, key, sizeof(size) + size);
+  memcpy(_record.data + _record.size, &size, sizeof(size));
+  _record.size += sizeof(size);
+  memcpy(_record.data + _record.size, str, size);
+  _record.size += size;
 }
 
 //-----------------------------------------------------------------------------
-LogStream& swarm::operator<<(LogStream& s, const char* desc)
+LogStream& LogStream::operator<<(const char* desc)
 {
-  std::ostringstream str;
-  str << desc;
-  s.Append("desc", desc);
-  return s;
+  AppendString("desc", desc, strlen(desc));
+  return *this;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include "utils.hpp"
+#include "mpsc_queue.hpp"
 
 namespace swarm
 {
@@ -14,37 +15,94 @@ namespace swarm
   };
 
   //----------------------------------------------------------------------------------
+  // Keys are stored by pointer and read on the log writer thread, so they must
+  // be string literals
   template <typename T>
   struct LogObject
   {
-    LogObject(const string& key, const T& value) : key(key), value(value) {}
-    string key;
-    T value;
+    LogObject(const char* key, const T& value) : key(key), value(value) {}
+    const char* key;
+    const T& value;
   };
 
   //----------------------------------------------------------------------------------
   template <typename T>
-  LogObject<T> LogKeyValue(const string& key, const T& value)
+  LogObject<T> LogKeyValue(const char* key, const T& value)
   {
     return LogObject<T>(key, value);
   }
 
+  //----------------------------------------------------------------------------------
+  // The arguments of a log statement, encoded as [type][key ptr][value] and
+  // formatted by the sink
+  enum class LogArgType : u8
+  {
+    Int,
+    UInt,
+    Double,
+    Bool,
+    String,
+  };
+
+  struct LogRecord
+  {
+    enum { MAX_SIZE = 496 };
+    u64 timestampUs;
+    LogLevel level;
+    u16 size;
+    char data[MAX_SIZE];
+  };
+
+  void FormatLogRecordArgs(const LogRecord& record, string* out);
+
   //----------------------------------------------------------------------------------
   struct LogSink
   {
-    virtual void Log(LogLevel level, const vector<pair<string, string> >& msg) = 0;
+    virtual void Log(const LogRecord& record) = 0;
   };
 
   //----------------------------------------------------------------------------------
+  // What to do when a log call finds the queue full
+  enum class LogFullPolicy
+  {
+    Drop,
+    Block,
+  };
+
+  //----------------------------------------------------------------------------------
+  // Log calls only copy the record onto a lock free queue, and a writer thread
+  // does the formatting and file io in batches, so logging never blocks the
+  // calling thread on a syscall.
   struct LogSinkFile : public LogSink
   {
     LogSinkFile();
     ~LogSinkFile();
 
     bool Open(const char* filename);
-    virtual void Log(LogLevel level, const vector<pair<string, string> >& msg);
+    virtual void Log(const LogRecord& record);
+
+    // Blocks until everything logged so far has been written
+    void Flush();
+
+    void SetFullPolicy(LogFullPolicy policy);
+    u64 GetNumDropped() const;
+
+    enum { QUEUE_SIZE = 4096 };
+
+    void WriterThread();
+    void WriteRecord(const LogRecord& record, string* out);
 
-    FILE* _log;
+    MpscQueue<LogRecord> _queue;
+    atomic<FILE*> _log;
+    atomic<LogFullPolicy> _fullPolicy;
+    atomic<u64> _numDropped;
+    atomic<u64> _numWritten;
+    atomic<bool> _done;
+    thread _writerThread;
+
+    // cached formatting of the current second
+    s64 _prefixSecond;
+    char _prefix[32];
   };
 
   //----------------------------------------------------------------------------------
@@ -53,39 +111,77 @@ namespace swarm
   };
 
   //----------------------------------------------------------------------------------
+  // Captures the arguments of a log statement in binary form. Arguments that
+  // don't fit in the record are dropped.
   struct LogStream
   {
     LogStream(LogSink* sink, LogLevel level);
     ~LogStream();
 
-    void Append(const string& key, const string& value);
+    LogStream& operator<<(const char* desc);
+
+    template <typename T>
+    LogStream& operator<<(const LogObject<T>& obj)
+    {
+      AppendValue(obj.key, obj.value);
+      return *this;
+    }
+
+    void AppendInt(const char* key, s64 value);
+    void AppendUInt(const char* key, u64 value);
+    void AppendDouble(const char* key, double value);
+    void AppendBool(const char* key, bool value);
+    void AppendString(const char* key, const char* str, size_t len);
+
+    const LogRecord& GetRecord() const { return _record; }
+
+  private:
+    template <typename T>
+    void AppendValue(const char* key, const T& value)
+    {
+      if (std::is_enum<T>::value || (std::is_integral<T>::value && std::is_signed<T>::value))
+        AppendInt(key, (s64)value);
+      else if (std::is_integral<T>::value)
+        AppendUInt(key, (u64)value);
+      else
+        AppendDouble(key, (double)value);
+    }
+
+    void AppendValue(const char* key, bool value) { AppendBool(key, value); }
+    void AppendValue(const char* key, const char* value) { AppendString(key, value, strlen(value)); }
+    void AppendValue(const char* key, const string& value) { AppendString(key, value.data(), value.size()); }
+
+    template <size_t N>
+    void AppendValue(const char* key, const char (&value)[N]) { AppendString(key, value, strlen(value)); }
+
+    bool AppendHeader(LogArgType type, const char* key, size_t valueSize);
 
-    vector<pair<string, string> > _output;
+    LogRecord _record;
     LogSink* _sink;
-    LogLevel _level;
   };
 
-  template <typename T>
-  LogStream& operator<<(LogStream& s, const LogObject<T>& lhs)
-  {
-    std::ostringstream str;
-    str << lhs.value;
-    s.Append(lhs.key, str.str());
-    return s;
-  }
-
-  LogStream& operator<<(LogStream& s, const char* desc);
-  
   extern LogSinkFile g_logSinkFile;
   extern LogLevel g_logLevel;
 
-#define LOG_DEBUG(x) \
-  swarm::LogStream GEN_NAME(s, __LINE__)(&swarm::g_logSinkFile, swarm::LogLevel::Debug); GEN_NAME(s, __LINE__) << x
-#define LOG_INFO(x) \
-  swarm::LogStream GEN_NAME(s, __LINE__)(&swarm::g_logSinkFile, swarm::LogLevel::Info); GEN_NAME(s, __LINE__) << x
-#define LOG_WARN(x) \
-  swarm::LogStream GEN_NAME(s, __LINE__)(&swarm::g_logSinkFile, swarm::LogLevel::Warning); GEN_NAME(s, __LINE__) << x
-#define LOG_ERROR(x)  \
-  swarm::LogStream GEN_NAME(s, __LINE__)(&swarm::g_logSinkFile, swarm::LogLevel::Error); GEN_NAME(s, __LINE__) << x
-}
+  // Log statements below this level are compiled out
+#ifndef SWARM_MIN_LOG_LEVEL
+#ifdef NDEBUG
+#define SWARM_MIN_LOG_LEVEL 2
+#else
+#define SWARM_MIN_LOG_LEVEL 1
+#endif
+#endif
+
+  // The level is checked before any of the arguments are evaluated. A loop
+  // that runs at most once, rather than an if, so an else after a LOG_*
+  // statement still pairs with the caller's if
+#define LOG_AT_LEVEL(level, x) \
+  for (bool swarm_logEnabled = (int)(level) >= SWARM_MIN_LOG_LEVEL && (level) >= swarm::g_logLevel; \
+      swarm_logEnabled; swarm_logEnabled = false) \
+    swarm::LogStream(&swarm::g_logSinkFile, level) << x
 
+#define LOG_DEBUG(x) LOG_AT_LEVEL(swarm::LogLevel::Debug, x)
+#define LOG_INFO(x) LOG_AT_LEVEL(swarm::LogLevel::Info, x)
+#define LOG_WARN(x) LOG_AT_LEVEL(swarm::LogLevel::Warning, x)
+#define LOG_ERROR(x) LOG_AT_LEVEL(swarm::LogLevel::Error, x)
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // 16.16 fixed point. Integer math gives the same result on every machine and
+  // compiler, which floats don't, so this is what the lockstep simulation runs
+  // on. Floats are only converted on the server, and the raw values are sent.
+  typedef s32 fixed;
+
+  const int FIXED_SHIFT = 16;
+  const fixed FIXED_ONE = 1 << FIXED_SHIFT;
+
+  inline fixed FixedFromInt(int v)
+  {
+    return (fixed)(v * FIXED_ONE);
+  }
+
+  inline fixed FixedFromFloat(float v)
+  {
+    return (fixed)floor((double)v * FIXED_ONE + 0.5);
+  }
+
+  inline float FixedToFloat(fixed v)
+  {
+    return (float)((double)v / FIXED_ONE);
+  }
+
+  inline fixed FixedMul(fixed a, fixed b)
+  {
+    return (fixed)(((s64)a * b) >> FIXED_SHIFT);
+  }
+
+  inline fixed FixedDiv(fixed a, fixed b)
+  {
+    return (fixed)(((s64)a << FIXED_SHIFT) / b);
+  }
+
+  // Integer part, rounded towards negative infinity
+  inline int FixedFloor(fixed v)
+  {
+    return v >> FIXED_SHIFT;
+  }
+
+  //-----------------------------------------------------------------------------
+  // floor(sqrt(v)). The square root of a 32.32 value is its 16.16 root.
+  inline u64 ISqrt(u64 v)
+  {
+    u64 res = 0;
+    u64 bit = 1ull << 62;
+    while (bit > v)
+      bit >>= 2;
+
+    while (bit)
+    {
+      if (v >= res + bit)
+      {
+        v -= res + bit;
+        res = (res >> 1) + bit;
+      }
+      else
+      {
+        res >>= 1;
+      }
+      bit >>= 2;
+    }
+    return res;
+  }
+
+  //-----------------------------------------------------------------------------
+  struct FixedVector2
+  {
+    FixedVector2() : x(0), y(0) {}
+    FixedVector2(fixed x, fixed y) : x(x), y(y) {}
+    fixed x, y;
+  };
+
+  inline FixedVector2 FixedFromFloat(const Vector2f& v)
+  {
+    return FixedVector2(FixedFromFloat(v.x), FixedFromFloat(v.y));
+  }
+
+  inline Vector2f FixedToFloat(const FixedVector2& v)
+  {
+    return Vector2f(FixedToFloat(v.x), FixedToFloat(v.y));
+  }
+}
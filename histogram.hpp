@@ -0,0 +1,196 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  inline int Log2(u64 v)
+  {
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanReverse64(&idx, v);
+    return (int)idx;
+#else
+    return 63 - __builtin_clzll(v);
+#endif
+  }
+
+  //-----------------------------------------------------------------------------
+  // HDR style bucketing of u64 values: each power of two is split into
+  // 2^SubBucketBits linear sub buckets, so every value maps to a bucket whose
+  // width is at most 1/2^SubBucketBits of the value. Values below 2^SubBucketBits
+  // get a bucket each.
+  template <int SubBucketBits>
+  struct LogBuckets
+  {
+    enum
+    {
+      SUB_BUCKETS = 1 << SubBucketBits,
+      NUM_BUCKETS = (64 - SubBucketBits + 1) * SUB_BUCKETS,
+    };
+
+    static int Index(u64 value)
+    {
+      if (value < SUB_BUCKETS)
+        return (int)value;
+
+      int e = Log2(value);
+      int sub = (int)(value >> (e - SubBucketBits)) & (SUB_BUCKETS - 1);
+      return (e - SubBucketBits + 1) * SUB_BUCKETS + sub;
+    }
+
+    static u64 UpperBound(int index)
+    {
+      if (index < SUB_BUCKETS)
+        return index;
+
+      int e = index / SUB_BUCKETS + SubBucketBits - 1;
+      u64 sub = index % SUB_BUCKETS;
+      u64 width = 1ull << (e - SubBucketBits);
+      return ((SUB_BUCKETS + sub) << (e - SubBucketBits)) + width - 1;
+    }
+  };
+
+  //-----------------------------------------------------------------------------
+  // Fixed memory histogram with O(1) recording and percentile queries that are
+  // accurate to within 1/2^SubBucketBits. Values are non-negative integers, so
+  // record times in a suitable unit (us, ns). Histograms can be merged, so
+  // per-thread histograms can be combined into one.
+  // Not thread safe, see AtomicHistogram for that.
+  template <int SubBucketBits = 5>
+  class Histogram
+  {
+  public:
+    typedef LogBuckets<SubBucketBits> Buckets;
+
+    Histogram()
+    {
+      Reset();
+    }
+
+    void Record(u64 value)
+    {
+      _buckets[Buckets::Index(value)]++;
+      _count++;
+      _sum += value;
+      _min = min(_min, value);
+      _max = max(_max, value);
+    }
+
+    void Merge(const Histogram& other)
+    {
+      for (int i = 0; i < Buckets::NUM_BUCKETS; ++i)
+        _buckets[i] += other._buckets[i];
+      _count += other._count;
+      _sum += other._sum;
+      _min = min(_min, other._min);
+      _max = max(_max, other._max);
+    }
+
+    void Reset()
+    {
+      memset(_buckets, 0, sizeof(_buckets));
+      _count = 0;
+      _sum = 0;
+      _min = ~0ull;
+      _max = 0;
+    }
+
+    u64 GetCount() const { return _count; }
+    u64 GetMin() const { return _count ? _min : 0; }
+    u64 GetMax() const { return _max; }
+    u64 GetSum() const { return _sum; }
+    double GetMean() const { return _count ? (double)_sum / _count : 0; }
+
+    // Returns the value below which the given fraction (0..1) of the samples fall
+    u64 GetPercentile(double p) const
+    {
+      if (_count == 0)
+        return 0;
+
+      u64 target = max<u64>(1, (u64)(p * _count + 0.5));
+      u64 seen = 0;
+      for (int i = 0; i < Buckets::NUM_BUCKETS; ++i)
+      {
+        seen += _buckets[i];
+        if (seen >= target)
+          return Clamp(Buckets::UpperBound(i), GetMin(), _max);
+      }
+      return _max;
+    }
+
+  private:
+    template <int> friend class AtomicHistogram;
+
+    u64 _buckets[Buckets::NUM_BUCKETS];
+    u64 _count;
+    u64 _sum;
+    u64 _min;
+    u64 _max;
+  };
+
+  //-----------------------------------------------------------------------------
+  // Histogram that is recorded lock free from a single thread, while any
+  // thread can take a snapshot of it. Use one per recording thread, and merge
+  // the snapshots to combine them.
+  template <int SubBucketBits = 5>
+  class AtomicHistogram
+  {
+  public:
+    typedef LogBuckets<SubBucketBits> Buckets;
+
+    AtomicHistogram()
+    {
+      Reset();
+    }
+
+    void Record(u64 value)
+    {
+      // only one thread writes, so there is no need for atomic increments
+      Increment(_buckets[Buckets::Index(value)], 1);
+      Increment(_count, 1);
+      Increment(_sum, value);
+      if (value < _min.load(std::memory_order_relaxed))
+        _min.store(value, std::memory_order_relaxed);
+      if (value > _max.load(std::memory_order_relaxed))
+        _max.store(value, std::memory_order_relaxed);
+    }
+
+    void Reset()
+    {
+      for (atomic<u64>& bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+      _count.store(0, std::memory_order_relaxed);
+      _sum.store(0, std::memory_order_relaxed);
+      _min.store(~0ull, std::memory_order_relaxed);
+      _max.store(0, std::memory_order_relaxed);
+    }
+
+    // Adds the current contents to the histogram
+    void Snapshot(Histogram<SubBucketBits>* out) const
+    {
+      Histogram<SubBucketBits> h;
+      for (int i = 0; i < Buckets::NUM_BUCKETS; ++i)
+        h._buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+      h._count = _count.load(std::memory_order_relaxed);
+      h._sum = _sum.load(std::memory_order_relaxed);
+      h._min = _min.load(std::memory_order_relaxed);
+      h._max = _max.load(std::memory_order_relaxed);
+      out->Merge(h);
+    }
+
+  private:
+    static void Increment(atomic<u64>& v, u64 delta)
+    {
+      v.store(v.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    atomic<u64> _buckets[Buckets::NUM_BUCKETS];
+    atomic<u64> _count;
+    atomic<u64> _sum;
+    atomic<u64> _min;
+    atomic<u64> _max;
+
+    DISALLOW_COPY_AND_ASSIGN(AtomicHistogram);
+  };
+}
@@ -0,0 +1,122 @@
+#include "initial_state_encoder.hpp"
+
+using namespace swarm;
+
+//-----------------------------------------------------------------------------
+InitialStateEncoder::InitialStateEncoder()
+  : _done(false)
+{
+  _workerThread = thread(&InitialStateEncoder::WorkerThread, this);
+}
+
+//-----------------------------------------------------------------------------
+InitialStateEncoder::~InitialStateEncoder()
+{
+  {
+    lock_guard<mutex> lock(_jobMutex);
+    _done = true;
+  }
+  _jobReady.notify_one();
+  _workerThread.join();
+}
+
+//-----------------------------------------------------------------------------
+u32 InitialStateEncoder::NumChunks(size_t numMonsters)
+{
+  return (u32)((numMonsters + INITIAL_STATE_CHUNK_MONSTERS - 1) / INITIAL_STATE_CHUNK_MONSTERS);
+}
+
+//-----------------------------------------------------------------------------
+void InitialStateEncoder::Encode(Job* job)
+{
+  {
+    lock_guard<mutex> lock(_jobMutex);
+    _jobs.push_back(Job());
+    Job& queued = _jobs.back();
+    queued.connectionId = job->connectionId;
+    queued.tick = job->tick;
+    queued.serverTime = job->serverTime;
+    queued.monsters.swap(job->monsters);
+    queued.lockstepMonsters.swap(job->lockstepMonsters);
+  }
+  _jobReady.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+bool InitialStateEncoder::PopChunk(Chunk* chunk)
+{
+  lock_guard<mutex> lock(_chunkMutex);
+  if (_chunks.empty())
+    return false;
+
+  chunk->connectionId = _chunks.front().connectionId;
+  chunk->buf.swap(_chunks.front().buf);
+  _chunks.pop_front();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void InitialStateEncoder::WorkerThread()
+{
+  while (true)
+  {
+    Job job;
+    {
+      std::unique_lock<mutex> lock(_jobMutex);
+      _jobReady.wait(lock, [this] { return _done || !_jobs.empty(); });
+      if (_done)
+        return;
+
+      job.connectionId = _jobs.front().connectionId;
+      job.tick = _jobs.front().tick;
+      job.serverTime = _jobs.front().serverTime;
+      job.monsters.swap(_jobs.front().monsters);
+      job.lockstepMonsters.swap(_jobs.front().lockstepMonsters);
+      _jobs.pop_front();
+    }
+
+    EncodeJob(job);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void InitialStateEncoder::EncodeJob(const Job& job)
+{
+  u32 numChunks = NumChunks(job.monsters.size());
+  for (u32 i = 0; i < numChunks; ++i)
+  {
+    Chunk chunk;
+    chunk.connectionId = job.connectionId;
+    {
+      wire::Writer writer(&chunk.buf);
+      writer.BeginFrame();
+      writer.WriteVarint(game::ServerMessage::kTypeFieldNumber, game::ServerMessage_Type_SWARM_STATE);
+      writer.BeginNested(game::ServerMessage::kSwarmStateFieldNumber);
+
+      size_t end = min(job.monsters.size(), (i + 1) * INITIAL_STATE_CHUNK_MONSTERS);
+      for (size_t j = i * INITIAL_STATE_CHUNK_MONSTERS; j < end; ++j)
+      {
+        const Monster& monster = job.monsters[j];
+        wire::Monster fixed;
+        fixed.hasFixedState = false;
+        if (j < job.lockstepMonsters.size())
+          ToProtocol(&fixed, job.lockstepMonsters[j]);
+
+        writer.WriteMonster(game::SwarmState::kMonsterFieldNumber, monster.id, monster.pos, monster.vel,
+            monster.size, fixed.hasFixedState ? fixed.fixedState : nullptr);
+      }
+
+      writer.WriteVarint(game::SwarmState::kTickFieldNumber, job.tick);
+      writer.WriteDouble(game::SwarmState::kServerTimeFieldNumber, job.serverTime);
+      writer.WriteVarint(game::SwarmState::kChunkFieldNumber, i);
+      writer.WriteVarint(game::SwarmState::kNumChunksFieldNumber, numChunks);
+      writer.End();
+      writer.End();
+    }
+
+    lock_guard<mutex> lock(_chunkMutex);
+    _chunks.push_back(Chunk());
+    _chunks.back().connectionId = chunk.connectionId;
+    _chunks.back().buf.swap(chunk.buf);
+  }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "protocol.hpp"
+#include "lockstep.hpp"
+
+namespace swarm
+{
+  // Monsters per chunk of the initial state. Each chunk is a bit over 10 KB.
+  const size_t INITIAL_STATE_CHUNK_MONSTERS = 256;
+
+  //-----------------------------------------------------------------------------
+  // Encodes the swarm state a joining client starts from on a worker thread,
+  // so a join doesn't stall the tick. The state is split into chunks of
+  // consecutive monster ids, each a partial swarm state at the join tick,
+  // which the server sends to the client a few at a time.
+  class InitialStateEncoder
+  {
+  public:
+    struct Monster
+    {
+      Vector2f pos;
+      Vector2f vel;
+      u32 id;
+      float size;
+    };
+
+    struct Job
+    {
+      u32 connectionId;
+      u32 tick;
+      double serverTime;
+      // sorted by id
+      vector<Monster> monsters;
+      // in lockstep mode, the exact state of the same monsters
+      vector<LockstepSwarm::Monster> lockstepMonsters;
+    };
+
+    // A framed SWARM_STATE message, ready to send
+    struct Chunk
+    {
+      u32 connectionId;
+      vector<char> buf;
+    };
+
+    InitialStateEncoder();
+    ~InitialStateEncoder();
+
+    static u32 NumChunks(size_t numMonsters);
+
+    // Takes over the job's monsters
+    void Encode(Job* job);
+
+    // Returns the next encoded chunk. The chunks of a job come out in order.
+    bool PopChunk(Chunk* chunk);
+
+  private:
+    void WorkerThread();
+    void EncodeJob(const Job& job);
+
+    mutex _jobMutex;
+    condition_variable _jobReady;
+    deque<Job> _jobs;
+
+    mutex _chunkMutex;
+    deque<Chunk> _chunks;
+
+    bool _done;
+    thread _workerThread;
+  };
+}
@@ -39,7 +39,7 @@ bool Level::Load(const string& filename)
 }
 
 //----------------------------------------------------------------------------------
-bool Level::PosToBackground(const Vector2f& p, u8* out)
+bool Level::PosToBackground(const Vector2f& p, u8* out) const
 {
   if (p.x < 0 || p.x >= _width)
     return false;
@@ -52,6 +52,16 @@ bool Level::PosToBackground(const Vector2f& p, u8* out)
   return true;
 }
 
+//-----------------------------------------------------------------------------
+bool Level::CellToBackground(int x, int y, u8* out) const
+{
+  if (x < 0 || x >= _width || y < 0 || y >= _height)
+    return false;
+
+  *out = _background[y*_width + x];
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 void Level::AddMonsters(vector<Monster* >* monsters)
 {
@@ -9,7 +9,8 @@ namespace swarm
   {
   public:
     bool Load(const string& filename);
-    bool PosToBackground(const Vector2f& p, u8* out);
+    bool PosToBackground(const Vector2f& p, u8* out) const;
+    bool CellToBackground(int x, int y, u8* out) const;
 
     Player* AddPlayer();
     void AddMonsters(vector<Monster* >* monsters);
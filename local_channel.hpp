@@ -0,0 +1,46 @@
+#pragma once
+#include "protocol.hpp"
+#include "spsc_queue.hpp"
+
+namespace swarm
+{
+  typedef shared_ptr<const game::ServerMessage> ServerMessagePtr;
+  typedef shared_ptr<const game::PlayerMessage> PlayerMessagePtr;
+
+  // Messages either way that can be in flight. The client drains its side
+  // every frame, so this is only reached if it stalls for seconds.
+  const size_t LOCAL_CHANNEL_CAPACITY = 4096;
+
+  //-----------------------------------------------------------------------------
+  // Connects a client to a server running in the same process. The messages
+  // are passed as immutable objects instead of going through a socket, so
+  // they're never serialized or parsed, and a message for all clients is only
+  // built once. Either side can close the channel, after which the other side
+  // treats it as a lost connection.
+  class LocalChannel
+  {
+  public:
+    LocalChannel()
+      : _toClient(LOCAL_CHANNEL_CAPACITY)
+      , _toServer(LOCAL_CHANNEL_CAPACITY)
+      , _closed(false)
+    {
+    }
+
+    // server side
+    bool SendToClient(const ServerMessagePtr& msg) { return _toClient.TryPush(msg); }
+    bool ReceiveFromClient(PlayerMessagePtr* msg) { return _toServer.TryPop(msg); }
+
+    // client side
+    bool SendToServer(const PlayerMessagePtr& msg) { return _toServer.TryPush(msg); }
+    bool ReceiveFromServer(ServerMessagePtr* msg) { return _toClient.TryPop(msg); }
+
+    void Close() { _closed = true; }
+    bool IsClosed() const { return _closed; }
+
+  private:
+    SpscQueue<ServerMessagePtr> _toClient;
+    SpscQueue<PlayerMessagePtr> _toServer;
+    atomic<bool> _closed;
+  };
+}
@@ -0,0 +1,182 @@
+#include "lockstep.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  // the same pull as a click has in Server::ApplyAttractor
+  const fixed ATTRACTOR_FORCE = FixedFromInt(1000);
+
+  // FNV-1a
+  const u64 HASH_BASIS = 14695981039346656037ull;
+  const u64 HASH_PRIME = 1099511628211ull;
+
+  void HashU32(u64* hash, u32 v)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      *hash ^= (v >> (i * 8)) & 0xff;
+      *hash *= HASH_PRIME;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void swarm::ToProtocol(game::Monster* lhs, const LockstepSwarm::Monster& rhs)
+{
+  lhs->add_fixed_state(rhs.state._pos.x);
+  lhs->add_fixed_state(rhs.state._pos.y);
+  lhs->add_fixed_state(rhs.state._vel.x);
+  lhs->add_fixed_state(rhs.state._vel.y);
+  lhs->add_fixed_state(rhs.size);
+}
+
+//-----------------------------------------------------------------------------
+void swarm::ToProtocol(wire::Monster* lhs, const LockstepSwarm::Monster& rhs)
+{
+  lhs->fixedState[0] = rhs.state._pos.x;
+  lhs->fixedState[1] = rhs.state._pos.y;
+  lhs->fixedState[2] = rhs.state._vel.x;
+  lhs->fixedState[3] = rhs.state._vel.y;
+  lhs->fixedState[4] = rhs.size;
+  lhs->hasFixedState = true;
+}
+
+//-----------------------------------------------------------------------------
+bool swarm::FromProtocol(LockstepSwarm::Monster* lhs, const wire::Monster& rhs)
+{
+  if (!rhs.hasFixedState)
+    return false;
+
+  lhs->id = rhs.id;
+  lhs->state = FixedPhysicsState();
+  lhs->state._pos = FixedVector2(rhs.fixedState[0], rhs.fixedState[1]);
+  lhs->state._vel = FixedVector2(rhs.fixedState[2], rhs.fixedState[3]);
+  lhs->size = rhs.fixedState[4];
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+LockstepSwarm::LockstepSwarm()
+  : _tick(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+void LockstepSwarm::Clear(u32 tick)
+{
+  _monsters.clear();
+  _tick = tick;
+}
+
+//-----------------------------------------------------------------------------
+void LockstepSwarm::Add(const wire::SwarmState& msg)
+{
+  for (const wire::Monster& m : msg.monsters)
+  {
+    Monster monster;
+    if (FromProtocol(&monster, m))
+      AddMonster(monster);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void LockstepSwarm::AddMonster(const Monster& monster)
+{
+  _monsters.push_back(monster);
+}
+
+//-----------------------------------------------------------------------------
+void LockstepSwarm::RemoveMonster(u32 id)
+{
+  auto it = std::lower_bound(_monsters.begin(), _monsters.end(), id,
+      [](const Monster& m, u32 id) { return m.id < id; });
+  if (it != _monsters.end() && it->id == id)
+    _monsters.erase(it);
+}
+
+//-----------------------------------------------------------------------------
+void LockstepSwarm::Step(const Level& level, const game::LockstepFrame& frame)
+{
+  for (int i = 0; i < frame.removed_id_size(); ++i)
+    RemoveMonster(frame.removed_id(i));
+
+  // attractors act on a single tick
+  for (Monster& monster : _monsters)
+    monster.state._acc = FixedVector2();
+
+  for (int i = 0; i < frame.attractor_size(); ++i)
+    ApplyAttractor(frame.attractor(i));
+
+  for (Monster& monster : _monsters)
+    UpdateStateFixed(level, FIXED_MONSTER_FRICTION, &monster.state);
+
+  ++_tick;
+}
+
+//-----------------------------------------------------------------------------
+void LockstepSwarm::ApplyAttractor(const game::LockstepAttractor& a)
+{
+  // the distances are compared squared, in 32.32
+  s64 radius = a.radius();
+  if (radius <= 0)
+    return;
+
+  u64 radiusSq = (u64)(radius * radius);
+  for (Monster& monster : _monsters)
+  {
+    s64 dx = a.x() - monster.state._pos.x;
+    s64 dy = a.y() - monster.state._pos.y;
+    u64 distSq = (u64)(dx * dx) + (u64)(dy * dy);
+    if (distSq >= radiusSq)
+      continue;
+
+    fixed dist = (fixed)ISqrt(distSq);
+    if (dist == 0)
+      continue;
+
+    // f = m * a, a = f / m
+    fixed strength = FixedDiv(ATTRACTOR_FORCE, monster.size);
+    monster.state._acc.x += FixedMul(strength, FixedDiv((fixed)dx, dist));
+    monster.state._acc.y += FixedMul(strength, FixedDiv((fixed)dy, dist));
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool LockstepSwarm::Advance(const Level& level, const game::LockstepFrames& msg)
+{
+  // frames from before the swarm's tick were in the state it started from
+  int next = 0;
+  while (next < msg.frame_size() && (s32)(msg.frame(next).tick() - _tick) < 0)
+    ++next;
+
+  game::LockstepFrame empty;
+  while ((s32)(msg.tick() - _tick) > 0)
+  {
+    const game::LockstepFrame* frame = &empty;
+    if (next < msg.frame_size() && msg.frame(next).tick() == _tick)
+      frame = &msg.frame(next++);
+
+    Step(level, *frame);
+    if (frame->has_hash() && frame->hash() != Hash())
+      return false;
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+u64 LockstepSwarm::Hash() const
+{
+  u64 hash = HASH_BASIS;
+  HashU32(&hash, _tick);
+  for (const Monster& monster : _monsters)
+  {
+    HashU32(&hash, monster.id);
+    HashU32(&hash, (u32)monster.state._pos.x);
+    HashU32(&hash, (u32)monster.state._pos.y);
+    HashU32(&hash, (u32)monster.state._vel.x);
+    HashU32(&hash, (u32)monster.state._vel.y);
+  }
+  return hash;
+}
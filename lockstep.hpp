@@ -0,0 +1,59 @@
+#pragma once
+#include "physics.hpp"
+#include "protocol.hpp"
+#include "wire_codec.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // The swarm simulated in fixed point, so the same frames give bit identical
+  // monsters on every machine. In lockstep mode the server and the clients
+  // each run one. The server sends the state once when a client joins, and
+  // after that only a LockstepFrame for each tick where monsters died or were
+  // clicked, so the bandwidth doesn't depend on the number of monsters.
+  //
+  // Every so often a frame carries a hash of the server's swarm, so a client
+  // that has drifted out of sync can tell.
+  class LockstepSwarm
+  {
+  public:
+    struct Monster
+    {
+      FixedPhysicsState state;
+      u32 id;
+      fixed size;
+    };
+
+    LockstepSwarm();
+
+    // Empties the swarm, which is at tick from then on
+    void Clear(u32 tick);
+
+    // Adds the monsters in a swarm state. They must come in id order.
+    void Add(const wire::SwarmState& msg);
+    void AddMonster(const Monster& monster);
+    void RemoveMonster(u32 id);
+
+    // Simulates the frame's tick, which must be the current tick
+    void Step(const Level& level, const game::LockstepFrame& frame);
+
+    // Simulates up to the message's tick, and returns false if a hash doesn't
+    // match
+    bool Advance(const Level& level, const game::LockstepFrames& msg);
+
+    u64 Hash() const;
+
+    u32 GetTick() const { return _tick; }
+    const vector<Monster>& GetMonsters() const { return _monsters; }
+
+  private:
+    void ApplyAttractor(const game::LockstepAttractor& a);
+
+    vector<Monster> _monsters;
+    u32 _tick;
+  };
+
+  void ToProtocol(game::Monster* lhs, const LockstepSwarm::Monster& rhs);
+  void ToProtocol(wire::Monster* lhs, const LockstepSwarm::Monster& rhs);
+  bool FromProtocol(LockstepSwarm::Monster* lhs, const wire::Monster& rhs);
+}
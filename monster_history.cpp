@@ -0,0 +1,94 @@
+#include "monster_history.hpp"
+#include "error.hpp"
+
+using namespace swarm;
+
+//-----------------------------------------------------------------------------
+MonsterHistory::MonsterHistory()
+  : _maxTicks(1)
+  , _maxBytes(0)
+  , _warnedCapped(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+void MonsterHistory::Init(u32 maxTicks, size_t maxBytes)
+{
+  _maxTicks = max<u32>(1, maxTicks);
+  _maxBytes = maxBytes;
+  _warnedCapped = false;
+  Clear();
+}
+
+//-----------------------------------------------------------------------------
+void MonsterHistory::Clear()
+{
+  _frames.clear();
+}
+
+//-----------------------------------------------------------------------------
+vector<MonsterHistory::Entry>* MonsterHistory::BeginTick(u32 tick, size_t numMonsters)
+{
+  // Find relies on the ticks being consecutive
+  if (!_frames.empty() && tick != _frames.back().tick + 1)
+    Clear();
+
+  // the current tick is always kept, even if it's over the memory cap
+  size_t maxFrames = _maxTicks;
+  if (_maxBytes > 0)
+  {
+    size_t frameBytes = max<size_t>(1, numMonsters * sizeof(Entry));
+    maxFrames = Clamp<size_t>(_maxBytes / frameBytes, 1, _maxTicks);
+    if (maxFrames < _maxTicks && !_warnedCapped)
+    {
+      // older clicks are evaluated against the oldest tick there is
+      LOG_WARN("Monster history cap shortens the rewind window"
+          << LogKeyValue("ticks", maxFrames)
+          << LogKeyValue("rewind_ticks", _maxTicks)
+          << LogKeyValue("monsters", numMonsters));
+      _warnedCapped = true;
+    }
+  }
+
+  // reuse the storage of the oldest frame, and free any others that no
+  // longer fit
+  Frame frame;
+  while (!_frames.empty() && _frames.size() >= maxFrames)
+  {
+    frame.entries.swap(_frames.front().entries);
+    _frames.pop_front();
+  }
+
+  _frames.push_back(Frame());
+  Frame& newest = _frames.back();
+  newest.tick = tick;
+  newest.entries.swap(frame.entries);
+  newest.entries.clear();
+  newest.entries.reserve(numMonsters);
+  return &newest.entries;
+}
+
+//-----------------------------------------------------------------------------
+const vector<MonsterHistory::Entry>* MonsterHistory::Find(u32 tick) const
+{
+  if (_frames.empty())
+    return nullptr;
+
+  if ((s32)(tick - _frames.front().tick) <= 0)
+    return &_frames.front().entries;
+
+  if ((s32)(tick - _frames.back().tick) >= 0)
+    return &_frames.back().entries;
+
+  // a frame is recorded every tick, so the ticks are consecutive
+  return &_frames[tick - _frames.front().tick].entries;
+}
+
+//-----------------------------------------------------------------------------
+size_t MonsterHistory::GetMemoryUsage() const
+{
+  size_t bytes = 0;
+  for (const Frame& frame : _frames)
+    bytes += frame.entries.capacity() * sizeof(Entry);
+  return bytes;
+}
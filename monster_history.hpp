@@ -0,0 +1,53 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Ring buffer of the monster positions of the most recent ticks. Clicks are
+  // evaluated against the positions at the tick the player was looking at, so
+  // they hit what was on screen, and not where the monsters have moved to
+  // since.
+  //
+  // The history covers at most maxTicks ticks, and fewer if that many ticks of
+  // positions wouldn't fit in maxBytes. A maxBytes of 0 means no cap. The
+  // first time the cap shortens the window, a warning is logged.
+  class MonsterHistory
+  {
+  public:
+    struct Entry
+    {
+      u32 id;
+      Vector2f pos;
+    };
+
+    MonsterHistory();
+
+    void Init(u32 maxTicks, size_t maxBytes);
+    void Clear();
+
+    // Starts recording the positions of a new tick, and returns the list to add
+    // them to, in id order. Evicts the oldest ticks that fall outside the
+    // rewind window or the memory cap.
+    vector<Entry>* BeginTick(u32 tick, size_t numMonsters);
+
+    // Returns the positions at the given tick, clamped to the recorded range,
+    // or nullptr if there is no history
+    const vector<Entry>* Find(u32 tick) const;
+
+    size_t GetNumTicks() const { return _frames.size(); }
+    size_t GetMemoryUsage() const;
+
+  private:
+    struct Frame
+    {
+      u32 tick;
+      vector<Entry> entries;
+    };
+
+    deque<Frame> _frames;
+    u32 _maxTicks;
+    size_t _maxBytes;
+    bool _warnedCapped;
+  };
+}
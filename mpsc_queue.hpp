@@ -0,0 +1,101 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Bounded multiple producer, single consumer queue. Every slot carries a
+  // sequence number that tells producers and the consumer if the slot is free or
+  // full, so a push is a single CAS on the write position and never locks,
+  // allocates or makes a syscall. Based on Dmitry Vyukov's bounded MPMC queue.
+  template <typename T>
+  class MpscQueue
+  {
+  public:
+    // capacity is rounded up to a power of two
+    MpscQueue(size_t capacity)
+      : _writePos(0)
+      , _readPos(0)
+    {
+      size_t size = 1;
+      while (size < capacity)
+        size <<= 1;
+
+      _mask = size - 1;
+      _slots = new Slot[size];
+      for (size_t i = 0; i < size; ++i)
+        _slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    ~MpscQueue()
+    {
+      delete[] _slots;
+    }
+
+    // Returns false if the queue is full
+    bool TryPush(const T& value)
+    {
+      size_t pos = _writePos.load(std::memory_order_relaxed);
+      while (true)
+      {
+        Slot* slot = &_slots[pos & _mask];
+        size_t seq = slot->seq.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0)
+        {
+          if (_writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            slot->value = value;
+            slot->seq.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0)
+        {
+          return false;
+        }
+        else
+        {
+          pos = _writePos.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Must only be called from the consumer thread
+    bool TryPop(T* value)
+    {
+      Slot* slot = &_slots[_readPos & _mask];
+      if (slot->seq.load(std::memory_order_acquire) != _readPos + 1)
+        return false;
+
+      *value = slot->value;
+      slot->seq.store(_readPos + _mask + 1, std::memory_order_release);
+      ++_readPos;
+      return true;
+    }
+
+    // Number of values pushed since the queue was created
+    size_t GetNumPushed() const
+    {
+      return _writePos.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Slot
+    {
+      atomic<size_t> seq;
+      T value;
+    };
+
+    Slot* _slots;
+    size_t _mask;
+
+    // keep the producer and consumer positions on separate cache lines
+    char _pad0[64];
+    atomic<size_t> _writePos;
+    char _pad1[64];
+    size_t _readPos;
+
+    DISALLOW_COPY_AND_ASSIGN(MpscQueue);
+  };
+}
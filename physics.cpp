@@ -0,0 +1,75 @@
+#include "physics.hpp"
+#include "level.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  bool IsOpenFixed(const Level& level, fixed scale, fixed x, fixed y)
+  {
+    u8 b;
+    return level.CellToBackground(FixedFloor(FixedDiv(x, scale)), FixedFloor(FixedDiv(y, scale)), &b) && b == 0;
+  }
+}
+
+//----------------------------------------------------------------------------------
+void swarm::UpdateState(const Level& level, float friction, float dt, PhysicsState* state)
+{
+  // Velocity Verlet integration
+  float scale = level._scale;
+  Vector2f oldVel = state->_vel;
+  Vector2f p = state->_pos;
+  Vector2f v = friction * (state->_vel + state->_acc * dt);
+
+  Vector2f newPos = state->_pos + (oldVel + state->_vel) * 0.5f * dt;
+
+  u8 b;
+  // check horizontal collisions
+  if (!(level.PosToBackground(1/scale * (p + dt * Vector2f(v.x, 0)), &b) && b == 0))
+  {
+    newPos.x = p.x;
+    v.x = -v.x;
+  }
+
+  // check vertical
+  if (!(level.PosToBackground(1/scale * (p + dt * Vector2f(0, v.y)), &b) && b == 0))
+  {
+    newPos.y = p.y;
+    v.y = -v.y;
+  }
+
+  state->_vel = v;
+  state->_pos = newPos;
+}
+
+//----------------------------------------------------------------------------------
+void swarm::UpdateStateFixed(const Level& level, fixed friction, FixedPhysicsState* state)
+{
+  // same steps as UpdateState, where the position also moves with the
+  // velocity from before the step
+  fixed dt = FIXED_TIMESTEP;
+  fixed scale = FixedFromFloat(level._scale);
+  FixedVector2 p = state->_pos;
+  FixedVector2 v(
+      FixedMul(friction, state->_vel.x + FixedMul(state->_acc.x, dt)),
+      FixedMul(friction, state->_vel.y + FixedMul(state->_acc.y, dt)));
+
+  FixedVector2 newPos(p.x + FixedMul(state->_vel.x, dt), p.y + FixedMul(state->_vel.y, dt));
+
+  // check horizontal collisions
+  if (!IsOpenFixed(level, scale, p.x + FixedMul(dt, v.x), p.y))
+  {
+    newPos.x = p.x;
+    v.x = -v.x;
+  }
+
+  // check vertical
+  if (!IsOpenFixed(level, scale, p.x, p.y + FixedMul(dt, v.y)))
+  {
+    newPos.y = p.y;
+    v.y = -v.y;
+  }
+
+  state->_vel = v;
+  state->_pos = newPos;
+}
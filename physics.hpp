@@ -1,7 +1,10 @@
 #pragma once
+#include "fixed_point.hpp"
 
 namespace swarm
 {
+  class Level;
+
   struct PhysicsState
   {
     PhysicsState() : _acc(0,0), _vel(0,0), _pos(0,0) {}
@@ -9,4 +12,31 @@ namespace swarm
     Vector2f _vel;
     Vector2f _pos;
   };
+
+  // fixed simulation step, in seconds
+  const float TIMESTEP = 1 / 50.0f;
+
+  const float MONSTER_FRICTION = 0.999f;
+  const float PLAYER_FRICTION = 0.99f;
+
+  // max acceleration a player can give itself
+  const float PLAYER_ACCELERATION = 30;
+
+  // Velocity Verlet step, bouncing off the level walls. Used by both the client
+  // and server, so they agree on how things move.
+  void UpdateState(const Level& level, float friction, float dt, PhysicsState* state);
+
+  struct FixedPhysicsState
+  {
+    FixedVector2 _acc;
+    FixedVector2 _vel;
+    FixedVector2 _pos;
+  };
+
+  const fixed FIXED_TIMESTEP = FIXED_ONE / 50;
+  const fixed FIXED_MONSTER_FRICTION = (fixed)(MONSTER_FRICTION * FIXED_ONE);
+
+  // UpdateState in fixed point, for the lockstep simulation. Gives bit identical
+  // results everywhere, and always steps TIMESTEP.
+  void UpdateStateFixed(const Level& level, fixed friction, FixedPhysicsState* state);
 }
@@ -3,11 +3,13 @@
 #include <SFML/Network.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <algorithm>
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <queue>
 #include <set>
@@ -67,8 +69,11 @@ namespace swarm
   using std::pair;
   using std::make_pair;
   using std::shared_ptr;
+  using std::make_shared;
   using std::unique_ptr;
   using std::thread;
+  using std::mutex;
+  using std::lock_guard;
 
   using std::function;
 
@@ -2,6 +2,12 @@
 
 namespace swarm
 {
+  namespace
+  {
+    const size_t RECEIVE_CHUNK_SIZE = 64 * 1024;
+    const u32 MAX_MESSAGE_SIZE = 256 * 1024 * 1024;
+  }
+
   //-----------------------------------------------------------------------------
   void ToProtocol(game::Vector2* lhs, const Vector2f& rhs)
   {
@@ -15,4 +21,65 @@ namespace swarm
     lhs->x = rhs.x();
     lhs->y = rhs.y();
   }
+
+  //-----------------------------------------------------------------------------
+  MessageReader::MessageReader()
+    : _buffer(RECEIVE_CHUNK_SIZE)
+    , _readPos(0)
+    , _writePos(0)
+    , _corrupt(false)
+  {
+  }
+
+  //-----------------------------------------------------------------------------
+  Socket::Status MessageReader::Receive(TcpSocket* socket, size_t* bytesReceived)
+  {
+    *bytesReceived = 0;
+    while (true)
+    {
+      // move any partial message to the front of the buffer, and make sure
+      // there is room for another chunk
+      if (_readPos > 0)
+      {
+        memmove(_buffer.data(), _buffer.data() + _readPos, _writePos - _readPos);
+        _writePos -= _readPos;
+        _readPos = 0;
+      }
+
+      if (_buffer.size() - _writePos < RECEIVE_CHUNK_SIZE)
+        _buffer.resize(_writePos + RECEIVE_CHUNK_SIZE);
+
+      size_t received = 0;
+      Socket::Status status = socket->receive(&_buffer[_writePos], _buffer.size() - _writePos, received);
+      if (status != Socket::Done)
+        return *bytesReceived > 0 ? Socket::Done : status;
+
+      _writePos += received;
+      *bytesReceived += received;
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  bool MessageReader::NextMessage(const char** data, u32* size)
+  {
+    size_t available = _writePos - _readPos;
+    if (_corrupt || available < sizeof(u32))
+      return false;
+
+    u32 msgSize = ntohl(*(u32*)&_buffer[_readPos]);
+    if (msgSize > MAX_MESSAGE_SIZE)
+    {
+      LOG_WARN("Message size out of bounds" << LogKeyValue("size", msgSize));
+      _corrupt = true;
+      return false;
+    }
+
+    if (available < sizeof(u32) + msgSize)
+      return false;
+
+    *data = &_buffer[_readPos + sizeof(u32)];
+    *size = msgSize;
+    _readPos += sizeof(u32) + msgSize;
+    return true;
+  }
 }
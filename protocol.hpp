@@ -1,5 +1,6 @@
 #pragma once
 #include "utils.hpp"
+#include "error.hpp"
 #include "protocol/game.pb.h"
 #include <google/protobuf/text_format.h>
 
@@ -17,4 +18,45 @@ namespace swarm
 
     return google::protobuf::TextFormat::ParseFromString(str, msg);
   }
-}
\ No newline at end of file
+
+  // Messages are sent in both directions as a u32 size (network order),
+  // followed by the serialized message
+  template <typename T>
+  bool PackMessage(vector<char>& buf, const T& msg)
+  {
+    size_t size = msg.ByteSizeLong();
+    buf.resize(size + sizeof(u32));
+    *(u32*)buf.data() = htonl((u32)size);
+    if (!msg.SerializeToArray(&buf[4], (int)size))
+    {
+      LOG_WARN("Unable to serialize message");
+      return false;
+    }
+    return true;
+  }
+
+  //-----------------------------------------------------------------------------
+  // Accumulates the byte stream from a socket, and splits it into messages
+  class MessageReader
+  {
+  public:
+    MessageReader();
+
+    // Reads everything currently available on the socket. Returns Done if any
+    // data was read.
+    Socket::Status Receive(TcpSocket* socket, size_t* bytesReceived);
+
+    // Returns the next complete message, or false if the next message
+    // hasn't been fully received yet.
+    bool NextMessage(const char** data, u32* size);
+
+    // True if the stream is corrupt (ie the message size is out of bounds)
+    bool IsCorrupt() const { return _corrupt; }
+
+  private:
+    vector<char> _buffer;
+    size_t _readPos;
+    size_t _writePos;
+    bool _corrupt;
+  };
+}
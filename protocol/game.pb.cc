@@ -1,5050 +1,10377 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: game.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "game.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
 namespace swarm {
 namespace game {
-
-namespace {
-
-const ::google::protobuf::Descriptor* Vector2_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Vector2_reflection_ = NULL;
-const ::google::protobuf::Descriptor* PlayerJoined_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PlayerJoined_reflection_ = NULL;
-const ::google::protobuf::Descriptor* PlayerLeft_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PlayerLeft_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Monster_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Monster_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SwarmState_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SwarmState_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Player_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Player_reflection_ = NULL;
-const ::google::protobuf::Descriptor* PlayerClick_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PlayerClick_reflection_ = NULL;
-const ::google::protobuf::Descriptor* PlayerState_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PlayerState_reflection_ = NULL;
-const ::google::protobuf::Descriptor* GameStarted_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  GameStarted_reflection_ = NULL;
-const ::google::protobuf::Descriptor* GameEnded_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  GameEnded_reflection_ = NULL;
-const ::google::protobuf::Descriptor* PlayerDied_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PlayerDied_reflection_ = NULL;
-const ::google::protobuf::Descriptor* MonsterDied_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MonsterDied_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ServerMessage_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ServerMessage_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* ServerMessage_Type_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* PlayerMessage_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  PlayerMessage_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* PlayerMessage_Type_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Config_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Config_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_game_2eproto() {
-  protobuf_AddDesc_game_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "game.proto");
-  GOOGLE_CHECK(file != NULL);
-  Vector2_descriptor_ = file->message_type(0);
-  static const int Vector2_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Vector2, x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Vector2, y_),
+PROTOBUF_CONSTEXPR Vector2::Vector2(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0} {}
+struct Vector2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Vector2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Vector2DefaultTypeInternal() {}
+  union {
+    Vector2 _instance;
   };
-  Vector2_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Vector2_descriptor_,
-      Vector2::default_instance_,
-      Vector2_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Vector2, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Vector2, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Vector2));
-  PlayerJoined_descriptor_ = file->message_type(1);
-  static const int PlayerJoined_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerJoined, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerJoined, id_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vector2DefaultTypeInternal _Vector2_default_instance_;
+PROTOBUF_CONSTEXPR PlayerJoined::PlayerJoined(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u} {}
+struct PlayerJoinedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerJoinedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerJoinedDefaultTypeInternal() {}
+  union {
+    PlayerJoined _instance;
   };
-  PlayerJoined_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PlayerJoined_descriptor_,
-      PlayerJoined::default_instance_,
-      PlayerJoined_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerJoined, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerJoined, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PlayerJoined));
-  PlayerLeft_descriptor_ = file->message_type(2);
-  static const int PlayerLeft_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerLeft, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerLeft, id_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerJoinedDefaultTypeInternal _PlayerJoined_default_instance_;
+PROTOBUF_CONSTEXPR PlayerLeft::PlayerLeft(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u} {}
+struct PlayerLeftDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerLeftDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerLeftDefaultTypeInternal() {}
+  union {
+    PlayerLeft _instance;
   };
-  PlayerLeft_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PlayerLeft_descriptor_,
-      PlayerLeft::default_instance_,
-      PlayerLeft_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerLeft, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerLeft, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PlayerLeft));
-  Monster_descriptor_ = file->message_type(3);
-  static const int Monster_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Monster, acc_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Monster, vel_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Monster, pos_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Monster, size_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerLeftDefaultTypeInternal _PlayerLeft_default_instance_;
+PROTOBUF_CONSTEXPR Monster::Monster(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.fixed_state_)*/{}
+  , /*decltype(_impl_._fixed_state_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.acc_)*/nullptr
+  , /*decltype(_impl_.vel_)*/nullptr
+  , /*decltype(_impl_.pos_)*/nullptr
+  , /*decltype(_impl_.size_)*/0
+  , /*decltype(_impl_.id_)*/0u} {}
+struct MonsterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MonsterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MonsterDefaultTypeInternal() {}
+  union {
+    Monster _instance;
   };
-  Monster_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Monster_descriptor_,
-      Monster::default_instance_,
-      Monster_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Monster, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Monster, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Monster));
-  SwarmState_descriptor_ = file->message_type(4);
-  static const int SwarmState_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SwarmState, monster_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MonsterDefaultTypeInternal _Monster_default_instance_;
+PROTOBUF_CONSTEXPR SwarmAggregate::SwarmAggregate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.pos_)*/nullptr
+  , /*decltype(_impl_.vel_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.extent_)*/0
+  , /*decltype(_impl_.count_)*/0u} {}
+struct SwarmAggregateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SwarmAggregateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SwarmAggregateDefaultTypeInternal() {}
+  union {
+    SwarmAggregate _instance;
   };
-  SwarmState_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SwarmState_descriptor_,
-      SwarmState::default_instance_,
-      SwarmState_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SwarmState, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SwarmState, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SwarmState));
-  Player_descriptor_ = file->message_type(5);
-  static const int Player_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, acc_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, vel_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, pos_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, health_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SwarmAggregateDefaultTypeInternal _SwarmAggregate_default_instance_;
+PROTOBUF_CONSTEXPR SwarmState::SwarmState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.monster_)*/{}
+  , /*decltype(_impl_.removed_id_)*/{}
+  , /*decltype(_impl_.aggregate_)*/{}
+  , /*decltype(_impl_.packed_monsters_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_time_)*/0
+  , /*decltype(_impl_.tick_)*/0u
+  , /*decltype(_impl_.full_)*/false
+  , /*decltype(_impl_.chunk_)*/0u
+  , /*decltype(_impl_.num_chunks_)*/0u} {}
+struct SwarmStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SwarmStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SwarmStateDefaultTypeInternal() {}
+  union {
+    SwarmState _instance;
   };
-  Player_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Player_descriptor_,
-      Player::default_instance_,
-      Player_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Player, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Player));
-  PlayerClick_descriptor_ = file->message_type(6);
-  static const int PlayerClick_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerClick, click_pos_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerClick, click_size_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SwarmStateDefaultTypeInternal _SwarmState_default_instance_;
+PROTOBUF_CONSTEXPR Player::Player(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.acc_)*/nullptr
+  , /*decltype(_impl_.vel_)*/nullptr
+  , /*decltype(_impl_.pos_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.health_)*/0
+  , /*decltype(_impl_.last_input_seq_)*/0u} {}
+struct PlayerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerDefaultTypeInternal() {}
+  union {
+    Player _instance;
   };
-  PlayerClick_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PlayerClick_descriptor_,
-      PlayerClick::default_instance_,
-      PlayerClick_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerClick, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerClick, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PlayerClick));
-  PlayerState_descriptor_ = file->message_type(7);
-  static const int PlayerState_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerState, player_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerDefaultTypeInternal _Player_default_instance_;
+PROTOBUF_CONSTEXPR PlayerClick::PlayerClick(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.click_pos_)*/nullptr
+  , /*decltype(_impl_.click_size_)*/0
+  , /*decltype(_impl_.render_tick_)*/0u} {}
+struct PlayerClickDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerClickDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerClickDefaultTypeInternal() {}
+  union {
+    PlayerClick _instance;
   };
-  PlayerState_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PlayerState_descriptor_,
-      PlayerState::default_instance_,
-      PlayerState_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerState, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerState, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PlayerState));
-  GameStarted_descriptor_ = file->message_type(8);
-  static const int GameStarted_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, player_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, health_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, map_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, player_state_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, swarm_state_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerClickDefaultTypeInternal _PlayerClick_default_instance_;
+PROTOBUF_CONSTEXPR PlayerInput::PlayerInput(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.acc_)*/nullptr
+  , /*decltype(_impl_.seq_)*/0u} {}
+struct PlayerInputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerInputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerInputDefaultTypeInternal() {}
+  union {
+    PlayerInput _instance;
   };
-  GameStarted_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      GameStarted_descriptor_,
-      GameStarted::default_instance_,
-      GameStarted_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameStarted, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(GameStarted));
-  GameEnded_descriptor_ = file->message_type(9);
-  static const int GameEnded_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameEnded, winner_id_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerInputDefaultTypeInternal _PlayerInput_default_instance_;
+PROTOBUF_CONSTEXPR PlayerHello::PlayerHello(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.session_token_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_tick_)*/0u
+  , /*decltype(_impl_.spectator_)*/false} {}
+struct PlayerHelloDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerHelloDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerHelloDefaultTypeInternal() {}
+  union {
+    PlayerHello _instance;
   };
-  GameEnded_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      GameEnded_descriptor_,
-      GameEnded::default_instance_,
-      GameEnded_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameEnded, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GameEnded, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(GameEnded));
-  PlayerDied_descriptor_ = file->message_type(10);
-  static const int PlayerDied_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerDied, player_id_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerHelloDefaultTypeInternal _PlayerHello_default_instance_;
+PROTOBUF_CONSTEXPR PlayerState::PlayerState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.player_)*/{}
+  , /*decltype(_impl_.server_time_)*/0
+  , /*decltype(_impl_.tick_)*/0u} {}
+struct PlayerStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerStateDefaultTypeInternal() {}
+  union {
+    PlayerState _instance;
   };
-  PlayerDied_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PlayerDied_descriptor_,
-      PlayerDied::default_instance_,
-      PlayerDied_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerDied, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerDied, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PlayerDied));
-  MonsterDied_descriptor_ = file->message_type(11);
-  static const int MonsterDied_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MonsterDied, pos_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerStateDefaultTypeInternal _PlayerState_default_instance_;
+PROTOBUF_CONSTEXPR GameStarted::GameStarted(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.map_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.player_state_)*/nullptr
+  , /*decltype(_impl_.swarm_state_)*/nullptr
+  , /*decltype(_impl_.player_id_)*/0u
+  , /*decltype(_impl_.health_)*/0u
+  , /*decltype(_impl_.snapshot_interval_ms_)*/0u
+  , /*decltype(_impl_.udp_port_)*/0u
+  , /*decltype(_impl_.session_token_)*/uint64_t{0u}
+  , /*decltype(_impl_.udp_token_)*/0u
+  , /*decltype(_impl_.initial_state_chunks_)*/0u
+  , /*decltype(_impl_.resumed_)*/false
+  , /*decltype(_impl_.lockstep_)*/false} {}
+struct GameStartedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStartedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStartedDefaultTypeInternal() {}
+  union {
+    GameStarted _instance;
   };
-  MonsterDied_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MonsterDied_descriptor_,
-      MonsterDied::default_instance_,
-      MonsterDied_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MonsterDied, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MonsterDied, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MonsterDied));
-  ServerMessage_descriptor_ = file->message_type(12);
-  static const int ServerMessage_offsets_[9] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, game_started_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, player_joined_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, player_left_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, swarm_state_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, player_state_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, player_died_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, game_ended_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, monster_died_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStartedDefaultTypeInternal _GameStarted_default_instance_;
+PROTOBUF_CONSTEXPR GameEnded::GameEnded(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.winner_id_)*/0u} {}
+struct GameEndedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEndedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEndedDefaultTypeInternal() {}
+  union {
+    GameEnded _instance;
   };
-  ServerMessage_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      ServerMessage_descriptor_,
-      ServerMessage::default_instance_,
-      ServerMessage_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ServerMessage, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(ServerMessage));
-  ServerMessage_Type_descriptor_ = ServerMessage_descriptor_->enum_type(0);
-  PlayerMessage_descriptor_ = file->message_type(13);
-  static const int PlayerMessage_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerMessage, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerMessage, pos_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerMessage, click_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEndedDefaultTypeInternal _GameEnded_default_instance_;
+PROTOBUF_CONSTEXPR PlayerDied::PlayerDied(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.player_id_)*/0u} {}
+struct PlayerDiedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerDiedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerDiedDefaultTypeInternal() {}
+  union {
+    PlayerDied _instance;
   };
-  PlayerMessage_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      PlayerMessage_descriptor_,
-      PlayerMessage::default_instance_,
-      PlayerMessage_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerMessage, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(PlayerMessage, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(PlayerMessage));
-  PlayerMessage_Type_descriptor_ = PlayerMessage_descriptor_->enum_type(0);
-  Config_descriptor_ = file->message_type(14);
-  static const int Config_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, map_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, num_swarms_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, monsters_per_swarm_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, min_players_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, max_players_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, initial_health_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerDiedDefaultTypeInternal _PlayerDied_default_instance_;
+PROTOBUF_CONSTEXPR MonsterDied::MonsterDied(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pos_)*/{}
+  , /*decltype(_impl_.id_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MonsterDiedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MonsterDiedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MonsterDiedDefaultTypeInternal() {}
+  union {
+    MonsterDied _instance;
   };
-  Config_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Config_descriptor_,
-      Config::default_instance_,
-      Config_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Config, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Config));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_game_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Vector2_descriptor_, &Vector2::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PlayerJoined_descriptor_, &PlayerJoined::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PlayerLeft_descriptor_, &PlayerLeft::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Monster_descriptor_, &Monster::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SwarmState_descriptor_, &SwarmState::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Player_descriptor_, &Player::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PlayerClick_descriptor_, &PlayerClick::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PlayerState_descriptor_, &PlayerState::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    GameStarted_descriptor_, &GameStarted::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    GameEnded_descriptor_, &GameEnded::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PlayerDied_descriptor_, &PlayerDied::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MonsterDied_descriptor_, &MonsterDied::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    ServerMessage_descriptor_, &ServerMessage::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    PlayerMessage_descriptor_, &PlayerMessage::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Config_descriptor_, &Config::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_game_2eproto() {
-  delete Vector2::default_instance_;
-  delete Vector2_reflection_;
-  delete PlayerJoined::default_instance_;
-  delete PlayerJoined_reflection_;
-  delete PlayerLeft::default_instance_;
-  delete PlayerLeft_reflection_;
-  delete Monster::default_instance_;
-  delete Monster_reflection_;
-  delete SwarmState::default_instance_;
-  delete SwarmState_reflection_;
-  delete Player::default_instance_;
-  delete Player_reflection_;
-  delete PlayerClick::default_instance_;
-  delete PlayerClick_reflection_;
-  delete PlayerState::default_instance_;
-  delete PlayerState_reflection_;
-  delete GameStarted::default_instance_;
-  delete GameStarted_reflection_;
-  delete GameEnded::default_instance_;
-  delete GameEnded_reflection_;
-  delete PlayerDied::default_instance_;
-  delete PlayerDied_reflection_;
-  delete MonsterDied::default_instance_;
-  delete MonsterDied_reflection_;
-  delete ServerMessage::default_instance_;
-  delete ServerMessage_reflection_;
-  delete PlayerMessage::default_instance_;
-  delete PlayerMessage_reflection_;
-  delete Config::default_instance_;
-  delete Config_reflection_;
-}
-
-void protobuf_AddDesc_game_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\ngame.proto\022\nswarm.game\"\037\n\007Vector2\022\t\n\001x"
-    "\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\"(\n\014PlayerJoined\022\014\n\004nam"
-    "e\030\001 \001(\t\022\n\n\002id\030\002 \001(\r\"&\n\nPlayerLeft\022\014\n\004nam"
-    "e\030\001 \001(\t\022\n\n\002id\030\002 \001(\r\"}\n\007Monster\022 \n\003acc\030\001 "
-    "\001(\0132\023.swarm.game.Vector2\022 \n\003vel\030\002 \001(\0132\023."
-    "swarm.game.Vector2\022 \n\003pos\030\003 \001(\0132\023.swarm."
-    "game.Vector2\022\014\n\004size\030\004 \001(\002\"2\n\nSwarmState"
-    "\022$\n\007monster\030\001 \003(\0132\023.swarm.game.Monster\"\212"
-    "\001\n\006Player\022\n\n\002id\030\001 \001(\r\022 \n\003acc\030\002 \001(\0132\023.swa"
-    "rm.game.Vector2\022 \n\003vel\030\003 \001(\0132\023.swarm.gam"
-    "e.Vector2\022 \n\003pos\030\004 \001(\0132\023.swarm.game.Vect"
-    "or2\022\016\n\006health\030\005 \001(\005\"I\n\013PlayerClick\022&\n\tcl"
-    "ick_pos\030\001 \001(\0132\023.swarm.game.Vector2\022\022\n\ncl"
-    "ick_size\030\002 \001(\002\"1\n\013PlayerState\022\"\n\006player\030"
-    "\001 \003(\0132\022.swarm.game.Player\"\236\001\n\013GameStarte"
-    "d\022\021\n\tplayer_id\030\001 \001(\r\022\016\n\006health\030\002 \001(\r\022\020\n\010"
-    "map_name\030\003 \001(\t\022-\n\014player_state\030\004 \001(\0132\027.s"
-    "warm.game.PlayerState\022+\n\013swarm_state\030\005 \001"
-    "(\0132\026.swarm.game.SwarmState\"\036\n\tGameEnded\022"
-    "\021\n\twinner_id\030\001 \001(\r\"\037\n\nPlayerDied\022\021\n\tplay"
-    "er_id\030\001 \001(\r\"/\n\013MonsterDied\022 \n\003pos\030\001 \003(\0132"
-    "\023.swarm.game.Vector2\"\302\004\n\rServerMessage\022,"
-    "\n\004type\030\001 \002(\0162\036.swarm.game.ServerMessage."
-    "Type\022-\n\014game_started\030\002 \001(\0132\027.swarm.game."
-    "GameStarted\022/\n\rplayer_joined\030\003 \001(\0132\030.swa"
-    "rm.game.PlayerJoined\022+\n\013player_left\030\004 \001("
-    "\0132\026.swarm.game.PlayerLeft\022+\n\013swarm_state"
-    "\030\005 \001(\0132\026.swarm.game.SwarmState\022-\n\014player"
-    "_state\030\006 \001(\0132\027.swarm.game.PlayerState\022+\n"
-    "\013player_died\030\007 \001(\0132\026.swarm.game.PlayerDi"
-    "ed\022)\n\ngame_ended\030\010 \001(\0132\025.swarm.game.Game"
-    "Ended\022-\n\014monster_died\030\t \001(\0132\027.swarm.game"
-    ".MonsterDied\"\222\001\n\004Type\022\020\n\014GAME_STARTED\020\000\022"
-    "\021\n\rPLAYER_JOINED\020\001\022\017\n\013PLAYER_LEFT\020\002\022\017\n\013S"
-    "WARM_STATE\020\003\022\020\n\014PLAYER_STATE\020\004\022\017\n\013PLAYER"
-    "_DIED\020\005\022\016\n\nGAME_ENDED\020\006\022\020\n\014MONSTER_DIED\020"
-    "\007\"\261\001\n\rPlayerMessage\022,\n\004type\030\001 \002(\0162\036.swar"
-    "m.game.PlayerMessage.Type\022 \n\003pos\030\002 \001(\0132\023"
-    ".swarm.game.Vector2\022&\n\005click\030\003 \001(\0132\027.swa"
-    "rm.game.PlayerClick\"(\n\004Type\022\016\n\nPLAYER_PO"
-    "S\020\001\022\020\n\014PLAYER_CLICK\020\002\"\235\001\n\006Config\022\020\n\010map_"
-    "name\030\001 \001(\t\022\025\n\nnum_swarms\030\002 \001(\r:\0015\022\036\n\022mon"
-    "sters_per_swarm\030\003 \001(\r:\00210\022\026\n\013min_players"
-    "\030\004 \001(\r:\0012\022\026\n\013max_players\030\005 \001(\r:\0014\022\032\n\016ini"
-    "tial_health\030\006 \001(\r:\00210", 1781);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "game.proto", &protobuf_RegisterTypes);
-  Vector2::default_instance_ = new Vector2();
-  PlayerJoined::default_instance_ = new PlayerJoined();
-  PlayerLeft::default_instance_ = new PlayerLeft();
-  Monster::default_instance_ = new Monster();
-  SwarmState::default_instance_ = new SwarmState();
-  Player::default_instance_ = new Player();
-  PlayerClick::default_instance_ = new PlayerClick();
-  PlayerState::default_instance_ = new PlayerState();
-  GameStarted::default_instance_ = new GameStarted();
-  GameEnded::default_instance_ = new GameEnded();
-  PlayerDied::default_instance_ = new PlayerDied();
-  MonsterDied::default_instance_ = new MonsterDied();
-  ServerMessage::default_instance_ = new ServerMessage();
-  PlayerMessage::default_instance_ = new PlayerMessage();
-  Config::default_instance_ = new Config();
-  Vector2::default_instance_->InitAsDefaultInstance();
-  PlayerJoined::default_instance_->InitAsDefaultInstance();
-  PlayerLeft::default_instance_->InitAsDefaultInstance();
-  Monster::default_instance_->InitAsDefaultInstance();
-  SwarmState::default_instance_->InitAsDefaultInstance();
-  Player::default_instance_->InitAsDefaultInstance();
-  PlayerClick::default_instance_->InitAsDefaultInstance();
-  PlayerState::default_instance_->InitAsDefaultInstance();
-  GameStarted::default_instance_->InitAsDefaultInstance();
-  GameEnded::default_instance_->InitAsDefaultInstance();
-  PlayerDied::default_instance_->InitAsDefaultInstance();
-  MonsterDied::default_instance_->InitAsDefaultInstance();
-  ServerMessage::default_instance_->InitAsDefaultInstance();
-  PlayerMessage::default_instance_->InitAsDefaultInstance();
-  Config::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_game_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_game_2eproto {
-  StaticDescriptorInitializer_game_2eproto() {
-    protobuf_AddDesc_game_2eproto();
-  }
-} static_descriptor_initializer_game_2eproto_;
-
-// ===================================================================
-
-#ifndef _MSC_VER
-const int Vector2::kXFieldNumber;
-const int Vector2::kYFieldNumber;
-#endif  // !_MSC_VER
-
-Vector2::Vector2()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MonsterDiedDefaultTypeInternal _MonsterDied_default_instance_;
+PROTOBUF_CONSTEXPR Ping::Ping(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.client_time_)*/0
+  , /*decltype(_impl_.seq_)*/0u
+  , /*decltype(_impl_.rtt_ms_)*/0} {}
+struct PingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PingDefaultTypeInternal() {}
+  union {
+    Ping _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingDefaultTypeInternal _Ping_default_instance_;
+PROTOBUF_CONSTEXPR Pong::Pong(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.client_time_)*/0
+  , /*decltype(_impl_.server_receive_time_)*/0
+  , /*decltype(_impl_.server_send_time_)*/0
+  , /*decltype(_impl_.seq_)*/0u} {}
+struct PongDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PongDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PongDefaultTypeInternal() {}
+  union {
+    Pong _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PongDefaultTypeInternal _Pong_default_instance_;
+PROTOBUF_CONSTEXPR LockstepAttractor::LockstepAttractor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.radius_)*/0} {}
+struct LockstepAttractorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LockstepAttractorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LockstepAttractorDefaultTypeInternal() {}
+  union {
+    LockstepAttractor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LockstepAttractorDefaultTypeInternal _LockstepAttractor_default_instance_;
+PROTOBUF_CONSTEXPR LockstepFrame::LockstepFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.removed_id_)*/{}
+  , /*decltype(_impl_.attractor_)*/{}
+  , /*decltype(_impl_.hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.tick_)*/0u} {}
+struct LockstepFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LockstepFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LockstepFrameDefaultTypeInternal() {}
+  union {
+    LockstepFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LockstepFrameDefaultTypeInternal _LockstepFrame_default_instance_;
+PROTOBUF_CONSTEXPR LockstepFrames::LockstepFrames(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.frame_)*/{}
+  , /*decltype(_impl_.server_time_)*/0
+  , /*decltype(_impl_.tick_)*/0u} {}
+struct LockstepFramesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LockstepFramesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LockstepFramesDefaultTypeInternal() {}
+  union {
+    LockstepFrames _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LockstepFramesDefaultTypeInternal _LockstepFrames_default_instance_;
+PROTOBUF_CONSTEXPR ServerMessage::ServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.game_started_)*/nullptr
+  , /*decltype(_impl_.player_joined_)*/nullptr
+  , /*decltype(_impl_.player_left_)*/nullptr
+  , /*decltype(_impl_.swarm_state_)*/nullptr
+  , /*decltype(_impl_.player_state_)*/nullptr
+  , /*decltype(_impl_.player_died_)*/nullptr
+  , /*decltype(_impl_.game_ended_)*/nullptr
+  , /*decltype(_impl_.monster_died_)*/nullptr
+  , /*decltype(_impl_.pong_)*/nullptr
+  , /*decltype(_impl_.lockstep_frames_)*/nullptr
+  , /*decltype(_impl_.type_)*/0} {}
+struct ServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerMessageDefaultTypeInternal() {}
+  union {
+    ServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+PROTOBUF_CONSTEXPR PlayerMessage::PlayerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.input_)*/{}
+  , /*decltype(_impl_.click_)*/nullptr
+  , /*decltype(_impl_.hello_)*/nullptr
+  , /*decltype(_impl_.ping_)*/nullptr
+  , /*decltype(_impl_.type_)*/2} {}
+struct PlayerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerMessageDefaultTypeInternal() {}
+  union {
+    PlayerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerMessageDefaultTypeInternal _PlayerMessage_default_instance_;
+PROTOBUF_CONSTEXPR Config::Config(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.map_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shared_snapshot_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_history_kb_)*/0u
+  , /*decltype(_impl_.lockstep_)*/false
+  , /*decltype(_impl_.monster_compression_)*/0
+  , /*decltype(_impl_.aggregate_distance_)*/0
+  , /*decltype(_impl_.num_swarms_)*/5u
+  , /*decltype(_impl_.monsters_per_swarm_)*/10u
+  , /*decltype(_impl_.min_players_)*/2u
+  , /*decltype(_impl_.max_players_)*/4u
+  , /*decltype(_impl_.initial_health_)*/10u
+  , /*decltype(_impl_.snapshot_interval_ms_)*/100u
+  , /*decltype(_impl_.max_rewind_ms_)*/400u
+  , /*decltype(_impl_.dead_reckoning_tolerance_)*/1
+  , /*decltype(_impl_.monster_refresh_ms_)*/1000u
+  , /*decltype(_impl_.client_bytes_per_sec_)*/64000u
+  , /*decltype(_impl_.udp_enabled_)*/true
+  , /*decltype(_impl_.session_timeout_ms_)*/30000u
+  , /*decltype(_impl_.hello_timeout_ms_)*/5000u
+  , /*decltype(_impl_.initial_state_bytes_per_sec_)*/256000u
+  , /*decltype(_impl_.lockstep_hash_interval_ms_)*/1000u
+  , /*decltype(_impl_.aggregate_cell_size_)*/64} {}
+struct ConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigDefaultTypeInternal() {}
+  union {
+    Config _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigDefaultTypeInternal _Config_default_instance_;
+PROTOBUF_CONSTEXPR LinkConditions::LinkConditions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.delay_ms_)*/0u
+  , /*decltype(_impl_.jitter_ms_)*/0u
+  , /*decltype(_impl_.loss_)*/0
+  , /*decltype(_impl_.loss_burst_)*/0
+  , /*decltype(_impl_.reorder_)*/0
+  , /*decltype(_impl_.duplicate_)*/0
+  , /*decltype(_impl_.bytes_per_sec_)*/0u
+  , /*decltype(_impl_.queue_ms_)*/200u
+  , /*decltype(_impl_.jitter_distribution_)*/1
+  , /*decltype(_impl_.reorder_ms_)*/20u} {}
+struct LinkConditionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LinkConditionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LinkConditionsDefaultTypeInternal() {}
+  union {
+    LinkConditions _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LinkConditionsDefaultTypeInternal _LinkConditions_default_instance_;
+PROTOBUF_CONSTEXPR LinkScriptStep::LinkScriptStep(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.up_)*/nullptr
+  , /*decltype(_impl_.down_)*/nullptr
+  , /*decltype(_impl_.both_)*/nullptr
+  , /*decltype(_impl_.at_)*/0} {}
+struct LinkScriptStepDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LinkScriptStepDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LinkScriptStepDefaultTypeInternal() {}
+  union {
+    LinkScriptStep _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LinkScriptStepDefaultTypeInternal _LinkScriptStep_default_instance_;
+PROTOBUF_CONSTEXPR LinkScript::LinkScript(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.step_)*/{}
+  , /*decltype(_impl_.repeat_after_)*/0} {}
+struct LinkScriptDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LinkScriptDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LinkScriptDefaultTypeInternal() {}
+  union {
+    LinkScript _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LinkScriptDefaultTypeInternal _LinkScript_default_instance_;
+}  // namespace game
+}  // namespace swarm
+static ::_pb::Metadata file_level_metadata_game_2eproto[26];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_game_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_game_2eproto = nullptr;
+
+const uint32_t TableStruct_game_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Vector2, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Vector2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Vector2, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Vector2, _impl_.y_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerJoined, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerJoined, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerJoined, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerJoined, _impl_.id_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerLeft, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerLeft, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerLeft, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerLeft, _impl_.id_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_.acc_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_.vel_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_.pos_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Monster, _impl_.fixed_state_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _impl_.pos_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _impl_.vel_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _impl_.extent_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmAggregate, _impl_.count_),
+  2,
+  0,
+  1,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.monster_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.server_time_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.full_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.removed_id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.chunk_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.num_chunks_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.packed_monsters_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::SwarmState, _impl_.aggregate_),
+  ~0u,
+  2,
+  1,
+  3,
+  ~0u,
+  4,
+  5,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_.acc_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_.vel_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_.pos_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_.health_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Player, _impl_.last_input_seq_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerClick, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerClick, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerClick, _impl_.click_pos_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerClick, _impl_.click_size_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerClick, _impl_.render_tick_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerInput, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerInput, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerInput, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerInput, _impl_.acc_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerHello, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerHello, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerHello, _impl_.session_token_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerHello, _impl_.last_tick_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerHello, _impl_.spectator_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerState, _impl_.player_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerState, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerState, _impl_.server_time_),
+  ~0u,
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.health_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.map_name_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.player_state_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.swarm_state_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.snapshot_interval_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.udp_port_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.udp_token_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.session_token_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.resumed_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.initial_state_chunks_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameStarted, _impl_.lockstep_),
+  3,
+  4,
+  0,
+  1,
+  2,
+  5,
+  6,
+  8,
+  7,
+  10,
+  9,
+  11,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameEnded, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameEnded, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::GameEnded, _impl_.winner_id_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerDied, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerDied, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerDied, _impl_.player_id_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::MonsterDied, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::MonsterDied, _impl_.pos_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::MonsterDied, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Ping, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Ping, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Ping, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Ping, _impl_.client_time_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Ping, _impl_.rtt_ms_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Pong, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Pong, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Pong, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Pong, _impl_.client_time_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Pong, _impl_.server_receive_time_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Pong, _impl_.server_send_time_),
+  3,
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepAttractor, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepAttractor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepAttractor, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepAttractor, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepAttractor, _impl_.radius_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrame, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrame, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrame, _impl_.removed_id_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrame, _impl_.attractor_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrame, _impl_.hash_),
+  1,
+  ~0u,
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrames, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrames, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrames, _impl_.frame_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrames, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LockstepFrames, _impl_.server_time_),
+  ~0u,
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.game_started_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.player_joined_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.player_left_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.swarm_state_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.player_state_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.player_died_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.game_ended_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.monster_died_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.pong_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::ServerMessage, _impl_.lockstep_frames_),
+  10,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _impl_.click_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _impl_.input_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _impl_.hello_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::PlayerMessage, _impl_.ping_),
+  3,
+  0,
+  ~0u,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.map_name_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.num_swarms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.monsters_per_swarm_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.min_players_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.max_players_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.initial_health_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.snapshot_interval_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.max_rewind_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.max_history_kb_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.dead_reckoning_tolerance_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.monster_refresh_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.client_bytes_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.udp_enabled_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.session_timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.hello_timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.initial_state_bytes_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.shared_snapshot_name_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.lockstep_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.lockstep_hash_interval_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.monster_compression_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.aggregate_distance_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::Config, _impl_.aggregate_cell_size_),
+  0,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  2,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+  19,
+  1,
+  3,
+  20,
+  4,
+  5,
+  21,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.delay_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.jitter_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.jitter_distribution_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.loss_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.loss_burst_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.reorder_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.reorder_ms_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.duplicate_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.bytes_per_sec_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkConditions, _impl_.queue_ms_),
+  0,
+  1,
+  8,
+  2,
+  3,
+  4,
+  9,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScriptStep, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScriptStep, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScriptStep, _impl_.at_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScriptStep, _impl_.up_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScriptStep, _impl_.down_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScriptStep, _impl_.both_),
+  3,
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScript, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScript, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScript, _impl_.step_),
+  PROTOBUF_FIELD_OFFSET(::swarm::game::LinkScript, _impl_.repeat_after_),
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::swarm::game::Vector2)},
+  { 10, 18, -1, sizeof(::swarm::game::PlayerJoined)},
+  { 20, 28, -1, sizeof(::swarm::game::PlayerLeft)},
+  { 30, 42, -1, sizeof(::swarm::game::Monster)},
+  { 48, 59, -1, sizeof(::swarm::game::SwarmAggregate)},
+  { 64, 79, -1, sizeof(::swarm::game::SwarmState)},
+  { 88, 100, -1, sizeof(::swarm::game::Player)},
+  { 106, 115, -1, sizeof(::swarm::game::PlayerClick)},
+  { 118, 126, -1, sizeof(::swarm::game::PlayerInput)},
+  { 128, 137, -1, sizeof(::swarm::game::PlayerHello)},
+  { 140, 149, -1, sizeof(::swarm::game::PlayerState)},
+  { 152, 170, -1, sizeof(::swarm::game::GameStarted)},
+  { 182, 189, -1, sizeof(::swarm::game::GameEnded)},
+  { 190, 197, -1, sizeof(::swarm::game::PlayerDied)},
+  { 198, -1, -1, sizeof(::swarm::game::MonsterDied)},
+  { 206, 215, -1, sizeof(::swarm::game::Ping)},
+  { 218, 228, -1, sizeof(::swarm::game::Pong)},
+  { 232, 241, -1, sizeof(::swarm::game::LockstepAttractor)},
+  { 244, 254, -1, sizeof(::swarm::game::LockstepFrame)},
+  { 258, 267, -1, sizeof(::swarm::game::LockstepFrames)},
+  { 270, 287, -1, sizeof(::swarm::game::ServerMessage)},
+  { 298, 309, -1, sizeof(::swarm::game::PlayerMessage)},
+  { 314, 342, -1, sizeof(::swarm::game::Config)},
+  { 364, 380, -1, sizeof(::swarm::game::LinkConditions)},
+  { 390, 400, -1, sizeof(::swarm::game::LinkScriptStep)},
+  { 404, 412, -1, sizeof(::swarm::game::LinkScript)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::swarm::game::_Vector2_default_instance_._instance,
+  &::swarm::game::_PlayerJoined_default_instance_._instance,
+  &::swarm::game::_PlayerLeft_default_instance_._instance,
+  &::swarm::game::_Monster_default_instance_._instance,
+  &::swarm::game::_SwarmAggregate_default_instance_._instance,
+  &::swarm::game::_SwarmState_default_instance_._instance,
+  &::swarm::game::_Player_default_instance_._instance,
+  &::swarm::game::_PlayerClick_default_instance_._instance,
+  &::swarm::game::_PlayerInput_default_instance_._instance,
+  &::swarm::game::_PlayerHello_default_instance_._instance,
+  &::swarm::game::_PlayerState_default_instance_._instance,
+  &::swarm::game::_GameStarted_default_instance_._instance,
+  &::swarm::game::_GameEnded_default_instance_._instance,
+  &::swarm::game::_PlayerDied_default_instance_._instance,
+  &::swarm::game::_MonsterDied_default_instance_._instance,
+  &::swarm::game::_Ping_default_instance_._instance,
+  &::swarm::game::_Pong_default_instance_._instance,
+  &::swarm::game::_LockstepAttractor_default_instance_._instance,
+  &::swarm::game::_LockstepFrame_default_instance_._instance,
+  &::swarm::game::_LockstepFrames_default_instance_._instance,
+  &::swarm::game::_ServerMessage_default_instance_._instance,
+  &::swarm::game::_PlayerMessage_default_instance_._instance,
+  &::swarm::game::_Config_default_instance_._instance,
+  &::swarm::game::_LinkConditions_default_instance_._instance,
+  &::swarm::game::_LinkScriptStep_default_instance_._instance,
+  &::swarm::game::_LinkScript_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_game_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\ngame.proto\022\nswarm.game\"\037\n\007Vector2\022\t\n\001x"
+  "\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\"(\n\014PlayerJoined\022\014\n\004nam"
+  "e\030\001 \001(\t\022\n\n\002id\030\002 \001(\r\"&\n\nPlayerLeft\022\014\n\004nam"
+  "e\030\001 \001(\t\022\n\n\002id\030\002 \001(\r\"\242\001\n\007Monster\022 \n\003acc\030\001"
+  " \001(\0132\023.swarm.game.Vector2\022 \n\003vel\030\002 \001(\0132\023"
+  ".swarm.game.Vector2\022 \n\003pos\030\003 \001(\0132\023.swarm"
+  ".game.Vector2\022\014\n\004size\030\004 \001(\002\022\n\n\002id\030\005 \001(\r\022"
+  "\027\n\013fixed_state\030\006 \003(\021B\002\020\001\"\177\n\016SwarmAggrega"
+  "te\022\n\n\002id\030\001 \001(\r\022 \n\003pos\030\002 \001(\0132\023.swarm.game"
+  ".Vector2\022 \n\003vel\030\003 \001(\0132\023.swarm.game.Vecto"
+  "r2\022\016\n\006extent\030\004 \001(\002\022\r\n\005count\030\005 \001(\r\"\342\001\n\nSw"
+  "armState\022$\n\007monster\030\001 \003(\0132\023.swarm.game.M"
+  "onster\022\014\n\004tick\030\002 \001(\r\022\023\n\013server_time\030\003 \001("
+  "\001\022\014\n\004full\030\004 \001(\010\022\022\n\nremoved_id\030\005 \003(\r\022\r\n\005c"
+  "hunk\030\006 \001(\r\022\022\n\nnum_chunks\030\007 \001(\r\022\027\n\017packed"
+  "_monsters\030\010 \001(\014\022-\n\taggregate\030\t \003(\0132\032.swa"
+  "rm.game.SwarmAggregate\"\242\001\n\006Player\022\n\n\002id\030"
+  "\001 \001(\r\022 \n\003acc\030\002 \001(\0132\023.swarm.game.Vector2\022"
+  " \n\003vel\030\003 \001(\0132\023.swarm.game.Vector2\022 \n\003pos"
+  "\030\004 \001(\0132\023.swarm.game.Vector2\022\016\n\006health\030\005 "
+  "\001(\005\022\026\n\016last_input_seq\030\006 \001(\r\"^\n\013PlayerCli"
+  "ck\022&\n\tclick_pos\030\001 \001(\0132\023.swarm.game.Vecto"
+  "r2\022\022\n\nclick_size\030\002 \001(\002\022\023\n\013render_tick\030\003 "
+  "\001(\r\"<\n\013PlayerInput\022\013\n\003seq\030\001 \001(\r\022 \n\003acc\030\002"
+  " \001(\0132\023.swarm.game.Vector2\"J\n\013PlayerHello"
+  "\022\025\n\rsession_token\030\001 \001(\004\022\021\n\tlast_tick\030\002 \001"
+  "(\r\022\021\n\tspectator\030\003 \001(\010\"T\n\013PlayerState\022\"\n\006"
+  "player\030\001 \003(\0132\022.swarm.game.Player\022\014\n\004tick"
+  "\030\002 \001(\r\022\023\n\013server_time\030\003 \001(\001\"\271\002\n\013GameStar"
+  "ted\022\021\n\tplayer_id\030\001 \001(\r\022\016\n\006health\030\002 \001(\r\022\020"
+  "\n\010map_name\030\003 \001(\t\022-\n\014player_state\030\004 \001(\0132\027"
+  ".swarm.game.PlayerState\022+\n\013swarm_state\030\005"
+  " \001(\0132\026.swarm.game.SwarmState\022\034\n\024snapshot"
+  "_interval_ms\030\006 \001(\r\022\020\n\010udp_port\030\007 \001(\r\022\021\n\t"
+  "udp_token\030\010 \001(\r\022\025\n\rsession_token\030\t \001(\004\022\017"
+  "\n\007resumed\030\n \001(\010\022\034\n\024initial_state_chunks\030"
+  "\013 \001(\r\022\020\n\010lockstep\030\014 \001(\010\"\036\n\tGameEnded\022\021\n\t"
+  "winner_id\030\001 \001(\r\"\037\n\nPlayerDied\022\021\n\tplayer_"
+  "id\030\001 \001(\r\";\n\013MonsterDied\022 \n\003pos\030\001 \003(\0132\023.s"
+  "warm.game.Vector2\022\n\n\002id\030\002 \003(\r\"8\n\004Ping\022\013\n"
+  "\003seq\030\001 \001(\r\022\023\n\013client_time\030\002 \001(\001\022\016\n\006rtt_m"
+  "s\030\003 \001(\002\"_\n\004Pong\022\013\n\003seq\030\001 \001(\r\022\023\n\013client_t"
+  "ime\030\002 \001(\001\022\033\n\023server_receive_time\030\003 \001(\001\022\030"
+  "\n\020server_send_time\030\004 \001(\001\"9\n\021LockstepAttr"
+  "actor\022\t\n\001x\030\001 \001(\021\022\t\n\001y\030\002 \001(\021\022\016\n\006radius\030\003 "
+  "\001(\021\"q\n\rLockstepFrame\022\014\n\004tick\030\001 \001(\r\022\022\n\nre"
+  "moved_id\030\002 \003(\r\0220\n\tattractor\030\003 \003(\0132\035.swar"
+  "m.game.LockstepAttractor\022\014\n\004hash\030\004 \001(\004\"]"
+  "\n\016LockstepFrames\022(\n\005frame\030\001 \003(\0132\031.swarm."
+  "game.LockstepFrame\022\014\n\004tick\030\002 \001(\r\022\023\n\013serv"
+  "er_time\030\003 \001(\001\"\266\005\n\rServerMessage\022,\n\004type\030"
+  "\001 \002(\0162\036.swarm.game.ServerMessage.Type\022-\n"
+  "\014game_started\030\002 \001(\0132\027.swarm.game.GameSta"
+  "rted\022/\n\rplayer_joined\030\003 \001(\0132\030.swarm.game"
+  ".PlayerJoined\022+\n\013player_left\030\004 \001(\0132\026.swa"
+  "rm.game.PlayerLeft\022+\n\013swarm_state\030\005 \001(\0132"
+  "\026.swarm.game.SwarmState\022-\n\014player_state\030"
+  "\006 \001(\0132\027.swarm.game.PlayerState\022+\n\013player"
+  "_died\030\007 \001(\0132\026.swarm.game.PlayerDied\022)\n\ng"
+  "ame_ended\030\010 \001(\0132\025.swarm.game.GameEnded\022-"
+  "\n\014monster_died\030\t \001(\0132\027.swarm.game.Monste"
+  "rDied\022\036\n\004pong\030\n \001(\0132\020.swarm.game.Pong\0223\n"
+  "\017lockstep_frames\030\013 \001(\0132\032.swarm.game.Lock"
+  "stepFrames\"\261\001\n\004Type\022\020\n\014GAME_STARTED\020\000\022\021\n"
+  "\rPLAYER_JOINED\020\001\022\017\n\013PLAYER_LEFT\020\002\022\017\n\013SWA"
+  "RM_STATE\020\003\022\020\n\014PLAYER_STATE\020\004\022\017\n\013PLAYER_D"
+  "IED\020\005\022\016\n\nGAME_ENDED\020\006\022\020\n\014MONSTER_DIED\020\007\022"
+  "\010\n\004PONG\020\010\022\023\n\017LOCKSTEP_FRAMES\020\t\"\244\002\n\rPlaye"
+  "rMessage\022,\n\004type\030\001 \002(\0162\036.swarm.game.Play"
+  "erMessage.Type\022&\n\005click\030\003 \001(\0132\027.swarm.ga"
+  "me.PlayerClick\022&\n\005input\030\004 \003(\0132\027.swarm.ga"
+  "me.PlayerInput\022&\n\005hello\030\005 \001(\0132\027.swarm.ga"
+  "me.PlayerHello\022\036\n\004ping\030\006 \001(\0132\020.swarm.gam"
+  "e.Ping\"M\n\004Type\022\020\n\014PLAYER_CLICK\020\002\022\020\n\014PLAY"
+  "ER_INPUT\020\003\022\020\n\014PLAYER_HELLO\020\004\022\017\n\013PLAYER_P"
+  "ING\020\005\"\216\006\n\006Config\022\020\n\010map_name\030\001 \001(\t\022\025\n\nnu"
+  "m_swarms\030\002 \001(\r:\0015\022\036\n\022monsters_per_swarm\030"
+  "\003 \001(\r:\00210\022\026\n\013min_players\030\004 \001(\r:\0012\022\026\n\013max"
+  "_players\030\005 \001(\r:\0014\022\032\n\016initial_health\030\006 \001("
+  "\r:\00210\022!\n\024snapshot_interval_ms\030\007 \001(\r:\003100"
+  "\022\032\n\rmax_rewind_ms\030\010 \001(\r:\003400\022\026\n\016max_hist"
+  "ory_kb\030\t \001(\r\022#\n\030dead_reckoning_tolerance"
+  "\030\n \001(\002:\0011\022 \n\022monster_refresh_ms\030\013 \001(\r:\0041"
+  "000\022#\n\024client_bytes_per_sec\030\014 \001(\r:\00564000"
+  "\022\031\n\013udp_enabled\030\r \001(\010:\004true\022!\n\022session_t"
+  "imeout_ms\030\016 \001(\r:\00530000\022\036\n\020hello_timeout_"
+  "ms\030\017 \001(\r:\0045000\022+\n\033initial_state_bytes_pe"
+  "r_sec\030\020 \001(\r:\006256000\022\034\n\024shared_snapshot_n"
+  "ame\030\021 \001(\t\022\020\n\010lockstep\030\022 \001(\010\022\'\n\031lockstep_"
+  "hash_interval_ms\030\023 \001(\r:\0041000\022B\n\023monster_"
+  "compression\030\024 \001(\0162%.swarm.game.Config.Mo"
+  "nsterCompression\022\032\n\022aggregate_distance\030\025"
+  " \001(\002\022\037\n\023aggregate_cell_size\030\026 \001(\002:\00264\"G\n"
+  "\022MonsterCompression\022\020\n\014UNCOMPRESSED\020\000\022\014\n"
+  "\010ID_ORDER\020\001\022\021\n\rSPATIAL_ORDER\020\002\"\304\002\n\016LinkC"
+  "onditions\022\020\n\010delay_ms\030\001 \001(\r\022\021\n\tjitter_ms"
+  "\030\002 \001(\r\022L\n\023jitter_distribution\030\003 \001(\0162\'.sw"
+  "arm.game.LinkConditions.Distribution:\006NO"
+  "RMAL\022\014\n\004loss\030\004 \001(\002\022\022\n\nloss_burst\030\005 \001(\002\022\017"
+  "\n\007reorder\030\006 \001(\002\022\026\n\nreorder_ms\030\007 \001(\r:\00220\022"
+  "\021\n\tduplicate\030\010 \001(\002\022\025\n\rbytes_per_sec\030\t \001("
+  "\r\022\025\n\010queue_ms\030\n \001(\r:\003200\"3\n\014Distribution"
+  "\022\013\n\007UNIFORM\020\000\022\n\n\006NORMAL\020\001\022\n\n\006PARETO\020\002\"\230\001"
+  "\n\016LinkScriptStep\022\n\n\002at\030\001 \001(\002\022&\n\002up\030\002 \001(\013"
+  "2\032.swarm.game.LinkConditions\022(\n\004down\030\003 \001"
+  "(\0132\032.swarm.game.LinkConditions\022(\n\004both\030\004"
+  " \001(\0132\032.swarm.game.LinkConditions\"L\n\nLink"
+  "Script\022(\n\004step\030\001 \003(\0132\032.swarm.game.LinkSc"
+  "riptStep\022\024\n\014repeat_after\030\002 \001(\002"
+  ;
+static ::_pbi::once_flag descriptor_table_game_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_game_2eproto = {
+    false, false, 4350, descriptor_table_protodef_game_2eproto,
+    "game.proto",
+    &descriptor_table_game_2eproto_once, nullptr, 0, 26,
+    schemas, file_default_instances, TableStruct_game_2eproto::offsets,
+    file_level_metadata_game_2eproto, file_level_enum_descriptors_game_2eproto,
+    file_level_service_descriptors_game_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_game_2eproto_getter() {
+  return &descriptor_table_game_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_game_2eproto(&descriptor_table_game_2eproto);
+namespace swarm {
+namespace game {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ServerMessage_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_game_2eproto);
+  return file_level_enum_descriptors_game_2eproto[0];
 }
-
-void Vector2::InitAsDefaultInstance() {
+bool ServerMessage_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Vector2::Vector2(const Vector2& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ServerMessage_Type ServerMessage::GAME_STARTED;
+constexpr ServerMessage_Type ServerMessage::PLAYER_JOINED;
+constexpr ServerMessage_Type ServerMessage::PLAYER_LEFT;
+constexpr ServerMessage_Type ServerMessage::SWARM_STATE;
+constexpr ServerMessage_Type ServerMessage::PLAYER_STATE;
+constexpr ServerMessage_Type ServerMessage::PLAYER_DIED;
+constexpr ServerMessage_Type ServerMessage::GAME_ENDED;
+constexpr ServerMessage_Type ServerMessage::MONSTER_DIED;
+constexpr ServerMessage_Type ServerMessage::PONG;
+constexpr ServerMessage_Type ServerMessage::LOCKSTEP_FRAMES;
+constexpr ServerMessage_Type ServerMessage::Type_MIN;
+constexpr ServerMessage_Type ServerMessage::Type_MAX;
+constexpr int ServerMessage::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PlayerMessage_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_game_2eproto);
+  return file_level_enum_descriptors_game_2eproto[1];
 }
-
-void Vector2::SharedCtor() {
-  _cached_size_ = 0;
-  x_ = 0;
-  y_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool PlayerMessage_Type_IsValid(int value) {
+  switch (value) {
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Vector2::~Vector2() {
-  SharedDtor();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr PlayerMessage_Type PlayerMessage::PLAYER_CLICK;
+constexpr PlayerMessage_Type PlayerMessage::PLAYER_INPUT;
+constexpr PlayerMessage_Type PlayerMessage::PLAYER_HELLO;
+constexpr PlayerMessage_Type PlayerMessage::PLAYER_PING;
+constexpr PlayerMessage_Type PlayerMessage::Type_MIN;
+constexpr PlayerMessage_Type PlayerMessage::Type_MAX;
+constexpr int PlayerMessage::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Config_MonsterCompression_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_game_2eproto);
+  return file_level_enum_descriptors_game_2eproto[2];
 }
-
-void Vector2::SharedDtor() {
-  if (this != default_instance_) {
+bool Config_MonsterCompression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
   }
 }
 
-void Vector2::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Config_MonsterCompression Config::UNCOMPRESSED;
+constexpr Config_MonsterCompression Config::ID_ORDER;
+constexpr Config_MonsterCompression Config::SPATIAL_ORDER;
+constexpr Config_MonsterCompression Config::MonsterCompression_MIN;
+constexpr Config_MonsterCompression Config::MonsterCompression_MAX;
+constexpr int Config::MonsterCompression_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LinkConditions_Distribution_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_game_2eproto);
+  return file_level_enum_descriptors_game_2eproto[3];
 }
-const ::google::protobuf::Descriptor* Vector2::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Vector2_descriptor_;
-}
-
-const Vector2& Vector2::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
+bool LinkConditions_Distribution_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Vector2* Vector2::default_instance_ = NULL;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr LinkConditions_Distribution LinkConditions::UNIFORM;
+constexpr LinkConditions_Distribution LinkConditions::NORMAL;
+constexpr LinkConditions_Distribution LinkConditions::PARETO;
+constexpr LinkConditions_Distribution LinkConditions::Distribution_MIN;
+constexpr LinkConditions_Distribution LinkConditions::Distribution_MAX;
+constexpr int LinkConditions::Distribution_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-Vector2* Vector2::New() const {
-  return new Vector2;
-}
+// ===================================================================
 
-void Vector2::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    x_ = 0;
-    y_ = 0;
+class Vector2::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Vector2>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Vector2::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional float x = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &x_)));
-          set_has_x();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_y;
-        break;
-      }
-
-      // optional float y = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &y_)));
-          set_has_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  return true;
-#undef DO_
+};
+
+Vector2::Vector2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.Vector2)
+}
+Vector2::Vector2(const Vector2& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vector2* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.Vector2)
+}
+
+inline void Vector2::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+  };
 }
 
-void Vector2::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional float x = 1;
-  if (has_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->x(), output);
+Vector2::~Vector2() {
+  // @@protoc_insertion_point(destructor:swarm.game.Vector2)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // optional float y = 2;
-  if (has_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->y(), output);
-  }
+inline void Vector2::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+void Vector2::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-::google::protobuf::uint8* Vector2::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+void Vector2::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.Vector2)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.y_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Vector2::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Vector2::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.Vector2)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional float x = 1;
-  if (has_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->x(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
   // optional float y = 2;
-  if (has_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->y(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.Vector2)
   return target;
 }
 
-int Vector2::ByteSize() const {
-  int total_size = 0;
+size_t Vector2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.Vector2)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional float x = 1;
-    if (has_x()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 + 4;
     }
 
     // optional float y = 2;
-    if (has_y()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 + 4;
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Vector2::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Vector2* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Vector2*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vector2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vector2::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vector2::GetClassData() const { return &_class_data_; }
+
 
-void Vector2::MergeFrom(const Vector2& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_x()) {
-      set_x(from.x());
+void Vector2::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vector2*>(&to_msg);
+  auto& from = static_cast<const Vector2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.Vector2)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
     }
-    if (from.has_y()) {
-      set_y(from.y());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Vector2::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Vector2::CopyFrom(const Vector2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.Vector2)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Vector2::IsInitialized() const {
-
   return true;
 }
 
-void Vector2::Swap(Vector2* other) {
-  if (other != this) {
-    std::swap(x_, other->x_);
-    std::swap(y_, other->y_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Vector2::InternalSwap(Vector2* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Vector2, _impl_.y_)
+      + sizeof(Vector2::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(Vector2, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata Vector2::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Vector2_descriptor_;
-  metadata.reflection = Vector2_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Vector2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int PlayerJoined::kNameFieldNumber;
-const int PlayerJoined::kIdFieldNumber;
-#endif  // !_MSC_VER
-
-PlayerJoined::PlayerJoined()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class PlayerJoined::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerJoined>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void PlayerJoined::InitAsDefaultInstance() {
+PlayerJoined::PlayerJoined(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerJoined)
 }
-
 PlayerJoined::PlayerJoined(const PlayerJoined& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void PlayerJoined::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  id_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerJoined* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerJoined)
+}
+
+inline void PlayerJoined::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){0u}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PlayerJoined::~PlayerJoined() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerJoined)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerJoined::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void PlayerJoined::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void PlayerJoined::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PlayerJoined::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerJoined_descriptor_;
-}
-
-const PlayerJoined& PlayerJoined::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-PlayerJoined* PlayerJoined::default_instance_ = NULL;
-
-PlayerJoined* PlayerJoined::New() const {
-  return new PlayerJoined;
+  _impl_._cached_size_.Set(size);
 }
 
 void PlayerJoined::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    id_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool PlayerJoined::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerJoined)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerJoined::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_id;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "swarm.game.PlayerJoined.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 id = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void PlayerJoined::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
-
-  // optional uint32 id = 2;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->id(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* PlayerJoined::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerJoined::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerJoined)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "swarm.game.PlayerJoined.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // optional uint32 id = 2;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->id(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerJoined)
   return target;
 }
 
-int PlayerJoined::ByteSize() const {
-  int total_size = 0;
+size_t PlayerJoined::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerJoined)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional string name = 1;
-    if (has_name()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
     }
 
     // optional uint32 id = 2;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->id());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerJoined::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PlayerJoined* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PlayerJoined*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerJoined::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerJoined::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerJoined::GetClassData() const { return &_class_data_; }
+
 
-void PlayerJoined::MergeFrom(const PlayerJoined& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+void PlayerJoined::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerJoined*>(&to_msg);
+  auto& from = static_cast<const PlayerJoined&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerJoined)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_id()) {
-      set_id(from.id());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void PlayerJoined::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerJoined::CopyFrom(const PlayerJoined& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerJoined)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool PlayerJoined::IsInitialized() const {
-
   return true;
 }
 
-void PlayerJoined::Swap(PlayerJoined* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(id_, other->id_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void PlayerJoined::InternalSwap(PlayerJoined* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.id_, other->_impl_.id_);
 }
 
-::google::protobuf::Metadata PlayerJoined::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PlayerJoined_descriptor_;
-  metadata.reflection = PlayerJoined_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerJoined::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int PlayerLeft::kNameFieldNumber;
-const int PlayerLeft::kIdFieldNumber;
-#endif  // !_MSC_VER
-
-PlayerLeft::PlayerLeft()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class PlayerLeft::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerLeft>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void PlayerLeft::InitAsDefaultInstance() {
+PlayerLeft::PlayerLeft(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerLeft)
 }
-
 PlayerLeft::PlayerLeft(const PlayerLeft& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void PlayerLeft::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  id_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerLeft* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerLeft)
+}
+
+inline void PlayerLeft::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){0u}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PlayerLeft::~PlayerLeft() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerLeft)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerLeft::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void PlayerLeft::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void PlayerLeft::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PlayerLeft::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerLeft_descriptor_;
-}
-
-const PlayerLeft& PlayerLeft::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-PlayerLeft* PlayerLeft::default_instance_ = NULL;
-
-PlayerLeft* PlayerLeft::New() const {
-  return new PlayerLeft;
+  _impl_._cached_size_.Set(size);
 }
 
 void PlayerLeft::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
-    }
-    id_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool PlayerLeft::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerLeft)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerLeft::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_id;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "swarm.game.PlayerLeft.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 id = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void PlayerLeft::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
-
-  // optional uint32 id = 2;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->id(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* PlayerLeft::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerLeft::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerLeft)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "swarm.game.PlayerLeft.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // optional uint32 id = 2;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->id(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerLeft)
   return target;
 }
 
-int PlayerLeft::ByteSize() const {
-  int total_size = 0;
+size_t PlayerLeft::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerLeft)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional string name = 1;
-    if (has_name()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
     }
 
     // optional uint32 id = 2;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->id());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerLeft::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PlayerLeft* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PlayerLeft*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerLeft::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerLeft::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerLeft::GetClassData() const { return &_class_data_; }
+
 
-void PlayerLeft::MergeFrom(const PlayerLeft& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+void PlayerLeft::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerLeft*>(&to_msg);
+  auto& from = static_cast<const PlayerLeft&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerLeft)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_id()) {
-      set_id(from.id());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void PlayerLeft::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerLeft::CopyFrom(const PlayerLeft& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerLeft)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool PlayerLeft::IsInitialized() const {
-
   return true;
 }
 
-void PlayerLeft::Swap(PlayerLeft* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(id_, other->id_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void PlayerLeft::InternalSwap(PlayerLeft* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.id_, other->_impl_.id_);
 }
 
-::google::protobuf::Metadata PlayerLeft::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PlayerLeft_descriptor_;
-  metadata.reflection = PlayerLeft_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerLeft::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[2]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Monster::kAccFieldNumber;
-const int Monster::kVelFieldNumber;
-const int Monster::kPosFieldNumber;
-const int Monster::kSizeFieldNumber;
-#endif  // !_MSC_VER
+class Monster::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Monster>()._impl_._has_bits_);
+  static const ::swarm::game::Vector2& acc(const Monster* msg);
+  static void set_has_acc(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::Vector2& vel(const Monster* msg);
+  static void set_has_vel(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::Vector2& pos(const Monster* msg);
+  static void set_has_pos(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
 
-Monster::Monster()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::swarm::game::Vector2&
+Monster::_Internal::acc(const Monster* msg) {
+  return *msg->_impl_.acc_;
 }
-
-void Monster::InitAsDefaultInstance() {
-  acc_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
-  vel_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
-  pos_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
+const ::swarm::game::Vector2&
+Monster::_Internal::vel(const Monster* msg) {
+  return *msg->_impl_.vel_;
 }
-
-Monster::Monster(const Monster& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::swarm::game::Vector2&
+Monster::_Internal::pos(const Monster* msg) {
+  return *msg->_impl_.pos_;
 }
-
-void Monster::SharedCtor() {
-  _cached_size_ = 0;
-  acc_ = NULL;
-  vel_ = NULL;
-  pos_ = NULL;
-  size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+Monster::Monster(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.Monster)
+}
+Monster::Monster(const Monster& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Monster* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.fixed_state_){from._impl_.fixed_state_}
+    , /*decltype(_impl_._fixed_state_cached_byte_size_)*/{0}
+    , decltype(_impl_.acc_){nullptr}
+    , decltype(_impl_.vel_){nullptr}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_acc()) {
+    _this->_impl_.acc_ = new ::swarm::game::Vector2(*from._impl_.acc_);
+  }
+  if (from._internal_has_vel()) {
+    _this->_impl_.vel_ = new ::swarm::game::Vector2(*from._impl_.vel_);
+  }
+  if (from._internal_has_pos()) {
+    _this->_impl_.pos_ = new ::swarm::game::Vector2(*from._impl_.pos_);
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.id_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.Monster)
+}
+
+inline void Monster::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.fixed_state_){arena}
+    , /*decltype(_impl_._fixed_state_cached_byte_size_)*/{0}
+    , decltype(_impl_.acc_){nullptr}
+    , decltype(_impl_.vel_){nullptr}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.size_){0}
+    , decltype(_impl_.id_){0u}
+  };
 }
 
 Monster::~Monster() {
+  // @@protoc_insertion_point(destructor:swarm.game.Monster)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Monster::SharedDtor() {
-  if (this != default_instance_) {
-    delete acc_;
-    delete vel_;
-    delete pos_;
-  }
+inline void Monster::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.fixed_state_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.acc_;
+  if (this != internal_default_instance()) delete _impl_.vel_;
+  if (this != internal_default_instance()) delete _impl_.pos_;
 }
 
 void Monster::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Monster::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Monster_descriptor_;
-}
-
-const Monster& Monster::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-Monster* Monster::default_instance_ = NULL;
-
-Monster* Monster::New() const {
-  return new Monster;
+  _impl_._cached_size_.Set(size);
 }
 
 void Monster::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_acc()) {
-      if (acc_ != NULL) acc_->::swarm::game::Vector2::Clear();
+// @@protoc_insertion_point(message_clear_start:swarm.game.Monster)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.fixed_state_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.acc_ != nullptr);
+      _impl_.acc_->Clear();
     }
-    if (has_vel()) {
-      if (vel_ != NULL) vel_->::swarm::game::Vector2::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.vel_ != nullptr);
+      _impl_.vel_->Clear();
     }
-    if (has_pos()) {
-      if (pos_ != NULL) pos_->::swarm::game::Vector2::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.pos_ != nullptr);
+      _impl_.pos_->Clear();
     }
-    size_ = 0;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x00000018u) {
+    ::memset(&_impl_.size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.id_) -
+        reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Monster::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Monster::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .swarm.game.Vector2 acc = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_acc()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_vel;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.Vector2 vel = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_vel:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_vel()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_pos;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.Vector2 pos = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pos:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_pos()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(37)) goto parse_size;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pos(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float size = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &size_)));
-          set_has_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 fixed_state = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_fixed_state(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_fixed_state(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Monster::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Monster::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.Monster)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .swarm.game.Vector2 acc = 1;
-  if (has_acc()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->acc(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::acc(this),
+        _Internal::acc(this).GetCachedSize(), target, stream);
   }
 
   // optional .swarm.game.Vector2 vel = 2;
-  if (has_vel()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->vel(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::vel(this),
+        _Internal::vel(this).GetCachedSize(), target, stream);
   }
 
   // optional .swarm.game.Vector2 pos = 3;
-  if (has_pos()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->pos(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::pos(this),
+        _Internal::pos(this).GetCachedSize(), target, stream);
   }
 
   // optional float size = 4;
-  if (has_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->size(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Monster::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional .swarm.game.Vector2 acc = 1;
-  if (has_acc()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->acc(), target);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_size(), target);
   }
 
-  // optional .swarm.game.Vector2 vel = 2;
-  if (has_vel()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->vel(), target);
-  }
-
-  // optional .swarm.game.Vector2 pos = 3;
-  if (has_pos()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->pos(), target);
+  // optional uint32 id = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_id(), target);
   }
 
-  // optional float size = 4;
-  if (has_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->size(), target);
+  // repeated sint32 fixed_state = 6 [packed = true];
+  {
+    int byte_size = _impl_._fixed_state_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          6, _internal_fixed_state(), byte_size, target);
+    }
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.Monster)
   return target;
 }
 
-int Monster::ByteSize() const {
-  int total_size = 0;
+size_t Monster::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.Monster)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .swarm.game.Vector2 acc = 1;
-    if (has_acc()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated sint32 fixed_state = 6 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.fixed_state_);
+    if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->acc());
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._fixed_state_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .swarm.game.Vector2 acc = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.acc_);
     }
 
     // optional .swarm.game.Vector2 vel = 2;
-    if (has_vel()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->vel());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.vel_);
     }
 
     // optional .swarm.game.Vector2 pos = 3;
-    if (has_pos()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->pos());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pos_);
     }
 
     // optional float size = 4;
-    if (has_size()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 + 4;
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint32 id = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+    }
 
-void Monster::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Monster* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Monster*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Monster::MergeFrom(const Monster& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_acc()) {
-      mutable_acc()->::swarm::game::Vector2::MergeFrom(from.acc());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Monster::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Monster::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Monster::GetClassData() const { return &_class_data_; }
+
+
+void Monster::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Monster*>(&to_msg);
+  auto& from = static_cast<const Monster&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.Monster)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.fixed_state_.MergeFrom(from._impl_.fixed_state_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_acc()->::swarm::game::Vector2::MergeFrom(
+          from._internal_acc());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_vel()->::swarm::game::Vector2::MergeFrom(
+          from._internal_vel());
     }
-    if (from.has_vel()) {
-      mutable_vel()->::swarm::game::Vector2::MergeFrom(from.vel());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_pos()->::swarm::game::Vector2::MergeFrom(
+          from._internal_pos());
     }
-    if (from.has_pos()) {
-      mutable_pos()->::swarm::game::Vector2::MergeFrom(from.pos());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.size_ = from._impl_.size_;
     }
-    if (from.has_size()) {
-      set_size(from.size());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Monster::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Monster::CopyFrom(const Monster& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.Monster)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Monster::IsInitialized() const {
-
   return true;
 }
 
-void Monster::Swap(Monster* other) {
-  if (other != this) {
-    std::swap(acc_, other->acc_);
-    std::swap(vel_, other->vel_);
-    std::swap(pos_, other->pos_);
-    std::swap(size_, other->size_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Monster::InternalSwap(Monster* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.fixed_state_.InternalSwap(&other->_impl_.fixed_state_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Monster, _impl_.id_)
+      + sizeof(Monster::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(Monster, _impl_.acc_)>(
+          reinterpret_cast<char*>(&_impl_.acc_),
+          reinterpret_cast<char*>(&other->_impl_.acc_));
 }
 
-::google::protobuf::Metadata Monster::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Monster_descriptor_;
-  metadata.reflection = Monster_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Monster::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[3]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SwarmState::kMonsterFieldNumber;
-#endif  // !_MSC_VER
+class SwarmAggregate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SwarmAggregate>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::swarm::game::Vector2& pos(const SwarmAggregate* msg);
+  static void set_has_pos(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::Vector2& vel(const SwarmAggregate* msg);
+  static void set_has_vel(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_extent(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::swarm::game::Vector2&
+SwarmAggregate::_Internal::pos(const SwarmAggregate* msg) {
+  return *msg->_impl_.pos_;
+}
+const ::swarm::game::Vector2&
+SwarmAggregate::_Internal::vel(const SwarmAggregate* msg) {
+  return *msg->_impl_.vel_;
+}
+SwarmAggregate::SwarmAggregate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.SwarmAggregate)
+}
+SwarmAggregate::SwarmAggregate(const SwarmAggregate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SwarmAggregate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.vel_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.extent_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_pos()) {
+    _this->_impl_.pos_ = new ::swarm::game::Vector2(*from._impl_.pos_);
+  }
+  if (from._internal_has_vel()) {
+    _this->_impl_.vel_ = new ::swarm::game::Vector2(*from._impl_.vel_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.SwarmAggregate)
+}
+
+inline void SwarmAggregate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.vel_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.extent_){0}
+    , decltype(_impl_.count_){0u}
+  };
+}
+
+SwarmAggregate::~SwarmAggregate() {
+  // @@protoc_insertion_point(destructor:swarm.game.SwarmAggregate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-SwarmState::SwarmState()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+inline void SwarmAggregate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.pos_;
+  if (this != internal_default_instance()) delete _impl_.vel_;
 }
 
-void SwarmState::InitAsDefaultInstance() {
+void SwarmAggregate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-SwarmState::SwarmState(const SwarmState& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+void SwarmAggregate::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.SwarmAggregate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.pos_ != nullptr);
+      _impl_.pos_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.vel_ != nullptr);
+      _impl_.vel_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SwarmState::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const char* SwarmAggregate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.Vector2 pos = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pos(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.Vector2 vel = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float extent = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_extent(&has_bits);
+          _impl_.extent_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SwarmAggregate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.SwarmAggregate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 id = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // optional .swarm.game.Vector2 pos = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pos(this),
+        _Internal::pos(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .swarm.game.Vector2 vel = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::vel(this),
+        _Internal::vel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional float extent = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_extent(), target);
+  }
+
+  // optional uint32 count = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.SwarmAggregate)
+  return target;
 }
 
-SwarmState::~SwarmState() {
-  SharedDtor();
+size_t SwarmAggregate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.SwarmAggregate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .swarm.game.Vector2 pos = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pos_);
+    }
+
+    // optional .swarm.game.Vector2 vel = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.vel_);
+    }
+
+    // optional uint32 id = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+    }
+
+    // optional float extent = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 count = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SwarmState::SharedDtor() {
-  if (this != default_instance_) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SwarmAggregate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SwarmAggregate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SwarmAggregate::GetClassData() const { return &_class_data_; }
+
+
+void SwarmAggregate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SwarmAggregate*>(&to_msg);
+  auto& from = static_cast<const SwarmAggregate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.SwarmAggregate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_pos()->::swarm::game::Vector2::MergeFrom(
+          from._internal_pos());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_vel()->::swarm::game::Vector2::MergeFrom(
+          from._internal_vel());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.extent_ = from._impl_.extent_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SwarmState::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+void SwarmAggregate::CopyFrom(const SwarmAggregate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.SwarmAggregate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SwarmAggregate::IsInitialized() const {
+  return true;
+}
+
+void SwarmAggregate::InternalSwap(SwarmAggregate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SwarmAggregate, _impl_.count_)
+      + sizeof(SwarmAggregate::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(SwarmAggregate, _impl_.pos_)>(
+          reinterpret_cast<char*>(&_impl_.pos_),
+          reinterpret_cast<char*>(&other->_impl_.pos_));
 }
-const ::google::protobuf::Descriptor* SwarmState::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SwarmState_descriptor_;
+
+::PROTOBUF_NAMESPACE_ID::Metadata SwarmAggregate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[4]);
 }
 
-const SwarmState& SwarmState::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
+// ===================================================================
+
+class SwarmState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SwarmState>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_server_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_full(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_chunk(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_num_chunks(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_packed_monsters(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SwarmState::SwarmState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.SwarmState)
+}
+SwarmState::SwarmState(const SwarmState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SwarmState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.monster_){from._impl_.monster_}
+    , decltype(_impl_.removed_id_){from._impl_.removed_id_}
+    , decltype(_impl_.aggregate_){from._impl_.aggregate_}
+    , decltype(_impl_.packed_monsters_){}
+    , decltype(_impl_.server_time_){}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.full_){}
+    , decltype(_impl_.chunk_){}
+    , decltype(_impl_.num_chunks_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.packed_monsters_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_monsters_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_packed_monsters()) {
+    _this->_impl_.packed_monsters_.Set(from._internal_packed_monsters(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.server_time_, &from._impl_.server_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_chunks_) -
+    reinterpret_cast<char*>(&_impl_.server_time_)) + sizeof(_impl_.num_chunks_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.SwarmState)
+}
+
+inline void SwarmState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.monster_){arena}
+    , decltype(_impl_.removed_id_){arena}
+    , decltype(_impl_.aggregate_){arena}
+    , decltype(_impl_.packed_monsters_){}
+    , decltype(_impl_.server_time_){0}
+    , decltype(_impl_.tick_){0u}
+    , decltype(_impl_.full_){false}
+    , decltype(_impl_.chunk_){0u}
+    , decltype(_impl_.num_chunks_){0u}
+  };
+  _impl_.packed_monsters_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_monsters_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SwarmState* SwarmState::default_instance_ = NULL;
+SwarmState::~SwarmState() {
+  // @@protoc_insertion_point(destructor:swarm.game.SwarmState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-SwarmState* SwarmState::New() const {
-  return new SwarmState;
+inline void SwarmState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.monster_.~RepeatedPtrField();
+  _impl_.removed_id_.~RepeatedField();
+  _impl_.aggregate_.~RepeatedPtrField();
+  _impl_.packed_monsters_.Destroy();
 }
 
-void SwarmState::Clear() {
-  monster_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void SwarmState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool SwarmState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void SwarmState::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.SwarmState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.monster_.Clear();
+  _impl_.removed_id_.Clear();
+  _impl_.aggregate_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.packed_monsters_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.server_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_chunks_) -
+        reinterpret_cast<char*>(&_impl_.server_time_)) + sizeof(_impl_.num_chunks_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SwarmState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .swarm.game.Monster monster = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_monster:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_monster()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_monster;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_monster(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 tick = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double server_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_server_time(&has_bits);
+          _impl_.server_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool full = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_full(&has_bits);
+          _impl_.full_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 removed_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_removed_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<40>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_removed_id(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 chunk = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_chunk(&has_bits);
+          _impl_.chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 num_chunks = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_num_chunks(&has_bits);
+          _impl_.num_chunks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes packed_monsters = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_packed_monsters();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .swarm.game.SwarmAggregate aggregate = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_aggregate(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SwarmState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.SwarmState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SwarmState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .swarm.game.Monster monster = 1;
-  for (int i = 0; i < this->monster_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->monster(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_monster_size()); i < n; i++) {
+    const auto& repfield = this->_internal_monster(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 tick = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tick(), target);
   }
-}
 
-::google::protobuf::uint8* SwarmState::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .swarm.game.Monster monster = 1;
-  for (int i = 0; i < this->monster_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->monster(i), target);
+  // optional double server_time = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_server_time(), target);
+  }
+
+  // optional bool full = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_full(), target);
+  }
+
+  // repeated uint32 removed_id = 5;
+  for (int i = 0, n = this->_internal_removed_id_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_removed_id(i), target);
+  }
+
+  // optional uint32 chunk = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_chunk(), target);
+  }
+
+  // optional uint32 num_chunks = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_num_chunks(), target);
+  }
+
+  // optional bytes packed_monsters = 8;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_packed_monsters(), target);
+  }
+
+  // repeated .swarm.game.SwarmAggregate aggregate = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_aggregate_size()); i < n; i++) {
+    const auto& repfield = this->_internal_aggregate(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.SwarmState)
   return target;
 }
 
-int SwarmState::ByteSize() const {
-  int total_size = 0;
+size_t SwarmState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.SwarmState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .swarm.game.Monster monster = 1;
-  total_size += 1 * this->monster_size();
-  for (int i = 0; i < this->monster_size(); i++) {
+  total_size += 1UL * this->_internal_monster_size();
+  for (const auto& msg : this->_impl_.monster_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->monster(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 removed_id = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.removed_id_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_removed_id_size());
+    total_size += data_size;
   }
 
-  if (!unknown_fields().empty()) {
+  // repeated .swarm.game.SwarmAggregate aggregate = 9;
+  total_size += 1UL * this->_internal_aggregate_size();
+  for (const auto& msg : this->_impl_.aggregate_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void SwarmState::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SwarmState* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SwarmState*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional bytes packed_monsters = 8;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_packed_monsters());
+    }
+
+    // optional double server_time = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 tick = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+    }
+
+    // optional bool full = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 chunk = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk());
+    }
+
+    // optional uint32 num_chunks = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_chunks());
+    }
+
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SwarmState::MergeFrom(const SwarmState& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  monster_.MergeFrom(from.monster_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SwarmState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SwarmState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SwarmState::GetClassData() const { return &_class_data_; }
 
-void SwarmState::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void SwarmState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SwarmState*>(&to_msg);
+  auto& from = static_cast<const SwarmState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.SwarmState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.monster_.MergeFrom(from._impl_.monster_);
+  _this->_impl_.removed_id_.MergeFrom(from._impl_.removed_id_);
+  _this->_impl_.aggregate_.MergeFrom(from._impl_.aggregate_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_packed_monsters(from._internal_packed_monsters());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.server_time_ = from._impl_.server_time_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.full_ = from._impl_.full_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.chunk_ = from._impl_.chunk_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.num_chunks_ = from._impl_.num_chunks_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SwarmState::CopyFrom(const SwarmState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.SwarmState)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SwarmState::IsInitialized() const {
-
   return true;
 }
 
-void SwarmState::Swap(SwarmState* other) {
-  if (other != this) {
-    monster_.Swap(&other->monster_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata SwarmState::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SwarmState_descriptor_;
-  metadata.reflection = SwarmState_reflection_;
-  return metadata;
+void SwarmState::InternalSwap(SwarmState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.monster_.InternalSwap(&other->_impl_.monster_);
+  _impl_.removed_id_.InternalSwap(&other->_impl_.removed_id_);
+  _impl_.aggregate_.InternalSwap(&other->_impl_.aggregate_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.packed_monsters_, lhs_arena,
+      &other->_impl_.packed_monsters_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SwarmState, _impl_.num_chunks_)
+      + sizeof(SwarmState::_impl_.num_chunks_)
+      - PROTOBUF_FIELD_OFFSET(SwarmState, _impl_.server_time_)>(
+          reinterpret_cast<char*>(&_impl_.server_time_),
+          reinterpret_cast<char*>(&other->_impl_.server_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SwarmState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Player::kIdFieldNumber;
-const int Player::kAccFieldNumber;
-const int Player::kVelFieldNumber;
-const int Player::kPosFieldNumber;
-const int Player::kHealthFieldNumber;
-#endif  // !_MSC_VER
+class Player::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Player>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::swarm::game::Vector2& acc(const Player* msg);
+  static void set_has_acc(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::Vector2& vel(const Player* msg);
+  static void set_has_vel(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::Vector2& pos(const Player* msg);
+  static void set_has_pos(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_health(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_last_input_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
 
-Player::Player()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::swarm::game::Vector2&
+Player::_Internal::acc(const Player* msg) {
+  return *msg->_impl_.acc_;
 }
-
-void Player::InitAsDefaultInstance() {
-  acc_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
-  vel_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
-  pos_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
+const ::swarm::game::Vector2&
+Player::_Internal::vel(const Player* msg) {
+  return *msg->_impl_.vel_;
 }
-
-Player::Player(const Player& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::swarm::game::Vector2&
+Player::_Internal::pos(const Player* msg) {
+  return *msg->_impl_.pos_;
 }
-
-void Player::SharedCtor() {
-  _cached_size_ = 0;
-  id_ = 0u;
-  acc_ = NULL;
-  vel_ = NULL;
-  pos_ = NULL;
-  health_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+Player::Player(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.Player)
+}
+Player::Player(const Player& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Player* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.acc_){nullptr}
+    , decltype(_impl_.vel_){nullptr}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.health_){}
+    , decltype(_impl_.last_input_seq_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_acc()) {
+    _this->_impl_.acc_ = new ::swarm::game::Vector2(*from._impl_.acc_);
+  }
+  if (from._internal_has_vel()) {
+    _this->_impl_.vel_ = new ::swarm::game::Vector2(*from._impl_.vel_);
+  }
+  if (from._internal_has_pos()) {
+    _this->_impl_.pos_ = new ::swarm::game::Vector2(*from._impl_.pos_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_input_seq_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.last_input_seq_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.Player)
+}
+
+inline void Player::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.acc_){nullptr}
+    , decltype(_impl_.vel_){nullptr}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.health_){0}
+    , decltype(_impl_.last_input_seq_){0u}
+  };
 }
 
 Player::~Player() {
+  // @@protoc_insertion_point(destructor:swarm.game.Player)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Player::SharedDtor() {
-  if (this != default_instance_) {
-    delete acc_;
-    delete vel_;
-    delete pos_;
-  }
+inline void Player::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.acc_;
+  if (this != internal_default_instance()) delete _impl_.vel_;
+  if (this != internal_default_instance()) delete _impl_.pos_;
 }
 
 void Player::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Player::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Player_descriptor_;
-}
-
-const Player& Player::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-Player* Player::default_instance_ = NULL;
-
-Player* Player::New() const {
-  return new Player;
+  _impl_._cached_size_.Set(size);
 }
 
 void Player::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    id_ = 0u;
-    if (has_acc()) {
-      if (acc_ != NULL) acc_->::swarm::game::Vector2::Clear();
+// @@protoc_insertion_point(message_clear_start:swarm.game.Player)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.acc_ != nullptr);
+      _impl_.acc_->Clear();
     }
-    if (has_vel()) {
-      if (vel_ != NULL) vel_->::swarm::game::Vector2::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.vel_ != nullptr);
+      _impl_.vel_->Clear();
     }
-    if (has_pos()) {
-      if (pos_ != NULL) pos_->::swarm::game::Vector2::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.pos_ != nullptr);
+      _impl_.pos_->Clear();
     }
-    health_ = 0;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x00000038u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.last_input_seq_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.last_input_seq_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Player::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Player::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional uint32 id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_acc;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.Vector2 acc = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_acc:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_acc()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_vel;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.Vector2 vel = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_vel:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_vel()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_pos;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.Vector2 pos = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pos:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_pos()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_health;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pos(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 health = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_health:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &health_)));
-          set_has_health();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_health(&has_bits);
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 last_input_seq = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_last_input_seq(&has_bits);
+          _impl_.last_input_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Player::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Player::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.Player)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional uint32 id = 1;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->id(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
   }
 
   // optional .swarm.game.Vector2 acc = 2;
-  if (has_acc()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->acc(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::acc(this),
+        _Internal::acc(this).GetCachedSize(), target, stream);
   }
 
   // optional .swarm.game.Vector2 vel = 3;
-  if (has_vel()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->vel(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::vel(this),
+        _Internal::vel(this).GetCachedSize(), target, stream);
   }
 
   // optional .swarm.game.Vector2 pos = 4;
-  if (has_pos()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->pos(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::pos(this),
+        _Internal::pos(this).GetCachedSize(), target, stream);
   }
 
   // optional int32 health = 5;
-  if (has_health()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->health(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Player::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional uint32 id = 1;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->id(), target);
-  }
-
-  // optional .swarm.game.Vector2 acc = 2;
-  if (has_acc()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->acc(), target);
-  }
-
-  // optional .swarm.game.Vector2 vel = 3;
-  if (has_vel()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->vel(), target);
-  }
-
-  // optional .swarm.game.Vector2 pos = 4;
-  if (has_pos()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->pos(), target);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_health(), target);
   }
 
-  // optional int32 health = 5;
-  if (has_health()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->health(), target);
+  // optional uint32 last_input_seq = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_last_input_seq(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.Player)
   return target;
 }
 
-int Player::ByteSize() const {
-  int total_size = 0;
+size_t Player::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.Player)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional uint32 id = 1;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->id());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
     // optional .swarm.game.Vector2 acc = 2;
-    if (has_acc()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->acc());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.acc_);
     }
 
     // optional .swarm.game.Vector2 vel = 3;
-    if (has_vel()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->vel());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.vel_);
     }
 
     // optional .swarm.game.Vector2 pos = 4;
-    if (has_pos()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->pos());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pos_);
+    }
+
+    // optional uint32 id = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
     }
 
     // optional int32 health = 5;
-    if (has_health()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->health());
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_health());
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint32 last_input_seq = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_input_seq());
+    }
 
-void Player::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Player* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Player*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Player::MergeFrom(const Player& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_id()) {
-      set_id(from.id());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Player::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Player::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Player::GetClassData() const { return &_class_data_; }
+
+
+void Player::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Player*>(&to_msg);
+  auto& from = static_cast<const Player&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.Player)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_acc()->::swarm::game::Vector2::MergeFrom(
+          from._internal_acc());
     }
-    if (from.has_acc()) {
-      mutable_acc()->::swarm::game::Vector2::MergeFrom(from.acc());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_vel()->::swarm::game::Vector2::MergeFrom(
+          from._internal_vel());
     }
-    if (from.has_vel()) {
-      mutable_vel()->::swarm::game::Vector2::MergeFrom(from.vel());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_pos()->::swarm::game::Vector2::MergeFrom(
+          from._internal_pos());
     }
-    if (from.has_pos()) {
-      mutable_pos()->::swarm::game::Vector2::MergeFrom(from.pos());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
-    if (from.has_health()) {
-      set_health(from.health());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.health_ = from._impl_.health_;
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.last_input_seq_ = from._impl_.last_input_seq_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Player::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Player::CopyFrom(const Player& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.Player)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Player::IsInitialized() const {
-
   return true;
 }
 
-void Player::Swap(Player* other) {
-  if (other != this) {
-    std::swap(id_, other->id_);
-    std::swap(acc_, other->acc_);
-    std::swap(vel_, other->vel_);
-    std::swap(pos_, other->pos_);
-    std::swap(health_, other->health_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Player::InternalSwap(Player* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Player, _impl_.last_input_seq_)
+      + sizeof(Player::_impl_.last_input_seq_)
+      - PROTOBUF_FIELD_OFFSET(Player, _impl_.acc_)>(
+          reinterpret_cast<char*>(&_impl_.acc_),
+          reinterpret_cast<char*>(&other->_impl_.acc_));
 }
 
-::google::protobuf::Metadata Player::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Player_descriptor_;
-  metadata.reflection = Player_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Player::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[6]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int PlayerClick::kClickPosFieldNumber;
-const int PlayerClick::kClickSizeFieldNumber;
-#endif  // !_MSC_VER
+class PlayerClick::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerClick>()._impl_._has_bits_);
+  static const ::swarm::game::Vector2& click_pos(const PlayerClick* msg);
+  static void set_has_click_pos(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_click_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_render_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
 
-PlayerClick::PlayerClick()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::swarm::game::Vector2&
+PlayerClick::_Internal::click_pos(const PlayerClick* msg) {
+  return *msg->_impl_.click_pos_;
 }
-
-void PlayerClick::InitAsDefaultInstance() {
-  click_pos_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
+PlayerClick::PlayerClick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerClick)
 }
-
 PlayerClick::PlayerClick(const PlayerClick& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void PlayerClick::SharedCtor() {
-  _cached_size_ = 0;
-  click_pos_ = NULL;
-  click_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerClick* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.click_pos_){nullptr}
+    , decltype(_impl_.click_size_){}
+    , decltype(_impl_.render_tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_click_pos()) {
+    _this->_impl_.click_pos_ = new ::swarm::game::Vector2(*from._impl_.click_pos_);
+  }
+  ::memcpy(&_impl_.click_size_, &from._impl_.click_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.render_tick_) -
+    reinterpret_cast<char*>(&_impl_.click_size_)) + sizeof(_impl_.render_tick_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerClick)
+}
+
+inline void PlayerClick::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.click_pos_){nullptr}
+    , decltype(_impl_.click_size_){0}
+    , decltype(_impl_.render_tick_){0u}
+  };
 }
 
 PlayerClick::~PlayerClick() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerClick)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerClick::SharedDtor() {
-  if (this != default_instance_) {
-    delete click_pos_;
-  }
+inline void PlayerClick::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.click_pos_;
 }
 
 void PlayerClick::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PlayerClick::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerClick_descriptor_;
-}
-
-const PlayerClick& PlayerClick::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-PlayerClick* PlayerClick::default_instance_ = NULL;
-
-PlayerClick* PlayerClick::New() const {
-  return new PlayerClick;
+  _impl_._cached_size_.Set(size);
 }
 
 void PlayerClick::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_click_pos()) {
-      if (click_pos_ != NULL) click_pos_->::swarm::game::Vector2::Clear();
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerClick)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.click_pos_ != nullptr);
+    _impl_.click_pos_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.click_size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.render_tick_) -
+        reinterpret_cast<char*>(&_impl_.click_size_)) + sizeof(_impl_.render_tick_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerClick::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .swarm.game.Vector2 click_pos = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_click_pos(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float click_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_click_size(&has_bits);
+          _impl_.click_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 render_tick = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_render_tick(&has_bits);
+          _impl_.render_tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-    click_size_ = 0;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerClick::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerClick)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .swarm.game.Vector2 click_pos = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::click_pos(this),
+        _Internal::click_pos(this).GetCachedSize(), target, stream);
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
 
-bool PlayerClick::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .swarm.game.Vector2 click_pos = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_click_pos()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_click_size;
-        break;
-      }
+  // optional float click_size = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_click_size(), target);
+  }
 
-      // optional float click_size = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_click_size:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &click_size_)));
-          set_has_click_size();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+  // optional uint32 render_tick = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_render_tick(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerClick)
+  return target;
+}
+
+size_t PlayerClick::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerClick)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .swarm.game.Vector2 click_pos = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.click_pos_);
+    }
+
+    // optional float click_size = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 render_tick = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_render_tick());
     }
+
   }
-  return true;
-#undef DO_
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerClick::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional .swarm.game.Vector2 click_pos = 1;
-  if (has_click_pos()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->click_pos(), output);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerClick::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerClick::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerClick::GetClassData() const { return &_class_data_; }
+
+
+void PlayerClick::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerClick*>(&to_msg);
+  auto& from = static_cast<const PlayerClick&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerClick)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_click_pos()->::swarm::game::Vector2::MergeFrom(
+          from._internal_click_pos());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.click_size_ = from._impl_.click_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.render_tick_ = from._impl_.render_tick_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // optional float click_size = 2;
-  if (has_click_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->click_size(), output);
+void PlayerClick::CopyFrom(const PlayerClick& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerClick)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PlayerClick::IsInitialized() const {
+  return true;
+}
+
+void PlayerClick::InternalSwap(PlayerClick* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerClick, _impl_.render_tick_)
+      + sizeof(PlayerClick::_impl_.render_tick_)
+      - PROTOBUF_FIELD_OFFSET(PlayerClick, _impl_.click_pos_)>(
+          reinterpret_cast<char*>(&_impl_.click_pos_),
+          reinterpret_cast<char*>(&other->_impl_.click_pos_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerClick::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[7]);
+}
+
+// ===================================================================
+
+class PlayerInput::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerInput>()._impl_._has_bits_);
+  static void set_has_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::Vector2& acc(const PlayerInput* msg);
+  static void set_has_acc(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::swarm::game::Vector2&
+PlayerInput::_Internal::acc(const PlayerInput* msg) {
+  return *msg->_impl_.acc_;
+}
+PlayerInput::PlayerInput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerInput)
+}
+PlayerInput::PlayerInput(const PlayerInput& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerInput* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.acc_){nullptr}
+    , decltype(_impl_.seq_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_acc()) {
+    _this->_impl_.acc_ = new ::swarm::game::Vector2(*from._impl_.acc_);
+  }
+  _this->_impl_.seq_ = from._impl_.seq_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerInput)
+}
+
+inline void PlayerInput::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.acc_){nullptr}
+    , decltype(_impl_.seq_){0u}
+  };
+}
+
+PlayerInput::~PlayerInput() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerInput)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void PlayerInput::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.acc_;
+}
+
+void PlayerInput::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+void PlayerInput::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerInput)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.acc_ != nullptr);
+    _impl_.acc_->Clear();
   }
+  _impl_.seq_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-::google::protobuf::uint8* PlayerClick::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional .swarm.game.Vector2 click_pos = 1;
-  if (has_click_pos()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->click_pos(), target);
+const char* PlayerInput::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_seq(&has_bits);
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.Vector2 acc = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerInput::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerInput)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 seq = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_seq(), target);
   }
 
-  // optional float click_size = 2;
-  if (has_click_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->click_size(), target);
+  // optional .swarm.game.Vector2 acc = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::acc(this),
+        _Internal::acc(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerInput)
   return target;
 }
 
-int PlayerClick::ByteSize() const {
-  int total_size = 0;
+size_t PlayerInput::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerInput)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .swarm.game.Vector2 click_pos = 1;
-    if (has_click_pos()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .swarm.game.Vector2 acc = 2;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->click_pos());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.acc_);
     }
 
-    // optional float click_size = 2;
-    if (has_click_size()) {
-      total_size += 1 + 4;
+    // optional uint32 seq = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_seq());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerClick::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PlayerClick* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PlayerClick*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerInput::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerInput::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerInput::GetClassData() const { return &_class_data_; }
+
 
-void PlayerClick::MergeFrom(const PlayerClick& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_click_pos()) {
-      mutable_click_pos()->::swarm::game::Vector2::MergeFrom(from.click_pos());
+void PlayerInput::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerInput*>(&to_msg);
+  auto& from = static_cast<const PlayerInput&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerInput)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_acc()->::swarm::game::Vector2::MergeFrom(
+          from._internal_acc());
     }
-    if (from.has_click_size()) {
-      set_click_size(from.click_size());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.seq_ = from._impl_.seq_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PlayerClick::CopyFrom(const ::google::protobuf::Message& from) {
+void PlayerInput::CopyFrom(const PlayerInput& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerInput)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PlayerClick::CopyFrom(const PlayerClick& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool PlayerInput::IsInitialized() const {
+  return true;
 }
 
-bool PlayerClick::IsInitialized() const {
+void PlayerInput::InternalSwap(PlayerInput* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerInput, _impl_.seq_)
+      + sizeof(PlayerInput::_impl_.seq_)
+      - PROTOBUF_FIELD_OFFSET(PlayerInput, _impl_.acc_)>(
+          reinterpret_cast<char*>(&_impl_.acc_),
+          reinterpret_cast<char*>(&other->_impl_.acc_));
+}
 
-  return true;
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerInput::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[8]);
+}
+
+// ===================================================================
+
+class PlayerHello::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerHello>()._impl_._has_bits_);
+  static void set_has_session_token(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_last_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_spectator(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+PlayerHello::PlayerHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerHello)
+}
+PlayerHello::PlayerHello(const PlayerHello& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerHello* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.session_token_){}
+    , decltype(_impl_.last_tick_){}
+    , decltype(_impl_.spectator_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.session_token_, &from._impl_.session_token_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.spectator_) -
+    reinterpret_cast<char*>(&_impl_.session_token_)) + sizeof(_impl_.spectator_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerHello)
+}
+
+inline void PlayerHello::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.session_token_){uint64_t{0u}}
+    , decltype(_impl_.last_tick_){0u}
+    , decltype(_impl_.spectator_){false}
+  };
 }
 
-void PlayerClick::Swap(PlayerClick* other) {
-  if (other != this) {
-    std::swap(click_pos_, other->click_pos_);
-    std::swap(click_size_, other->click_size_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+PlayerHello::~PlayerHello() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerHello)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata PlayerClick::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PlayerClick_descriptor_;
-  metadata.reflection = PlayerClick_reflection_;
-  return metadata;
+inline void PlayerHello::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PlayerHello::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PlayerHello::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerHello)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.session_token_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.spectator_) -
+        reinterpret_cast<char*>(&_impl_.session_token_)) + sizeof(_impl_.spectator_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerHello::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 session_token = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_session_token(&has_bits);
+          _impl_.session_token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 last_tick = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_last_tick(&has_bits);
+          _impl_.last_tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool spectator = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_spectator(&has_bits);
+          _impl_.spectator_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerHello::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerHello)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 session_token = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_session_token(), target);
+  }
+
+  // optional uint32 last_tick = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_last_tick(), target);
+  }
+
+  // optional bool spectator = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_spectator(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerHello)
+  return target;
 }
 
+size_t PlayerHello::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerHello)
+  size_t total_size = 0;
 
-// ===================================================================
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint64 session_token = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_session_token());
+    }
 
-#ifndef _MSC_VER
-const int PlayerState::kPlayerFieldNumber;
-#endif  // !_MSC_VER
+    // optional uint32 last_tick = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_last_tick());
+    }
+
+    // optional bool spectator = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
 
-PlayerState::PlayerState()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerState::InitAsDefaultInstance() {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerHello::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerHello::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerHello::GetClassData() const { return &_class_data_; }
+
+
+void PlayerHello::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerHello*>(&to_msg);
+  auto& from = static_cast<const PlayerHello&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerHello)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.session_token_ = from._impl_.session_token_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.last_tick_ = from._impl_.last_tick_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.spectator_ = from._impl_.spectator_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-PlayerState::PlayerState(const PlayerState& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+void PlayerHello::CopyFrom(const PlayerHello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerHello)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void PlayerState::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool PlayerHello::IsInitialized() const {
+  return true;
 }
 
-PlayerState::~PlayerState() {
-  SharedDtor();
+void PlayerHello::InternalSwap(PlayerHello* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerHello, _impl_.spectator_)
+      + sizeof(PlayerHello::_impl_.spectator_)
+      - PROTOBUF_FIELD_OFFSET(PlayerHello, _impl_.session_token_)>(
+          reinterpret_cast<char*>(&_impl_.session_token_),
+          reinterpret_cast<char*>(&other->_impl_.session_token_));
 }
 
-void PlayerState::SharedDtor() {
-  if (this != default_instance_) {
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerHello::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[9]);
 }
 
-void PlayerState::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+// ===================================================================
+
+class PlayerState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerState>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_server_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+PlayerState::PlayerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerState)
 }
-const ::google::protobuf::Descriptor* PlayerState::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerState_descriptor_;
+PlayerState::PlayerState(const PlayerState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.player_){from._impl_.player_}
+    , decltype(_impl_.server_time_){}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.server_time_, &from._impl_.server_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_) -
+    reinterpret_cast<char*>(&_impl_.server_time_)) + sizeof(_impl_.tick_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerState)
+}
+
+inline void PlayerState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.player_){arena}
+    , decltype(_impl_.server_time_){0}
+    , decltype(_impl_.tick_){0u}
+  };
 }
 
-const PlayerState& PlayerState::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
+PlayerState::~PlayerState() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-PlayerState* PlayerState::default_instance_ = NULL;
-
-PlayerState* PlayerState::New() const {
-  return new PlayerState;
+inline void PlayerState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.player_.~RepeatedPtrField();
 }
 
-void PlayerState::Clear() {
-  player_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void PlayerState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool PlayerState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void PlayerState::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.player_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.server_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tick_) -
+        reinterpret_cast<char*>(&_impl_.server_time_)) + sizeof(_impl_.tick_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .swarm.game.Player player = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_player:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_player()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_player;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_player(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 tick = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double server_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_server_time(&has_bits);
+          _impl_.server_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PlayerState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .swarm.game.Player player = 1;
-  for (int i = 0; i < this->player_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->player(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_player_size()); i < n; i++) {
+    const auto& repfield = this->_internal_player(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 tick = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tick(), target);
   }
-}
 
-::google::protobuf::uint8* PlayerState::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .swarm.game.Player player = 1;
-  for (int i = 0; i < this->player_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->player(i), target);
+  // optional double server_time = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_server_time(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerState)
   return target;
 }
 
-int PlayerState::ByteSize() const {
-  int total_size = 0;
+size_t PlayerState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .swarm.game.Player player = 1;
-  total_size += 1 * this->player_size();
-  for (int i = 0; i < this->player_size(); i++) {
+  total_size += 1UL * this->_internal_player_size();
+  for (const auto& msg : this->_impl_.player_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->player(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional double server_time = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 tick = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+    }
 
-void PlayerState::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PlayerState* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PlayerState*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerState::MergeFrom(const PlayerState& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  player_.MergeFrom(from.player_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerState::GetClassData() const { return &_class_data_; }
 
-void PlayerState::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void PlayerState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerState*>(&to_msg);
+  auto& from = static_cast<const PlayerState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.player_.MergeFrom(from._impl_.player_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.server_time_ = from._impl_.server_time_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerState::CopyFrom(const PlayerState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerState)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool PlayerState::IsInitialized() const {
-
   return true;
 }
 
-void PlayerState::Swap(PlayerState* other) {
-  if (other != this) {
-    player_.Swap(&other->player_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void PlayerState::InternalSwap(PlayerState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.player_.InternalSwap(&other->_impl_.player_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerState, _impl_.tick_)
+      + sizeof(PlayerState::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(PlayerState, _impl_.server_time_)>(
+          reinterpret_cast<char*>(&_impl_.server_time_),
+          reinterpret_cast<char*>(&other->_impl_.server_time_));
 }
 
-::google::protobuf::Metadata PlayerState::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PlayerState_descriptor_;
-  metadata.reflection = PlayerState_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[10]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int GameStarted::kPlayerIdFieldNumber;
-const int GameStarted::kHealthFieldNumber;
-const int GameStarted::kMapNameFieldNumber;
-const int GameStarted::kPlayerStateFieldNumber;
-const int GameStarted::kSwarmStateFieldNumber;
-#endif  // !_MSC_VER
+class GameStarted::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GameStarted>()._impl_._has_bits_);
+  static void set_has_player_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_health(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_map_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::PlayerState& player_state(const GameStarted* msg);
+  static void set_has_player_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::SwarmState& swarm_state(const GameStarted* msg);
+  static void set_has_swarm_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_snapshot_interval_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_udp_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_udp_token(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_session_token(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_resumed(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_initial_state_chunks(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_lockstep(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+};
 
-GameStarted::GameStarted()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::swarm::game::PlayerState&
+GameStarted::_Internal::player_state(const GameStarted* msg) {
+  return *msg->_impl_.player_state_;
 }
-
-void GameStarted::InitAsDefaultInstance() {
-  player_state_ = const_cast< ::swarm::game::PlayerState*>(&::swarm::game::PlayerState::default_instance());
-  swarm_state_ = const_cast< ::swarm::game::SwarmState*>(&::swarm::game::SwarmState::default_instance());
+const ::swarm::game::SwarmState&
+GameStarted::_Internal::swarm_state(const GameStarted* msg) {
+  return *msg->_impl_.swarm_state_;
 }
-
-GameStarted::GameStarted(const GameStarted& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+GameStarted::GameStarted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.GameStarted)
 }
-
-void GameStarted::SharedCtor() {
-  _cached_size_ = 0;
-  player_id_ = 0u;
-  health_ = 0u;
-  map_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  player_state_ = NULL;
-  swarm_state_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+GameStarted::GameStarted(const GameStarted& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameStarted* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.player_state_){nullptr}
+    , decltype(_impl_.swarm_state_){nullptr}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.health_){}
+    , decltype(_impl_.snapshot_interval_ms_){}
+    , decltype(_impl_.udp_port_){}
+    , decltype(_impl_.session_token_){}
+    , decltype(_impl_.udp_token_){}
+    , decltype(_impl_.initial_state_chunks_){}
+    , decltype(_impl_.resumed_){}
+    , decltype(_impl_.lockstep_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_map_name()) {
+    _this->_impl_.map_name_.Set(from._internal_map_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_player_state()) {
+    _this->_impl_.player_state_ = new ::swarm::game::PlayerState(*from._impl_.player_state_);
+  }
+  if (from._internal_has_swarm_state()) {
+    _this->_impl_.swarm_state_ = new ::swarm::game::SwarmState(*from._impl_.swarm_state_);
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lockstep_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.lockstep_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.GameStarted)
+}
+
+inline void GameStarted::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.player_state_){nullptr}
+    , decltype(_impl_.swarm_state_){nullptr}
+    , decltype(_impl_.player_id_){0u}
+    , decltype(_impl_.health_){0u}
+    , decltype(_impl_.snapshot_interval_ms_){0u}
+    , decltype(_impl_.udp_port_){0u}
+    , decltype(_impl_.session_token_){uint64_t{0u}}
+    , decltype(_impl_.udp_token_){0u}
+    , decltype(_impl_.initial_state_chunks_){0u}
+    , decltype(_impl_.resumed_){false}
+    , decltype(_impl_.lockstep_){false}
+  };
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameStarted::~GameStarted() {
+  // @@protoc_insertion_point(destructor:swarm.game.GameStarted)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameStarted::SharedDtor() {
-  if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete map_name_;
-  }
-  if (this != default_instance_) {
-    delete player_state_;
-    delete swarm_state_;
-  }
+inline void GameStarted::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.map_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.player_state_;
+  if (this != internal_default_instance()) delete _impl_.swarm_state_;
 }
 
 void GameStarted::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* GameStarted::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return GameStarted_descriptor_;
-}
-
-const GameStarted& GameStarted::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-GameStarted* GameStarted::default_instance_ = NULL;
-
-GameStarted* GameStarted::New() const {
-  return new GameStarted;
+  _impl_._cached_size_.Set(size);
 }
 
 void GameStarted::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    player_id_ = 0u;
-    health_ = 0u;
-    if (has_map_name()) {
-      if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-        map_name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:swarm.game.GameStarted)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.map_name_.ClearNonDefaultToEmpty();
     }
-    if (has_player_state()) {
-      if (player_state_ != NULL) player_state_->::swarm::game::PlayerState::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.player_state_ != nullptr);
+      _impl_.player_state_->Clear();
     }
-    if (has_swarm_state()) {
-      if (swarm_state_ != NULL) swarm_state_->::swarm::game::SwarmState::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.swarm_state_ != nullptr);
+      _impl_.swarm_state_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.session_token_) -
+        reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.session_token_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.udp_token_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.lockstep_) -
+        reinterpret_cast<char*>(&_impl_.udp_token_)) + sizeof(_impl_.lockstep_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool GameStarted::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* GameStarted::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional uint32 player_id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &player_id_)));
-          set_has_player_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_health;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_player_id(&has_bits);
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 health = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_health:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &health_)));
-          set_has_health();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_map_name;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_health(&has_bits);
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string map_name = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_map_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_map_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->map_name().data(), this->map_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_player_state;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_map_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "swarm.game.GameStarted.map_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.PlayerState player_state = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_player_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_player_state()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_swarm_state;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .swarm.game.SwarmState swarm_state = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_swarm_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_swarm_state()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_swarm_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 snapshot_interval_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_snapshot_interval_ms(&has_bits);
+          _impl_.snapshot_interval_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 udp_port = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_udp_port(&has_bits);
+          _impl_.udp_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 udp_token = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_udp_token(&has_bits);
+          _impl_.udp_token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 session_token = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_session_token(&has_bits);
+          _impl_.session_token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool resumed = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_resumed(&has_bits);
+          _impl_.resumed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 initial_state_chunks = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_initial_state_chunks(&has_bits);
+          _impl_.initial_state_chunks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool lockstep = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_lockstep(&has_bits);
+          _impl_.lockstep_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void GameStarted::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameStarted::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.GameStarted)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional uint32 player_id = 1;
-  if (has_player_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->player_id(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_player_id(), target);
   }
 
   // optional uint32 health = 2;
-  if (has_health()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->health(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_health(), target);
   }
 
   // optional string map_name = 3;
-  if (has_map_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->map_name().data(), this->map_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->map_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_map_name().data(), static_cast<int>(this->_internal_map_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "swarm.game.GameStarted.map_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_map_name(), target);
   }
 
   // optional .swarm.game.PlayerState player_state = 4;
-  if (has_player_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->player_state(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::player_state(this),
+        _Internal::player_state(this).GetCachedSize(), target, stream);
   }
 
   // optional .swarm.game.SwarmState swarm_state = 5;
-  if (has_swarm_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->swarm_state(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::swarm_state(this),
+        _Internal::swarm_state(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional uint32 snapshot_interval_ms = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_snapshot_interval_ms(), target);
   }
-}
 
-::google::protobuf::uint8* GameStarted::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional uint32 player_id = 1;
-  if (has_player_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->player_id(), target);
+  // optional uint32 udp_port = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_udp_port(), target);
   }
 
-  // optional uint32 health = 2;
-  if (has_health()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->health(), target);
+  // optional uint32 udp_token = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_udp_token(), target);
   }
 
-  // optional string map_name = 3;
-  if (has_map_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->map_name().data(), this->map_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->map_name(), target);
+  // optional uint64 session_token = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_session_token(), target);
   }
 
-  // optional .swarm.game.PlayerState player_state = 4;
-  if (has_player_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->player_state(), target);
+  // optional bool resumed = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_resumed(), target);
   }
 
-  // optional .swarm.game.SwarmState swarm_state = 5;
-  if (has_swarm_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->swarm_state(), target);
+  // optional uint32 initial_state_chunks = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_initial_state_chunks(), target);
+  }
+
+  // optional bool lockstep = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_lockstep(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.GameStarted)
   return target;
 }
 
-int GameStarted::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional uint32 player_id = 1;
-    if (has_player_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->player_id());
-    }
+size_t GameStarted::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.GameStarted)
+  size_t total_size = 0;
 
-    // optional uint32 health = 2;
-    if (has_health()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->health());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
     // optional string map_name = 3;
-    if (has_map_name()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->map_name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_map_name());
     }
 
     // optional .swarm.game.PlayerState player_state = 4;
-    if (has_player_state()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->player_state());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.player_state_);
     }
 
     // optional .swarm.game.SwarmState swarm_state = 5;
-    if (has_swarm_state()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->swarm_state());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.swarm_state_);
+    }
+
+    // optional uint32 player_id = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
+    }
+
+    // optional uint32 health = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_health());
+    }
+
+    // optional uint32 snapshot_interval_ms = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_snapshot_interval_ms());
+    }
+
+    // optional uint32 udp_port = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_udp_port());
+    }
+
+    // optional uint64 session_token = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_session_token());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  if (cached_has_bits & 0x00000f00u) {
+    // optional uint32 udp_token = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_udp_token());
+    }
+
+    // optional uint32 initial_state_chunks = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_initial_state_chunks());
+    }
+
+    // optional bool resumed = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool lockstep = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
 
-void GameStarted::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const GameStarted* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GameStarted*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameStarted::MergeFrom(const GameStarted& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_player_id()) {
-      set_player_id(from.player_id());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameStarted::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameStarted::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameStarted::GetClassData() const { return &_class_data_; }
+
+
+void GameStarted::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameStarted*>(&to_msg);
+  auto& from = static_cast<const GameStarted&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.GameStarted)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_map_name(from._internal_map_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_player_state()->::swarm::game::PlayerState::MergeFrom(
+          from._internal_player_state());
     }
-    if (from.has_health()) {
-      set_health(from.health());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_swarm_state()->::swarm::game::SwarmState::MergeFrom(
+          from._internal_swarm_state());
     }
-    if (from.has_map_name()) {
-      set_map_name(from.map_name());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.player_id_ = from._impl_.player_id_;
     }
-    if (from.has_player_state()) {
-      mutable_player_state()->::swarm::game::PlayerState::MergeFrom(from.player_state());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.health_ = from._impl_.health_;
     }
-    if (from.has_swarm_state()) {
-      mutable_swarm_state()->::swarm::game::SwarmState::MergeFrom(from.swarm_state());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.snapshot_interval_ms_ = from._impl_.snapshot_interval_ms_;
     }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.udp_port_ = from._impl_.udp_port_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.session_token_ = from._impl_.session_token_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void GameStarted::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.udp_token_ = from._impl_.udp_token_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.initial_state_chunks_ = from._impl_.initial_state_chunks_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.resumed_ = from._impl_.resumed_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.lockstep_ = from._impl_.lockstep_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameStarted::CopyFrom(const GameStarted& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.GameStarted)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool GameStarted::IsInitialized() const {
-
   return true;
 }
 
-void GameStarted::Swap(GameStarted* other) {
-  if (other != this) {
-    std::swap(player_id_, other->player_id_);
-    std::swap(health_, other->health_);
-    std::swap(map_name_, other->map_name_);
-    std::swap(player_state_, other->player_state_);
-    std::swap(swarm_state_, other->swarm_state_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void GameStarted::InternalSwap(GameStarted* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.map_name_, lhs_arena,
+      &other->_impl_.map_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameStarted, _impl_.lockstep_)
+      + sizeof(GameStarted::_impl_.lockstep_)
+      - PROTOBUF_FIELD_OFFSET(GameStarted, _impl_.player_state_)>(
+          reinterpret_cast<char*>(&_impl_.player_state_),
+          reinterpret_cast<char*>(&other->_impl_.player_state_));
 }
 
-::google::protobuf::Metadata GameStarted::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GameStarted_descriptor_;
-  metadata.reflection = GameStarted_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata GameStarted::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[11]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int GameEnded::kWinnerIdFieldNumber;
-#endif  // !_MSC_VER
-
-GameEnded::GameEnded()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class GameEnded::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GameEnded>()._impl_._has_bits_);
+  static void set_has_winner_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void GameEnded::InitAsDefaultInstance() {
+GameEnded::GameEnded(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.GameEnded)
 }
-
 GameEnded::GameEnded(const GameEnded& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void GameEnded::SharedCtor() {
-  _cached_size_ = 0;
-  winner_id_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEnded* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.winner_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.winner_id_ = from._impl_.winner_id_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.GameEnded)
+}
+
+inline void GameEnded::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.winner_id_){0u}
+  };
 }
 
 GameEnded::~GameEnded() {
+  // @@protoc_insertion_point(destructor:swarm.game.GameEnded)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameEnded::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void GameEnded::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void GameEnded::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* GameEnded::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return GameEnded_descriptor_;
-}
-
-const GameEnded& GameEnded::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-GameEnded* GameEnded::default_instance_ = NULL;
-
-GameEnded* GameEnded::New() const {
-  return new GameEnded;
+  _impl_._cached_size_.Set(size);
 }
 
 void GameEnded::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    winner_id_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool GameEnded::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:swarm.game.GameEnded)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.winner_id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameEnded::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional uint32 winner_id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &winner_id_)));
-          set_has_winner_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_winner_id(&has_bits);
+          _impl_.winner_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void GameEnded::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameEnded::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.GameEnded)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional uint32 winner_id = 1;
-  if (has_winner_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->winner_id(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_winner_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.GameEnded)
+  return target;
 }
 
-::google::protobuf::uint8* GameEnded::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t GameEnded::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.GameEnded)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // optional uint32 winner_id = 1;
-  if (has_winner_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->winner_id(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_winner_id());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int GameEnded::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional uint32 winner_id = 1;
-    if (has_winner_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->winner_id());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEnded::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEnded::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEnded::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void GameEnded::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const GameEnded* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GameEnded*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void GameEnded::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEnded*>(&to_msg);
+  auto& from = static_cast<const GameEnded&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.GameEnded)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void GameEnded::MergeFrom(const GameEnded& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_winner_id()) {
-      set_winner_id(from.winner_id());
-    }
+  if (from._internal_has_winner_id()) {
+    _this->_internal_set_winner_id(from._internal_winner_id());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void GameEnded::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameEnded::CopyFrom(const GameEnded& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.GameEnded)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool GameEnded::IsInitialized() const {
-
   return true;
 }
 
-void GameEnded::Swap(GameEnded* other) {
-  if (other != this) {
-    std::swap(winner_id_, other->winner_id_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void GameEnded::InternalSwap(GameEnded* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.winner_id_, other->_impl_.winner_id_);
 }
 
-::google::protobuf::Metadata GameEnded::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GameEnded_descriptor_;
-  metadata.reflection = GameEnded_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata GameEnded::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[12]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int PlayerDied::kPlayerIdFieldNumber;
-#endif  // !_MSC_VER
-
-PlayerDied::PlayerDied()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class PlayerDied::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerDied>()._impl_._has_bits_);
+  static void set_has_player_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void PlayerDied::InitAsDefaultInstance() {
+PlayerDied::PlayerDied(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerDied)
 }
-
 PlayerDied::PlayerDied(const PlayerDied& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void PlayerDied::SharedCtor() {
-  _cached_size_ = 0;
-  player_id_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerDied* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.player_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.player_id_ = from._impl_.player_id_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerDied)
+}
+
+inline void PlayerDied::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.player_id_){0u}
+  };
 }
 
 PlayerDied::~PlayerDied() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerDied)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerDied::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void PlayerDied::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void PlayerDied::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PlayerDied::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerDied_descriptor_;
-}
-
-const PlayerDied& PlayerDied::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-PlayerDied* PlayerDied::default_instance_ = NULL;
-
-PlayerDied* PlayerDied::New() const {
-  return new PlayerDied;
+  _impl_._cached_size_.Set(size);
 }
 
 void PlayerDied::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    player_id_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool PlayerDied::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerDied)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.player_id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerDied::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional uint32 player_id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &player_id_)));
-          set_has_player_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_player_id(&has_bits);
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void PlayerDied::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerDied::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerDied)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional uint32 player_id = 1;
-  if (has_player_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->player_id(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_player_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerDied)
+  return target;
 }
 
-::google::protobuf::uint8* PlayerDied::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t PlayerDied::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerDied)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // optional uint32 player_id = 1;
-  if (has_player_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->player_id(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int PlayerDied::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional uint32 player_id = 1;
-    if (has_player_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->player_id());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerDied::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerDied::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerDied::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void PlayerDied::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PlayerDied* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PlayerDied*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void PlayerDied::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerDied*>(&to_msg);
+  auto& from = static_cast<const PlayerDied&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerDied)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void PlayerDied::MergeFrom(const PlayerDied& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_player_id()) {
-      set_player_id(from.player_id());
-    }
+  if (from._internal_has_player_id()) {
+    _this->_internal_set_player_id(from._internal_player_id());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void PlayerDied::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerDied::CopyFrom(const PlayerDied& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerDied)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool PlayerDied::IsInitialized() const {
-
   return true;
 }
 
-void PlayerDied::Swap(PlayerDied* other) {
-  if (other != this) {
-    std::swap(player_id_, other->player_id_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void PlayerDied::InternalSwap(PlayerDied* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.player_id_, other->_impl_.player_id_);
 }
 
-::google::protobuf::Metadata PlayerDied::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PlayerDied_descriptor_;
-  metadata.reflection = PlayerDied_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerDied::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[13]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int MonsterDied::kPosFieldNumber;
-#endif  // !_MSC_VER
+class MonsterDied::_Internal {
+ public:
+};
 
-MonsterDied::MonsterDied()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+MonsterDied::MonsterDied(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.MonsterDied)
 }
-
-void MonsterDied::InitAsDefaultInstance() {
-}
-
 MonsterDied::MonsterDied(const MonsterDied& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MonsterDied::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MonsterDied* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pos_){from._impl_.pos_}
+    , decltype(_impl_.id_){from._impl_.id_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:swarm.game.MonsterDied)
+}
+
+inline void MonsterDied::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pos_){arena}
+    , decltype(_impl_.id_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 MonsterDied::~MonsterDied() {
+  // @@protoc_insertion_point(destructor:swarm.game.MonsterDied)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MonsterDied::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void MonsterDied::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pos_.~RepeatedPtrField();
+  _impl_.id_.~RepeatedField();
 }
 
 void MonsterDied::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MonsterDied::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MonsterDied_descriptor_;
-}
-
-const MonsterDied& MonsterDied::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
-}
-
-MonsterDied* MonsterDied::default_instance_ = NULL;
-
-MonsterDied* MonsterDied::New() const {
-  return new MonsterDied;
+  _impl_._cached_size_.Set(size);
 }
 
 void MonsterDied::Clear() {
-  pos_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool MonsterDied::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:swarm.game.MonsterDied)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pos_.Clear();
+  _impl_.id_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MonsterDied::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .swarm.game.Vector2 pos = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pos:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_pos()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_pos;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pos(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_id(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MonsterDied::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.MonsterDied)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void MonsterDied::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .swarm.game.Vector2 pos = 1;
-  for (int i = 0; i < this->pos_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->pos(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pos(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* MonsterDied::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .swarm.game.Vector2 pos = 1;
-  for (int i = 0; i < this->pos_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->pos(i), target);
+  // repeated uint32 id = 2;
+  for (int i = 0, n = this->_internal_id_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_id(i), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.MonsterDied)
   return target;
 }
 
-int MonsterDied::ByteSize() const {
-  int total_size = 0;
+size_t MonsterDied::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.MonsterDied)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .swarm.game.Vector2 pos = 1;
-  total_size += 1 * this->pos_size();
-  for (int i = 0; i < this->pos_size(); i++) {
+  total_size += 1UL * this->_internal_pos_size();
+  for (const auto& msg : this->_impl_.pos_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->pos(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // repeated uint32 id = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.id_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_id_size());
+    total_size += data_size;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MonsterDied::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MonsterDied* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MonsterDied*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MonsterDied::MergeFrom(const MonsterDied& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  pos_.MergeFrom(from.pos_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MonsterDied::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MonsterDied::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MonsterDied::GetClassData() const { return &_class_data_; }
 
-void MonsterDied::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void MonsterDied::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MonsterDied*>(&to_msg);
+  auto& from = static_cast<const MonsterDied&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.MonsterDied)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pos_.MergeFrom(from._impl_.pos_);
+  _this->_impl_.id_.MergeFrom(from._impl_.id_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MonsterDied::CopyFrom(const MonsterDied& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.MonsterDied)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MonsterDied::IsInitialized() const {
-
   return true;
 }
 
-void MonsterDied::Swap(MonsterDied* other) {
-  if (other != this) {
-    pos_.Swap(&other->pos_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MonsterDied::InternalSwap(MonsterDied* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pos_.InternalSwap(&other->_impl_.pos_);
+  _impl_.id_.InternalSwap(&other->_impl_.id_);
 }
 
-::google::protobuf::Metadata MonsterDied::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MonsterDied_descriptor_;
-  metadata.reflection = MonsterDied_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MonsterDied::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[14]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* ServerMessage_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ServerMessage_Type_descriptor_;
+class Ping::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Ping>()._impl_._has_bits_);
+  static void set_has_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_client_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_rtt_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+Ping::Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.Ping)
+}
+Ping::Ping(const Ping& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Ping* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_time_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.rtt_ms_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.client_time_, &from._impl_.client_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rtt_ms_) -
+    reinterpret_cast<char*>(&_impl_.client_time_)) + sizeof(_impl_.rtt_ms_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.Ping)
+}
+
+inline void Ping::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_time_){0}
+    , decltype(_impl_.seq_){0u}
+    , decltype(_impl_.rtt_ms_){0}
+  };
 }
-bool ServerMessage_Type_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
-    case 4:
-    case 5:
-    case 6:
-    case 7:
-      return true;
-    default:
-      return false;
+
+Ping::~Ping() {
+  // @@protoc_insertion_point(destructor:swarm.game.Ping)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-#ifndef _MSC_VER
-const ServerMessage_Type ServerMessage::GAME_STARTED;
-const ServerMessage_Type ServerMessage::PLAYER_JOINED;
-const ServerMessage_Type ServerMessage::PLAYER_LEFT;
-const ServerMessage_Type ServerMessage::SWARM_STATE;
-const ServerMessage_Type ServerMessage::PLAYER_STATE;
-const ServerMessage_Type ServerMessage::PLAYER_DIED;
-const ServerMessage_Type ServerMessage::GAME_ENDED;
-const ServerMessage_Type ServerMessage::MONSTER_DIED;
-const ServerMessage_Type ServerMessage::Type_MIN;
-const ServerMessage_Type ServerMessage::Type_MAX;
-const int ServerMessage::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int ServerMessage::kTypeFieldNumber;
-const int ServerMessage::kGameStartedFieldNumber;
-const int ServerMessage::kPlayerJoinedFieldNumber;
-const int ServerMessage::kPlayerLeftFieldNumber;
-const int ServerMessage::kSwarmStateFieldNumber;
-const int ServerMessage::kPlayerStateFieldNumber;
-const int ServerMessage::kPlayerDiedFieldNumber;
-const int ServerMessage::kGameEndedFieldNumber;
-const int ServerMessage::kMonsterDiedFieldNumber;
-#endif  // !_MSC_VER
-
-ServerMessage::ServerMessage()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void ServerMessage::InitAsDefaultInstance() {
-  game_started_ = const_cast< ::swarm::game::GameStarted*>(&::swarm::game::GameStarted::default_instance());
-  player_joined_ = const_cast< ::swarm::game::PlayerJoined*>(&::swarm::game::PlayerJoined::default_instance());
-  player_left_ = const_cast< ::swarm::game::PlayerLeft*>(&::swarm::game::PlayerLeft::default_instance());
-  swarm_state_ = const_cast< ::swarm::game::SwarmState*>(&::swarm::game::SwarmState::default_instance());
-  player_state_ = const_cast< ::swarm::game::PlayerState*>(&::swarm::game::PlayerState::default_instance());
-  player_died_ = const_cast< ::swarm::game::PlayerDied*>(&::swarm::game::PlayerDied::default_instance());
-  game_ended_ = const_cast< ::swarm::game::GameEnded*>(&::swarm::game::GameEnded::default_instance());
-  monster_died_ = const_cast< ::swarm::game::MonsterDied*>(&::swarm::game::MonsterDied::default_instance());
+inline void Ping::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Ping::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Ping::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.Ping)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.client_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.rtt_ms_) -
+        reinterpret_cast<char*>(&_impl_.client_time_)) + sizeof(_impl_.rtt_ms_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Ping::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_seq(&has_bits);
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double client_time = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_client_time(&has_bits);
+          _impl_.client_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float rtt_ms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_rtt_ms(&has_bits);
+          _impl_.rtt_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Ping::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.Ping)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 seq = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_seq(), target);
+  }
+
+  // optional double client_time = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_client_time(), target);
+  }
+
+  // optional float rtt_ms = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_rtt_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.Ping)
+  return target;
 }
 
-ServerMessage::ServerMessage(const ServerMessage& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
+size_t Ping::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.Ping)
+  size_t total_size = 0;
 
-void ServerMessage::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  game_started_ = NULL;
-  player_joined_ = NULL;
-  player_left_ = NULL;
-  swarm_state_ = NULL;
-  player_state_ = NULL;
-  player_died_ = NULL;
-  game_ended_ = NULL;
-  monster_died_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-ServerMessage::~ServerMessage() {
-  SharedDtor();
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional double client_time = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
 
-void ServerMessage::SharedDtor() {
-  if (this != default_instance_) {
-    delete game_started_;
-    delete player_joined_;
-    delete player_left_;
-    delete swarm_state_;
-    delete player_state_;
-    delete player_died_;
-    delete game_ended_;
-    delete monster_died_;
-  }
-}
+    // optional uint32 seq = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_seq());
+    }
 
-void ServerMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ServerMessage::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ServerMessage_descriptor_;
-}
+    // optional float rtt_ms = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
 
-const ServerMessage& ServerMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-ServerMessage* ServerMessage::default_instance_ = NULL;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Ping::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Ping::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Ping::GetClassData() const { return &_class_data_; }
 
-ServerMessage* ServerMessage::New() const {
-  return new ServerMessage;
-}
 
-void ServerMessage::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_game_started()) {
-      if (game_started_ != NULL) game_started_->::swarm::game::GameStarted::Clear();
-    }
-    if (has_player_joined()) {
-      if (player_joined_ != NULL) player_joined_->::swarm::game::PlayerJoined::Clear();
-    }
-    if (has_player_left()) {
-      if (player_left_ != NULL) player_left_->::swarm::game::PlayerLeft::Clear();
-    }
-    if (has_swarm_state()) {
-      if (swarm_state_ != NULL) swarm_state_->::swarm::game::SwarmState::Clear();
-    }
-    if (has_player_state()) {
-      if (player_state_ != NULL) player_state_->::swarm::game::PlayerState::Clear();
-    }
-    if (has_player_died()) {
-      if (player_died_ != NULL) player_died_->::swarm::game::PlayerDied::Clear();
+void Ping::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Ping*>(&to_msg);
+  auto& from = static_cast<const Ping&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.Ping)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.client_time_ = from._impl_.client_time_;
     }
-    if (has_game_ended()) {
-      if (game_ended_ != NULL) game_ended_->::swarm::game::GameEnded::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.seq_ = from._impl_.seq_;
     }
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (has_monster_died()) {
-      if (monster_died_ != NULL) monster_died_->::swarm::game::MonsterDied::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.rtt_ms_ = from._impl_.rtt_ms_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-bool ServerMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .swarm.game.ServerMessage.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::swarm::game::ServerMessage_Type_IsValid(value)) {
-            set_type(static_cast< ::swarm::game::ServerMessage_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_game_started;
-        break;
-      }
-
-      // optional .swarm.game.GameStarted game_started = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_game_started:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_game_started()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_player_joined;
-        break;
-      }
+void Ping::CopyFrom(const Ping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.Ping)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // optional .swarm.game.PlayerJoined player_joined = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_player_joined:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_player_joined()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_player_left;
-        break;
-      }
+bool Ping::IsInitialized() const {
+  return true;
+}
 
-      // optional .swarm.game.PlayerLeft player_left = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_player_left:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_player_left()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_swarm_state;
-        break;
-      }
+void Ping::InternalSwap(Ping* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Ping, _impl_.rtt_ms_)
+      + sizeof(Ping::_impl_.rtt_ms_)
+      - PROTOBUF_FIELD_OFFSET(Ping, _impl_.client_time_)>(
+          reinterpret_cast<char*>(&_impl_.client_time_),
+          reinterpret_cast<char*>(&other->_impl_.client_time_));
+}
 
-      // optional .swarm.game.SwarmState swarm_state = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_swarm_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_swarm_state()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_player_state;
-        break;
-      }
+::PROTOBUF_NAMESPACE_ID::Metadata Ping::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[15]);
+}
 
-      // optional .swarm.game.PlayerState player_state = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_player_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_player_state()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_player_died;
-        break;
-      }
+// ===================================================================
 
-      // optional .swarm.game.PlayerDied player_died = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_player_died:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_player_died()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_game_ended;
-        break;
-      }
+class Pong::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Pong>()._impl_._has_bits_);
+  static void set_has_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_client_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_server_receive_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_server_send_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+Pong::Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.Pong)
+}
+Pong::Pong(const Pong& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Pong* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_time_){}
+    , decltype(_impl_.server_receive_time_){}
+    , decltype(_impl_.server_send_time_){}
+    , decltype(_impl_.seq_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.client_time_, &from._impl_.client_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.seq_) -
+    reinterpret_cast<char*>(&_impl_.client_time_)) + sizeof(_impl_.seq_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.Pong)
+}
+
+inline void Pong::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_time_){0}
+    , decltype(_impl_.server_receive_time_){0}
+    , decltype(_impl_.server_send_time_){0}
+    , decltype(_impl_.seq_){0u}
+  };
+}
 
-      // optional .swarm.game.GameEnded game_ended = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_game_ended:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_game_ended()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(74)) goto parse_monster_died;
-        break;
-      }
+Pong::~Pong() {
+  // @@protoc_insertion_point(destructor:swarm.game.Pong)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-      // optional .swarm.game.MonsterDied monster_died = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_monster_died:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_monster_died()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+inline void Pong::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Pong::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Pong::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.Pong)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.client_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.seq_) -
+        reinterpret_cast<char*>(&_impl_.client_time_)) + sizeof(_impl_.seq_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Pong::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_seq(&has_bits);
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double client_time = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_client_time(&has_bits);
+          _impl_.client_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double server_receive_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_server_receive_time(&has_bits);
+          _impl_.server_receive_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double server_send_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_server_send_time(&has_bits);
+          _impl_.server_send_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void ServerMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .swarm.game.ServerMessage.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
+uint8_t* Pong::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.Pong)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional .swarm.game.GameStarted game_started = 2;
-  if (has_game_started()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->game_started(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 seq = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_seq(), target);
   }
 
-  // optional .swarm.game.PlayerJoined player_joined = 3;
-  if (has_player_joined()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->player_joined(), output);
+  // optional double client_time = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_client_time(), target);
   }
 
-  // optional .swarm.game.PlayerLeft player_left = 4;
-  if (has_player_left()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->player_left(), output);
+  // optional double server_receive_time = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_server_receive_time(), target);
   }
 
-  // optional .swarm.game.SwarmState swarm_state = 5;
-  if (has_swarm_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->swarm_state(), output);
+  // optional double server_send_time = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_server_send_time(), target);
   }
 
-  // optional .swarm.game.PlayerState player_state = 6;
-  if (has_player_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->player_state(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.Pong)
+  return target;
+}
 
-  // optional .swarm.game.PlayerDied player_died = 7;
-  if (has_player_died()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->player_died(), output);
-  }
+size_t Pong::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.Pong)
+  size_t total_size = 0;
 
-  // optional .swarm.game.GameEnded game_ended = 8;
-  if (has_game_ended()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->game_ended(), output);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional .swarm.game.MonsterDied monster_died = 9;
-  if (has_monster_died()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, this->monster_died(), output);
-  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional double client_time = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double server_receive_time = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double server_send_time = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 seq = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_seq());
+    }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-::google::protobuf::uint8* ServerMessage::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .swarm.game.ServerMessage.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Pong::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Pong::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Pong::GetClassData() const { return &_class_data_; }
 
-  // optional .swarm.game.GameStarted game_started = 2;
-  if (has_game_started()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->game_started(), target);
-  }
 
-  // optional .swarm.game.PlayerJoined player_joined = 3;
-  if (has_player_joined()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->player_joined(), target);
-  }
+void Pong::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Pong*>(&to_msg);
+  auto& from = static_cast<const Pong&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.Pong)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional .swarm.game.PlayerLeft player_left = 4;
-  if (has_player_left()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->player_left(), target);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.client_time_ = from._impl_.client_time_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.server_receive_time_ = from._impl_.server_receive_time_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_send_time_ = from._impl_.server_send_time_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.seq_ = from._impl_.seq_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // optional .swarm.game.SwarmState swarm_state = 5;
-  if (has_swarm_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->swarm_state(), target);
-  }
+void Pong::CopyFrom(const Pong& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.Pong)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-  // optional .swarm.game.PlayerState player_state = 6;
-  if (has_player_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->player_state(), target);
-  }
+bool Pong::IsInitialized() const {
+  return true;
+}
 
-  // optional .swarm.game.PlayerDied player_died = 7;
-  if (has_player_died()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->player_died(), target);
-  }
+void Pong::InternalSwap(Pong* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Pong, _impl_.seq_)
+      + sizeof(Pong::_impl_.seq_)
+      - PROTOBUF_FIELD_OFFSET(Pong, _impl_.client_time_)>(
+          reinterpret_cast<char*>(&_impl_.client_time_),
+          reinterpret_cast<char*>(&other->_impl_.client_time_));
+}
 
-  // optional .swarm.game.GameEnded game_ended = 8;
-  if (has_game_ended()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        8, this->game_ended(), target);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata Pong::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[16]);
+}
 
-  // optional .swarm.game.MonsterDied monster_died = 9;
-  if (has_monster_died()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        9, this->monster_died(), target);
-  }
+// ===================================================================
+
+class LockstepAttractor::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LockstepAttractor>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_radius(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+LockstepAttractor::LockstepAttractor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.LockstepAttractor)
+}
+LockstepAttractor::LockstepAttractor(const LockstepAttractor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LockstepAttractor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.radius_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.radius_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.radius_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.LockstepAttractor)
+}
+
+inline void LockstepAttractor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.radius_){0}
+  };
+}
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+LockstepAttractor::~LockstepAttractor() {
+  // @@protoc_insertion_point(destructor:swarm.game.LockstepAttractor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void LockstepAttractor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LockstepAttractor::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LockstepAttractor::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.LockstepAttractor)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.radius_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.radius_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LockstepAttractor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional sint32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint32 radius = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_radius(&has_bits);
+          _impl_.radius_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LockstepAttractor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.LockstepAttractor)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional sint32 x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional sint32 y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  // optional sint32 radius = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(3, this->_internal_radius(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.LockstepAttractor)
   return target;
 }
 
-int ServerMessage::ByteSize() const {
-  int total_size = 0;
+size_t LockstepAttractor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.LockstepAttractor)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .swarm.game.ServerMessage.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    // optional .swarm.game.GameStarted game_started = 2;
-    if (has_game_started()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->game_started());
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional sint32 x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_x());
     }
 
-    // optional .swarm.game.PlayerJoined player_joined = 3;
-    if (has_player_joined()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->player_joined());
+    // optional sint32 y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_y());
     }
 
-    // optional .swarm.game.PlayerLeft player_left = 4;
-    if (has_player_left()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->player_left());
-    }
-
-    // optional .swarm.game.SwarmState swarm_state = 5;
-    if (has_swarm_state()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->swarm_state());
-    }
-
-    // optional .swarm.game.PlayerState player_state = 6;
-    if (has_player_state()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->player_state());
-    }
-
-    // optional .swarm.game.PlayerDied player_died = 7;
-    if (has_player_died()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->player_died());
-    }
-
-    // optional .swarm.game.GameEnded game_ended = 8;
-    if (has_game_ended()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->game_ended());
+    // optional sint32 radius = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_radius());
     }
 
   }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    // optional .swarm.game.MonsterDied monster_died = 9;
-    if (has_monster_died()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->monster_died());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ServerMessage::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const ServerMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const ServerMessage*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LockstepAttractor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LockstepAttractor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LockstepAttractor::GetClassData() const { return &_class_data_; }
 
-void ServerMessage::MergeFrom(const ServerMessage& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_game_started()) {
-      mutable_game_started()->::swarm::game::GameStarted::MergeFrom(from.game_started());
-    }
-    if (from.has_player_joined()) {
-      mutable_player_joined()->::swarm::game::PlayerJoined::MergeFrom(from.player_joined());
-    }
-    if (from.has_player_left()) {
-      mutable_player_left()->::swarm::game::PlayerLeft::MergeFrom(from.player_left());
-    }
-    if (from.has_swarm_state()) {
-      mutable_swarm_state()->::swarm::game::SwarmState::MergeFrom(from.swarm_state());
-    }
-    if (from.has_player_state()) {
-      mutable_player_state()->::swarm::game::PlayerState::MergeFrom(from.player_state());
-    }
-    if (from.has_player_died()) {
-      mutable_player_died()->::swarm::game::PlayerDied::MergeFrom(from.player_died());
+
+void LockstepAttractor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LockstepAttractor*>(&to_msg);
+  auto& from = static_cast<const LockstepAttractor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.LockstepAttractor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
     }
-    if (from.has_game_ended()) {
-      mutable_game_ended()->::swarm::game::GameEnded::MergeFrom(from.game_ended());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
     }
-  }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_monster_died()) {
-      mutable_monster_died()->::swarm::game::MonsterDied::MergeFrom(from.monster_died());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.radius_ = from._impl_.radius_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void ServerMessage::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ServerMessage::CopyFrom(const ServerMessage& from) {
+void LockstepAttractor::CopyFrom(const LockstepAttractor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.LockstepAttractor)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ServerMessage::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+bool LockstepAttractor::IsInitialized() const {
   return true;
 }
 
-void ServerMessage::Swap(ServerMessage* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(game_started_, other->game_started_);
-    std::swap(player_joined_, other->player_joined_);
-    std::swap(player_left_, other->player_left_);
-    std::swap(swarm_state_, other->swarm_state_);
-    std::swap(player_state_, other->player_state_);
-    std::swap(player_died_, other->player_died_);
-    std::swap(game_ended_, other->game_ended_);
-    std::swap(monster_died_, other->monster_died_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void LockstepAttractor::InternalSwap(LockstepAttractor* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LockstepAttractor, _impl_.radius_)
+      + sizeof(LockstepAttractor::_impl_.radius_)
+      - PROTOBUF_FIELD_OFFSET(LockstepAttractor, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata ServerMessage::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ServerMessage_descriptor_;
-  metadata.reflection = ServerMessage_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata LockstepAttractor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[17]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* PlayerMessage_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerMessage_Type_descriptor_;
-}
-bool PlayerMessage_Type_IsValid(int value) {
-  switch(value) {
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
-  }
+class LockstepFrame::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LockstepFrame>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+LockstepFrame::LockstepFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.LockstepFrame)
+}
+LockstepFrame::LockstepFrame(const LockstepFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LockstepFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.removed_id_){from._impl_.removed_id_}
+    , decltype(_impl_.attractor_){from._impl_.attractor_}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.hash_, &from._impl_.hash_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_) -
+    reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.tick_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.LockstepFrame)
+}
+
+inline void LockstepFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.removed_id_){arena}
+    , decltype(_impl_.attractor_){arena}
+    , decltype(_impl_.hash_){uint64_t{0u}}
+    , decltype(_impl_.tick_){0u}
+  };
 }
 
-#ifndef _MSC_VER
-const PlayerMessage_Type PlayerMessage::PLAYER_POS;
-const PlayerMessage_Type PlayerMessage::PLAYER_CLICK;
-const PlayerMessage_Type PlayerMessage::Type_MIN;
-const PlayerMessage_Type PlayerMessage::Type_MAX;
-const int PlayerMessage::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int PlayerMessage::kTypeFieldNumber;
-const int PlayerMessage::kPosFieldNumber;
-const int PlayerMessage::kClickFieldNumber;
-#endif  // !_MSC_VER
-
-PlayerMessage::PlayerMessage()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+LockstepFrame::~LockstepFrame() {
+  // @@protoc_insertion_point(destructor:swarm.game.LockstepFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void PlayerMessage::InitAsDefaultInstance() {
-  pos_ = const_cast< ::swarm::game::Vector2*>(&::swarm::game::Vector2::default_instance());
-  click_ = const_cast< ::swarm::game::PlayerClick*>(&::swarm::game::PlayerClick::default_instance());
+inline void LockstepFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.removed_id_.~RepeatedField();
+  _impl_.attractor_.~RepeatedPtrField();
+}
+
+void LockstepFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LockstepFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.LockstepFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.removed_id_.Clear();
+  _impl_.attractor_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.hash_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tick_) -
+        reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.tick_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LockstepFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 removed_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_removed_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_removed_id(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .swarm.game.LockstepAttractor attractor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_attractor(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 hash = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_hash(&has_bits);
+          _impl_.hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LockstepFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.LockstepFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 tick = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  // repeated uint32 removed_id = 2;
+  for (int i = 0, n = this->_internal_removed_id_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_removed_id(i), target);
+  }
+
+  // repeated .swarm.game.LockstepAttractor attractor = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_attractor_size()); i < n; i++) {
+    const auto& repfield = this->_internal_attractor(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 hash = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.LockstepFrame)
+  return target;
 }
 
-PlayerMessage::PlayerMessage(const PlayerMessage& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
+size_t LockstepFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.LockstepFrame)
+  size_t total_size = 0;
 
-void PlayerMessage::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 1;
-  pos_ = NULL;
-  click_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-PlayerMessage::~PlayerMessage() {
-  SharedDtor();
-}
+  // repeated uint32 removed_id = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.removed_id_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_removed_id_size());
+    total_size += data_size;
+  }
 
-void PlayerMessage::SharedDtor() {
-  if (this != default_instance_) {
-    delete pos_;
-    delete click_;
+  // repeated .swarm.game.LockstepAttractor attractor = 3;
+  total_size += 1UL * this->_internal_attractor_size();
+  for (const auto& msg : this->_impl_.attractor_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-}
 
-void PlayerMessage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* PlayerMessage::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return PlayerMessage_descriptor_;
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint64 hash = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hash());
+    }
 
-const PlayerMessage& PlayerMessage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
+    // optional uint32 tick = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-PlayerMessage* PlayerMessage::default_instance_ = NULL;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LockstepFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LockstepFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LockstepFrame::GetClassData() const { return &_class_data_; }
 
-PlayerMessage* PlayerMessage::New() const {
-  return new PlayerMessage;
-}
 
-void PlayerMessage::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 1;
-    if (has_pos()) {
-      if (pos_ != NULL) pos_->::swarm::game::Vector2::Clear();
+void LockstepFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LockstepFrame*>(&to_msg);
+  auto& from = static_cast<const LockstepFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.LockstepFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.removed_id_.MergeFrom(from._impl_.removed_id_);
+  _this->_impl_.attractor_.MergeFrom(from._impl_.attractor_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.hash_ = from._impl_.hash_;
     }
-    if (has_click()) {
-      if (click_ != NULL) click_->::swarm::game::PlayerClick::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-bool PlayerMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .swarm.game.PlayerMessage.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::swarm::game::PlayerMessage_Type_IsValid(value)) {
-            set_type(static_cast< ::swarm::game::PlayerMessage_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_pos;
-        break;
-      }
-
-      // optional .swarm.game.Vector2 pos = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pos:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_pos()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_click;
-        break;
-      }
+void LockstepFrame::CopyFrom(const LockstepFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.LockstepFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-      // optional .swarm.game.PlayerClick click = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_click:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_click()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
+bool LockstepFrame::IsInitialized() const {
   return true;
-#undef DO_
 }
 
-void PlayerMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .swarm.game.PlayerMessage.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
-
-  // optional .swarm.game.Vector2 pos = 2;
-  if (has_pos()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->pos(), output);
-  }
-
-  // optional .swarm.game.PlayerClick click = 3;
-  if (has_click()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->click(), output);
-  }
+void LockstepFrame::InternalSwap(LockstepFrame* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.removed_id_.InternalSwap(&other->_impl_.removed_id_);
+  _impl_.attractor_.InternalSwap(&other->_impl_.attractor_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LockstepFrame, _impl_.tick_)
+      + sizeof(LockstepFrame::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(LockstepFrame, _impl_.hash_)>(
+          reinterpret_cast<char*>(&_impl_.hash_),
+          reinterpret_cast<char*>(&other->_impl_.hash_));
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata LockstepFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[18]);
 }
 
-::google::protobuf::uint8* PlayerMessage::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .swarm.game.PlayerMessage.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
+// ===================================================================
 
-  // optional .swarm.game.Vector2 pos = 2;
-  if (has_pos()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->pos(), target);
-  }
+class LockstepFrames::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LockstepFrames>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_server_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+LockstepFrames::LockstepFrames(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.LockstepFrames)
+}
+LockstepFrames::LockstepFrames(const LockstepFrames& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LockstepFrames* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.frame_){from._impl_.frame_}
+    , decltype(_impl_.server_time_){}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.server_time_, &from._impl_.server_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_) -
+    reinterpret_cast<char*>(&_impl_.server_time_)) + sizeof(_impl_.tick_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.LockstepFrames)
+}
+
+inline void LockstepFrames::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.frame_){arena}
+    , decltype(_impl_.server_time_){0}
+    , decltype(_impl_.tick_){0u}
+  };
+}
 
-  // optional .swarm.game.PlayerClick click = 3;
-  if (has_click()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->click(), target);
+LockstepFrames::~LockstepFrames() {
+  // @@protoc_insertion_point(destructor:swarm.game.LockstepFrames)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
+inline void LockstepFrames::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frame_.~RepeatedPtrField();
+}
+
+void LockstepFrames::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LockstepFrames::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.LockstepFrames)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frame_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.server_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tick_) -
+        reinterpret_cast<char*>(&_impl_.server_time_)) + sizeof(_impl_.tick_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LockstepFrames::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .swarm.game.LockstepFrame frame = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_frame(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 tick = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double server_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_server_time(&has_bits);
+          _impl_.server_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LockstepFrames::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.LockstepFrames)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .swarm.game.LockstepFrame frame = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_frame_size()); i < n; i++) {
+    const auto& repfield = this->_internal_frame(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 tick = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tick(), target);
+  }
+
+  // optional double server_time = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_server_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.LockstepFrames)
   return target;
 }
 
-int PlayerMessage::ByteSize() const {
-  int total_size = 0;
+size_t LockstepFrames::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.LockstepFrames)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .swarm.game.PlayerMessage.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    // optional .swarm.game.Vector2 pos = 2;
-    if (has_pos()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->pos());
+  // repeated .swarm.game.LockstepFrame frame = 1;
+  total_size += 1UL * this->_internal_frame_size();
+  for (const auto& msg : this->_impl_.frame_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional double server_time = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
     }
 
-    // optional .swarm.game.PlayerClick click = 3;
-    if (has_click()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->click());
+    // optional uint32 tick = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerMessage::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const PlayerMessage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const PlayerMessage*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LockstepFrames::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LockstepFrames::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LockstepFrames::GetClassData() const { return &_class_data_; }
 
-void PlayerMessage::MergeFrom(const PlayerMessage& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_pos()) {
-      mutable_pos()->::swarm::game::Vector2::MergeFrom(from.pos());
+
+void LockstepFrames::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LockstepFrames*>(&to_msg);
+  auto& from = static_cast<const LockstepFrames&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.LockstepFrames)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.frame_.MergeFrom(from._impl_.frame_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.server_time_ = from._impl_.server_time_;
     }
-    if (from.has_click()) {
-      mutable_click()->::swarm::game::PlayerClick::MergeFrom(from.click());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PlayerMessage::CopyFrom(const ::google::protobuf::Message& from) {
+void LockstepFrames::CopyFrom(const LockstepFrames& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.LockstepFrames)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PlayerMessage::CopyFrom(const PlayerMessage& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool PlayerMessage::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+bool LockstepFrames::IsInitialized() const {
   return true;
 }
 
-void PlayerMessage::Swap(PlayerMessage* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(pos_, other->pos_);
-    std::swap(click_, other->click_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void LockstepFrames::InternalSwap(LockstepFrames* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.frame_.InternalSwap(&other->_impl_.frame_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LockstepFrames, _impl_.tick_)
+      + sizeof(LockstepFrames::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(LockstepFrames, _impl_.server_time_)>(
+          reinterpret_cast<char*>(&_impl_.server_time_),
+          reinterpret_cast<char*>(&other->_impl_.server_time_));
 }
 
-::google::protobuf::Metadata PlayerMessage::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = PlayerMessage_descriptor_;
-  metadata.reflection = PlayerMessage_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata LockstepFrames::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[19]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Config::kMapNameFieldNumber;
-const int Config::kNumSwarmsFieldNumber;
-const int Config::kMonstersPerSwarmFieldNumber;
-const int Config::kMinPlayersFieldNumber;
-const int Config::kMaxPlayersFieldNumber;
-const int Config::kInitialHealthFieldNumber;
-#endif  // !_MSC_VER
+class ServerMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerMessage>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::swarm::game::GameStarted& game_started(const ServerMessage* msg);
+  static void set_has_game_started(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::PlayerJoined& player_joined(const ServerMessage* msg);
+  static void set_has_player_joined(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::PlayerLeft& player_left(const ServerMessage* msg);
+  static void set_has_player_left(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::swarm::game::SwarmState& swarm_state(const ServerMessage* msg);
+  static void set_has_swarm_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::swarm::game::PlayerState& player_state(const ServerMessage* msg);
+  static void set_has_player_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::swarm::game::PlayerDied& player_died(const ServerMessage* msg);
+  static void set_has_player_died(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::swarm::game::GameEnded& game_ended(const ServerMessage* msg);
+  static void set_has_game_ended(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::swarm::game::MonsterDied& monster_died(const ServerMessage* msg);
+  static void set_has_monster_died(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::swarm::game::Pong& pong(const ServerMessage* msg);
+  static void set_has_pong(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::swarm::game::LockstepFrames& lockstep_frames(const ServerMessage* msg);
+  static void set_has_lockstep_frames(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000400) ^ 0x00000400) != 0;
+  }
+};
 
-Config::Config()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::swarm::game::GameStarted&
+ServerMessage::_Internal::game_started(const ServerMessage* msg) {
+  return *msg->_impl_.game_started_;
 }
-
-void Config::InitAsDefaultInstance() {
+const ::swarm::game::PlayerJoined&
+ServerMessage::_Internal::player_joined(const ServerMessage* msg) {
+  return *msg->_impl_.player_joined_;
 }
-
-Config::Config(const Config& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::swarm::game::PlayerLeft&
+ServerMessage::_Internal::player_left(const ServerMessage* msg) {
+  return *msg->_impl_.player_left_;
 }
-
-void Config::SharedCtor() {
-  _cached_size_ = 0;
-  map_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  num_swarms_ = 5u;
-  monsters_per_swarm_ = 10u;
-  min_players_ = 2u;
-  max_players_ = 4u;
-  initial_health_ = 10u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::swarm::game::SwarmState&
+ServerMessage::_Internal::swarm_state(const ServerMessage* msg) {
+  return *msg->_impl_.swarm_state_;
 }
-
-Config::~Config() {
-  SharedDtor();
+const ::swarm::game::PlayerState&
+ServerMessage::_Internal::player_state(const ServerMessage* msg) {
+  return *msg->_impl_.player_state_;
 }
-
-void Config::SharedDtor() {
-  if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete map_name_;
-  }
-  if (this != default_instance_) {
-  }
+const ::swarm::game::PlayerDied&
+ServerMessage::_Internal::player_died(const ServerMessage* msg) {
+  return *msg->_impl_.player_died_;
 }
-
-void Config::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::swarm::game::GameEnded&
+ServerMessage::_Internal::game_ended(const ServerMessage* msg) {
+  return *msg->_impl_.game_ended_;
 }
-const ::google::protobuf::Descriptor* Config::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Config_descriptor_;
+const ::swarm::game::MonsterDied&
+ServerMessage::_Internal::monster_died(const ServerMessage* msg) {
+  return *msg->_impl_.monster_died_;
 }
-
-const Config& Config::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_game_2eproto();
-  return *default_instance_;
+const ::swarm::game::Pong&
+ServerMessage::_Internal::pong(const ServerMessage* msg) {
+  return *msg->_impl_.pong_;
 }
-
-Config* Config::default_instance_ = NULL;
-
-Config* Config::New() const {
-  return new Config;
+const ::swarm::game::LockstepFrames&
+ServerMessage::_Internal::lockstep_frames(const ServerMessage* msg) {
+  return *msg->_impl_.lockstep_frames_;
+}
+ServerMessage::ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.ServerMessage)
+}
+ServerMessage::ServerMessage(const ServerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.game_started_){nullptr}
+    , decltype(_impl_.player_joined_){nullptr}
+    , decltype(_impl_.player_left_){nullptr}
+    , decltype(_impl_.swarm_state_){nullptr}
+    , decltype(_impl_.player_state_){nullptr}
+    , decltype(_impl_.player_died_){nullptr}
+    , decltype(_impl_.game_ended_){nullptr}
+    , decltype(_impl_.monster_died_){nullptr}
+    , decltype(_impl_.pong_){nullptr}
+    , decltype(_impl_.lockstep_frames_){nullptr}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_game_started()) {
+    _this->_impl_.game_started_ = new ::swarm::game::GameStarted(*from._impl_.game_started_);
+  }
+  if (from._internal_has_player_joined()) {
+    _this->_impl_.player_joined_ = new ::swarm::game::PlayerJoined(*from._impl_.player_joined_);
+  }
+  if (from._internal_has_player_left()) {
+    _this->_impl_.player_left_ = new ::swarm::game::PlayerLeft(*from._impl_.player_left_);
+  }
+  if (from._internal_has_swarm_state()) {
+    _this->_impl_.swarm_state_ = new ::swarm::game::SwarmState(*from._impl_.swarm_state_);
+  }
+  if (from._internal_has_player_state()) {
+    _this->_impl_.player_state_ = new ::swarm::game::PlayerState(*from._impl_.player_state_);
+  }
+  if (from._internal_has_player_died()) {
+    _this->_impl_.player_died_ = new ::swarm::game::PlayerDied(*from._impl_.player_died_);
+  }
+  if (from._internal_has_game_ended()) {
+    _this->_impl_.game_ended_ = new ::swarm::game::GameEnded(*from._impl_.game_ended_);
+  }
+  if (from._internal_has_monster_died()) {
+    _this->_impl_.monster_died_ = new ::swarm::game::MonsterDied(*from._impl_.monster_died_);
+  }
+  if (from._internal_has_pong()) {
+    _this->_impl_.pong_ = new ::swarm::game::Pong(*from._impl_.pong_);
+  }
+  if (from._internal_has_lockstep_frames()) {
+    _this->_impl_.lockstep_frames_ = new ::swarm::game::LockstepFrames(*from._impl_.lockstep_frames_);
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.ServerMessage)
+}
+
+inline void ServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.game_started_){nullptr}
+    , decltype(_impl_.player_joined_){nullptr}
+    , decltype(_impl_.player_left_){nullptr}
+    , decltype(_impl_.swarm_state_){nullptr}
+    , decltype(_impl_.player_state_){nullptr}
+    , decltype(_impl_.player_died_){nullptr}
+    , decltype(_impl_.game_ended_){nullptr}
+    , decltype(_impl_.monster_died_){nullptr}
+    , decltype(_impl_.pong_){nullptr}
+    , decltype(_impl_.lockstep_frames_){nullptr}
+    , decltype(_impl_.type_){0}
+  };
 }
 
-void Config::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_map_name()) {
-      if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-        map_name_->clear();
-      }
-    }
-    num_swarms_ = 5u;
-    monsters_per_swarm_ = 10u;
-    min_players_ = 2u;
-    max_players_ = 4u;
-    initial_health_ = 10u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Config::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string map_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_map_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->map_name().data(), this->map_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_num_swarms;
-        break;
-      }
-
-      // optional uint32 num_swarms = 2 [default = 5];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_num_swarms:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &num_swarms_)));
-          set_has_num_swarms();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_monsters_per_swarm;
-        break;
-      }
-
-      // optional uint32 monsters_per_swarm = 3 [default = 10];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_monsters_per_swarm:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &monsters_per_swarm_)));
-          set_has_monsters_per_swarm();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_min_players;
-        break;
-      }
+ServerMessage::~ServerMessage() {
+  // @@protoc_insertion_point(destructor:swarm.game.ServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-      // optional uint32 min_players = 4 [default = 2];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_min_players:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &min_players_)));
-          set_has_min_players();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_max_players;
-        break;
-      }
+inline void ServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.game_started_;
+  if (this != internal_default_instance()) delete _impl_.player_joined_;
+  if (this != internal_default_instance()) delete _impl_.player_left_;
+  if (this != internal_default_instance()) delete _impl_.swarm_state_;
+  if (this != internal_default_instance()) delete _impl_.player_state_;
+  if (this != internal_default_instance()) delete _impl_.player_died_;
+  if (this != internal_default_instance()) delete _impl_.game_ended_;
+  if (this != internal_default_instance()) delete _impl_.monster_died_;
+  if (this != internal_default_instance()) delete _impl_.pong_;
+  if (this != internal_default_instance()) delete _impl_.lockstep_frames_;
+}
 
-      // optional uint32 max_players = 5 [default = 4];
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_max_players:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &max_players_)));
-          set_has_max_players();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(48)) goto parse_initial_health;
-        break;
-      }
+void ServerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-      // optional uint32 initial_health = 6 [default = 10];
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_initial_health:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &initial_health_)));
-          set_has_initial_health();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+void ServerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.ServerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.game_started_ != nullptr);
+      _impl_.game_started_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.player_joined_ != nullptr);
+      _impl_.player_joined_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.player_left_ != nullptr);
+      _impl_.player_left_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.swarm_state_ != nullptr);
+      _impl_.swarm_state_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.player_state_ != nullptr);
+      _impl_.player_state_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.player_died_ != nullptr);
+      _impl_.player_died_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.game_ended_ != nullptr);
+      _impl_.game_ended_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.monster_died_ != nullptr);
+      _impl_.monster_died_->Clear();
     }
   }
-  return true;
-#undef DO_
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.pong_ != nullptr);
+      _impl_.pong_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.lockstep_frames_ != nullptr);
+      _impl_.lockstep_frames_->Clear();
+    }
+  }
+  _impl_.type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Config::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string map_name = 1;
-  if (has_map_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->map_name().data(), this->map_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->map_name(), output);
+const char* ServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .swarm.game.ServerMessage.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::swarm::game::ServerMessage_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::swarm::game::ServerMessage_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.GameStarted game_started = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_started(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.PlayerJoined player_joined = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_joined(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.PlayerLeft player_left = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_left(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.SwarmState swarm_state = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_swarm_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.PlayerState player_state = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.PlayerDied player_died = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_player_died(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.GameEnded game_ended = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_ended(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.MonsterDied monster_died = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_monster_died(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.Pong pong = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pong(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.LockstepFrames lockstep_frames = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lockstep_frames(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.ServerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .swarm.game.ServerMessage.Type type = 1;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
-  // optional uint32 num_swarms = 2 [default = 5];
-  if (has_num_swarms()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->num_swarms(), output);
+  // optional .swarm.game.GameStarted game_started = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::game_started(this),
+        _Internal::game_started(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 monsters_per_swarm = 3 [default = 10];
-  if (has_monsters_per_swarm()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->monsters_per_swarm(), output);
+  // optional .swarm.game.PlayerJoined player_joined = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::player_joined(this),
+        _Internal::player_joined(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 min_players = 4 [default = 2];
-  if (has_min_players()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->min_players(), output);
+  // optional .swarm.game.PlayerLeft player_left = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::player_left(this),
+        _Internal::player_left(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 max_players = 5 [default = 4];
-  if (has_max_players()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->max_players(), output);
+  // optional .swarm.game.SwarmState swarm_state = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::swarm_state(this),
+        _Internal::swarm_state(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 initial_health = 6 [default = 10];
-  if (has_initial_health()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->initial_health(), output);
+  // optional .swarm.game.PlayerState player_state = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::player_state(this),
+        _Internal::player_state(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional .swarm.game.PlayerDied player_died = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::player_died(this),
+        _Internal::player_died(this).GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* Config::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string map_name = 1;
-  if (has_map_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->map_name().data(), this->map_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->map_name(), target);
+  // optional .swarm.game.GameEnded game_ended = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::game_ended(this),
+        _Internal::game_ended(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 num_swarms = 2 [default = 5];
-  if (has_num_swarms()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->num_swarms(), target);
+  // optional .swarm.game.MonsterDied monster_died = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::monster_died(this),
+        _Internal::monster_died(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 monsters_per_swarm = 3 [default = 10];
-  if (has_monsters_per_swarm()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->monsters_per_swarm(), target);
+  // optional .swarm.game.Pong pong = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::pong(this),
+        _Internal::pong(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 min_players = 4 [default = 2];
-  if (has_min_players()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->min_players(), target);
+  // optional .swarm.game.LockstepFrames lockstep_frames = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::lockstep_frames(this),
+        _Internal::lockstep_frames(this).GetCachedSize(), target, stream);
   }
 
-  // optional uint32 max_players = 5 [default = 4];
-  if (has_max_players()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->max_players(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.ServerMessage)
+  return target;
+}
 
-  // optional uint32 initial_health = 6 [default = 10];
-  if (has_initial_health()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->initial_health(), target);
-  }
+size_t ServerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.ServerMessage)
+  size_t total_size = 0;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // required .swarm.game.ServerMessage.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
-  return target;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-int Config::ByteSize() const {
-  int total_size = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .swarm.game.GameStarted game_started = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.game_started_);
+    }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string map_name = 1;
-    if (has_map_name()) {
+    // optional .swarm.game.PlayerJoined player_joined = 3;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->map_name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.player_joined_);
     }
 
-    // optional uint32 num_swarms = 2 [default = 5];
-    if (has_num_swarms()) {
+    // optional .swarm.game.PlayerLeft player_left = 4;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->num_swarms());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.player_left_);
     }
 
-    // optional uint32 monsters_per_swarm = 3 [default = 10];
-    if (has_monsters_per_swarm()) {
+    // optional .swarm.game.SwarmState swarm_state = 5;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->monsters_per_swarm());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.swarm_state_);
     }
 
-    // optional uint32 min_players = 4 [default = 2];
-    if (has_min_players()) {
+    // optional .swarm.game.PlayerState player_state = 6;
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->min_players());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.player_state_);
     }
 
-    // optional uint32 max_players = 5 [default = 4];
-    if (has_max_players()) {
+    // optional .swarm.game.PlayerDied player_died = 7;
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->max_players());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.player_died_);
     }
 
-    // optional uint32 initial_health = 6 [default = 10];
-    if (has_initial_health()) {
+    // optional .swarm.game.GameEnded game_ended = 8;
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->initial_health());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.game_ended_);
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+    // optional .swarm.game.MonsterDied monster_died = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.monster_died_);
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional .swarm.game.Pong pong = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pong_);
+    }
+
+    // optional .swarm.game.LockstepFrames lockstep_frames = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.lockstep_frames_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerMessage::GetClassData() const { return &_class_data_; }
+
+
+void ServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerMessage*>(&to_msg);
+  auto& from = static_cast<const ServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.ServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_game_started()->::swarm::game::GameStarted::MergeFrom(
+          from._internal_game_started());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_player_joined()->::swarm::game::PlayerJoined::MergeFrom(
+          from._internal_player_joined());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_player_left()->::swarm::game::PlayerLeft::MergeFrom(
+          from._internal_player_left());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_swarm_state()->::swarm::game::SwarmState::MergeFrom(
+          from._internal_swarm_state());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_player_state()->::swarm::game::PlayerState::MergeFrom(
+          from._internal_player_state());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_player_died()->::swarm::game::PlayerDied::MergeFrom(
+          from._internal_player_died());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_game_ended()->::swarm::game::GameEnded::MergeFrom(
+          from._internal_game_ended());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_monster_died()->::swarm::game::MonsterDied::MergeFrom(
+          from._internal_monster_died());
+    }
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_pong()->::swarm::game::Pong::MergeFrom(
+          from._internal_pong());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_lockstep_frames()->::swarm::game::LockstepFrames::MergeFrom(
+          from._internal_lockstep_frames());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerMessage::CopyFrom(const ServerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.ServerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerMessage::InternalSwap(ServerMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerMessage, _impl_.type_)
+      + sizeof(ServerMessage::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(ServerMessage, _impl_.game_started_)>(
+          reinterpret_cast<char*>(&_impl_.game_started_),
+          reinterpret_cast<char*>(&other->_impl_.game_started_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[20]);
+}
+
+// ===================================================================
+
+class PlayerMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerMessage>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::swarm::game::PlayerClick& click(const PlayerMessage* msg);
+  static void set_has_click(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::PlayerHello& hello(const PlayerMessage* msg);
+  static void set_has_hello(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::Ping& ping(const PlayerMessage* msg);
+  static void set_has_ping(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000008) ^ 0x00000008) != 0;
+  }
+};
+
+const ::swarm::game::PlayerClick&
+PlayerMessage::_Internal::click(const PlayerMessage* msg) {
+  return *msg->_impl_.click_;
+}
+const ::swarm::game::PlayerHello&
+PlayerMessage::_Internal::hello(const PlayerMessage* msg) {
+  return *msg->_impl_.hello_;
+}
+const ::swarm::game::Ping&
+PlayerMessage::_Internal::ping(const PlayerMessage* msg) {
+  return *msg->_impl_.ping_;
+}
+PlayerMessage::PlayerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.PlayerMessage)
+}
+PlayerMessage::PlayerMessage(const PlayerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.input_){from._impl_.input_}
+    , decltype(_impl_.click_){nullptr}
+    , decltype(_impl_.hello_){nullptr}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_click()) {
+    _this->_impl_.click_ = new ::swarm::game::PlayerClick(*from._impl_.click_);
+  }
+  if (from._internal_has_hello()) {
+    _this->_impl_.hello_ = new ::swarm::game::PlayerHello(*from._impl_.hello_);
+  }
+  if (from._internal_has_ping()) {
+    _this->_impl_.ping_ = new ::swarm::game::Ping(*from._impl_.ping_);
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.PlayerMessage)
+}
+
+inline void PlayerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.input_){arena}
+    , decltype(_impl_.click_){nullptr}
+    , decltype(_impl_.hello_){nullptr}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.type_){2}
+  };
+}
+
+PlayerMessage::~PlayerMessage() {
+  // @@protoc_insertion_point(destructor:swarm.game.PlayerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PlayerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.input_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.click_;
+  if (this != internal_default_instance()) delete _impl_.hello_;
+  if (this != internal_default_instance()) delete _impl_.ping_;
+}
+
+void PlayerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PlayerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.PlayerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.input_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.click_ != nullptr);
+      _impl_.click_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.hello_ != nullptr);
+      _impl_.hello_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.ping_ != nullptr);
+      _impl_.ping_->Clear();
+    }
+    _impl_.type_ = 2;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Config::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Config* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Config*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+const char* PlayerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .swarm.game.PlayerMessage.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::swarm::game::PlayerMessage_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::swarm::game::PlayerMessage_Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.PlayerClick click = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_click(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .swarm.game.PlayerInput input = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_input(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.PlayerHello hello = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hello(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.Ping ping = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.PlayerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .swarm.game.PlayerMessage.Type type = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional .swarm.game.PlayerClick click = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::click(this),
+        _Internal::click(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .swarm.game.PlayerInput input = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_input_size()); i < n; i++) {
+    const auto& repfield = this->_internal_input(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .swarm.game.PlayerHello hello = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::hello(this),
+        _Internal::hello(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .swarm.game.Ping ping = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::ping(this),
+        _Internal::ping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.PlayerMessage)
+  return target;
+}
+
+size_t PlayerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.PlayerMessage)
+  size_t total_size = 0;
+
+  // required .swarm.game.PlayerMessage.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .swarm.game.PlayerInput input = 4;
+  total_size += 1UL * this->_internal_input_size();
+  for (const auto& msg : this->_impl_.input_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .swarm.game.PlayerClick click = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.click_);
+    }
+
+    // optional .swarm.game.PlayerHello hello = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hello_);
+    }
+
+    // optional .swarm.game.Ping ping = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ping_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerMessage::GetClassData() const { return &_class_data_; }
+
+
+void PlayerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerMessage*>(&to_msg);
+  auto& from = static_cast<const PlayerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.PlayerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.input_.MergeFrom(from._impl_.input_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_click()->::swarm::game::PlayerClick::MergeFrom(
+          from._internal_click());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_hello()->::swarm::game::PlayerHello::MergeFrom(
+          from._internal_hello());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_ping()->::swarm::game::Ping::MergeFrom(
+          from._internal_ping());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PlayerMessage::CopyFrom(const PlayerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.PlayerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PlayerMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PlayerMessage::InternalSwap(PlayerMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.input_.InternalSwap(&other->_impl_.input_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerMessage, _impl_.ping_)
+      + sizeof(PlayerMessage::_impl_.ping_)
+      - PROTOBUF_FIELD_OFFSET(PlayerMessage, _impl_.click_)>(
+          reinterpret_cast<char*>(&_impl_.click_),
+          reinterpret_cast<char*>(&other->_impl_.click_));
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[21]);
+}
+
+// ===================================================================
+
+class Config::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Config>()._impl_._has_bits_);
+  static void set_has_map_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_swarms(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_monsters_per_swarm(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_min_players(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_max_players(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_initial_health(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_snapshot_interval_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_max_rewind_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_max_history_kb(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_dead_reckoning_tolerance(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_monster_refresh_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_client_bytes_per_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_udp_enabled(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_session_timeout_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_hello_timeout_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_initial_state_bytes_per_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_shared_snapshot_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_lockstep(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lockstep_hash_interval_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_monster_compression(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_aggregate_distance(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_aggregate_cell_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+};
+
+Config::Config(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.Config)
+}
+Config::Config(const Config& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Config* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.shared_snapshot_name_){}
+    , decltype(_impl_.max_history_kb_){}
+    , decltype(_impl_.lockstep_){}
+    , decltype(_impl_.monster_compression_){}
+    , decltype(_impl_.aggregate_distance_){}
+    , decltype(_impl_.num_swarms_){}
+    , decltype(_impl_.monsters_per_swarm_){}
+    , decltype(_impl_.min_players_){}
+    , decltype(_impl_.max_players_){}
+    , decltype(_impl_.initial_health_){}
+    , decltype(_impl_.snapshot_interval_ms_){}
+    , decltype(_impl_.max_rewind_ms_){}
+    , decltype(_impl_.dead_reckoning_tolerance_){}
+    , decltype(_impl_.monster_refresh_ms_){}
+    , decltype(_impl_.client_bytes_per_sec_){}
+    , decltype(_impl_.udp_enabled_){}
+    , decltype(_impl_.session_timeout_ms_){}
+    , decltype(_impl_.hello_timeout_ms_){}
+    , decltype(_impl_.initial_state_bytes_per_sec_){}
+    , decltype(_impl_.lockstep_hash_interval_ms_){}
+    , decltype(_impl_.aggregate_cell_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_map_name()) {
+    _this->_impl_.map_name_.Set(from._internal_map_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.shared_snapshot_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shared_snapshot_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_shared_snapshot_name()) {
+    _this->_impl_.shared_snapshot_name_.Set(from._internal_shared_snapshot_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.max_history_kb_, &from._impl_.max_history_kb_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.aggregate_cell_size_) -
+    reinterpret_cast<char*>(&_impl_.max_history_kb_)) + sizeof(_impl_.aggregate_cell_size_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.Config)
+}
+
+inline void Config::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.shared_snapshot_name_){}
+    , decltype(_impl_.max_history_kb_){0u}
+    , decltype(_impl_.lockstep_){false}
+    , decltype(_impl_.monster_compression_){0}
+    , decltype(_impl_.aggregate_distance_){0}
+    , decltype(_impl_.num_swarms_){5u}
+    , decltype(_impl_.monsters_per_swarm_){10u}
+    , decltype(_impl_.min_players_){2u}
+    , decltype(_impl_.max_players_){4u}
+    , decltype(_impl_.initial_health_){10u}
+    , decltype(_impl_.snapshot_interval_ms_){100u}
+    , decltype(_impl_.max_rewind_ms_){400u}
+    , decltype(_impl_.dead_reckoning_tolerance_){1}
+    , decltype(_impl_.monster_refresh_ms_){1000u}
+    , decltype(_impl_.client_bytes_per_sec_){64000u}
+    , decltype(_impl_.udp_enabled_){true}
+    , decltype(_impl_.session_timeout_ms_){30000u}
+    , decltype(_impl_.hello_timeout_ms_){5000u}
+    , decltype(_impl_.initial_state_bytes_per_sec_){256000u}
+    , decltype(_impl_.lockstep_hash_interval_ms_){1000u}
+    , decltype(_impl_.aggregate_cell_size_){64}
+  };
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.shared_snapshot_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shared_snapshot_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Config::~Config() {
+  // @@protoc_insertion_point(destructor:swarm.game.Config)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Config::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.map_name_.Destroy();
+  _impl_.shared_snapshot_name_.Destroy();
+}
+
+void Config::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Config::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.Config)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.map_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.shared_snapshot_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.max_history_kb_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.aggregate_distance_) -
+        reinterpret_cast<char*>(&_impl_.max_history_kb_)) + sizeof(_impl_.aggregate_distance_));
+    _impl_.num_swarms_ = 5u;
+    _impl_.monsters_per_swarm_ = 10u;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    _impl_.min_players_ = 2u;
+    _impl_.max_players_ = 4u;
+    _impl_.initial_health_ = 10u;
+    _impl_.snapshot_interval_ms_ = 100u;
+    _impl_.max_rewind_ms_ = 400u;
+    _impl_.dead_reckoning_tolerance_ = 1;
+    _impl_.monster_refresh_ms_ = 1000u;
+    _impl_.client_bytes_per_sec_ = 64000u;
+  }
+  if (cached_has_bits & 0x003f0000u) {
+    _impl_.udp_enabled_ = true;
+    _impl_.session_timeout_ms_ = 30000u;
+    _impl_.hello_timeout_ms_ = 5000u;
+    _impl_.initial_state_bytes_per_sec_ = 256000u;
+    _impl_.lockstep_hash_interval_ms_ = 1000u;
+    _impl_.aggregate_cell_size_ = 64;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Config::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string map_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_map_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "swarm.game.Config.map_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 num_swarms = 2 [default = 5];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_swarms(&has_bits);
+          _impl_.num_swarms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 monsters_per_swarm = 3 [default = 10];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_monsters_per_swarm(&has_bits);
+          _impl_.monsters_per_swarm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 min_players = 4 [default = 2];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_min_players(&has_bits);
+          _impl_.min_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 max_players = 5 [default = 4];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_max_players(&has_bits);
+          _impl_.max_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 initial_health = 6 [default = 10];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_initial_health(&has_bits);
+          _impl_.initial_health_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 snapshot_interval_ms = 7 [default = 100];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_snapshot_interval_ms(&has_bits);
+          _impl_.snapshot_interval_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 max_rewind_ms = 8 [default = 400];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_max_rewind_ms(&has_bits);
+          _impl_.max_rewind_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 max_history_kb = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_max_history_kb(&has_bits);
+          _impl_.max_history_kb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float dead_reckoning_tolerance = 10 [default = 1];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_dead_reckoning_tolerance(&has_bits);
+          _impl_.dead_reckoning_tolerance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 monster_refresh_ms = 11 [default = 1000];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_monster_refresh_ms(&has_bits);
+          _impl_.monster_refresh_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 client_bytes_per_sec = 12 [default = 64000];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_client_bytes_per_sec(&has_bits);
+          _impl_.client_bytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool udp_enabled = 13 [default = true];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_udp_enabled(&has_bits);
+          _impl_.udp_enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 session_timeout_ms = 14 [default = 30000];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_session_timeout_ms(&has_bits);
+          _impl_.session_timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hello_timeout_ms = 15 [default = 5000];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_hello_timeout_ms(&has_bits);
+          _impl_.hello_timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 initial_state_bytes_per_sec = 16 [default = 256000];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_initial_state_bytes_per_sec(&has_bits);
+          _impl_.initial_state_bytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string shared_snapshot_name = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          auto str = _internal_mutable_shared_snapshot_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "swarm.game.Config.shared_snapshot_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool lockstep = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_lockstep(&has_bits);
+          _impl_.lockstep_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 lockstep_hash_interval_ms = 19 [default = 1000];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_lockstep_hash_interval_ms(&has_bits);
+          _impl_.lockstep_hash_interval_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.Config.MonsterCompression monster_compression = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::swarm::game::Config_MonsterCompression_IsValid(val))) {
+            _internal_set_monster_compression(static_cast<::swarm::game::Config_MonsterCompression>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(20, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float aggregate_distance = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 173)) {
+          _Internal::set_has_aggregate_distance(&has_bits);
+          _impl_.aggregate_distance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float aggregate_cell_size = 22 [default = 64];
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 181)) {
+          _Internal::set_has_aggregate_cell_size(&has_bits);
+          _impl_.aggregate_cell_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Config::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.Config)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string map_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_map_name().data(), static_cast<int>(this->_internal_map_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "swarm.game.Config.map_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_map_name(), target);
+  }
+
+  // optional uint32 num_swarms = 2 [default = 5];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_num_swarms(), target);
+  }
+
+  // optional uint32 monsters_per_swarm = 3 [default = 10];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_monsters_per_swarm(), target);
+  }
+
+  // optional uint32 min_players = 4 [default = 2];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_min_players(), target);
+  }
+
+  // optional uint32 max_players = 5 [default = 4];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_max_players(), target);
+  }
+
+  // optional uint32 initial_health = 6 [default = 10];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_initial_health(), target);
+  }
+
+  // optional uint32 snapshot_interval_ms = 7 [default = 100];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_snapshot_interval_ms(), target);
+  }
+
+  // optional uint32 max_rewind_ms = 8 [default = 400];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_max_rewind_ms(), target);
+  }
+
+  // optional uint32 max_history_kb = 9;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_max_history_kb(), target);
+  }
+
+  // optional float dead_reckoning_tolerance = 10 [default = 1];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_dead_reckoning_tolerance(), target);
+  }
+
+  // optional uint32 monster_refresh_ms = 11 [default = 1000];
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_monster_refresh_ms(), target);
+  }
+
+  // optional uint32 client_bytes_per_sec = 12 [default = 64000];
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_client_bytes_per_sec(), target);
+  }
+
+  // optional bool udp_enabled = 13 [default = true];
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_udp_enabled(), target);
+  }
+
+  // optional uint32 session_timeout_ms = 14 [default = 30000];
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(14, this->_internal_session_timeout_ms(), target);
+  }
+
+  // optional uint32 hello_timeout_ms = 15 [default = 5000];
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_hello_timeout_ms(), target);
+  }
+
+  // optional uint32 initial_state_bytes_per_sec = 16 [default = 256000];
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(16, this->_internal_initial_state_bytes_per_sec(), target);
+  }
+
+  // optional string shared_snapshot_name = 17;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_shared_snapshot_name().data(), static_cast<int>(this->_internal_shared_snapshot_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "swarm.game.Config.shared_snapshot_name");
+    target = stream->WriteStringMaybeAliased(
+        17, this->_internal_shared_snapshot_name(), target);
+  }
+
+  // optional bool lockstep = 18;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(18, this->_internal_lockstep(), target);
+  }
+
+  // optional uint32 lockstep_hash_interval_ms = 19 [default = 1000];
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(19, this->_internal_lockstep_hash_interval_ms(), target);
+  }
+
+  // optional .swarm.game.Config.MonsterCompression monster_compression = 20;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      20, this->_internal_monster_compression(), target);
+  }
+
+  // optional float aggregate_distance = 21;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(21, this->_internal_aggregate_distance(), target);
+  }
+
+  // optional float aggregate_cell_size = 22 [default = 64];
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(22, this->_internal_aggregate_cell_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.Config)
+  return target;
+}
+
+size_t Config::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.Config)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string map_name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_map_name());
+    }
+
+    // optional string shared_snapshot_name = 17;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_shared_snapshot_name());
+    }
+
+    // optional uint32 max_history_kb = 9;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_history_kb());
+    }
+
+    // optional bool lockstep = 18;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 + 1;
+    }
+
+    // optional .swarm.game.Config.MonsterCompression monster_compression = 20;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_monster_compression());
+    }
+
+    // optional float aggregate_distance = 21;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 + 4;
+    }
+
+    // optional uint32 num_swarms = 2 [default = 5];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_swarms());
+    }
+
+    // optional uint32 monsters_per_swarm = 3 [default = 10];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_monsters_per_swarm());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional uint32 min_players = 4 [default = 2];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_min_players());
+    }
+
+    // optional uint32 max_players = 5 [default = 4];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_players());
+    }
+
+    // optional uint32 initial_health = 6 [default = 10];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_initial_health());
+    }
+
+    // optional uint32 snapshot_interval_ms = 7 [default = 100];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_snapshot_interval_ms());
+    }
+
+    // optional uint32 max_rewind_ms = 8 [default = 400];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_rewind_ms());
+    }
+
+    // optional float dead_reckoning_tolerance = 10 [default = 1];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 monster_refresh_ms = 11 [default = 1000];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_monster_refresh_ms());
+    }
+
+    // optional uint32 client_bytes_per_sec = 12 [default = 64000];
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_bytes_per_sec());
+    }
+
+  }
+  if (cached_has_bits & 0x003f0000u) {
+    // optional bool udp_enabled = 13 [default = true];
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 session_timeout_ms = 14 [default = 30000];
+    if (cached_has_bits & 0x00020000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_session_timeout_ms());
+    }
+
+    // optional uint32 hello_timeout_ms = 15 [default = 5000];
+    if (cached_has_bits & 0x00040000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hello_timeout_ms());
+    }
+
+    // optional uint32 initial_state_bytes_per_sec = 16 [default = 256000];
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_initial_state_bytes_per_sec());
+    }
+
+    // optional uint32 lockstep_hash_interval_ms = 19 [default = 1000];
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_lockstep_hash_interval_ms());
+    }
+
+    // optional float aggregate_cell_size = 22 [default = 64];
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 + 4;
+    }
+
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Config::MergeFrom(const Config& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_map_name()) {
-      set_map_name(from.map_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Config::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Config::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Config::GetClassData() const { return &_class_data_; }
+
+
+void Config::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Config*>(&to_msg);
+  auto& from = static_cast<const Config&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.Config)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_map_name(from._internal_map_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_shared_snapshot_name(from._internal_shared_snapshot_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_history_kb_ = from._impl_.max_history_kb_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lockstep_ = from._impl_.lockstep_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.monster_compression_ = from._impl_.monster_compression_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.aggregate_distance_ = from._impl_.aggregate_distance_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.num_swarms_ = from._impl_.num_swarms_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.monsters_per_swarm_ = from._impl_.monsters_per_swarm_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.min_players_ = from._impl_.min_players_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.max_players_ = from._impl_.max_players_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.initial_health_ = from._impl_.initial_health_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.snapshot_interval_ms_ = from._impl_.snapshot_interval_ms_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.max_rewind_ms_ = from._impl_.max_rewind_ms_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.dead_reckoning_tolerance_ = from._impl_.dead_reckoning_tolerance_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.monster_refresh_ms_ = from._impl_.monster_refresh_ms_;
     }
-    if (from.has_num_swarms()) {
-      set_num_swarms(from.num_swarms());
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.client_bytes_per_sec_ = from._impl_.client_bytes_per_sec_;
     }
-    if (from.has_monsters_per_swarm()) {
-      set_monsters_per_swarm(from.monsters_per_swarm());
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x003f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.udp_enabled_ = from._impl_.udp_enabled_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.session_timeout_ms_ = from._impl_.session_timeout_ms_;
     }
-    if (from.has_min_players()) {
-      set_min_players(from.min_players());
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.hello_timeout_ms_ = from._impl_.hello_timeout_ms_;
     }
-    if (from.has_max_players()) {
-      set_max_players(from.max_players());
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.initial_state_bytes_per_sec_ = from._impl_.initial_state_bytes_per_sec_;
     }
-    if (from.has_initial_health()) {
-      set_initial_health(from.initial_health());
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.lockstep_hash_interval_ms_ = from._impl_.lockstep_hash_interval_ms_;
     }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.aggregate_cell_size_ = from._impl_.aggregate_cell_size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Config::CopyFrom(const ::google::protobuf::Message& from) {
+void Config::CopyFrom(const Config& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.Config)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Config::CopyFrom(const Config& from) {
+bool Config::IsInitialized() const {
+  return true;
+}
+
+void Config::InternalSwap(Config* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.map_name_, lhs_arena,
+      &other->_impl_.map_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.shared_snapshot_name_, lhs_arena,
+      &other->_impl_.shared_snapshot_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Config, _impl_.aggregate_distance_)
+      + sizeof(Config::_impl_.aggregate_distance_)
+      - PROTOBUF_FIELD_OFFSET(Config, _impl_.max_history_kb_)>(
+          reinterpret_cast<char*>(&_impl_.max_history_kb_),
+          reinterpret_cast<char*>(&other->_impl_.max_history_kb_));
+  swap(_impl_.num_swarms_, other->_impl_.num_swarms_);
+  swap(_impl_.monsters_per_swarm_, other->_impl_.monsters_per_swarm_);
+  swap(_impl_.min_players_, other->_impl_.min_players_);
+  swap(_impl_.max_players_, other->_impl_.max_players_);
+  swap(_impl_.initial_health_, other->_impl_.initial_health_);
+  swap(_impl_.snapshot_interval_ms_, other->_impl_.snapshot_interval_ms_);
+  swap(_impl_.max_rewind_ms_, other->_impl_.max_rewind_ms_);
+  swap(_impl_.dead_reckoning_tolerance_, other->_impl_.dead_reckoning_tolerance_);
+  swap(_impl_.monster_refresh_ms_, other->_impl_.monster_refresh_ms_);
+  swap(_impl_.client_bytes_per_sec_, other->_impl_.client_bytes_per_sec_);
+  swap(_impl_.udp_enabled_, other->_impl_.udp_enabled_);
+  swap(_impl_.session_timeout_ms_, other->_impl_.session_timeout_ms_);
+  swap(_impl_.hello_timeout_ms_, other->_impl_.hello_timeout_ms_);
+  swap(_impl_.initial_state_bytes_per_sec_, other->_impl_.initial_state_bytes_per_sec_);
+  swap(_impl_.lockstep_hash_interval_ms_, other->_impl_.lockstep_hash_interval_ms_);
+  swap(_impl_.aggregate_cell_size_, other->_impl_.aggregate_cell_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Config::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[22]);
+}
+
+// ===================================================================
+
+class LinkConditions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LinkConditions>()._impl_._has_bits_);
+  static void set_has_delay_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_jitter_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_jitter_distribution(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_loss(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_loss_burst(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_reorder(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_reorder_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_duplicate(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_bytes_per_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_queue_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+LinkConditions::LinkConditions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.LinkConditions)
+}
+LinkConditions::LinkConditions(const LinkConditions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LinkConditions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.delay_ms_){}
+    , decltype(_impl_.jitter_ms_){}
+    , decltype(_impl_.loss_){}
+    , decltype(_impl_.loss_burst_){}
+    , decltype(_impl_.reorder_){}
+    , decltype(_impl_.duplicate_){}
+    , decltype(_impl_.bytes_per_sec_){}
+    , decltype(_impl_.queue_ms_){}
+    , decltype(_impl_.jitter_distribution_){}
+    , decltype(_impl_.reorder_ms_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.delay_ms_, &from._impl_.delay_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.reorder_ms_) -
+    reinterpret_cast<char*>(&_impl_.delay_ms_)) + sizeof(_impl_.reorder_ms_));
+  // @@protoc_insertion_point(copy_constructor:swarm.game.LinkConditions)
+}
+
+inline void LinkConditions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.delay_ms_){0u}
+    , decltype(_impl_.jitter_ms_){0u}
+    , decltype(_impl_.loss_){0}
+    , decltype(_impl_.loss_burst_){0}
+    , decltype(_impl_.reorder_){0}
+    , decltype(_impl_.duplicate_){0}
+    , decltype(_impl_.bytes_per_sec_){0u}
+    , decltype(_impl_.queue_ms_){200u}
+    , decltype(_impl_.jitter_distribution_){1}
+    , decltype(_impl_.reorder_ms_){20u}
+  };
+}
+
+LinkConditions::~LinkConditions() {
+  // @@protoc_insertion_point(destructor:swarm.game.LinkConditions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LinkConditions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LinkConditions::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LinkConditions::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.LinkConditions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.delay_ms_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bytes_per_sec_) -
+        reinterpret_cast<char*>(&_impl_.delay_ms_)) + sizeof(_impl_.bytes_per_sec_));
+    _impl_.queue_ms_ = 200u;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    _impl_.jitter_distribution_ = 1;
+    _impl_.reorder_ms_ = 20u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LinkConditions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 delay_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_delay_ms(&has_bits);
+          _impl_.delay_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 jitter_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_jitter_ms(&has_bits);
+          _impl_.jitter_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.LinkConditions.Distribution jitter_distribution = 3 [default = NORMAL];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::swarm::game::LinkConditions_Distribution_IsValid(val))) {
+            _internal_set_jitter_distribution(static_cast<::swarm::game::LinkConditions_Distribution>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float loss = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_loss(&has_bits);
+          _impl_.loss_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float loss_burst = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_loss_burst(&has_bits);
+          _impl_.loss_burst_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float reorder = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_reorder(&has_bits);
+          _impl_.reorder_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 reorder_ms = 7 [default = 20];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_reorder_ms(&has_bits);
+          _impl_.reorder_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float duplicate = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_duplicate(&has_bits);
+          _impl_.duplicate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bytes_per_sec = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_bytes_per_sec(&has_bits);
+          _impl_.bytes_per_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 queue_ms = 10 [default = 200];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_queue_ms(&has_bits);
+          _impl_.queue_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LinkConditions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.LinkConditions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 delay_ms = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_delay_ms(), target);
+  }
+
+  // optional uint32 jitter_ms = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_jitter_ms(), target);
+  }
+
+  // optional .swarm.game.LinkConditions.Distribution jitter_distribution = 3 [default = NORMAL];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_jitter_distribution(), target);
+  }
+
+  // optional float loss = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_loss(), target);
+  }
+
+  // optional float loss_burst = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_loss_burst(), target);
+  }
+
+  // optional float reorder = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_reorder(), target);
+  }
+
+  // optional uint32 reorder_ms = 7 [default = 20];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_reorder_ms(), target);
+  }
+
+  // optional float duplicate = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_duplicate(), target);
+  }
+
+  // optional uint32 bytes_per_sec = 9;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_bytes_per_sec(), target);
+  }
+
+  // optional uint32 queue_ms = 10 [default = 200];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_queue_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.LinkConditions)
+  return target;
+}
+
+size_t LinkConditions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.LinkConditions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional uint32 delay_ms = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_delay_ms());
+    }
+
+    // optional uint32 jitter_ms = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_jitter_ms());
+    }
+
+    // optional float loss = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float loss_burst = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float reorder = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float duplicate = 8;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 bytes_per_sec = 9;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bytes_per_sec());
+    }
+
+    // optional uint32 queue_ms = 10 [default = 200];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_queue_ms());
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional .swarm.game.LinkConditions.Distribution jitter_distribution = 3 [default = NORMAL];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_jitter_distribution());
+    }
+
+    // optional uint32 reorder_ms = 7 [default = 20];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_reorder_ms());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LinkConditions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LinkConditions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LinkConditions::GetClassData() const { return &_class_data_; }
+
+
+void LinkConditions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LinkConditions*>(&to_msg);
+  auto& from = static_cast<const LinkConditions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.LinkConditions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.delay_ms_ = from._impl_.delay_ms_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.jitter_ms_ = from._impl_.jitter_ms_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.loss_ = from._impl_.loss_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.loss_burst_ = from._impl_.loss_burst_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.reorder_ = from._impl_.reorder_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.duplicate_ = from._impl_.duplicate_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.bytes_per_sec_ = from._impl_.bytes_per_sec_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.queue_ms_ = from._impl_.queue_ms_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.jitter_distribution_ = from._impl_.jitter_distribution_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.reorder_ms_ = from._impl_.reorder_ms_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LinkConditions::CopyFrom(const LinkConditions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.LinkConditions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Config::IsInitialized() const {
+bool LinkConditions::IsInitialized() const {
+  return true;
+}
+
+void LinkConditions::InternalSwap(LinkConditions* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LinkConditions, _impl_.bytes_per_sec_)
+      + sizeof(LinkConditions::_impl_.bytes_per_sec_)
+      - PROTOBUF_FIELD_OFFSET(LinkConditions, _impl_.delay_ms_)>(
+          reinterpret_cast<char*>(&_impl_.delay_ms_),
+          reinterpret_cast<char*>(&other->_impl_.delay_ms_));
+  swap(_impl_.queue_ms_, other->_impl_.queue_ms_);
+  swap(_impl_.jitter_distribution_, other->_impl_.jitter_distribution_);
+  swap(_impl_.reorder_ms_, other->_impl_.reorder_ms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LinkConditions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[23]);
+}
+
+// ===================================================================
+
+class LinkScriptStep::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LinkScriptStep>()._impl_._has_bits_);
+  static void set_has_at(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::swarm::game::LinkConditions& up(const LinkScriptStep* msg);
+  static void set_has_up(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::swarm::game::LinkConditions& down(const LinkScriptStep* msg);
+  static void set_has_down(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::swarm::game::LinkConditions& both(const LinkScriptStep* msg);
+  static void set_has_both(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::swarm::game::LinkConditions&
+LinkScriptStep::_Internal::up(const LinkScriptStep* msg) {
+  return *msg->_impl_.up_;
+}
+const ::swarm::game::LinkConditions&
+LinkScriptStep::_Internal::down(const LinkScriptStep* msg) {
+  return *msg->_impl_.down_;
+}
+const ::swarm::game::LinkConditions&
+LinkScriptStep::_Internal::both(const LinkScriptStep* msg) {
+  return *msg->_impl_.both_;
+}
+LinkScriptStep::LinkScriptStep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.LinkScriptStep)
+}
+LinkScriptStep::LinkScriptStep(const LinkScriptStep& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LinkScriptStep* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.up_){nullptr}
+    , decltype(_impl_.down_){nullptr}
+    , decltype(_impl_.both_){nullptr}
+    , decltype(_impl_.at_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_up()) {
+    _this->_impl_.up_ = new ::swarm::game::LinkConditions(*from._impl_.up_);
+  }
+  if (from._internal_has_down()) {
+    _this->_impl_.down_ = new ::swarm::game::LinkConditions(*from._impl_.down_);
+  }
+  if (from._internal_has_both()) {
+    _this->_impl_.both_ = new ::swarm::game::LinkConditions(*from._impl_.both_);
+  }
+  _this->_impl_.at_ = from._impl_.at_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.LinkScriptStep)
+}
+
+inline void LinkScriptStep::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.up_){nullptr}
+    , decltype(_impl_.down_){nullptr}
+    , decltype(_impl_.both_){nullptr}
+    , decltype(_impl_.at_){0}
+  };
+}
+
+LinkScriptStep::~LinkScriptStep() {
+  // @@protoc_insertion_point(destructor:swarm.game.LinkScriptStep)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LinkScriptStep::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.up_;
+  if (this != internal_default_instance()) delete _impl_.down_;
+  if (this != internal_default_instance()) delete _impl_.both_;
+}
+
+void LinkScriptStep::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LinkScriptStep::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.LinkScriptStep)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.up_ != nullptr);
+      _impl_.up_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.down_ != nullptr);
+      _impl_.down_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.both_ != nullptr);
+      _impl_.both_->Clear();
+    }
+  }
+  _impl_.at_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LinkScriptStep::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float at = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_at(&has_bits);
+          _impl_.at_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.LinkConditions up = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_up(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.LinkConditions down = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_down(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .swarm.game.LinkConditions both = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_both(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LinkScriptStep::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.LinkScriptStep)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float at = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_at(), target);
+  }
+
+  // optional .swarm.game.LinkConditions up = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::up(this),
+        _Internal::up(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .swarm.game.LinkConditions down = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::down(this),
+        _Internal::down(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .swarm.game.LinkConditions both = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::both(this),
+        _Internal::both(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.LinkScriptStep)
+  return target;
+}
+
+size_t LinkScriptStep::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.LinkScriptStep)
+  size_t total_size = 0;
 
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .swarm.game.LinkConditions up = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.up_);
+    }
+
+    // optional .swarm.game.LinkConditions down = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.down_);
+    }
+
+    // optional .swarm.game.LinkConditions both = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.both_);
+    }
+
+    // optional float at = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LinkScriptStep::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LinkScriptStep::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LinkScriptStep::GetClassData() const { return &_class_data_; }
+
+
+void LinkScriptStep::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LinkScriptStep*>(&to_msg);
+  auto& from = static_cast<const LinkScriptStep&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.LinkScriptStep)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_up()->::swarm::game::LinkConditions::MergeFrom(
+          from._internal_up());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_down()->::swarm::game::LinkConditions::MergeFrom(
+          from._internal_down());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_both()->::swarm::game::LinkConditions::MergeFrom(
+          from._internal_both());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.at_ = from._impl_.at_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LinkScriptStep::CopyFrom(const LinkScriptStep& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.LinkScriptStep)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LinkScriptStep::IsInitialized() const {
   return true;
 }
 
-void Config::Swap(Config* other) {
-  if (other != this) {
-    std::swap(map_name_, other->map_name_);
-    std::swap(num_swarms_, other->num_swarms_);
-    std::swap(monsters_per_swarm_, other->monsters_per_swarm_);
-    std::swap(min_players_, other->min_players_);
-    std::swap(max_players_, other->max_players_);
-    std::swap(initial_health_, other->initial_health_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+void LinkScriptStep::InternalSwap(LinkScriptStep* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LinkScriptStep, _impl_.at_)
+      + sizeof(LinkScriptStep::_impl_.at_)
+      - PROTOBUF_FIELD_OFFSET(LinkScriptStep, _impl_.up_)>(
+          reinterpret_cast<char*>(&_impl_.up_),
+          reinterpret_cast<char*>(&other->_impl_.up_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LinkScriptStep::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[24]);
+}
+
+// ===================================================================
+
+class LinkScript::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LinkScript>()._impl_._has_bits_);
+  static void set_has_repeat_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+LinkScript::LinkScript(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:swarm.game.LinkScript)
+}
+LinkScript::LinkScript(const LinkScript& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LinkScript* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.step_){from._impl_.step_}
+    , decltype(_impl_.repeat_after_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.repeat_after_ = from._impl_.repeat_after_;
+  // @@protoc_insertion_point(copy_constructor:swarm.game.LinkScript)
+}
+
+inline void LinkScript::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.step_){arena}
+    , decltype(_impl_.repeat_after_){0}
+  };
+}
+
+LinkScript::~LinkScript() {
+  // @@protoc_insertion_point(destructor:swarm.game.LinkScript)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata Config::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Config_descriptor_;
-  metadata.reflection = Config_reflection_;
-  return metadata;
+inline void LinkScript::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.step_.~RepeatedPtrField();
+}
+
+void LinkScript::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LinkScript::Clear() {
+// @@protoc_insertion_point(message_clear_start:swarm.game.LinkScript)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.step_.Clear();
+  _impl_.repeat_after_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LinkScript::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .swarm.game.LinkScriptStep step = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_step(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float repeat_after = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_repeat_after(&has_bits);
+          _impl_.repeat_after_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LinkScript::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:swarm.game.LinkScript)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .swarm.game.LinkScriptStep step = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_step_size()); i < n; i++) {
+    const auto& repfield = this->_internal_step(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float repeat_after = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_repeat_after(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:swarm.game.LinkScript)
+  return target;
 }
 
+size_t LinkScript::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:swarm.game.LinkScript)
+  size_t total_size = 0;
 
-// @@protoc_insertion_point(namespace_scope)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .swarm.game.LinkScriptStep step = 1;
+  total_size += 1UL * this->_internal_step_size();
+  for (const auto& msg : this->_impl_.step_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional float repeat_after = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LinkScript::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LinkScript::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LinkScript::GetClassData() const { return &_class_data_; }
+
+
+void LinkScript::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LinkScript*>(&to_msg);
+  auto& from = static_cast<const LinkScript&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:swarm.game.LinkScript)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.step_.MergeFrom(from._impl_.step_);
+  if (from._internal_has_repeat_after()) {
+    _this->_internal_set_repeat_after(from._internal_repeat_after());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LinkScript::CopyFrom(const LinkScript& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:swarm.game.LinkScript)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LinkScript::IsInitialized() const {
+  return true;
+}
+
+void LinkScript::InternalSwap(LinkScript* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.step_.InternalSwap(&other->_impl_.step_);
+  swap(_impl_.repeat_after_, other->_impl_.repeat_after_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LinkScript::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_game_2eproto_getter, &descriptor_table_game_2eproto_once,
+      file_level_metadata_game_2eproto[25]);
+}
 
+// @@protoc_insertion_point(namespace_scope)
 }  // namespace game
 }  // namespace swarm
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::swarm::game::Vector2*
+Arena::CreateMaybeMessage< ::swarm::game::Vector2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::Vector2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerJoined*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerJoined >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerJoined >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerLeft*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerLeft >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerLeft >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::Monster*
+Arena::CreateMaybeMessage< ::swarm::game::Monster >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::Monster >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::SwarmAggregate*
+Arena::CreateMaybeMessage< ::swarm::game::SwarmAggregate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::SwarmAggregate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::SwarmState*
+Arena::CreateMaybeMessage< ::swarm::game::SwarmState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::SwarmState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::Player*
+Arena::CreateMaybeMessage< ::swarm::game::Player >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::Player >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerClick*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerClick >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerClick >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerInput*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerInput >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerInput >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerHello*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerHello >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerHello >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerState*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::GameStarted*
+Arena::CreateMaybeMessage< ::swarm::game::GameStarted >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::GameStarted >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::GameEnded*
+Arena::CreateMaybeMessage< ::swarm::game::GameEnded >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::GameEnded >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerDied*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerDied >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerDied >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::MonsterDied*
+Arena::CreateMaybeMessage< ::swarm::game::MonsterDied >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::MonsterDied >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::Ping*
+Arena::CreateMaybeMessage< ::swarm::game::Ping >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::Ping >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::Pong*
+Arena::CreateMaybeMessage< ::swarm::game::Pong >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::Pong >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::LockstepAttractor*
+Arena::CreateMaybeMessage< ::swarm::game::LockstepAttractor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::LockstepAttractor >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::LockstepFrame*
+Arena::CreateMaybeMessage< ::swarm::game::LockstepFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::LockstepFrame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::LockstepFrames*
+Arena::CreateMaybeMessage< ::swarm::game::LockstepFrames >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::LockstepFrames >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::ServerMessage*
+Arena::CreateMaybeMessage< ::swarm::game::ServerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::ServerMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::PlayerMessage*
+Arena::CreateMaybeMessage< ::swarm::game::PlayerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::PlayerMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::Config*
+Arena::CreateMaybeMessage< ::swarm::game::Config >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::Config >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::LinkConditions*
+Arena::CreateMaybeMessage< ::swarm::game::LinkConditions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::LinkConditions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::LinkScriptStep*
+Arena::CreateMaybeMessage< ::swarm::game::LinkScriptStep >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::LinkScriptStep >(arena);
+}
+template<> PROTOBUF_NOINLINE ::swarm::game::LinkScript*
+Arena::CreateMaybeMessage< ::swarm::game::LinkScript >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::swarm::game::LinkScript >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
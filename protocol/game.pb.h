@@ -1,57 +1,164 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: game.proto
 
-#ifndef PROTOBUF_game_2eproto__INCLUDED
-#define PROTOBUF_game_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_game_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_game_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_game_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_game_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_game_2eproto;
 namespace swarm {
 namespace game {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_game_2eproto();
-void protobuf_AssignDesc_game_2eproto();
-void protobuf_ShutdownFile_game_2eproto();
-
-class Vector2;
-class PlayerJoined;
-class PlayerLeft;
+class Config;
+struct ConfigDefaultTypeInternal;
+extern ConfigDefaultTypeInternal _Config_default_instance_;
+class GameEnded;
+struct GameEndedDefaultTypeInternal;
+extern GameEndedDefaultTypeInternal _GameEnded_default_instance_;
+class GameStarted;
+struct GameStartedDefaultTypeInternal;
+extern GameStartedDefaultTypeInternal _GameStarted_default_instance_;
+class LinkConditions;
+struct LinkConditionsDefaultTypeInternal;
+extern LinkConditionsDefaultTypeInternal _LinkConditions_default_instance_;
+class LinkScript;
+struct LinkScriptDefaultTypeInternal;
+extern LinkScriptDefaultTypeInternal _LinkScript_default_instance_;
+class LinkScriptStep;
+struct LinkScriptStepDefaultTypeInternal;
+extern LinkScriptStepDefaultTypeInternal _LinkScriptStep_default_instance_;
+class LockstepAttractor;
+struct LockstepAttractorDefaultTypeInternal;
+extern LockstepAttractorDefaultTypeInternal _LockstepAttractor_default_instance_;
+class LockstepFrame;
+struct LockstepFrameDefaultTypeInternal;
+extern LockstepFrameDefaultTypeInternal _LockstepFrame_default_instance_;
+class LockstepFrames;
+struct LockstepFramesDefaultTypeInternal;
+extern LockstepFramesDefaultTypeInternal _LockstepFrames_default_instance_;
 class Monster;
-class SwarmState;
+struct MonsterDefaultTypeInternal;
+extern MonsterDefaultTypeInternal _Monster_default_instance_;
+class MonsterDied;
+struct MonsterDiedDefaultTypeInternal;
+extern MonsterDiedDefaultTypeInternal _MonsterDied_default_instance_;
+class Ping;
+struct PingDefaultTypeInternal;
+extern PingDefaultTypeInternal _Ping_default_instance_;
 class Player;
+struct PlayerDefaultTypeInternal;
+extern PlayerDefaultTypeInternal _Player_default_instance_;
 class PlayerClick;
-class PlayerState;
-class GameStarted;
-class GameEnded;
+struct PlayerClickDefaultTypeInternal;
+extern PlayerClickDefaultTypeInternal _PlayerClick_default_instance_;
 class PlayerDied;
-class MonsterDied;
-class ServerMessage;
+struct PlayerDiedDefaultTypeInternal;
+extern PlayerDiedDefaultTypeInternal _PlayerDied_default_instance_;
+class PlayerHello;
+struct PlayerHelloDefaultTypeInternal;
+extern PlayerHelloDefaultTypeInternal _PlayerHello_default_instance_;
+class PlayerInput;
+struct PlayerInputDefaultTypeInternal;
+extern PlayerInputDefaultTypeInternal _PlayerInput_default_instance_;
+class PlayerJoined;
+struct PlayerJoinedDefaultTypeInternal;
+extern PlayerJoinedDefaultTypeInternal _PlayerJoined_default_instance_;
+class PlayerLeft;
+struct PlayerLeftDefaultTypeInternal;
+extern PlayerLeftDefaultTypeInternal _PlayerLeft_default_instance_;
 class PlayerMessage;
-class Config;
+struct PlayerMessageDefaultTypeInternal;
+extern PlayerMessageDefaultTypeInternal _PlayerMessage_default_instance_;
+class PlayerState;
+struct PlayerStateDefaultTypeInternal;
+extern PlayerStateDefaultTypeInternal _PlayerState_default_instance_;
+class Pong;
+struct PongDefaultTypeInternal;
+extern PongDefaultTypeInternal _Pong_default_instance_;
+class ServerMessage;
+struct ServerMessageDefaultTypeInternal;
+extern ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+class SwarmAggregate;
+struct SwarmAggregateDefaultTypeInternal;
+extern SwarmAggregateDefaultTypeInternal _SwarmAggregate_default_instance_;
+class SwarmState;
+struct SwarmStateDefaultTypeInternal;
+extern SwarmStateDefaultTypeInternal _SwarmState_default_instance_;
+class Vector2;
+struct Vector2DefaultTypeInternal;
+extern Vector2DefaultTypeInternal _Vector2_default_instance_;
+}  // namespace game
+}  // namespace swarm
+PROTOBUF_NAMESPACE_OPEN
+template<> ::swarm::game::Config* Arena::CreateMaybeMessage<::swarm::game::Config>(Arena*);
+template<> ::swarm::game::GameEnded* Arena::CreateMaybeMessage<::swarm::game::GameEnded>(Arena*);
+template<> ::swarm::game::GameStarted* Arena::CreateMaybeMessage<::swarm::game::GameStarted>(Arena*);
+template<> ::swarm::game::LinkConditions* Arena::CreateMaybeMessage<::swarm::game::LinkConditions>(Arena*);
+template<> ::swarm::game::LinkScript* Arena::CreateMaybeMessage<::swarm::game::LinkScript>(Arena*);
+template<> ::swarm::game::LinkScriptStep* Arena::CreateMaybeMessage<::swarm::game::LinkScriptStep>(Arena*);
+template<> ::swarm::game::LockstepAttractor* Arena::CreateMaybeMessage<::swarm::game::LockstepAttractor>(Arena*);
+template<> ::swarm::game::LockstepFrame* Arena::CreateMaybeMessage<::swarm::game::LockstepFrame>(Arena*);
+template<> ::swarm::game::LockstepFrames* Arena::CreateMaybeMessage<::swarm::game::LockstepFrames>(Arena*);
+template<> ::swarm::game::Monster* Arena::CreateMaybeMessage<::swarm::game::Monster>(Arena*);
+template<> ::swarm::game::MonsterDied* Arena::CreateMaybeMessage<::swarm::game::MonsterDied>(Arena*);
+template<> ::swarm::game::Ping* Arena::CreateMaybeMessage<::swarm::game::Ping>(Arena*);
+template<> ::swarm::game::Player* Arena::CreateMaybeMessage<::swarm::game::Player>(Arena*);
+template<> ::swarm::game::PlayerClick* Arena::CreateMaybeMessage<::swarm::game::PlayerClick>(Arena*);
+template<> ::swarm::game::PlayerDied* Arena::CreateMaybeMessage<::swarm::game::PlayerDied>(Arena*);
+template<> ::swarm::game::PlayerHello* Arena::CreateMaybeMessage<::swarm::game::PlayerHello>(Arena*);
+template<> ::swarm::game::PlayerInput* Arena::CreateMaybeMessage<::swarm::game::PlayerInput>(Arena*);
+template<> ::swarm::game::PlayerJoined* Arena::CreateMaybeMessage<::swarm::game::PlayerJoined>(Arena*);
+template<> ::swarm::game::PlayerLeft* Arena::CreateMaybeMessage<::swarm::game::PlayerLeft>(Arena*);
+template<> ::swarm::game::PlayerMessage* Arena::CreateMaybeMessage<::swarm::game::PlayerMessage>(Arena*);
+template<> ::swarm::game::PlayerState* Arena::CreateMaybeMessage<::swarm::game::PlayerState>(Arena*);
+template<> ::swarm::game::Pong* Arena::CreateMaybeMessage<::swarm::game::Pong>(Arena*);
+template<> ::swarm::game::ServerMessage* Arena::CreateMaybeMessage<::swarm::game::ServerMessage>(Arena*);
+template<> ::swarm::game::SwarmAggregate* Arena::CreateMaybeMessage<::swarm::game::SwarmAggregate>(Arena*);
+template<> ::swarm::game::SwarmState* Arena::CreateMaybeMessage<::swarm::game::SwarmState>(Arena*);
+template<> ::swarm::game::Vector2* Arena::CreateMaybeMessage<::swarm::game::Vector2>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace swarm {
+namespace game {
 
-enum ServerMessage_Type {
+enum ServerMessage_Type : int {
   ServerMessage_Type_GAME_STARTED = 0,
   ServerMessage_Type_PLAYER_JOINED = 1,
   ServerMessage_Type_PLAYER_LEFT = 2,
@@ -59,3276 +166,12200 @@ enum ServerMessage_Type {
   ServerMessage_Type_PLAYER_STATE = 4,
   ServerMessage_Type_PLAYER_DIED = 5,
   ServerMessage_Type_GAME_ENDED = 6,
-  ServerMessage_Type_MONSTER_DIED = 7
+  ServerMessage_Type_MONSTER_DIED = 7,
+  ServerMessage_Type_PONG = 8,
+  ServerMessage_Type_LOCKSTEP_FRAMES = 9
 };
 bool ServerMessage_Type_IsValid(int value);
-const ServerMessage_Type ServerMessage_Type_Type_MIN = ServerMessage_Type_GAME_STARTED;
-const ServerMessage_Type ServerMessage_Type_Type_MAX = ServerMessage_Type_MONSTER_DIED;
-const int ServerMessage_Type_Type_ARRAYSIZE = ServerMessage_Type_Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ServerMessage_Type_descriptor();
-inline const ::std::string& ServerMessage_Type_Name(ServerMessage_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ServerMessage_Type_descriptor(), value);
+constexpr ServerMessage_Type ServerMessage_Type_Type_MIN = ServerMessage_Type_GAME_STARTED;
+constexpr ServerMessage_Type ServerMessage_Type_Type_MAX = ServerMessage_Type_LOCKSTEP_FRAMES;
+constexpr int ServerMessage_Type_Type_ARRAYSIZE = ServerMessage_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ServerMessage_Type_descriptor();
+template<typename T>
+inline const std::string& ServerMessage_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ServerMessage_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ServerMessage_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ServerMessage_Type_descriptor(), enum_t_value);
 }
 inline bool ServerMessage_Type_Parse(
-    const ::std::string& name, ServerMessage_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ServerMessage_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ServerMessage_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ServerMessage_Type>(
     ServerMessage_Type_descriptor(), name, value);
 }
-enum PlayerMessage_Type {
-  PlayerMessage_Type_PLAYER_POS = 1,
-  PlayerMessage_Type_PLAYER_CLICK = 2
+enum PlayerMessage_Type : int {
+  PlayerMessage_Type_PLAYER_CLICK = 2,
+  PlayerMessage_Type_PLAYER_INPUT = 3,
+  PlayerMessage_Type_PLAYER_HELLO = 4,
+  PlayerMessage_Type_PLAYER_PING = 5
 };
 bool PlayerMessage_Type_IsValid(int value);
-const PlayerMessage_Type PlayerMessage_Type_Type_MIN = PlayerMessage_Type_PLAYER_POS;
-const PlayerMessage_Type PlayerMessage_Type_Type_MAX = PlayerMessage_Type_PLAYER_CLICK;
-const int PlayerMessage_Type_Type_ARRAYSIZE = PlayerMessage_Type_Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* PlayerMessage_Type_descriptor();
-inline const ::std::string& PlayerMessage_Type_Name(PlayerMessage_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    PlayerMessage_Type_descriptor(), value);
+constexpr PlayerMessage_Type PlayerMessage_Type_Type_MIN = PlayerMessage_Type_PLAYER_CLICK;
+constexpr PlayerMessage_Type PlayerMessage_Type_Type_MAX = PlayerMessage_Type_PLAYER_PING;
+constexpr int PlayerMessage_Type_Type_ARRAYSIZE = PlayerMessage_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PlayerMessage_Type_descriptor();
+template<typename T>
+inline const std::string& PlayerMessage_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PlayerMessage_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PlayerMessage_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PlayerMessage_Type_descriptor(), enum_t_value);
 }
 inline bool PlayerMessage_Type_Parse(
-    const ::std::string& name, PlayerMessage_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<PlayerMessage_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PlayerMessage_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PlayerMessage_Type>(
     PlayerMessage_Type_descriptor(), name, value);
 }
+enum Config_MonsterCompression : int {
+  Config_MonsterCompression_UNCOMPRESSED = 0,
+  Config_MonsterCompression_ID_ORDER = 1,
+  Config_MonsterCompression_SPATIAL_ORDER = 2
+};
+bool Config_MonsterCompression_IsValid(int value);
+constexpr Config_MonsterCompression Config_MonsterCompression_MonsterCompression_MIN = Config_MonsterCompression_UNCOMPRESSED;
+constexpr Config_MonsterCompression Config_MonsterCompression_MonsterCompression_MAX = Config_MonsterCompression_SPATIAL_ORDER;
+constexpr int Config_MonsterCompression_MonsterCompression_ARRAYSIZE = Config_MonsterCompression_MonsterCompression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Config_MonsterCompression_descriptor();
+template<typename T>
+inline const std::string& Config_MonsterCompression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Config_MonsterCompression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Config_MonsterCompression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Config_MonsterCompression_descriptor(), enum_t_value);
+}
+inline bool Config_MonsterCompression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Config_MonsterCompression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Config_MonsterCompression>(
+    Config_MonsterCompression_descriptor(), name, value);
+}
+enum LinkConditions_Distribution : int {
+  LinkConditions_Distribution_UNIFORM = 0,
+  LinkConditions_Distribution_NORMAL = 1,
+  LinkConditions_Distribution_PARETO = 2
+};
+bool LinkConditions_Distribution_IsValid(int value);
+constexpr LinkConditions_Distribution LinkConditions_Distribution_Distribution_MIN = LinkConditions_Distribution_UNIFORM;
+constexpr LinkConditions_Distribution LinkConditions_Distribution_Distribution_MAX = LinkConditions_Distribution_PARETO;
+constexpr int LinkConditions_Distribution_Distribution_ARRAYSIZE = LinkConditions_Distribution_Distribution_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LinkConditions_Distribution_descriptor();
+template<typename T>
+inline const std::string& LinkConditions_Distribution_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LinkConditions_Distribution>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LinkConditions_Distribution_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LinkConditions_Distribution_descriptor(), enum_t_value);
+}
+inline bool LinkConditions_Distribution_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LinkConditions_Distribution* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LinkConditions_Distribution>(
+    LinkConditions_Distribution_descriptor(), name, value);
+}
 // ===================================================================
 
-class Vector2 : public ::google::protobuf::Message {
+class Vector2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.Vector2) */ {
  public:
-  Vector2();
-  virtual ~Vector2();
+  inline Vector2() : Vector2(nullptr) {}
+  ~Vector2() override;
+  explicit PROTOBUF_CONSTEXPR Vector2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Vector2(const Vector2& from);
+  Vector2(Vector2&& from) noexcept
+    : Vector2() {
+    *this = ::std::move(from);
+  }
 
   inline Vector2& operator=(const Vector2& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Vector2& operator=(Vector2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Vector2& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Vector2& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Vector2* internal_default_instance() {
+    return reinterpret_cast<const Vector2*>(
+               &_Vector2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Vector2* other);
+  friend void swap(Vector2& a, Vector2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Vector2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Vector2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Vector2* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Vector2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Vector2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Vector2& from);
-  void MergeFrom(const Vector2& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Vector2& from) {
+    Vector2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Vector2* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.Vector2";
+  }
+  protected:
+  explicit Vector2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+  };
   // optional float x = 1;
-  inline bool has_x() const;
-  inline void clear_x();
-  static const int kXFieldNumber = 1;
-  inline float x() const;
-  inline void set_x(float value);
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  float x() const;
+  void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
 
   // optional float y = 2;
-  inline bool has_y() const;
-  inline void clear_y();
-  static const int kYFieldNumber = 2;
-  inline float y() const;
-  inline void set_y(float value);
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  float y() const;
+  void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:swarm.game.Vector2)
  private:
-  inline void set_has_x();
-  inline void clear_has_x();
-  inline void set_has_y();
-  inline void clear_has_y();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  float x_;
-  float y_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static Vector2* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float x_;
+    float y_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerJoined : public ::google::protobuf::Message {
+class PlayerJoined final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerJoined) */ {
  public:
-  PlayerJoined();
-  virtual ~PlayerJoined();
+  inline PlayerJoined() : PlayerJoined(nullptr) {}
+  ~PlayerJoined() override;
+  explicit PROTOBUF_CONSTEXPR PlayerJoined(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayerJoined(const PlayerJoined& from);
+  PlayerJoined(PlayerJoined&& from) noexcept
+    : PlayerJoined() {
+    *this = ::std::move(from);
+  }
 
   inline PlayerJoined& operator=(const PlayerJoined& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerJoined& operator=(PlayerJoined&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerJoined& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerJoined& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerJoined* internal_default_instance() {
+    return reinterpret_cast<const PlayerJoined*>(
+               &_PlayerJoined_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(PlayerJoined* other);
+  friend void swap(PlayerJoined& a, PlayerJoined& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerJoined* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerJoined* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PlayerJoined* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  PlayerJoined* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerJoined>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerJoined& from);
-  void MergeFrom(const PlayerJoined& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerJoined& from) {
+    PlayerJoined::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerJoined* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerJoined";
+  }
+  protected:
+  explicit PlayerJoined(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kIdFieldNumber = 2,
+  };
   // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // optional uint32 id = 2;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 2;
-  inline ::google::protobuf::uint32 id() const;
-  inline void set_id(::google::protobuf::uint32 value);
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:swarm.game.PlayerJoined)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::google::protobuf::uint32 id_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static PlayerJoined* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerLeft : public ::google::protobuf::Message {
+class PlayerLeft final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerLeft) */ {
  public:
-  PlayerLeft();
-  virtual ~PlayerLeft();
+  inline PlayerLeft() : PlayerLeft(nullptr) {}
+  ~PlayerLeft() override;
+  explicit PROTOBUF_CONSTEXPR PlayerLeft(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayerLeft(const PlayerLeft& from);
+  PlayerLeft(PlayerLeft&& from) noexcept
+    : PlayerLeft() {
+    *this = ::std::move(from);
+  }
 
   inline PlayerLeft& operator=(const PlayerLeft& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerLeft& operator=(PlayerLeft&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerLeft& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerLeft& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerLeft* internal_default_instance() {
+    return reinterpret_cast<const PlayerLeft*>(
+               &_PlayerLeft_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(PlayerLeft* other);
+  friend void swap(PlayerLeft& a, PlayerLeft& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerLeft* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerLeft* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PlayerLeft* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  PlayerLeft* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerLeft>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerLeft& from);
-  void MergeFrom(const PlayerLeft& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerLeft& from) {
+    PlayerLeft::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerLeft* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerLeft";
+  }
+  protected:
+  explicit PlayerLeft(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kIdFieldNumber = 2,
+  };
   // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // optional uint32 id = 2;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 2;
-  inline ::google::protobuf::uint32 id() const;
-  inline void set_id(::google::protobuf::uint32 value);
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:swarm.game.PlayerLeft)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  ::google::protobuf::uint32 id_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static PlayerLeft* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Monster : public ::google::protobuf::Message {
+class Monster final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.Monster) */ {
  public:
-  Monster();
-  virtual ~Monster();
+  inline Monster() : Monster(nullptr) {}
+  ~Monster() override;
+  explicit PROTOBUF_CONSTEXPR Monster(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Monster(const Monster& from);
+  Monster(Monster&& from) noexcept
+    : Monster() {
+    *this = ::std::move(from);
+  }
 
   inline Monster& operator=(const Monster& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Monster& operator=(Monster&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Monster& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Monster& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Monster* internal_default_instance() {
+    return reinterpret_cast<const Monster*>(
+               &_Monster_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(Monster* other);
+  friend void swap(Monster& a, Monster& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Monster* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Monster* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Monster* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Monster* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Monster>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Monster& from);
-  void MergeFrom(const Monster& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Monster& from) {
+    Monster::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Monster* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.Monster";
+  }
+  protected:
+  explicit Monster(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFixedStateFieldNumber = 6,
+    kAccFieldNumber = 1,
+    kVelFieldNumber = 2,
+    kPosFieldNumber = 3,
+    kSizeFieldNumber = 4,
+    kIdFieldNumber = 5,
+  };
+  // repeated sint32 fixed_state = 6 [packed = true];
+  int fixed_state_size() const;
+  private:
+  int _internal_fixed_state_size() const;
+  public:
+  void clear_fixed_state();
+  private:
+  int32_t _internal_fixed_state(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_fixed_state() const;
+  void _internal_add_fixed_state(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_fixed_state();
+  public:
+  int32_t fixed_state(int index) const;
+  void set_fixed_state(int index, int32_t value);
+  void add_fixed_state(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      fixed_state() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_fixed_state();
+
   // optional .swarm.game.Vector2 acc = 1;
-  inline bool has_acc() const;
-  inline void clear_acc();
-  static const int kAccFieldNumber = 1;
-  inline const ::swarm::game::Vector2& acc() const;
-  inline ::swarm::game::Vector2* mutable_acc();
-  inline ::swarm::game::Vector2* release_acc();
-  inline void set_allocated_acc(::swarm::game::Vector2* acc);
+  bool has_acc() const;
+  private:
+  bool _internal_has_acc() const;
+  public:
+  void clear_acc();
+  const ::swarm::game::Vector2& acc() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_acc();
+  ::swarm::game::Vector2* mutable_acc();
+  void set_allocated_acc(::swarm::game::Vector2* acc);
+  private:
+  const ::swarm::game::Vector2& _internal_acc() const;
+  ::swarm::game::Vector2* _internal_mutable_acc();
+  public:
+  void unsafe_arena_set_allocated_acc(
+      ::swarm::game::Vector2* acc);
+  ::swarm::game::Vector2* unsafe_arena_release_acc();
 
   // optional .swarm.game.Vector2 vel = 2;
-  inline bool has_vel() const;
-  inline void clear_vel();
-  static const int kVelFieldNumber = 2;
-  inline const ::swarm::game::Vector2& vel() const;
-  inline ::swarm::game::Vector2* mutable_vel();
-  inline ::swarm::game::Vector2* release_vel();
-  inline void set_allocated_vel(::swarm::game::Vector2* vel);
+  bool has_vel() const;
+  private:
+  bool _internal_has_vel() const;
+  public:
+  void clear_vel();
+  const ::swarm::game::Vector2& vel() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_vel();
+  ::swarm::game::Vector2* mutable_vel();
+  void set_allocated_vel(::swarm::game::Vector2* vel);
+  private:
+  const ::swarm::game::Vector2& _internal_vel() const;
+  ::swarm::game::Vector2* _internal_mutable_vel();
+  public:
+  void unsafe_arena_set_allocated_vel(
+      ::swarm::game::Vector2* vel);
+  ::swarm::game::Vector2* unsafe_arena_release_vel();
 
   // optional .swarm.game.Vector2 pos = 3;
-  inline bool has_pos() const;
-  inline void clear_pos();
-  static const int kPosFieldNumber = 3;
-  inline const ::swarm::game::Vector2& pos() const;
-  inline ::swarm::game::Vector2* mutable_pos();
-  inline ::swarm::game::Vector2* release_pos();
-  inline void set_allocated_pos(::swarm::game::Vector2* pos);
+  bool has_pos() const;
+  private:
+  bool _internal_has_pos() const;
+  public:
+  void clear_pos();
+  const ::swarm::game::Vector2& pos() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_pos();
+  ::swarm::game::Vector2* mutable_pos();
+  void set_allocated_pos(::swarm::game::Vector2* pos);
+  private:
+  const ::swarm::game::Vector2& _internal_pos() const;
+  ::swarm::game::Vector2* _internal_mutable_pos();
+  public:
+  void unsafe_arena_set_allocated_pos(
+      ::swarm::game::Vector2* pos);
+  ::swarm::game::Vector2* unsafe_arena_release_pos();
 
   // optional float size = 4;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 4;
-  inline float size() const;
-  inline void set_size(float value);
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  float size() const;
+  void set_size(float value);
+  private:
+  float _internal_size() const;
+  void _internal_set_size(float value);
+  public:
+
+  // optional uint32 id = 5;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:swarm.game.Monster)
  private:
-  inline void set_has_acc();
-  inline void clear_has_acc();
-  inline void set_has_vel();
-  inline void clear_has_vel();
-  inline void set_has_pos();
-  inline void clear_has_pos();
-  inline void set_has_size();
-  inline void clear_has_size();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::swarm::game::Vector2* acc_;
-  ::swarm::game::Vector2* vel_;
-  ::swarm::game::Vector2* pos_;
-  float size_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static Monster* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > fixed_state_;
+    mutable std::atomic<int> _fixed_state_cached_byte_size_;
+    ::swarm::game::Vector2* acc_;
+    ::swarm::game::Vector2* vel_;
+    ::swarm::game::Vector2* pos_;
+    float size_;
+    uint32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SwarmState : public ::google::protobuf::Message {
+class SwarmAggregate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.SwarmAggregate) */ {
  public:
-  SwarmState();
-  virtual ~SwarmState();
-
-  SwarmState(const SwarmState& from);
+  inline SwarmAggregate() : SwarmAggregate(nullptr) {}
+  ~SwarmAggregate() override;
+  explicit PROTOBUF_CONSTEXPR SwarmAggregate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SwarmAggregate(const SwarmAggregate& from);
+  SwarmAggregate(SwarmAggregate&& from) noexcept
+    : SwarmAggregate() {
+    *this = ::std::move(from);
+  }
 
-  inline SwarmState& operator=(const SwarmState& from) {
+  inline SwarmAggregate& operator=(const SwarmAggregate& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SwarmAggregate& operator=(SwarmAggregate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SwarmState& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SwarmAggregate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SwarmAggregate* internal_default_instance() {
+    return reinterpret_cast<const SwarmAggregate*>(
+               &_SwarmAggregate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(SwarmState* other);
+  friend void swap(SwarmAggregate& a, SwarmAggregate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SwarmAggregate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SwarmAggregate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SwarmState* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SwarmState& from);
-  void MergeFrom(const SwarmState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  SwarmAggregate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SwarmAggregate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SwarmAggregate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SwarmAggregate& from) {
+    SwarmAggregate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SwarmAggregate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.SwarmAggregate";
+  }
+  protected:
+  explicit SwarmAggregate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .swarm.game.Monster monster = 1;
-  inline int monster_size() const;
-  inline void clear_monster();
-  static const int kMonsterFieldNumber = 1;
-  inline const ::swarm::game::Monster& monster(int index) const;
-  inline ::swarm::game::Monster* mutable_monster(int index);
-  inline ::swarm::game::Monster* add_monster();
-  inline const ::google::protobuf::RepeatedPtrField< ::swarm::game::Monster >&
-      monster() const;
-  inline ::google::protobuf::RepeatedPtrField< ::swarm::game::Monster >*
-      mutable_monster();
-
-  // @@protoc_insertion_point(class_scope:swarm.game.SwarmState)
- private:
+  enum : int {
+    kPosFieldNumber = 2,
+    kVelFieldNumber = 3,
+    kIdFieldNumber = 1,
+    kExtentFieldNumber = 4,
+    kCountFieldNumber = 5,
+  };
+  // optional .swarm.game.Vector2 pos = 2;
+  bool has_pos() const;
+  private:
+  bool _internal_has_pos() const;
+  public:
+  void clear_pos();
+  const ::swarm::game::Vector2& pos() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_pos();
+  ::swarm::game::Vector2* mutable_pos();
+  void set_allocated_pos(::swarm::game::Vector2* pos);
+  private:
+  const ::swarm::game::Vector2& _internal_pos() const;
+  ::swarm::game::Vector2* _internal_mutable_pos();
+  public:
+  void unsafe_arena_set_allocated_pos(
+      ::swarm::game::Vector2* pos);
+  ::swarm::game::Vector2* unsafe_arena_release_pos();
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // optional .swarm.game.Vector2 vel = 3;
+  bool has_vel() const;
+  private:
+  bool _internal_has_vel() const;
+  public:
+  void clear_vel();
+  const ::swarm::game::Vector2& vel() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_vel();
+  ::swarm::game::Vector2* mutable_vel();
+  void set_allocated_vel(::swarm::game::Vector2* vel);
+  private:
+  const ::swarm::game::Vector2& _internal_vel() const;
+  ::swarm::game::Vector2* _internal_mutable_vel();
+  public:
+  void unsafe_arena_set_allocated_vel(
+      ::swarm::game::Vector2* vel);
+  ::swarm::game::Vector2* unsafe_arena_release_vel();
 
-  ::google::protobuf::RepeatedPtrField< ::swarm::game::Monster > monster_;
+  // optional uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional float extent = 4;
+  bool has_extent() const;
+  private:
+  bool _internal_has_extent() const;
+  public:
+  void clear_extent();
+  float extent() const;
+  void set_extent(float value);
+  private:
+  float _internal_extent() const;
+  void _internal_set_extent(float value);
+  public:
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // optional uint32 count = 5;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static SwarmState* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.SwarmAggregate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::swarm::game::Vector2* pos_;
+    ::swarm::game::Vector2* vel_;
+    uint32_t id_;
+    float extent_;
+    uint32_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Player : public ::google::protobuf::Message {
+class SwarmState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.SwarmState) */ {
  public:
-  Player();
-  virtual ~Player();
+  inline SwarmState() : SwarmState(nullptr) {}
+  ~SwarmState() override;
+  explicit PROTOBUF_CONSTEXPR SwarmState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Player(const Player& from);
+  SwarmState(const SwarmState& from);
+  SwarmState(SwarmState&& from) noexcept
+    : SwarmState() {
+    *this = ::std::move(from);
+  }
 
-  inline Player& operator=(const Player& from) {
+  inline SwarmState& operator=(const SwarmState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SwarmState& operator=(SwarmState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Player& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SwarmState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SwarmState* internal_default_instance() {
+    return reinterpret_cast<const SwarmState*>(
+               &_SwarmState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(Player* other);
+  friend void swap(SwarmState& a, SwarmState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SwarmState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SwarmState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Player* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Player& from);
-  void MergeFrom(const Player& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  SwarmState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SwarmState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SwarmState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SwarmState& from) {
+    SwarmState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SwarmState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.SwarmState";
+  }
+  protected:
+  explicit SwarmState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional uint32 id = 1;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 id() const;
-  inline void set_id(::google::protobuf::uint32 value);
+  enum : int {
+    kMonsterFieldNumber = 1,
+    kRemovedIdFieldNumber = 5,
+    kAggregateFieldNumber = 9,
+    kPackedMonstersFieldNumber = 8,
+    kServerTimeFieldNumber = 3,
+    kTickFieldNumber = 2,
+    kFullFieldNumber = 4,
+    kChunkFieldNumber = 6,
+    kNumChunksFieldNumber = 7,
+  };
+  // repeated .swarm.game.Monster monster = 1;
+  int monster_size() const;
+  private:
+  int _internal_monster_size() const;
+  public:
+  void clear_monster();
+  ::swarm::game::Monster* mutable_monster(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Monster >*
+      mutable_monster();
+  private:
+  const ::swarm::game::Monster& _internal_monster(int index) const;
+  ::swarm::game::Monster* _internal_add_monster();
+  public:
+  const ::swarm::game::Monster& monster(int index) const;
+  ::swarm::game::Monster* add_monster();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Monster >&
+      monster() const;
 
-  // optional .swarm.game.Vector2 acc = 2;
-  inline bool has_acc() const;
-  inline void clear_acc();
-  static const int kAccFieldNumber = 2;
-  inline const ::swarm::game::Vector2& acc() const;
-  inline ::swarm::game::Vector2* mutable_acc();
-  inline ::swarm::game::Vector2* release_acc();
-  inline void set_allocated_acc(::swarm::game::Vector2* acc);
+  // repeated uint32 removed_id = 5;
+  int removed_id_size() const;
+  private:
+  int _internal_removed_id_size() const;
+  public:
+  void clear_removed_id();
+  private:
+  uint32_t _internal_removed_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_removed_id() const;
+  void _internal_add_removed_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_removed_id();
+  public:
+  uint32_t removed_id(int index) const;
+  void set_removed_id(int index, uint32_t value);
+  void add_removed_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      removed_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_removed_id();
+
+  // repeated .swarm.game.SwarmAggregate aggregate = 9;
+  int aggregate_size() const;
+  private:
+  int _internal_aggregate_size() const;
+  public:
+  void clear_aggregate();
+  ::swarm::game::SwarmAggregate* mutable_aggregate(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::SwarmAggregate >*
+      mutable_aggregate();
+  private:
+  const ::swarm::game::SwarmAggregate& _internal_aggregate(int index) const;
+  ::swarm::game::SwarmAggregate* _internal_add_aggregate();
+  public:
+  const ::swarm::game::SwarmAggregate& aggregate(int index) const;
+  ::swarm::game::SwarmAggregate* add_aggregate();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::SwarmAggregate >&
+      aggregate() const;
 
-  // optional .swarm.game.Vector2 vel = 3;
-  inline bool has_vel() const;
-  inline void clear_vel();
-  static const int kVelFieldNumber = 3;
-  inline const ::swarm::game::Vector2& vel() const;
-  inline ::swarm::game::Vector2* mutable_vel();
-  inline ::swarm::game::Vector2* release_vel();
-  inline void set_allocated_vel(::swarm::game::Vector2* vel);
+  // optional bytes packed_monsters = 8;
+  bool has_packed_monsters() const;
+  private:
+  bool _internal_has_packed_monsters() const;
+  public:
+  void clear_packed_monsters();
+  const std::string& packed_monsters() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_packed_monsters(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_packed_monsters();
+  PROTOBUF_NODISCARD std::string* release_packed_monsters();
+  void set_allocated_packed_monsters(std::string* packed_monsters);
+  private:
+  const std::string& _internal_packed_monsters() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_packed_monsters(const std::string& value);
+  std::string* _internal_mutable_packed_monsters();
+  public:
 
-  // optional .swarm.game.Vector2 pos = 4;
-  inline bool has_pos() const;
-  inline void clear_pos();
-  static const int kPosFieldNumber = 4;
-  inline const ::swarm::game::Vector2& pos() const;
-  inline ::swarm::game::Vector2* mutable_pos();
-  inline ::swarm::game::Vector2* release_pos();
-  inline void set_allocated_pos(::swarm::game::Vector2* pos);
+  // optional double server_time = 3;
+  bool has_server_time() const;
+  private:
+  bool _internal_has_server_time() const;
+  public:
+  void clear_server_time();
+  double server_time() const;
+  void set_server_time(double value);
+  private:
+  double _internal_server_time() const;
+  void _internal_set_server_time(double value);
+  public:
 
-  // optional int32 health = 5;
-  inline bool has_health() const;
-  inline void clear_health();
-  static const int kHealthFieldNumber = 5;
-  inline ::google::protobuf::int32 health() const;
-  inline void set_health(::google::protobuf::int32 value);
+  // optional uint32 tick = 2;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:swarm.game.Player)
+  // optional bool full = 4;
+  bool has_full() const;
+  private:
+  bool _internal_has_full() const;
+  public:
+  void clear_full();
+  bool full() const;
+  void set_full(bool value);
+  private:
+  bool _internal_full() const;
+  void _internal_set_full(bool value);
+  public:
+
+  // optional uint32 chunk = 6;
+  bool has_chunk() const;
+  private:
+  bool _internal_has_chunk() const;
+  public:
+  void clear_chunk();
+  uint32_t chunk() const;
+  void set_chunk(uint32_t value);
+  private:
+  uint32_t _internal_chunk() const;
+  void _internal_set_chunk(uint32_t value);
+  public:
+
+  // optional uint32 num_chunks = 7;
+  bool has_num_chunks() const;
+  private:
+  bool _internal_has_num_chunks() const;
+  public:
+  void clear_num_chunks();
+  uint32_t num_chunks() const;
+  void set_num_chunks(uint32_t value);
+  private:
+  uint32_t _internal_num_chunks() const;
+  void _internal_set_num_chunks(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.SwarmState)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_acc();
-  inline void clear_has_acc();
-  inline void set_has_vel();
-  inline void clear_has_vel();
-  inline void set_has_pos();
-  inline void clear_has_pos();
-  inline void set_has_health();
-  inline void clear_has_health();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::swarm::game::Vector2* acc_;
-  ::swarm::game::Vector2* vel_;
-  ::google::protobuf::uint32 id_;
-  ::google::protobuf::int32 health_;
-  ::swarm::game::Vector2* pos_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static Player* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Monster > monster_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > removed_id_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::SwarmAggregate > aggregate_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_monsters_;
+    double server_time_;
+    uint32_t tick_;
+    bool full_;
+    uint32_t chunk_;
+    uint32_t num_chunks_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerClick : public ::google::protobuf::Message {
+class Player final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.Player) */ {
  public:
-  PlayerClick();
-  virtual ~PlayerClick();
+  inline Player() : Player(nullptr) {}
+  ~Player() override;
+  explicit PROTOBUF_CONSTEXPR Player(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PlayerClick(const PlayerClick& from);
+  Player(const Player& from);
+  Player(Player&& from) noexcept
+    : Player() {
+    *this = ::std::move(from);
+  }
 
-  inline PlayerClick& operator=(const PlayerClick& from) {
+  inline Player& operator=(const Player& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Player& operator=(Player&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerClick& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Player& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Player* internal_default_instance() {
+    return reinterpret_cast<const Player*>(
+               &_Player_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(PlayerClick* other);
+  friend void swap(Player& a, Player& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Player* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Player* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PlayerClick* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PlayerClick& from);
-  void MergeFrom(const PlayerClick& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  Player* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Player>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Player& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Player& from) {
+    Player::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Player* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.Player";
+  }
+  protected:
+  explicit Player(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .swarm.game.Vector2 click_pos = 1;
-  inline bool has_click_pos() const;
-  inline void clear_click_pos();
-  static const int kClickPosFieldNumber = 1;
-  inline const ::swarm::game::Vector2& click_pos() const;
-  inline ::swarm::game::Vector2* mutable_click_pos();
-  inline ::swarm::game::Vector2* release_click_pos();
-  inline void set_allocated_click_pos(::swarm::game::Vector2* click_pos);
-
-  // optional float click_size = 2;
-  inline bool has_click_size() const;
-  inline void clear_click_size();
-  static const int kClickSizeFieldNumber = 2;
-  inline float click_size() const;
-  inline void set_click_size(float value);
+  enum : int {
+    kAccFieldNumber = 2,
+    kVelFieldNumber = 3,
+    kPosFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kHealthFieldNumber = 5,
+    kLastInputSeqFieldNumber = 6,
+  };
+  // optional .swarm.game.Vector2 acc = 2;
+  bool has_acc() const;
+  private:
+  bool _internal_has_acc() const;
+  public:
+  void clear_acc();
+  const ::swarm::game::Vector2& acc() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_acc();
+  ::swarm::game::Vector2* mutable_acc();
+  void set_allocated_acc(::swarm::game::Vector2* acc);
+  private:
+  const ::swarm::game::Vector2& _internal_acc() const;
+  ::swarm::game::Vector2* _internal_mutable_acc();
+  public:
+  void unsafe_arena_set_allocated_acc(
+      ::swarm::game::Vector2* acc);
+  ::swarm::game::Vector2* unsafe_arena_release_acc();
 
-  // @@protoc_insertion_point(class_scope:swarm.game.PlayerClick)
- private:
-  inline void set_has_click_pos();
-  inline void clear_has_click_pos();
-  inline void set_has_click_size();
-  inline void clear_has_click_size();
+  // optional .swarm.game.Vector2 vel = 3;
+  bool has_vel() const;
+  private:
+  bool _internal_has_vel() const;
+  public:
+  void clear_vel();
+  const ::swarm::game::Vector2& vel() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_vel();
+  ::swarm::game::Vector2* mutable_vel();
+  void set_allocated_vel(::swarm::game::Vector2* vel);
+  private:
+  const ::swarm::game::Vector2& _internal_vel() const;
+  ::swarm::game::Vector2* _internal_mutable_vel();
+  public:
+  void unsafe_arena_set_allocated_vel(
+      ::swarm::game::Vector2* vel);
+  ::swarm::game::Vector2* unsafe_arena_release_vel();
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // optional .swarm.game.Vector2 pos = 4;
+  bool has_pos() const;
+  private:
+  bool _internal_has_pos() const;
+  public:
+  void clear_pos();
+  const ::swarm::game::Vector2& pos() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_pos();
+  ::swarm::game::Vector2* mutable_pos();
+  void set_allocated_pos(::swarm::game::Vector2* pos);
+  private:
+  const ::swarm::game::Vector2& _internal_pos() const;
+  ::swarm::game::Vector2* _internal_mutable_pos();
+  public:
+  void unsafe_arena_set_allocated_pos(
+      ::swarm::game::Vector2* pos);
+  ::swarm::game::Vector2* unsafe_arena_release_pos();
 
-  ::swarm::game::Vector2* click_pos_;
-  float click_size_;
+  // optional uint32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional int32 health = 5;
+  bool has_health() const;
+  private:
+  bool _internal_has_health() const;
+  public:
+  void clear_health();
+  int32_t health() const;
+  void set_health(int32_t value);
+  private:
+  int32_t _internal_health() const;
+  void _internal_set_health(int32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // optional uint32 last_input_seq = 6;
+  bool has_last_input_seq() const;
+  private:
+  bool _internal_has_last_input_seq() const;
+  public:
+  void clear_last_input_seq();
+  uint32_t last_input_seq() const;
+  void set_last_input_seq(uint32_t value);
+  private:
+  uint32_t _internal_last_input_seq() const;
+  void _internal_set_last_input_seq(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static PlayerClick* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.Player)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::swarm::game::Vector2* acc_;
+    ::swarm::game::Vector2* vel_;
+    ::swarm::game::Vector2* pos_;
+    uint32_t id_;
+    int32_t health_;
+    uint32_t last_input_seq_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerState : public ::google::protobuf::Message {
+class PlayerClick final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerClick) */ {
  public:
-  PlayerState();
-  virtual ~PlayerState();
+  inline PlayerClick() : PlayerClick(nullptr) {}
+  ~PlayerClick() override;
+  explicit PROTOBUF_CONSTEXPR PlayerClick(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PlayerState(const PlayerState& from);
+  PlayerClick(const PlayerClick& from);
+  PlayerClick(PlayerClick&& from) noexcept
+    : PlayerClick() {
+    *this = ::std::move(from);
+  }
 
-  inline PlayerState& operator=(const PlayerState& from) {
+  inline PlayerClick& operator=(const PlayerClick& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerClick& operator=(PlayerClick&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerState& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerClick& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerClick* internal_default_instance() {
+    return reinterpret_cast<const PlayerClick*>(
+               &_PlayerClick_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(PlayerState* other);
+  friend void swap(PlayerClick& a, PlayerClick& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerClick* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerClick* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PlayerState* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PlayerState& from);
-  void MergeFrom(const PlayerState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  PlayerClick* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerClick>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerClick& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerClick& from) {
+    PlayerClick::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerClick* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerClick";
+  }
+  protected:
+  explicit PlayerClick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // repeated .swarm.game.Player player = 1;
-  inline int player_size() const;
-  inline void clear_player();
-  static const int kPlayerFieldNumber = 1;
-  inline const ::swarm::game::Player& player(int index) const;
-  inline ::swarm::game::Player* mutable_player(int index);
-  inline ::swarm::game::Player* add_player();
-  inline const ::google::protobuf::RepeatedPtrField< ::swarm::game::Player >&
-      player() const;
-  inline ::google::protobuf::RepeatedPtrField< ::swarm::game::Player >*
-      mutable_player();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:swarm.game.PlayerState)
- private:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::RepeatedPtrField< ::swarm::game::Player > player_;
+  enum : int {
+    kClickPosFieldNumber = 1,
+    kClickSizeFieldNumber = 2,
+    kRenderTickFieldNumber = 3,
+  };
+  // optional .swarm.game.Vector2 click_pos = 1;
+  bool has_click_pos() const;
+  private:
+  bool _internal_has_click_pos() const;
+  public:
+  void clear_click_pos();
+  const ::swarm::game::Vector2& click_pos() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_click_pos();
+  ::swarm::game::Vector2* mutable_click_pos();
+  void set_allocated_click_pos(::swarm::game::Vector2* click_pos);
+  private:
+  const ::swarm::game::Vector2& _internal_click_pos() const;
+  ::swarm::game::Vector2* _internal_mutable_click_pos();
+  public:
+  void unsafe_arena_set_allocated_click_pos(
+      ::swarm::game::Vector2* click_pos);
+  ::swarm::game::Vector2* unsafe_arena_release_click_pos();
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional float click_size = 2;
+  bool has_click_size() const;
+  private:
+  bool _internal_has_click_size() const;
+  public:
+  void clear_click_size();
+  float click_size() const;
+  void set_click_size(float value);
+  private:
+  float _internal_click_size() const;
+  void _internal_set_click_size(float value);
+  public:
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // optional uint32 render_tick = 3;
+  bool has_render_tick() const;
+  private:
+  bool _internal_has_render_tick() const;
+  public:
+  void clear_render_tick();
+  uint32_t render_tick() const;
+  void set_render_tick(uint32_t value);
+  private:
+  uint32_t _internal_render_tick() const;
+  void _internal_set_render_tick(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static PlayerState* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.PlayerClick)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::swarm::game::Vector2* click_pos_;
+    float click_size_;
+    uint32_t render_tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameStarted : public ::google::protobuf::Message {
+class PlayerInput final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerInput) */ {
  public:
-  GameStarted();
-  virtual ~GameStarted();
-
-  GameStarted(const GameStarted& from);
+  inline PlayerInput() : PlayerInput(nullptr) {}
+  ~PlayerInput() override;
+  explicit PROTOBUF_CONSTEXPR PlayerInput(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayerInput(const PlayerInput& from);
+  PlayerInput(PlayerInput&& from) noexcept
+    : PlayerInput() {
+    *this = ::std::move(from);
+  }
 
-  inline GameStarted& operator=(const GameStarted& from) {
+  inline PlayerInput& operator=(const PlayerInput& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerInput& operator=(PlayerInput&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameStarted& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerInput& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerInput* internal_default_instance() {
+    return reinterpret_cast<const PlayerInput*>(
+               &_PlayerInput_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(GameStarted* other);
+  friend void swap(PlayerInput& a, PlayerInput& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerInput* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerInput* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  GameStarted* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const GameStarted& from);
-  void MergeFrom(const GameStarted& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  PlayerInput* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerInput>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerInput& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerInput& from) {
+    PlayerInput::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerInput* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerInput";
+  }
+  protected:
+  explicit PlayerInput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // optional uint32 player_id = 1;
-  inline bool has_player_id() const;
-  inline void clear_player_id();
-  static const int kPlayerIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 player_id() const;
-  inline void set_player_id(::google::protobuf::uint32 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // optional uint32 health = 2;
-  inline bool has_health() const;
-  inline void clear_health();
-  static const int kHealthFieldNumber = 2;
-  inline ::google::protobuf::uint32 health() const;
-  inline void set_health(::google::protobuf::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional string map_name = 3;
-  inline bool has_map_name() const;
-  inline void clear_map_name();
-  static const int kMapNameFieldNumber = 3;
-  inline const ::std::string& map_name() const;
-  inline void set_map_name(const ::std::string& value);
-  inline void set_map_name(const char* value);
-  inline void set_map_name(const char* value, size_t size);
-  inline ::std::string* mutable_map_name();
-  inline ::std::string* release_map_name();
-  inline void set_allocated_map_name(::std::string* map_name);
+  // nested types ----------------------------------------------------
 
-  // optional .swarm.game.PlayerState player_state = 4;
-  inline bool has_player_state() const;
-  inline void clear_player_state();
-  static const int kPlayerStateFieldNumber = 4;
-  inline const ::swarm::game::PlayerState& player_state() const;
-  inline ::swarm::game::PlayerState* mutable_player_state();
-  inline ::swarm::game::PlayerState* release_player_state();
-  inline void set_allocated_player_state(::swarm::game::PlayerState* player_state);
+  // accessors -------------------------------------------------------
 
-  // optional .swarm.game.SwarmState swarm_state = 5;
-  inline bool has_swarm_state() const;
-  inline void clear_swarm_state();
-  static const int kSwarmStateFieldNumber = 5;
-  inline const ::swarm::game::SwarmState& swarm_state() const;
-  inline ::swarm::game::SwarmState* mutable_swarm_state();
-  inline ::swarm::game::SwarmState* release_swarm_state();
-  inline void set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state);
+  enum : int {
+    kAccFieldNumber = 2,
+    kSeqFieldNumber = 1,
+  };
+  // optional .swarm.game.Vector2 acc = 2;
+  bool has_acc() const;
+  private:
+  bool _internal_has_acc() const;
+  public:
+  void clear_acc();
+  const ::swarm::game::Vector2& acc() const;
+  PROTOBUF_NODISCARD ::swarm::game::Vector2* release_acc();
+  ::swarm::game::Vector2* mutable_acc();
+  void set_allocated_acc(::swarm::game::Vector2* acc);
+  private:
+  const ::swarm::game::Vector2& _internal_acc() const;
+  ::swarm::game::Vector2* _internal_mutable_acc();
+  public:
+  void unsafe_arena_set_allocated_acc(
+      ::swarm::game::Vector2* acc);
+  ::swarm::game::Vector2* unsafe_arena_release_acc();
 
-  // @@protoc_insertion_point(class_scope:swarm.game.GameStarted)
+  // optional uint32 seq = 1;
+  bool has_seq() const;
+  private:
+  bool _internal_has_seq() const;
+  public:
+  void clear_seq();
+  uint32_t seq() const;
+  void set_seq(uint32_t value);
+  private:
+  uint32_t _internal_seq() const;
+  void _internal_set_seq(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.PlayerInput)
  private:
-  inline void set_has_player_id();
-  inline void clear_has_player_id();
-  inline void set_has_health();
-  inline void clear_has_health();
-  inline void set_has_map_name();
-  inline void clear_has_map_name();
-  inline void set_has_player_state();
-  inline void clear_has_player_state();
-  inline void set_has_swarm_state();
-  inline void clear_has_swarm_state();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 player_id_;
-  ::google::protobuf::uint32 health_;
-  ::std::string* map_name_;
-  ::swarm::game::PlayerState* player_state_;
-  ::swarm::game::SwarmState* swarm_state_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static GameStarted* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::swarm::game::Vector2* acc_;
+    uint32_t seq_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameEnded : public ::google::protobuf::Message {
+class PlayerHello final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerHello) */ {
  public:
-  GameEnded();
-  virtual ~GameEnded();
-
-  GameEnded(const GameEnded& from);
+  inline PlayerHello() : PlayerHello(nullptr) {}
+  ~PlayerHello() override;
+  explicit PROTOBUF_CONSTEXPR PlayerHello(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayerHello(const PlayerHello& from);
+  PlayerHello(PlayerHello&& from) noexcept
+    : PlayerHello() {
+    *this = ::std::move(from);
+  }
 
-  inline GameEnded& operator=(const GameEnded& from) {
+  inline PlayerHello& operator=(const PlayerHello& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerHello& operator=(PlayerHello&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameEnded& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerHello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerHello* internal_default_instance() {
+    return reinterpret_cast<const PlayerHello*>(
+               &_PlayerHello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(GameEnded* other);
+  friend void swap(PlayerHello& a, PlayerHello& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerHello* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerHello* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  GameEnded* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const GameEnded& from);
-  void MergeFrom(const GameEnded& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  PlayerHello* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerHello>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerHello& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerHello& from) {
+    PlayerHello::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerHello* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerHello";
+  }
+  protected:
+  explicit PlayerHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // optional uint32 winner_id = 1;
-  inline bool has_winner_id() const;
-  inline void clear_winner_id();
-  static const int kWinnerIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 winner_id() const;
-  inline void set_winner_id(::google::protobuf::uint32 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:swarm.game.GameEnded)
- private:
-  inline void set_has_winner_id();
-  inline void clear_has_winner_id();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::uint32 winner_id_;
+  enum : int {
+    kSessionTokenFieldNumber = 1,
+    kLastTickFieldNumber = 2,
+    kSpectatorFieldNumber = 3,
+  };
+  // optional uint64 session_token = 1;
+  bool has_session_token() const;
+  private:
+  bool _internal_has_session_token() const;
+  public:
+  void clear_session_token();
+  uint64_t session_token() const;
+  void set_session_token(uint64_t value);
+  private:
+  uint64_t _internal_session_token() const;
+  void _internal_set_session_token(uint64_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional uint32 last_tick = 2;
+  bool has_last_tick() const;
+  private:
+  bool _internal_has_last_tick() const;
+  public:
+  void clear_last_tick();
+  uint32_t last_tick() const;
+  void set_last_tick(uint32_t value);
+  private:
+  uint32_t _internal_last_tick() const;
+  void _internal_set_last_tick(uint32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // optional bool spectator = 3;
+  bool has_spectator() const;
+  private:
+  bool _internal_has_spectator() const;
+  public:
+  void clear_spectator();
+  bool spectator() const;
+  void set_spectator(bool value);
+  private:
+  bool _internal_spectator() const;
+  void _internal_set_spectator(bool value);
+  public:
 
-  void InitAsDefaultInstance();
-  static GameEnded* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.PlayerHello)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t session_token_;
+    uint32_t last_tick_;
+    bool spectator_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerDied : public ::google::protobuf::Message {
+class PlayerState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerState) */ {
  public:
-  PlayerDied();
-  virtual ~PlayerDied();
+  inline PlayerState() : PlayerState(nullptr) {}
+  ~PlayerState() override;
+  explicit PROTOBUF_CONSTEXPR PlayerState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PlayerDied(const PlayerDied& from);
+  PlayerState(const PlayerState& from);
+  PlayerState(PlayerState&& from) noexcept
+    : PlayerState() {
+    *this = ::std::move(from);
+  }
 
-  inline PlayerDied& operator=(const PlayerDied& from) {
+  inline PlayerState& operator=(const PlayerState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerState& operator=(PlayerState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerDied& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerState* internal_default_instance() {
+    return reinterpret_cast<const PlayerState*>(
+               &_PlayerState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(PlayerDied* other);
+  friend void swap(PlayerState& a, PlayerState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PlayerDied* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PlayerDied& from);
-  void MergeFrom(const PlayerDied& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  PlayerState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerState& from) {
+    PlayerState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerState* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerState";
+  }
+  protected:
+  explicit PlayerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // optional uint32 player_id = 1;
-  inline bool has_player_id() const;
-  inline void clear_player_id();
-  static const int kPlayerIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 player_id() const;
-  inline void set_player_id(::google::protobuf::uint32 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // @@protoc_insertion_point(class_scope:swarm.game.PlayerDied)
- private:
-  inline void set_has_player_id();
-  inline void clear_has_player_id();
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::uint32 player_id_;
+  enum : int {
+    kPlayerFieldNumber = 1,
+    kServerTimeFieldNumber = 3,
+    kTickFieldNumber = 2,
+  };
+  // repeated .swarm.game.Player player = 1;
+  int player_size() const;
+  private:
+  int _internal_player_size() const;
+  public:
+  void clear_player();
+  ::swarm::game::Player* mutable_player(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Player >*
+      mutable_player();
+  private:
+  const ::swarm::game::Player& _internal_player(int index) const;
+  ::swarm::game::Player* _internal_add_player();
+  public:
+  const ::swarm::game::Player& player(int index) const;
+  ::swarm::game::Player* add_player();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Player >&
+      player() const;
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional double server_time = 3;
+  bool has_server_time() const;
+  private:
+  bool _internal_has_server_time() const;
+  public:
+  void clear_server_time();
+  double server_time() const;
+  void set_server_time(double value);
+  private:
+  double _internal_server_time() const;
+  void _internal_set_server_time(double value);
+  public:
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // optional uint32 tick = 2;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static PlayerDied* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.PlayerState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Player > player_;
+    double server_time_;
+    uint32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MonsterDied : public ::google::protobuf::Message {
+class GameStarted final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.GameStarted) */ {
  public:
-  MonsterDied();
-  virtual ~MonsterDied();
+  inline GameStarted() : GameStarted(nullptr) {}
+  ~GameStarted() override;
+  explicit PROTOBUF_CONSTEXPR GameStarted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  MonsterDied(const MonsterDied& from);
+  GameStarted(const GameStarted& from);
+  GameStarted(GameStarted&& from) noexcept
+    : GameStarted() {
+    *this = ::std::move(from);
+  }
 
-  inline MonsterDied& operator=(const MonsterDied& from) {
+  inline GameStarted& operator=(const GameStarted& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline GameStarted& operator=(GameStarted&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MonsterDied& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameStarted& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameStarted* internal_default_instance() {
+    return reinterpret_cast<const GameStarted*>(
+               &_GameStarted_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(MonsterDied* other);
+  friend void swap(GameStarted& a, GameStarted& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameStarted* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameStarted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MonsterDied* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const MonsterDied& from);
-  void MergeFrom(const MonsterDied& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  GameStarted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameStarted>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameStarted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameStarted& from) {
+    GameStarted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameStarted* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.GameStarted";
+  }
+  protected:
+  explicit GameStarted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .swarm.game.Vector2 pos = 1;
-  inline int pos_size() const;
-  inline void clear_pos();
-  static const int kPosFieldNumber = 1;
-  inline const ::swarm::game::Vector2& pos(int index) const;
-  inline ::swarm::game::Vector2* mutable_pos(int index);
-  inline ::swarm::game::Vector2* add_pos();
-  inline const ::google::protobuf::RepeatedPtrField< ::swarm::game::Vector2 >&
-      pos() const;
-  inline ::google::protobuf::RepeatedPtrField< ::swarm::game::Vector2 >*
-      mutable_pos();
+  enum : int {
+    kMapNameFieldNumber = 3,
+    kPlayerStateFieldNumber = 4,
+    kSwarmStateFieldNumber = 5,
+    kPlayerIdFieldNumber = 1,
+    kHealthFieldNumber = 2,
+    kSnapshotIntervalMsFieldNumber = 6,
+    kUdpPortFieldNumber = 7,
+    kSessionTokenFieldNumber = 9,
+    kUdpTokenFieldNumber = 8,
+    kInitialStateChunksFieldNumber = 11,
+    kResumedFieldNumber = 10,
+    kLockstepFieldNumber = 12,
+  };
+  // optional string map_name = 3;
+  bool has_map_name() const;
+  private:
+  bool _internal_has_map_name() const;
+  public:
+  void clear_map_name();
+  const std::string& map_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_map_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_map_name();
+  PROTOBUF_NODISCARD std::string* release_map_name();
+  void set_allocated_map_name(std::string* map_name);
+  private:
+  const std::string& _internal_map_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_map_name(const std::string& value);
+  std::string* _internal_mutable_map_name();
+  public:
 
-  // @@protoc_insertion_point(class_scope:swarm.game.MonsterDied)
- private:
+  // optional .swarm.game.PlayerState player_state = 4;
+  bool has_player_state() const;
+  private:
+  bool _internal_has_player_state() const;
+  public:
+  void clear_player_state();
+  const ::swarm::game::PlayerState& player_state() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerState* release_player_state();
+  ::swarm::game::PlayerState* mutable_player_state();
+  void set_allocated_player_state(::swarm::game::PlayerState* player_state);
+  private:
+  const ::swarm::game::PlayerState& _internal_player_state() const;
+  ::swarm::game::PlayerState* _internal_mutable_player_state();
+  public:
+  void unsafe_arena_set_allocated_player_state(
+      ::swarm::game::PlayerState* player_state);
+  ::swarm::game::PlayerState* unsafe_arena_release_player_state();
+
+  // optional .swarm.game.SwarmState swarm_state = 5;
+  bool has_swarm_state() const;
+  private:
+  bool _internal_has_swarm_state() const;
+  public:
+  void clear_swarm_state();
+  const ::swarm::game::SwarmState& swarm_state() const;
+  PROTOBUF_NODISCARD ::swarm::game::SwarmState* release_swarm_state();
+  ::swarm::game::SwarmState* mutable_swarm_state();
+  void set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state);
+  private:
+  const ::swarm::game::SwarmState& _internal_swarm_state() const;
+  ::swarm::game::SwarmState* _internal_mutable_swarm_state();
+  public:
+  void unsafe_arena_set_allocated_swarm_state(
+      ::swarm::game::SwarmState* swarm_state);
+  ::swarm::game::SwarmState* unsafe_arena_release_swarm_state();
+
+  // optional uint32 player_id = 1;
+  bool has_player_id() const;
+  private:
+  bool _internal_has_player_id() const;
+  public:
+  void clear_player_id();
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
+
+  // optional uint32 health = 2;
+  bool has_health() const;
+  private:
+  bool _internal_has_health() const;
+  public:
+  void clear_health();
+  uint32_t health() const;
+  void set_health(uint32_t value);
+  private:
+  uint32_t _internal_health() const;
+  void _internal_set_health(uint32_t value);
+  public:
+
+  // optional uint32 snapshot_interval_ms = 6;
+  bool has_snapshot_interval_ms() const;
+  private:
+  bool _internal_has_snapshot_interval_ms() const;
+  public:
+  void clear_snapshot_interval_ms();
+  uint32_t snapshot_interval_ms() const;
+  void set_snapshot_interval_ms(uint32_t value);
+  private:
+  uint32_t _internal_snapshot_interval_ms() const;
+  void _internal_set_snapshot_interval_ms(uint32_t value);
+  public:
+
+  // optional uint32 udp_port = 7;
+  bool has_udp_port() const;
+  private:
+  bool _internal_has_udp_port() const;
+  public:
+  void clear_udp_port();
+  uint32_t udp_port() const;
+  void set_udp_port(uint32_t value);
+  private:
+  uint32_t _internal_udp_port() const;
+  void _internal_set_udp_port(uint32_t value);
+  public:
+
+  // optional uint64 session_token = 9;
+  bool has_session_token() const;
+  private:
+  bool _internal_has_session_token() const;
+  public:
+  void clear_session_token();
+  uint64_t session_token() const;
+  void set_session_token(uint64_t value);
+  private:
+  uint64_t _internal_session_token() const;
+  void _internal_set_session_token(uint64_t value);
+  public:
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // optional uint32 udp_token = 8;
+  bool has_udp_token() const;
+  private:
+  bool _internal_has_udp_token() const;
+  public:
+  void clear_udp_token();
+  uint32_t udp_token() const;
+  void set_udp_token(uint32_t value);
+  private:
+  uint32_t _internal_udp_token() const;
+  void _internal_set_udp_token(uint32_t value);
+  public:
 
-  ::google::protobuf::RepeatedPtrField< ::swarm::game::Vector2 > pos_;
+  // optional uint32 initial_state_chunks = 11;
+  bool has_initial_state_chunks() const;
+  private:
+  bool _internal_has_initial_state_chunks() const;
+  public:
+  void clear_initial_state_chunks();
+  uint32_t initial_state_chunks() const;
+  void set_initial_state_chunks(uint32_t value);
+  private:
+  uint32_t _internal_initial_state_chunks() const;
+  void _internal_set_initial_state_chunks(uint32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // optional bool resumed = 10;
+  bool has_resumed() const;
+  private:
+  bool _internal_has_resumed() const;
+  public:
+  void clear_resumed();
+  bool resumed() const;
+  void set_resumed(bool value);
+  private:
+  bool _internal_resumed() const;
+  void _internal_set_resumed(bool value);
+  public:
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // optional bool lockstep = 12;
+  bool has_lockstep() const;
+  private:
+  bool _internal_has_lockstep() const;
+  public:
+  void clear_lockstep();
+  bool lockstep() const;
+  void set_lockstep(bool value);
+  private:
+  bool _internal_lockstep() const;
+  void _internal_set_lockstep(bool value);
+  public:
 
-  void InitAsDefaultInstance();
-  static MonsterDied* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.GameStarted)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr map_name_;
+    ::swarm::game::PlayerState* player_state_;
+    ::swarm::game::SwarmState* swarm_state_;
+    uint32_t player_id_;
+    uint32_t health_;
+    uint32_t snapshot_interval_ms_;
+    uint32_t udp_port_;
+    uint64_t session_token_;
+    uint32_t udp_token_;
+    uint32_t initial_state_chunks_;
+    bool resumed_;
+    bool lockstep_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerMessage : public ::google::protobuf::Message {
+class GameEnded final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.GameEnded) */ {
  public:
-  ServerMessage();
-  virtual ~ServerMessage();
+  inline GameEnded() : GameEnded(nullptr) {}
+  ~GameEnded() override;
+  explicit PROTOBUF_CONSTEXPR GameEnded(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ServerMessage(const ServerMessage& from);
+  GameEnded(const GameEnded& from);
+  GameEnded(GameEnded&& from) noexcept
+    : GameEnded() {
+    *this = ::std::move(from);
+  }
 
-  inline ServerMessage& operator=(const ServerMessage& from) {
+  inline GameEnded& operator=(const GameEnded& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline GameEnded& operator=(GameEnded&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ServerMessage& default_instance();
-
-  void Swap(ServerMessage* other);
-
-  // implements Message ----------------------------------------------
-
-  ServerMessage* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ServerMessage& from);
-  void MergeFrom(const ServerMessage& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  typedef ServerMessage_Type Type;
-  static const Type GAME_STARTED = ServerMessage_Type_GAME_STARTED;
-  static const Type PLAYER_JOINED = ServerMessage_Type_PLAYER_JOINED;
-  static const Type PLAYER_LEFT = ServerMessage_Type_PLAYER_LEFT;
-  static const Type SWARM_STATE = ServerMessage_Type_SWARM_STATE;
-  static const Type PLAYER_STATE = ServerMessage_Type_PLAYER_STATE;
-  static const Type PLAYER_DIED = ServerMessage_Type_PLAYER_DIED;
-  static const Type GAME_ENDED = ServerMessage_Type_GAME_ENDED;
-  static const Type MONSTER_DIED = ServerMessage_Type_MONSTER_DIED;
-  static inline bool Type_IsValid(int value) {
-    return ServerMessage_Type_IsValid(value);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  static const Type Type_MIN =
-    ServerMessage_Type_Type_MIN;
-  static const Type Type_MAX =
-    ServerMessage_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
-    ServerMessage_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Type_descriptor() {
-    return ServerMessage_Type_descriptor();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  static inline const ::std::string& Type_Name(Type value) {
-    return ServerMessage_Type_Name(value);
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  static inline bool Type_Parse(const ::std::string& name,
-      Type* value) {
-    return ServerMessage_Type_Parse(name, value);
+  static const GameEnded& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameEnded* internal_default_instance() {
+    return reinterpret_cast<const GameEnded*>(
+               &_GameEnded_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  // accessors -------------------------------------------------------
+  friend void swap(GameEnded& a, GameEnded& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameEnded* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEnded* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  // required .swarm.game.ServerMessage.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::swarm::game::ServerMessage_Type type() const;
-  inline void set_type(::swarm::game::ServerMessage_Type value);
+  // implements Message ----------------------------------------------
 
-  // optional .swarm.game.GameStarted game_started = 2;
-  inline bool has_game_started() const;
-  inline void clear_game_started();
-  static const int kGameStartedFieldNumber = 2;
-  inline const ::swarm::game::GameStarted& game_started() const;
-  inline ::swarm::game::GameStarted* mutable_game_started();
-  inline ::swarm::game::GameStarted* release_game_started();
-  inline void set_allocated_game_started(::swarm::game::GameStarted* game_started);
+  GameEnded* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameEnded>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameEnded& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEnded& from) {
+    GameEnded::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  // optional .swarm.game.PlayerJoined player_joined = 3;
-  inline bool has_player_joined() const;
-  inline void clear_player_joined();
-  static const int kPlayerJoinedFieldNumber = 3;
-  inline const ::swarm::game::PlayerJoined& player_joined() const;
-  inline ::swarm::game::PlayerJoined* mutable_player_joined();
-  inline ::swarm::game::PlayerJoined* release_player_joined();
-  inline void set_allocated_player_joined(::swarm::game::PlayerJoined* player_joined);
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // optional .swarm.game.PlayerLeft player_left = 4;
-  inline bool has_player_left() const;
-  inline void clear_player_left();
-  static const int kPlayerLeftFieldNumber = 4;
-  inline const ::swarm::game::PlayerLeft& player_left() const;
-  inline ::swarm::game::PlayerLeft* mutable_player_left();
-  inline ::swarm::game::PlayerLeft* release_player_left();
-  inline void set_allocated_player_left(::swarm::game::PlayerLeft* player_left);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameEnded* other);
 
-  // optional .swarm.game.SwarmState swarm_state = 5;
-  inline bool has_swarm_state() const;
-  inline void clear_swarm_state();
-  static const int kSwarmStateFieldNumber = 5;
-  inline const ::swarm::game::SwarmState& swarm_state() const;
-  inline ::swarm::game::SwarmState* mutable_swarm_state();
-  inline ::swarm::game::SwarmState* release_swarm_state();
-  inline void set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.GameEnded";
+  }
+  protected:
+  explicit GameEnded(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // optional .swarm.game.PlayerState player_state = 6;
-  inline bool has_player_state() const;
-  inline void clear_player_state();
-  static const int kPlayerStateFieldNumber = 6;
-  inline const ::swarm::game::PlayerState& player_state() const;
-  inline ::swarm::game::PlayerState* mutable_player_state();
-  inline ::swarm::game::PlayerState* release_player_state();
-  inline void set_allocated_player_state(::swarm::game::PlayerState* player_state);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // optional .swarm.game.PlayerDied player_died = 7;
-  inline bool has_player_died() const;
-  inline void clear_player_died();
-  static const int kPlayerDiedFieldNumber = 7;
-  inline const ::swarm::game::PlayerDied& player_died() const;
-  inline ::swarm::game::PlayerDied* mutable_player_died();
-  inline ::swarm::game::PlayerDied* release_player_died();
-  inline void set_allocated_player_died(::swarm::game::PlayerDied* player_died);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional .swarm.game.GameEnded game_ended = 8;
-  inline bool has_game_ended() const;
-  inline void clear_game_ended();
-  static const int kGameEndedFieldNumber = 8;
-  inline const ::swarm::game::GameEnded& game_ended() const;
-  inline ::swarm::game::GameEnded* mutable_game_ended();
-  inline ::swarm::game::GameEnded* release_game_ended();
-  inline void set_allocated_game_ended(::swarm::game::GameEnded* game_ended);
+  // nested types ----------------------------------------------------
 
-  // optional .swarm.game.MonsterDied monster_died = 9;
-  inline bool has_monster_died() const;
-  inline void clear_monster_died();
-  static const int kMonsterDiedFieldNumber = 9;
-  inline const ::swarm::game::MonsterDied& monster_died() const;
-  inline ::swarm::game::MonsterDied* mutable_monster_died();
-  inline ::swarm::game::MonsterDied* release_monster_died();
-  inline void set_allocated_monster_died(::swarm::game::MonsterDied* monster_died);
+  // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:swarm.game.ServerMessage)
+  enum : int {
+    kWinnerIdFieldNumber = 1,
+  };
+  // optional uint32 winner_id = 1;
+  bool has_winner_id() const;
+  private:
+  bool _internal_has_winner_id() const;
+  public:
+  void clear_winner_id();
+  uint32_t winner_id() const;
+  void set_winner_id(uint32_t value);
+  private:
+  uint32_t _internal_winner_id() const;
+  void _internal_set_winner_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.GameEnded)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_game_started();
-  inline void clear_has_game_started();
-  inline void set_has_player_joined();
-  inline void clear_has_player_joined();
-  inline void set_has_player_left();
-  inline void clear_has_player_left();
-  inline void set_has_swarm_state();
-  inline void clear_has_swarm_state();
-  inline void set_has_player_state();
-  inline void clear_has_player_state();
-  inline void set_has_player_died();
-  inline void clear_has_player_died();
-  inline void set_has_game_ended();
-  inline void clear_has_game_ended();
-  inline void set_has_monster_died();
-  inline void clear_has_monster_died();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::swarm::game::GameStarted* game_started_;
-  ::swarm::game::PlayerJoined* player_joined_;
-  ::swarm::game::PlayerLeft* player_left_;
-  ::swarm::game::SwarmState* swarm_state_;
-  ::swarm::game::PlayerState* player_state_;
-  ::swarm::game::PlayerDied* player_died_;
-  ::swarm::game::GameEnded* game_ended_;
-  ::swarm::game::MonsterDied* monster_died_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(9 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static ServerMessage* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t winner_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerMessage : public ::google::protobuf::Message {
+class PlayerDied final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerDied) */ {
  public:
-  PlayerMessage();
-  virtual ~PlayerMessage();
+  inline PlayerDied() : PlayerDied(nullptr) {}
+  ~PlayerDied() override;
+  explicit PROTOBUF_CONSTEXPR PlayerDied(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PlayerMessage(const PlayerMessage& from);
+  PlayerDied(const PlayerDied& from);
+  PlayerDied(PlayerDied&& from) noexcept
+    : PlayerDied() {
+    *this = ::std::move(from);
+  }
 
-  inline PlayerMessage& operator=(const PlayerMessage& from) {
+  inline PlayerDied& operator=(const PlayerDied& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline PlayerDied& operator=(PlayerDied&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerMessage& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerDied& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerDied* internal_default_instance() {
+    return reinterpret_cast<const PlayerDied*>(
+               &_PlayerDied_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
 
-  void Swap(PlayerMessage* other);
+  friend void swap(PlayerDied& a, PlayerDied& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerDied* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerDied* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  PlayerMessage* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PlayerMessage& from);
-  void MergeFrom(const PlayerMessage& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  PlayerDied* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerDied>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerDied& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerDied& from) {
+    PlayerDied::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerDied* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerDied";
+  }
+  protected:
+  explicit PlayerDied(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef PlayerMessage_Type Type;
-  static const Type PLAYER_POS = PlayerMessage_Type_PLAYER_POS;
-  static const Type PLAYER_CLICK = PlayerMessage_Type_PLAYER_CLICK;
-  static inline bool Type_IsValid(int value) {
-    return PlayerMessage_Type_IsValid(value);
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlayerIdFieldNumber = 1,
+  };
+  // optional uint32 player_id = 1;
+  bool has_player_id() const;
+  private:
+  bool _internal_has_player_id() const;
+  public:
+  void clear_player_id();
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.PlayerDied)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t player_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MonsterDied final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.MonsterDied) */ {
+ public:
+  inline MonsterDied() : MonsterDied(nullptr) {}
+  ~MonsterDied() override;
+  explicit PROTOBUF_CONSTEXPR MonsterDied(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MonsterDied(const MonsterDied& from);
+  MonsterDied(MonsterDied&& from) noexcept
+    : MonsterDied() {
+    *this = ::std::move(from);
   }
-  static const Type Type_MIN =
-    PlayerMessage_Type_Type_MIN;
-  static const Type Type_MAX =
-    PlayerMessage_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
-    PlayerMessage_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
-  Type_descriptor() {
-    return PlayerMessage_Type_descriptor();
+
+  inline MonsterDied& operator=(const MonsterDied& from) {
+    CopyFrom(from);
+    return *this;
   }
-  static inline const ::std::string& Type_Name(Type value) {
-    return PlayerMessage_Type_Name(value);
+  inline MonsterDied& operator=(MonsterDied&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  static inline bool Type_Parse(const ::std::string& name,
-      Type* value) {
-    return PlayerMessage_Type_Parse(name, value);
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  // accessors -------------------------------------------------------
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MonsterDied& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MonsterDied* internal_default_instance() {
+    return reinterpret_cast<const MonsterDied*>(
+               &_MonsterDied_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-  // required .swarm.game.PlayerMessage.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::swarm::game::PlayerMessage_Type type() const;
-  inline void set_type(::swarm::game::PlayerMessage_Type value);
+  friend void swap(MonsterDied& a, MonsterDied& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MonsterDied* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MonsterDied* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  // optional .swarm.game.Vector2 pos = 2;
-  inline bool has_pos() const;
-  inline void clear_pos();
-  static const int kPosFieldNumber = 2;
-  inline const ::swarm::game::Vector2& pos() const;
-  inline ::swarm::game::Vector2* mutable_pos();
-  inline ::swarm::game::Vector2* release_pos();
-  inline void set_allocated_pos(::swarm::game::Vector2* pos);
+  // implements Message ----------------------------------------------
 
-  // optional .swarm.game.PlayerClick click = 3;
-  inline bool has_click() const;
-  inline void clear_click();
-  static const int kClickFieldNumber = 3;
-  inline const ::swarm::game::PlayerClick& click() const;
-  inline ::swarm::game::PlayerClick* mutable_click();
-  inline ::swarm::game::PlayerClick* release_click();
-  inline void set_allocated_click(::swarm::game::PlayerClick* click);
+  MonsterDied* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MonsterDied>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MonsterDied& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MonsterDied& from) {
+    MonsterDied::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  // @@protoc_insertion_point(class_scope:swarm.game.PlayerMessage)
- private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_pos();
-  inline void clear_has_pos();
-  inline void set_has_click();
-  inline void clear_has_click();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MonsterDied* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.MonsterDied";
+  }
+  protected:
+  explicit MonsterDied(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
-  ::swarm::game::Vector2* pos_;
-  ::swarm::game::PlayerClick* click_;
-  int type_;
+  // accessors -------------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  enum : int {
+    kPosFieldNumber = 1,
+    kIdFieldNumber = 2,
+  };
+  // repeated .swarm.game.Vector2 pos = 1;
+  int pos_size() const;
+  private:
+  int _internal_pos_size() const;
+  public:
+  void clear_pos();
+  ::swarm::game::Vector2* mutable_pos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Vector2 >*
+      mutable_pos();
+  private:
+  const ::swarm::game::Vector2& _internal_pos(int index) const;
+  ::swarm::game::Vector2* _internal_add_pos();
+  public:
+  const ::swarm::game::Vector2& pos(int index) const;
+  ::swarm::game::Vector2* add_pos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Vector2 >&
+      pos() const;
 
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
+  // repeated uint32 id = 2;
+  int id_size() const;
+  private:
+  int _internal_id_size() const;
+  public:
+  void clear_id();
+  private:
+  uint32_t _internal_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_id() const;
+  void _internal_add_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_id();
+  public:
+  uint32_t id(int index) const;
+  void set_id(int index, uint32_t value);
+  void add_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_id();
 
-  void InitAsDefaultInstance();
-  static PlayerMessage* default_instance_;
+  // @@protoc_insertion_point(class_scope:swarm.game.MonsterDied)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Vector2 > pos_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Config : public ::google::protobuf::Message {
+class Ping final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.Ping) */ {
  public:
-  Config();
-  virtual ~Config();
-
-  Config(const Config& from);
+  inline Ping() : Ping(nullptr) {}
+  ~Ping() override;
+  explicit PROTOBUF_CONSTEXPR Ping(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Ping(const Ping& from);
+  Ping(Ping&& from) noexcept
+    : Ping() {
+    *this = ::std::move(from);
+  }
 
-  inline Config& operator=(const Config& from) {
+  inline Ping& operator=(const Ping& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Ping& operator=(Ping&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Config& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Ping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Ping* internal_default_instance() {
+    return reinterpret_cast<const Ping*>(
+               &_Ping_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
 
-  void Swap(Config* other);
+  friend void swap(Ping& a, Ping& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Ping* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Ping* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Config* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Config& from);
-  void MergeFrom(const Config& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  Ping* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Ping>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Ping& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Ping& from) {
+    Ping::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Ping* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.Ping";
+  }
+  protected:
+  explicit Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string map_name = 1;
-  inline bool has_map_name() const;
-  inline void clear_map_name();
-  static const int kMapNameFieldNumber = 1;
-  inline const ::std::string& map_name() const;
-  inline void set_map_name(const ::std::string& value);
-  inline void set_map_name(const char* value);
-  inline void set_map_name(const char* value, size_t size);
-  inline ::std::string* mutable_map_name();
-  inline ::std::string* release_map_name();
-  inline void set_allocated_map_name(::std::string* map_name);
+  enum : int {
+    kClientTimeFieldNumber = 2,
+    kSeqFieldNumber = 1,
+    kRttMsFieldNumber = 3,
+  };
+  // optional double client_time = 2;
+  bool has_client_time() const;
+  private:
+  bool _internal_has_client_time() const;
+  public:
+  void clear_client_time();
+  double client_time() const;
+  void set_client_time(double value);
+  private:
+  double _internal_client_time() const;
+  void _internal_set_client_time(double value);
+  public:
 
-  // optional uint32 num_swarms = 2 [default = 5];
-  inline bool has_num_swarms() const;
-  inline void clear_num_swarms();
-  static const int kNumSwarmsFieldNumber = 2;
-  inline ::google::protobuf::uint32 num_swarms() const;
-  inline void set_num_swarms(::google::protobuf::uint32 value);
+  // optional uint32 seq = 1;
+  bool has_seq() const;
+  private:
+  bool _internal_has_seq() const;
+  public:
+  void clear_seq();
+  uint32_t seq() const;
+  void set_seq(uint32_t value);
+  private:
+  uint32_t _internal_seq() const;
+  void _internal_set_seq(uint32_t value);
+  public:
 
-  // optional uint32 monsters_per_swarm = 3 [default = 10];
-  inline bool has_monsters_per_swarm() const;
-  inline void clear_monsters_per_swarm();
-  static const int kMonstersPerSwarmFieldNumber = 3;
-  inline ::google::protobuf::uint32 monsters_per_swarm() const;
-  inline void set_monsters_per_swarm(::google::protobuf::uint32 value);
+  // optional float rtt_ms = 3;
+  bool has_rtt_ms() const;
+  private:
+  bool _internal_has_rtt_ms() const;
+  public:
+  void clear_rtt_ms();
+  float rtt_ms() const;
+  void set_rtt_ms(float value);
+  private:
+  float _internal_rtt_ms() const;
+  void _internal_set_rtt_ms(float value);
+  public:
 
-  // optional uint32 min_players = 4 [default = 2];
-  inline bool has_min_players() const;
-  inline void clear_min_players();
-  static const int kMinPlayersFieldNumber = 4;
-  inline ::google::protobuf::uint32 min_players() const;
-  inline void set_min_players(::google::protobuf::uint32 value);
+  // @@protoc_insertion_point(class_scope:swarm.game.Ping)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double client_time_;
+    uint32_t seq_;
+    float rtt_ms_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
 
-  // optional uint32 max_players = 5 [default = 4];
-  inline bool has_max_players() const;
-  inline void clear_max_players();
-  static const int kMaxPlayersFieldNumber = 5;
-  inline ::google::protobuf::uint32 max_players() const;
-  inline void set_max_players(::google::protobuf::uint32 value);
+class Pong final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.Pong) */ {
+ public:
+  inline Pong() : Pong(nullptr) {}
+  ~Pong() override;
+  explicit PROTOBUF_CONSTEXPR Pong(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Pong(const Pong& from);
+  Pong(Pong&& from) noexcept
+    : Pong() {
+    *this = ::std::move(from);
+  }
 
-  // optional uint32 initial_health = 6 [default = 10];
-  inline bool has_initial_health() const;
-  inline void clear_initial_health();
-  static const int kInitialHealthFieldNumber = 6;
-  inline ::google::protobuf::uint32 initial_health() const;
-  inline void set_initial_health(::google::protobuf::uint32 value);
+  inline Pong& operator=(const Pong& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Pong& operator=(Pong&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  // @@protoc_insertion_point(class_scope:swarm.game.Config)
- private:
-  inline void set_has_map_name();
-  inline void clear_has_map_name();
-  inline void set_has_num_swarms();
-  inline void clear_has_num_swarms();
-  inline void set_has_monsters_per_swarm();
-  inline void clear_has_monsters_per_swarm();
-  inline void set_has_min_players();
-  inline void clear_has_min_players();
-  inline void set_has_max_players();
-  inline void clear_has_max_players();
-  inline void set_has_initial_health();
-  inline void clear_has_initial_health();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* map_name_;
-  ::google::protobuf::uint32 num_swarms_;
-  ::google::protobuf::uint32 monsters_per_swarm_;
-  ::google::protobuf::uint32 min_players_;
-  ::google::protobuf::uint32 max_players_;
-  ::google::protobuf::uint32 initial_health_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_game_2eproto();
-  friend void protobuf_AssignDesc_game_2eproto();
-  friend void protobuf_ShutdownFile_game_2eproto();
-
-  void InitAsDefaultInstance();
-  static Config* default_instance_;
-};
-// ===================================================================
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Pong& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Pong* internal_default_instance() {
+    return reinterpret_cast<const Pong*>(
+               &_Pong_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-// ===================================================================
+  friend void swap(Pong& a, Pong& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Pong* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Pong* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// Vector2
+  // implements Message ----------------------------------------------
 
-// optional float x = 1;
-inline bool Vector2::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Vector2::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Vector2::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void Vector2::clear_x() {
-  x_ = 0;
-  clear_has_x();
-}
-inline float Vector2::x() const {
-  return x_;
-}
-inline void Vector2::set_x(float value) {
-  set_has_x();
-  x_ = value;
-}
+  Pong* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Pong>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Pong& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Pong& from) {
+    Pong::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// optional float y = 2;
-inline bool Vector2::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Vector2::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Vector2::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Vector2::clear_y() {
-  y_ = 0;
-  clear_has_y();
-}
-inline float Vector2::y() const {
-  return y_;
-}
-inline void Vector2::set_y(float value) {
-  set_has_y();
-  y_ = value;
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Pong* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.Pong";
+  }
+  protected:
+  explicit Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientTimeFieldNumber = 2,
+    kServerReceiveTimeFieldNumber = 3,
+    kServerSendTimeFieldNumber = 4,
+    kSeqFieldNumber = 1,
+  };
+  // optional double client_time = 2;
+  bool has_client_time() const;
+  private:
+  bool _internal_has_client_time() const;
+  public:
+  void clear_client_time();
+  double client_time() const;
+  void set_client_time(double value);
+  private:
+  double _internal_client_time() const;
+  void _internal_set_client_time(double value);
+  public:
+
+  // optional double server_receive_time = 3;
+  bool has_server_receive_time() const;
+  private:
+  bool _internal_has_server_receive_time() const;
+  public:
+  void clear_server_receive_time();
+  double server_receive_time() const;
+  void set_server_receive_time(double value);
+  private:
+  double _internal_server_receive_time() const;
+  void _internal_set_server_receive_time(double value);
+  public:
+
+  // optional double server_send_time = 4;
+  bool has_server_send_time() const;
+  private:
+  bool _internal_has_server_send_time() const;
+  public:
+  void clear_server_send_time();
+  double server_send_time() const;
+  void set_server_send_time(double value);
+  private:
+  double _internal_server_send_time() const;
+  void _internal_set_server_send_time(double value);
+  public:
+
+  // optional uint32 seq = 1;
+  bool has_seq() const;
+  private:
+  bool _internal_has_seq() const;
+  public:
+  void clear_seq();
+  uint32_t seq() const;
+  void set_seq(uint32_t value);
+  private:
+  uint32_t _internal_seq() const;
+  void _internal_set_seq(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.Pong)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double client_time_;
+    double server_receive_time_;
+    double server_send_time_;
+    uint32_t seq_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
 // -------------------------------------------------------------------
 
-// PlayerJoined
+class LockstepAttractor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.LockstepAttractor) */ {
+ public:
+  inline LockstepAttractor() : LockstepAttractor(nullptr) {}
+  ~LockstepAttractor() override;
+  explicit PROTOBUF_CONSTEXPR LockstepAttractor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockstepAttractor(const LockstepAttractor& from);
+  LockstepAttractor(LockstepAttractor&& from) noexcept
+    : LockstepAttractor() {
+    *this = ::std::move(from);
+  }
 
-// optional string name = 1;
-inline bool PlayerJoined::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void PlayerJoined::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void PlayerJoined::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void PlayerJoined::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+  inline LockstepAttractor& operator=(const LockstepAttractor& from) {
+    CopyFrom(from);
+    return *this;
   }
-  clear_has_name();
-}
-inline const ::std::string& PlayerJoined::name() const {
-  return *name_;
-}
-inline void PlayerJoined::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  inline LockstepAttractor& operator=(LockstepAttractor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  name_->assign(value);
-}
-inline void PlayerJoined::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  name_->assign(value);
-}
-inline void PlayerJoined::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* PlayerJoined::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  return name_;
-}
-inline ::std::string* PlayerJoined::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-}
-inline void PlayerJoined::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  static const LockstepAttractor& default_instance() {
+    return *internal_default_instance();
   }
-}
+  static inline const LockstepAttractor* internal_default_instance() {
+    return reinterpret_cast<const LockstepAttractor*>(
+               &_LockstepAttractor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-// optional uint32 id = 2;
-inline bool PlayerJoined::has_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PlayerJoined::set_has_id() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PlayerJoined::clear_has_id() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void PlayerJoined::clear_id() {
-  id_ = 0u;
-  clear_has_id();
-}
-inline ::google::protobuf::uint32 PlayerJoined::id() const {
-  return id_;
-}
-inline void PlayerJoined::set_id(::google::protobuf::uint32 value) {
-  set_has_id();
-  id_ = value;
-}
+  friend void swap(LockstepAttractor& a, LockstepAttractor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockstepAttractor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockstepAttractor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockstepAttractor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockstepAttractor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockstepAttractor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockstepAttractor& from) {
+    LockstepAttractor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockstepAttractor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.LockstepAttractor";
+  }
+  protected:
+  explicit LockstepAttractor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kRadiusFieldNumber = 3,
+  };
+  // optional sint32 x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional sint32 y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional sint32 radius = 3;
+  bool has_radius() const;
+  private:
+  bool _internal_has_radius() const;
+  public:
+  void clear_radius();
+  int32_t radius() const;
+  void set_radius(int32_t value);
+  private:
+  int32_t _internal_radius() const;
+  void _internal_set_radius(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.LockstepAttractor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+    int32_t radius_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockstepFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.LockstepFrame) */ {
+ public:
+  inline LockstepFrame() : LockstepFrame(nullptr) {}
+  ~LockstepFrame() override;
+  explicit PROTOBUF_CONSTEXPR LockstepFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockstepFrame(const LockstepFrame& from);
+  LockstepFrame(LockstepFrame&& from) noexcept
+    : LockstepFrame() {
+    *this = ::std::move(from);
+  }
+
+  inline LockstepFrame& operator=(const LockstepFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockstepFrame& operator=(LockstepFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockstepFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockstepFrame* internal_default_instance() {
+    return reinterpret_cast<const LockstepFrame*>(
+               &_LockstepFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(LockstepFrame& a, LockstepFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockstepFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockstepFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockstepFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockstepFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockstepFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockstepFrame& from) {
+    LockstepFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockstepFrame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.LockstepFrame";
+  }
+  protected:
+  explicit LockstepFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRemovedIdFieldNumber = 2,
+    kAttractorFieldNumber = 3,
+    kHashFieldNumber = 4,
+    kTickFieldNumber = 1,
+  };
+  // repeated uint32 removed_id = 2;
+  int removed_id_size() const;
+  private:
+  int _internal_removed_id_size() const;
+  public:
+  void clear_removed_id();
+  private:
+  uint32_t _internal_removed_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_removed_id() const;
+  void _internal_add_removed_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_removed_id();
+  public:
+  uint32_t removed_id(int index) const;
+  void set_removed_id(int index, uint32_t value);
+  void add_removed_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      removed_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_removed_id();
+
+  // repeated .swarm.game.LockstepAttractor attractor = 3;
+  int attractor_size() const;
+  private:
+  int _internal_attractor_size() const;
+  public:
+  void clear_attractor();
+  ::swarm::game::LockstepAttractor* mutable_attractor(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepAttractor >*
+      mutable_attractor();
+  private:
+  const ::swarm::game::LockstepAttractor& _internal_attractor(int index) const;
+  ::swarm::game::LockstepAttractor* _internal_add_attractor();
+  public:
+  const ::swarm::game::LockstepAttractor& attractor(int index) const;
+  ::swarm::game::LockstepAttractor* add_attractor();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepAttractor >&
+      attractor() const;
+
+  // optional uint64 hash = 4;
+  bool has_hash() const;
+  private:
+  bool _internal_has_hash() const;
+  public:
+  void clear_hash();
+  uint64_t hash() const;
+  void set_hash(uint64_t value);
+  private:
+  uint64_t _internal_hash() const;
+  void _internal_set_hash(uint64_t value);
+  public:
+
+  // optional uint32 tick = 1;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.LockstepFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > removed_id_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepAttractor > attractor_;
+    uint64_t hash_;
+    uint32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockstepFrames final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.LockstepFrames) */ {
+ public:
+  inline LockstepFrames() : LockstepFrames(nullptr) {}
+  ~LockstepFrames() override;
+  explicit PROTOBUF_CONSTEXPR LockstepFrames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockstepFrames(const LockstepFrames& from);
+  LockstepFrames(LockstepFrames&& from) noexcept
+    : LockstepFrames() {
+    *this = ::std::move(from);
+  }
+
+  inline LockstepFrames& operator=(const LockstepFrames& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockstepFrames& operator=(LockstepFrames&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockstepFrames& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockstepFrames* internal_default_instance() {
+    return reinterpret_cast<const LockstepFrames*>(
+               &_LockstepFrames_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(LockstepFrames& a, LockstepFrames& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockstepFrames* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockstepFrames* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockstepFrames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockstepFrames>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockstepFrames& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockstepFrames& from) {
+    LockstepFrames::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockstepFrames* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.LockstepFrames";
+  }
+  protected:
+  explicit LockstepFrames(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameFieldNumber = 1,
+    kServerTimeFieldNumber = 3,
+    kTickFieldNumber = 2,
+  };
+  // repeated .swarm.game.LockstepFrame frame = 1;
+  int frame_size() const;
+  private:
+  int _internal_frame_size() const;
+  public:
+  void clear_frame();
+  ::swarm::game::LockstepFrame* mutable_frame(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepFrame >*
+      mutable_frame();
+  private:
+  const ::swarm::game::LockstepFrame& _internal_frame(int index) const;
+  ::swarm::game::LockstepFrame* _internal_add_frame();
+  public:
+  const ::swarm::game::LockstepFrame& frame(int index) const;
+  ::swarm::game::LockstepFrame* add_frame();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepFrame >&
+      frame() const;
+
+  // optional double server_time = 3;
+  bool has_server_time() const;
+  private:
+  bool _internal_has_server_time() const;
+  public:
+  void clear_server_time();
+  double server_time() const;
+  void set_server_time(double value);
+  private:
+  double _internal_server_time() const;
+  void _internal_set_server_time(double value);
+  public:
+
+  // optional uint32 tick = 2;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.LockstepFrames)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepFrame > frame_;
+    double server_time_;
+    uint32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.ServerMessage) */ {
+ public:
+  inline ServerMessage() : ServerMessage(nullptr) {}
+  ~ServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerMessage(const ServerMessage& from);
+  ServerMessage(ServerMessage&& from) noexcept
+    : ServerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerMessage& operator=(const ServerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerMessage& operator=(ServerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerMessage* internal_default_instance() {
+    return reinterpret_cast<const ServerMessage*>(
+               &_ServerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(ServerMessage& a, ServerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerMessage& from) {
+    ServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.ServerMessage";
+  }
+  protected:
+  explicit ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ServerMessage_Type Type;
+  static constexpr Type GAME_STARTED =
+    ServerMessage_Type_GAME_STARTED;
+  static constexpr Type PLAYER_JOINED =
+    ServerMessage_Type_PLAYER_JOINED;
+  static constexpr Type PLAYER_LEFT =
+    ServerMessage_Type_PLAYER_LEFT;
+  static constexpr Type SWARM_STATE =
+    ServerMessage_Type_SWARM_STATE;
+  static constexpr Type PLAYER_STATE =
+    ServerMessage_Type_PLAYER_STATE;
+  static constexpr Type PLAYER_DIED =
+    ServerMessage_Type_PLAYER_DIED;
+  static constexpr Type GAME_ENDED =
+    ServerMessage_Type_GAME_ENDED;
+  static constexpr Type MONSTER_DIED =
+    ServerMessage_Type_MONSTER_DIED;
+  static constexpr Type PONG =
+    ServerMessage_Type_PONG;
+  static constexpr Type LOCKSTEP_FRAMES =
+    ServerMessage_Type_LOCKSTEP_FRAMES;
+  static inline bool Type_IsValid(int value) {
+    return ServerMessage_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ServerMessage_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ServerMessage_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ServerMessage_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return ServerMessage_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ServerMessage_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ServerMessage_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGameStartedFieldNumber = 2,
+    kPlayerJoinedFieldNumber = 3,
+    kPlayerLeftFieldNumber = 4,
+    kSwarmStateFieldNumber = 5,
+    kPlayerStateFieldNumber = 6,
+    kPlayerDiedFieldNumber = 7,
+    kGameEndedFieldNumber = 8,
+    kMonsterDiedFieldNumber = 9,
+    kPongFieldNumber = 10,
+    kLockstepFramesFieldNumber = 11,
+    kTypeFieldNumber = 1,
+  };
+  // optional .swarm.game.GameStarted game_started = 2;
+  bool has_game_started() const;
+  private:
+  bool _internal_has_game_started() const;
+  public:
+  void clear_game_started();
+  const ::swarm::game::GameStarted& game_started() const;
+  PROTOBUF_NODISCARD ::swarm::game::GameStarted* release_game_started();
+  ::swarm::game::GameStarted* mutable_game_started();
+  void set_allocated_game_started(::swarm::game::GameStarted* game_started);
+  private:
+  const ::swarm::game::GameStarted& _internal_game_started() const;
+  ::swarm::game::GameStarted* _internal_mutable_game_started();
+  public:
+  void unsafe_arena_set_allocated_game_started(
+      ::swarm::game::GameStarted* game_started);
+  ::swarm::game::GameStarted* unsafe_arena_release_game_started();
+
+  // optional .swarm.game.PlayerJoined player_joined = 3;
+  bool has_player_joined() const;
+  private:
+  bool _internal_has_player_joined() const;
+  public:
+  void clear_player_joined();
+  const ::swarm::game::PlayerJoined& player_joined() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerJoined* release_player_joined();
+  ::swarm::game::PlayerJoined* mutable_player_joined();
+  void set_allocated_player_joined(::swarm::game::PlayerJoined* player_joined);
+  private:
+  const ::swarm::game::PlayerJoined& _internal_player_joined() const;
+  ::swarm::game::PlayerJoined* _internal_mutable_player_joined();
+  public:
+  void unsafe_arena_set_allocated_player_joined(
+      ::swarm::game::PlayerJoined* player_joined);
+  ::swarm::game::PlayerJoined* unsafe_arena_release_player_joined();
+
+  // optional .swarm.game.PlayerLeft player_left = 4;
+  bool has_player_left() const;
+  private:
+  bool _internal_has_player_left() const;
+  public:
+  void clear_player_left();
+  const ::swarm::game::PlayerLeft& player_left() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerLeft* release_player_left();
+  ::swarm::game::PlayerLeft* mutable_player_left();
+  void set_allocated_player_left(::swarm::game::PlayerLeft* player_left);
+  private:
+  const ::swarm::game::PlayerLeft& _internal_player_left() const;
+  ::swarm::game::PlayerLeft* _internal_mutable_player_left();
+  public:
+  void unsafe_arena_set_allocated_player_left(
+      ::swarm::game::PlayerLeft* player_left);
+  ::swarm::game::PlayerLeft* unsafe_arena_release_player_left();
+
+  // optional .swarm.game.SwarmState swarm_state = 5;
+  bool has_swarm_state() const;
+  private:
+  bool _internal_has_swarm_state() const;
+  public:
+  void clear_swarm_state();
+  const ::swarm::game::SwarmState& swarm_state() const;
+  PROTOBUF_NODISCARD ::swarm::game::SwarmState* release_swarm_state();
+  ::swarm::game::SwarmState* mutable_swarm_state();
+  void set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state);
+  private:
+  const ::swarm::game::SwarmState& _internal_swarm_state() const;
+  ::swarm::game::SwarmState* _internal_mutable_swarm_state();
+  public:
+  void unsafe_arena_set_allocated_swarm_state(
+      ::swarm::game::SwarmState* swarm_state);
+  ::swarm::game::SwarmState* unsafe_arena_release_swarm_state();
+
+  // optional .swarm.game.PlayerState player_state = 6;
+  bool has_player_state() const;
+  private:
+  bool _internal_has_player_state() const;
+  public:
+  void clear_player_state();
+  const ::swarm::game::PlayerState& player_state() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerState* release_player_state();
+  ::swarm::game::PlayerState* mutable_player_state();
+  void set_allocated_player_state(::swarm::game::PlayerState* player_state);
+  private:
+  const ::swarm::game::PlayerState& _internal_player_state() const;
+  ::swarm::game::PlayerState* _internal_mutable_player_state();
+  public:
+  void unsafe_arena_set_allocated_player_state(
+      ::swarm::game::PlayerState* player_state);
+  ::swarm::game::PlayerState* unsafe_arena_release_player_state();
+
+  // optional .swarm.game.PlayerDied player_died = 7;
+  bool has_player_died() const;
+  private:
+  bool _internal_has_player_died() const;
+  public:
+  void clear_player_died();
+  const ::swarm::game::PlayerDied& player_died() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerDied* release_player_died();
+  ::swarm::game::PlayerDied* mutable_player_died();
+  void set_allocated_player_died(::swarm::game::PlayerDied* player_died);
+  private:
+  const ::swarm::game::PlayerDied& _internal_player_died() const;
+  ::swarm::game::PlayerDied* _internal_mutable_player_died();
+  public:
+  void unsafe_arena_set_allocated_player_died(
+      ::swarm::game::PlayerDied* player_died);
+  ::swarm::game::PlayerDied* unsafe_arena_release_player_died();
+
+  // optional .swarm.game.GameEnded game_ended = 8;
+  bool has_game_ended() const;
+  private:
+  bool _internal_has_game_ended() const;
+  public:
+  void clear_game_ended();
+  const ::swarm::game::GameEnded& game_ended() const;
+  PROTOBUF_NODISCARD ::swarm::game::GameEnded* release_game_ended();
+  ::swarm::game::GameEnded* mutable_game_ended();
+  void set_allocated_game_ended(::swarm::game::GameEnded* game_ended);
+  private:
+  const ::swarm::game::GameEnded& _internal_game_ended() const;
+  ::swarm::game::GameEnded* _internal_mutable_game_ended();
+  public:
+  void unsafe_arena_set_allocated_game_ended(
+      ::swarm::game::GameEnded* game_ended);
+  ::swarm::game::GameEnded* unsafe_arena_release_game_ended();
+
+  // optional .swarm.game.MonsterDied monster_died = 9;
+  bool has_monster_died() const;
+  private:
+  bool _internal_has_monster_died() const;
+  public:
+  void clear_monster_died();
+  const ::swarm::game::MonsterDied& monster_died() const;
+  PROTOBUF_NODISCARD ::swarm::game::MonsterDied* release_monster_died();
+  ::swarm::game::MonsterDied* mutable_monster_died();
+  void set_allocated_monster_died(::swarm::game::MonsterDied* monster_died);
+  private:
+  const ::swarm::game::MonsterDied& _internal_monster_died() const;
+  ::swarm::game::MonsterDied* _internal_mutable_monster_died();
+  public:
+  void unsafe_arena_set_allocated_monster_died(
+      ::swarm::game::MonsterDied* monster_died);
+  ::swarm::game::MonsterDied* unsafe_arena_release_monster_died();
+
+  // optional .swarm.game.Pong pong = 10;
+  bool has_pong() const;
+  private:
+  bool _internal_has_pong() const;
+  public:
+  void clear_pong();
+  const ::swarm::game::Pong& pong() const;
+  PROTOBUF_NODISCARD ::swarm::game::Pong* release_pong();
+  ::swarm::game::Pong* mutable_pong();
+  void set_allocated_pong(::swarm::game::Pong* pong);
+  private:
+  const ::swarm::game::Pong& _internal_pong() const;
+  ::swarm::game::Pong* _internal_mutable_pong();
+  public:
+  void unsafe_arena_set_allocated_pong(
+      ::swarm::game::Pong* pong);
+  ::swarm::game::Pong* unsafe_arena_release_pong();
+
+  // optional .swarm.game.LockstepFrames lockstep_frames = 11;
+  bool has_lockstep_frames() const;
+  private:
+  bool _internal_has_lockstep_frames() const;
+  public:
+  void clear_lockstep_frames();
+  const ::swarm::game::LockstepFrames& lockstep_frames() const;
+  PROTOBUF_NODISCARD ::swarm::game::LockstepFrames* release_lockstep_frames();
+  ::swarm::game::LockstepFrames* mutable_lockstep_frames();
+  void set_allocated_lockstep_frames(::swarm::game::LockstepFrames* lockstep_frames);
+  private:
+  const ::swarm::game::LockstepFrames& _internal_lockstep_frames() const;
+  ::swarm::game::LockstepFrames* _internal_mutable_lockstep_frames();
+  public:
+  void unsafe_arena_set_allocated_lockstep_frames(
+      ::swarm::game::LockstepFrames* lockstep_frames);
+  ::swarm::game::LockstepFrames* unsafe_arena_release_lockstep_frames();
+
+  // required .swarm.game.ServerMessage.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::swarm::game::ServerMessage_Type type() const;
+  void set_type(::swarm::game::ServerMessage_Type value);
+  private:
+  ::swarm::game::ServerMessage_Type _internal_type() const;
+  void _internal_set_type(::swarm::game::ServerMessage_Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.ServerMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::swarm::game::GameStarted* game_started_;
+    ::swarm::game::PlayerJoined* player_joined_;
+    ::swarm::game::PlayerLeft* player_left_;
+    ::swarm::game::SwarmState* swarm_state_;
+    ::swarm::game::PlayerState* player_state_;
+    ::swarm::game::PlayerDied* player_died_;
+    ::swarm::game::GameEnded* game_ended_;
+    ::swarm::game::MonsterDied* monster_died_;
+    ::swarm::game::Pong* pong_;
+    ::swarm::game::LockstepFrames* lockstep_frames_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PlayerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.PlayerMessage) */ {
+ public:
+  inline PlayerMessage() : PlayerMessage(nullptr) {}
+  ~PlayerMessage() override;
+  explicit PROTOBUF_CONSTEXPR PlayerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayerMessage(const PlayerMessage& from);
+  PlayerMessage(PlayerMessage&& from) noexcept
+    : PlayerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PlayerMessage& operator=(const PlayerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PlayerMessage& operator=(PlayerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerMessage* internal_default_instance() {
+    return reinterpret_cast<const PlayerMessage*>(
+               &_PlayerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(PlayerMessage& a, PlayerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PlayerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerMessage& from) {
+    PlayerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.PlayerMessage";
+  }
+  protected:
+  explicit PlayerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PlayerMessage_Type Type;
+  static constexpr Type PLAYER_CLICK =
+    PlayerMessage_Type_PLAYER_CLICK;
+  static constexpr Type PLAYER_INPUT =
+    PlayerMessage_Type_PLAYER_INPUT;
+  static constexpr Type PLAYER_HELLO =
+    PlayerMessage_Type_PLAYER_HELLO;
+  static constexpr Type PLAYER_PING =
+    PlayerMessage_Type_PLAYER_PING;
+  static inline bool Type_IsValid(int value) {
+    return PlayerMessage_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    PlayerMessage_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    PlayerMessage_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    PlayerMessage_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return PlayerMessage_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return PlayerMessage_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return PlayerMessage_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInputFieldNumber = 4,
+    kClickFieldNumber = 3,
+    kHelloFieldNumber = 5,
+    kPingFieldNumber = 6,
+    kTypeFieldNumber = 1,
+  };
+  // repeated .swarm.game.PlayerInput input = 4;
+  int input_size() const;
+  private:
+  int _internal_input_size() const;
+  public:
+  void clear_input();
+  ::swarm::game::PlayerInput* mutable_input(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::PlayerInput >*
+      mutable_input();
+  private:
+  const ::swarm::game::PlayerInput& _internal_input(int index) const;
+  ::swarm::game::PlayerInput* _internal_add_input();
+  public:
+  const ::swarm::game::PlayerInput& input(int index) const;
+  ::swarm::game::PlayerInput* add_input();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::PlayerInput >&
+      input() const;
+
+  // optional .swarm.game.PlayerClick click = 3;
+  bool has_click() const;
+  private:
+  bool _internal_has_click() const;
+  public:
+  void clear_click();
+  const ::swarm::game::PlayerClick& click() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerClick* release_click();
+  ::swarm::game::PlayerClick* mutable_click();
+  void set_allocated_click(::swarm::game::PlayerClick* click);
+  private:
+  const ::swarm::game::PlayerClick& _internal_click() const;
+  ::swarm::game::PlayerClick* _internal_mutable_click();
+  public:
+  void unsafe_arena_set_allocated_click(
+      ::swarm::game::PlayerClick* click);
+  ::swarm::game::PlayerClick* unsafe_arena_release_click();
+
+  // optional .swarm.game.PlayerHello hello = 5;
+  bool has_hello() const;
+  private:
+  bool _internal_has_hello() const;
+  public:
+  void clear_hello();
+  const ::swarm::game::PlayerHello& hello() const;
+  PROTOBUF_NODISCARD ::swarm::game::PlayerHello* release_hello();
+  ::swarm::game::PlayerHello* mutable_hello();
+  void set_allocated_hello(::swarm::game::PlayerHello* hello);
+  private:
+  const ::swarm::game::PlayerHello& _internal_hello() const;
+  ::swarm::game::PlayerHello* _internal_mutable_hello();
+  public:
+  void unsafe_arena_set_allocated_hello(
+      ::swarm::game::PlayerHello* hello);
+  ::swarm::game::PlayerHello* unsafe_arena_release_hello();
+
+  // optional .swarm.game.Ping ping = 6;
+  bool has_ping() const;
+  private:
+  bool _internal_has_ping() const;
+  public:
+  void clear_ping();
+  const ::swarm::game::Ping& ping() const;
+  PROTOBUF_NODISCARD ::swarm::game::Ping* release_ping();
+  ::swarm::game::Ping* mutable_ping();
+  void set_allocated_ping(::swarm::game::Ping* ping);
+  private:
+  const ::swarm::game::Ping& _internal_ping() const;
+  ::swarm::game::Ping* _internal_mutable_ping();
+  public:
+  void unsafe_arena_set_allocated_ping(
+      ::swarm::game::Ping* ping);
+  ::swarm::game::Ping* unsafe_arena_release_ping();
+
+  // required .swarm.game.PlayerMessage.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::swarm::game::PlayerMessage_Type type() const;
+  void set_type(::swarm::game::PlayerMessage_Type value);
+  private:
+  ::swarm::game::PlayerMessage_Type _internal_type() const;
+  void _internal_set_type(::swarm::game::PlayerMessage_Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.PlayerMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::PlayerInput > input_;
+    ::swarm::game::PlayerClick* click_;
+    ::swarm::game::PlayerHello* hello_;
+    ::swarm::game::Ping* ping_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Config final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.Config) */ {
+ public:
+  inline Config() : Config(nullptr) {}
+  ~Config() override;
+  explicit PROTOBUF_CONSTEXPR Config(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Config(const Config& from);
+  Config(Config&& from) noexcept
+    : Config() {
+    *this = ::std::move(from);
+  }
+
+  inline Config& operator=(const Config& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Config& operator=(Config&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Config& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Config* internal_default_instance() {
+    return reinterpret_cast<const Config*>(
+               &_Config_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(Config& a, Config& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Config* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Config* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Config* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Config>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Config& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Config& from) {
+    Config::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Config* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.Config";
+  }
+  protected:
+  explicit Config(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Config_MonsterCompression MonsterCompression;
+  static constexpr MonsterCompression UNCOMPRESSED =
+    Config_MonsterCompression_UNCOMPRESSED;
+  static constexpr MonsterCompression ID_ORDER =
+    Config_MonsterCompression_ID_ORDER;
+  static constexpr MonsterCompression SPATIAL_ORDER =
+    Config_MonsterCompression_SPATIAL_ORDER;
+  static inline bool MonsterCompression_IsValid(int value) {
+    return Config_MonsterCompression_IsValid(value);
+  }
+  static constexpr MonsterCompression MonsterCompression_MIN =
+    Config_MonsterCompression_MonsterCompression_MIN;
+  static constexpr MonsterCompression MonsterCompression_MAX =
+    Config_MonsterCompression_MonsterCompression_MAX;
+  static constexpr int MonsterCompression_ARRAYSIZE =
+    Config_MonsterCompression_MonsterCompression_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  MonsterCompression_descriptor() {
+    return Config_MonsterCompression_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& MonsterCompression_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, MonsterCompression>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function MonsterCompression_Name.");
+    return Config_MonsterCompression_Name(enum_t_value);
+  }
+  static inline bool MonsterCompression_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      MonsterCompression* value) {
+    return Config_MonsterCompression_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapNameFieldNumber = 1,
+    kSharedSnapshotNameFieldNumber = 17,
+    kMaxHistoryKbFieldNumber = 9,
+    kLockstepFieldNumber = 18,
+    kMonsterCompressionFieldNumber = 20,
+    kAggregateDistanceFieldNumber = 21,
+    kNumSwarmsFieldNumber = 2,
+    kMonstersPerSwarmFieldNumber = 3,
+    kMinPlayersFieldNumber = 4,
+    kMaxPlayersFieldNumber = 5,
+    kInitialHealthFieldNumber = 6,
+    kSnapshotIntervalMsFieldNumber = 7,
+    kMaxRewindMsFieldNumber = 8,
+    kDeadReckoningToleranceFieldNumber = 10,
+    kMonsterRefreshMsFieldNumber = 11,
+    kClientBytesPerSecFieldNumber = 12,
+    kUdpEnabledFieldNumber = 13,
+    kSessionTimeoutMsFieldNumber = 14,
+    kHelloTimeoutMsFieldNumber = 15,
+    kInitialStateBytesPerSecFieldNumber = 16,
+    kLockstepHashIntervalMsFieldNumber = 19,
+    kAggregateCellSizeFieldNumber = 22,
+  };
+  // optional string map_name = 1;
+  bool has_map_name() const;
+  private:
+  bool _internal_has_map_name() const;
+  public:
+  void clear_map_name();
+  const std::string& map_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_map_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_map_name();
+  PROTOBUF_NODISCARD std::string* release_map_name();
+  void set_allocated_map_name(std::string* map_name);
+  private:
+  const std::string& _internal_map_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_map_name(const std::string& value);
+  std::string* _internal_mutable_map_name();
+  public:
+
+  // optional string shared_snapshot_name = 17;
+  bool has_shared_snapshot_name() const;
+  private:
+  bool _internal_has_shared_snapshot_name() const;
+  public:
+  void clear_shared_snapshot_name();
+  const std::string& shared_snapshot_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_shared_snapshot_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_shared_snapshot_name();
+  PROTOBUF_NODISCARD std::string* release_shared_snapshot_name();
+  void set_allocated_shared_snapshot_name(std::string* shared_snapshot_name);
+  private:
+  const std::string& _internal_shared_snapshot_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_shared_snapshot_name(const std::string& value);
+  std::string* _internal_mutable_shared_snapshot_name();
+  public:
+
+  // optional uint32 max_history_kb = 9;
+  bool has_max_history_kb() const;
+  private:
+  bool _internal_has_max_history_kb() const;
+  public:
+  void clear_max_history_kb();
+  uint32_t max_history_kb() const;
+  void set_max_history_kb(uint32_t value);
+  private:
+  uint32_t _internal_max_history_kb() const;
+  void _internal_set_max_history_kb(uint32_t value);
+  public:
+
+  // optional bool lockstep = 18;
+  bool has_lockstep() const;
+  private:
+  bool _internal_has_lockstep() const;
+  public:
+  void clear_lockstep();
+  bool lockstep() const;
+  void set_lockstep(bool value);
+  private:
+  bool _internal_lockstep() const;
+  void _internal_set_lockstep(bool value);
+  public:
+
+  // optional .swarm.game.Config.MonsterCompression monster_compression = 20;
+  bool has_monster_compression() const;
+  private:
+  bool _internal_has_monster_compression() const;
+  public:
+  void clear_monster_compression();
+  ::swarm::game::Config_MonsterCompression monster_compression() const;
+  void set_monster_compression(::swarm::game::Config_MonsterCompression value);
+  private:
+  ::swarm::game::Config_MonsterCompression _internal_monster_compression() const;
+  void _internal_set_monster_compression(::swarm::game::Config_MonsterCompression value);
+  public:
+
+  // optional float aggregate_distance = 21;
+  bool has_aggregate_distance() const;
+  private:
+  bool _internal_has_aggregate_distance() const;
+  public:
+  void clear_aggregate_distance();
+  float aggregate_distance() const;
+  void set_aggregate_distance(float value);
+  private:
+  float _internal_aggregate_distance() const;
+  void _internal_set_aggregate_distance(float value);
+  public:
+
+  // optional uint32 num_swarms = 2 [default = 5];
+  bool has_num_swarms() const;
+  private:
+  bool _internal_has_num_swarms() const;
+  public:
+  void clear_num_swarms();
+  uint32_t num_swarms() const;
+  void set_num_swarms(uint32_t value);
+  private:
+  uint32_t _internal_num_swarms() const;
+  void _internal_set_num_swarms(uint32_t value);
+  public:
+
+  // optional uint32 monsters_per_swarm = 3 [default = 10];
+  bool has_monsters_per_swarm() const;
+  private:
+  bool _internal_has_monsters_per_swarm() const;
+  public:
+  void clear_monsters_per_swarm();
+  uint32_t monsters_per_swarm() const;
+  void set_monsters_per_swarm(uint32_t value);
+  private:
+  uint32_t _internal_monsters_per_swarm() const;
+  void _internal_set_monsters_per_swarm(uint32_t value);
+  public:
+
+  // optional uint32 min_players = 4 [default = 2];
+  bool has_min_players() const;
+  private:
+  bool _internal_has_min_players() const;
+  public:
+  void clear_min_players();
+  uint32_t min_players() const;
+  void set_min_players(uint32_t value);
+  private:
+  uint32_t _internal_min_players() const;
+  void _internal_set_min_players(uint32_t value);
+  public:
+
+  // optional uint32 max_players = 5 [default = 4];
+  bool has_max_players() const;
+  private:
+  bool _internal_has_max_players() const;
+  public:
+  void clear_max_players();
+  uint32_t max_players() const;
+  void set_max_players(uint32_t value);
+  private:
+  uint32_t _internal_max_players() const;
+  void _internal_set_max_players(uint32_t value);
+  public:
+
+  // optional uint32 initial_health = 6 [default = 10];
+  bool has_initial_health() const;
+  private:
+  bool _internal_has_initial_health() const;
+  public:
+  void clear_initial_health();
+  uint32_t initial_health() const;
+  void set_initial_health(uint32_t value);
+  private:
+  uint32_t _internal_initial_health() const;
+  void _internal_set_initial_health(uint32_t value);
+  public:
+
+  // optional uint32 snapshot_interval_ms = 7 [default = 100];
+  bool has_snapshot_interval_ms() const;
+  private:
+  bool _internal_has_snapshot_interval_ms() const;
+  public:
+  void clear_snapshot_interval_ms();
+  uint32_t snapshot_interval_ms() const;
+  void set_snapshot_interval_ms(uint32_t value);
+  private:
+  uint32_t _internal_snapshot_interval_ms() const;
+  void _internal_set_snapshot_interval_ms(uint32_t value);
+  public:
+
+  // optional uint32 max_rewind_ms = 8 [default = 400];
+  bool has_max_rewind_ms() const;
+  private:
+  bool _internal_has_max_rewind_ms() const;
+  public:
+  void clear_max_rewind_ms();
+  uint32_t max_rewind_ms() const;
+  void set_max_rewind_ms(uint32_t value);
+  private:
+  uint32_t _internal_max_rewind_ms() const;
+  void _internal_set_max_rewind_ms(uint32_t value);
+  public:
+
+  // optional float dead_reckoning_tolerance = 10 [default = 1];
+  bool has_dead_reckoning_tolerance() const;
+  private:
+  bool _internal_has_dead_reckoning_tolerance() const;
+  public:
+  void clear_dead_reckoning_tolerance();
+  float dead_reckoning_tolerance() const;
+  void set_dead_reckoning_tolerance(float value);
+  private:
+  float _internal_dead_reckoning_tolerance() const;
+  void _internal_set_dead_reckoning_tolerance(float value);
+  public:
+
+  // optional uint32 monster_refresh_ms = 11 [default = 1000];
+  bool has_monster_refresh_ms() const;
+  private:
+  bool _internal_has_monster_refresh_ms() const;
+  public:
+  void clear_monster_refresh_ms();
+  uint32_t monster_refresh_ms() const;
+  void set_monster_refresh_ms(uint32_t value);
+  private:
+  uint32_t _internal_monster_refresh_ms() const;
+  void _internal_set_monster_refresh_ms(uint32_t value);
+  public:
+
+  // optional uint32 client_bytes_per_sec = 12 [default = 64000];
+  bool has_client_bytes_per_sec() const;
+  private:
+  bool _internal_has_client_bytes_per_sec() const;
+  public:
+  void clear_client_bytes_per_sec();
+  uint32_t client_bytes_per_sec() const;
+  void set_client_bytes_per_sec(uint32_t value);
+  private:
+  uint32_t _internal_client_bytes_per_sec() const;
+  void _internal_set_client_bytes_per_sec(uint32_t value);
+  public:
+
+  // optional bool udp_enabled = 13 [default = true];
+  bool has_udp_enabled() const;
+  private:
+  bool _internal_has_udp_enabled() const;
+  public:
+  void clear_udp_enabled();
+  bool udp_enabled() const;
+  void set_udp_enabled(bool value);
+  private:
+  bool _internal_udp_enabled() const;
+  void _internal_set_udp_enabled(bool value);
+  public:
+
+  // optional uint32 session_timeout_ms = 14 [default = 30000];
+  bool has_session_timeout_ms() const;
+  private:
+  bool _internal_has_session_timeout_ms() const;
+  public:
+  void clear_session_timeout_ms();
+  uint32_t session_timeout_ms() const;
+  void set_session_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_session_timeout_ms() const;
+  void _internal_set_session_timeout_ms(uint32_t value);
+  public:
+
+  // optional uint32 hello_timeout_ms = 15 [default = 5000];
+  bool has_hello_timeout_ms() const;
+  private:
+  bool _internal_has_hello_timeout_ms() const;
+  public:
+  void clear_hello_timeout_ms();
+  uint32_t hello_timeout_ms() const;
+  void set_hello_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_hello_timeout_ms() const;
+  void _internal_set_hello_timeout_ms(uint32_t value);
+  public:
+
+  // optional uint32 initial_state_bytes_per_sec = 16 [default = 256000];
+  bool has_initial_state_bytes_per_sec() const;
+  private:
+  bool _internal_has_initial_state_bytes_per_sec() const;
+  public:
+  void clear_initial_state_bytes_per_sec();
+  uint32_t initial_state_bytes_per_sec() const;
+  void set_initial_state_bytes_per_sec(uint32_t value);
+  private:
+  uint32_t _internal_initial_state_bytes_per_sec() const;
+  void _internal_set_initial_state_bytes_per_sec(uint32_t value);
+  public:
+
+  // optional uint32 lockstep_hash_interval_ms = 19 [default = 1000];
+  bool has_lockstep_hash_interval_ms() const;
+  private:
+  bool _internal_has_lockstep_hash_interval_ms() const;
+  public:
+  void clear_lockstep_hash_interval_ms();
+  uint32_t lockstep_hash_interval_ms() const;
+  void set_lockstep_hash_interval_ms(uint32_t value);
+  private:
+  uint32_t _internal_lockstep_hash_interval_ms() const;
+  void _internal_set_lockstep_hash_interval_ms(uint32_t value);
+  public:
+
+  // optional float aggregate_cell_size = 22 [default = 64];
+  bool has_aggregate_cell_size() const;
+  private:
+  bool _internal_has_aggregate_cell_size() const;
+  public:
+  void clear_aggregate_cell_size();
+  float aggregate_cell_size() const;
+  void set_aggregate_cell_size(float value);
+  private:
+  float _internal_aggregate_cell_size() const;
+  void _internal_set_aggregate_cell_size(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.Config)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr map_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr shared_snapshot_name_;
+    uint32_t max_history_kb_;
+    bool lockstep_;
+    int monster_compression_;
+    float aggregate_distance_;
+    uint32_t num_swarms_;
+    uint32_t monsters_per_swarm_;
+    uint32_t min_players_;
+    uint32_t max_players_;
+    uint32_t initial_health_;
+    uint32_t snapshot_interval_ms_;
+    uint32_t max_rewind_ms_;
+    float dead_reckoning_tolerance_;
+    uint32_t monster_refresh_ms_;
+    uint32_t client_bytes_per_sec_;
+    bool udp_enabled_;
+    uint32_t session_timeout_ms_;
+    uint32_t hello_timeout_ms_;
+    uint32_t initial_state_bytes_per_sec_;
+    uint32_t lockstep_hash_interval_ms_;
+    float aggregate_cell_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LinkConditions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.LinkConditions) */ {
+ public:
+  inline LinkConditions() : LinkConditions(nullptr) {}
+  ~LinkConditions() override;
+  explicit PROTOBUF_CONSTEXPR LinkConditions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LinkConditions(const LinkConditions& from);
+  LinkConditions(LinkConditions&& from) noexcept
+    : LinkConditions() {
+    *this = ::std::move(from);
+  }
+
+  inline LinkConditions& operator=(const LinkConditions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LinkConditions& operator=(LinkConditions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LinkConditions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LinkConditions* internal_default_instance() {
+    return reinterpret_cast<const LinkConditions*>(
+               &_LinkConditions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(LinkConditions& a, LinkConditions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LinkConditions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LinkConditions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LinkConditions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LinkConditions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LinkConditions& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LinkConditions& from) {
+    LinkConditions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LinkConditions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.LinkConditions";
+  }
+  protected:
+  explicit LinkConditions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LinkConditions_Distribution Distribution;
+  static constexpr Distribution UNIFORM =
+    LinkConditions_Distribution_UNIFORM;
+  static constexpr Distribution NORMAL =
+    LinkConditions_Distribution_NORMAL;
+  static constexpr Distribution PARETO =
+    LinkConditions_Distribution_PARETO;
+  static inline bool Distribution_IsValid(int value) {
+    return LinkConditions_Distribution_IsValid(value);
+  }
+  static constexpr Distribution Distribution_MIN =
+    LinkConditions_Distribution_Distribution_MIN;
+  static constexpr Distribution Distribution_MAX =
+    LinkConditions_Distribution_Distribution_MAX;
+  static constexpr int Distribution_ARRAYSIZE =
+    LinkConditions_Distribution_Distribution_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Distribution_descriptor() {
+    return LinkConditions_Distribution_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Distribution_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Distribution>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Distribution_Name.");
+    return LinkConditions_Distribution_Name(enum_t_value);
+  }
+  static inline bool Distribution_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Distribution* value) {
+    return LinkConditions_Distribution_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDelayMsFieldNumber = 1,
+    kJitterMsFieldNumber = 2,
+    kLossFieldNumber = 4,
+    kLossBurstFieldNumber = 5,
+    kReorderFieldNumber = 6,
+    kDuplicateFieldNumber = 8,
+    kBytesPerSecFieldNumber = 9,
+    kQueueMsFieldNumber = 10,
+    kJitterDistributionFieldNumber = 3,
+    kReorderMsFieldNumber = 7,
+  };
+  // optional uint32 delay_ms = 1;
+  bool has_delay_ms() const;
+  private:
+  bool _internal_has_delay_ms() const;
+  public:
+  void clear_delay_ms();
+  uint32_t delay_ms() const;
+  void set_delay_ms(uint32_t value);
+  private:
+  uint32_t _internal_delay_ms() const;
+  void _internal_set_delay_ms(uint32_t value);
+  public:
+
+  // optional uint32 jitter_ms = 2;
+  bool has_jitter_ms() const;
+  private:
+  bool _internal_has_jitter_ms() const;
+  public:
+  void clear_jitter_ms();
+  uint32_t jitter_ms() const;
+  void set_jitter_ms(uint32_t value);
+  private:
+  uint32_t _internal_jitter_ms() const;
+  void _internal_set_jitter_ms(uint32_t value);
+  public:
+
+  // optional float loss = 4;
+  bool has_loss() const;
+  private:
+  bool _internal_has_loss() const;
+  public:
+  void clear_loss();
+  float loss() const;
+  void set_loss(float value);
+  private:
+  float _internal_loss() const;
+  void _internal_set_loss(float value);
+  public:
+
+  // optional float loss_burst = 5;
+  bool has_loss_burst() const;
+  private:
+  bool _internal_has_loss_burst() const;
+  public:
+  void clear_loss_burst();
+  float loss_burst() const;
+  void set_loss_burst(float value);
+  private:
+  float _internal_loss_burst() const;
+  void _internal_set_loss_burst(float value);
+  public:
+
+  // optional float reorder = 6;
+  bool has_reorder() const;
+  private:
+  bool _internal_has_reorder() const;
+  public:
+  void clear_reorder();
+  float reorder() const;
+  void set_reorder(float value);
+  private:
+  float _internal_reorder() const;
+  void _internal_set_reorder(float value);
+  public:
+
+  // optional float duplicate = 8;
+  bool has_duplicate() const;
+  private:
+  bool _internal_has_duplicate() const;
+  public:
+  void clear_duplicate();
+  float duplicate() const;
+  void set_duplicate(float value);
+  private:
+  float _internal_duplicate() const;
+  void _internal_set_duplicate(float value);
+  public:
+
+  // optional uint32 bytes_per_sec = 9;
+  bool has_bytes_per_sec() const;
+  private:
+  bool _internal_has_bytes_per_sec() const;
+  public:
+  void clear_bytes_per_sec();
+  uint32_t bytes_per_sec() const;
+  void set_bytes_per_sec(uint32_t value);
+  private:
+  uint32_t _internal_bytes_per_sec() const;
+  void _internal_set_bytes_per_sec(uint32_t value);
+  public:
+
+  // optional uint32 queue_ms = 10 [default = 200];
+  bool has_queue_ms() const;
+  private:
+  bool _internal_has_queue_ms() const;
+  public:
+  void clear_queue_ms();
+  uint32_t queue_ms() const;
+  void set_queue_ms(uint32_t value);
+  private:
+  uint32_t _internal_queue_ms() const;
+  void _internal_set_queue_ms(uint32_t value);
+  public:
+
+  // optional .swarm.game.LinkConditions.Distribution jitter_distribution = 3 [default = NORMAL];
+  bool has_jitter_distribution() const;
+  private:
+  bool _internal_has_jitter_distribution() const;
+  public:
+  void clear_jitter_distribution();
+  ::swarm::game::LinkConditions_Distribution jitter_distribution() const;
+  void set_jitter_distribution(::swarm::game::LinkConditions_Distribution value);
+  private:
+  ::swarm::game::LinkConditions_Distribution _internal_jitter_distribution() const;
+  void _internal_set_jitter_distribution(::swarm::game::LinkConditions_Distribution value);
+  public:
+
+  // optional uint32 reorder_ms = 7 [default = 20];
+  bool has_reorder_ms() const;
+  private:
+  bool _internal_has_reorder_ms() const;
+  public:
+  void clear_reorder_ms();
+  uint32_t reorder_ms() const;
+  void set_reorder_ms(uint32_t value);
+  private:
+  uint32_t _internal_reorder_ms() const;
+  void _internal_set_reorder_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.LinkConditions)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t delay_ms_;
+    uint32_t jitter_ms_;
+    float loss_;
+    float loss_burst_;
+    float reorder_;
+    float duplicate_;
+    uint32_t bytes_per_sec_;
+    uint32_t queue_ms_;
+    int jitter_distribution_;
+    uint32_t reorder_ms_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LinkScriptStep final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.LinkScriptStep) */ {
+ public:
+  inline LinkScriptStep() : LinkScriptStep(nullptr) {}
+  ~LinkScriptStep() override;
+  explicit PROTOBUF_CONSTEXPR LinkScriptStep(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LinkScriptStep(const LinkScriptStep& from);
+  LinkScriptStep(LinkScriptStep&& from) noexcept
+    : LinkScriptStep() {
+    *this = ::std::move(from);
+  }
+
+  inline LinkScriptStep& operator=(const LinkScriptStep& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LinkScriptStep& operator=(LinkScriptStep&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LinkScriptStep& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LinkScriptStep* internal_default_instance() {
+    return reinterpret_cast<const LinkScriptStep*>(
+               &_LinkScriptStep_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(LinkScriptStep& a, LinkScriptStep& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LinkScriptStep* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LinkScriptStep* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LinkScriptStep* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LinkScriptStep>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LinkScriptStep& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LinkScriptStep& from) {
+    LinkScriptStep::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LinkScriptStep* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.LinkScriptStep";
+  }
+  protected:
+  explicit LinkScriptStep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpFieldNumber = 2,
+    kDownFieldNumber = 3,
+    kBothFieldNumber = 4,
+    kAtFieldNumber = 1,
+  };
+  // optional .swarm.game.LinkConditions up = 2;
+  bool has_up() const;
+  private:
+  bool _internal_has_up() const;
+  public:
+  void clear_up();
+  const ::swarm::game::LinkConditions& up() const;
+  PROTOBUF_NODISCARD ::swarm::game::LinkConditions* release_up();
+  ::swarm::game::LinkConditions* mutable_up();
+  void set_allocated_up(::swarm::game::LinkConditions* up);
+  private:
+  const ::swarm::game::LinkConditions& _internal_up() const;
+  ::swarm::game::LinkConditions* _internal_mutable_up();
+  public:
+  void unsafe_arena_set_allocated_up(
+      ::swarm::game::LinkConditions* up);
+  ::swarm::game::LinkConditions* unsafe_arena_release_up();
+
+  // optional .swarm.game.LinkConditions down = 3;
+  bool has_down() const;
+  private:
+  bool _internal_has_down() const;
+  public:
+  void clear_down();
+  const ::swarm::game::LinkConditions& down() const;
+  PROTOBUF_NODISCARD ::swarm::game::LinkConditions* release_down();
+  ::swarm::game::LinkConditions* mutable_down();
+  void set_allocated_down(::swarm::game::LinkConditions* down);
+  private:
+  const ::swarm::game::LinkConditions& _internal_down() const;
+  ::swarm::game::LinkConditions* _internal_mutable_down();
+  public:
+  void unsafe_arena_set_allocated_down(
+      ::swarm::game::LinkConditions* down);
+  ::swarm::game::LinkConditions* unsafe_arena_release_down();
+
+  // optional .swarm.game.LinkConditions both = 4;
+  bool has_both() const;
+  private:
+  bool _internal_has_both() const;
+  public:
+  void clear_both();
+  const ::swarm::game::LinkConditions& both() const;
+  PROTOBUF_NODISCARD ::swarm::game::LinkConditions* release_both();
+  ::swarm::game::LinkConditions* mutable_both();
+  void set_allocated_both(::swarm::game::LinkConditions* both);
+  private:
+  const ::swarm::game::LinkConditions& _internal_both() const;
+  ::swarm::game::LinkConditions* _internal_mutable_both();
+  public:
+  void unsafe_arena_set_allocated_both(
+      ::swarm::game::LinkConditions* both);
+  ::swarm::game::LinkConditions* unsafe_arena_release_both();
+
+  // optional float at = 1;
+  bool has_at() const;
+  private:
+  bool _internal_has_at() const;
+  public:
+  void clear_at();
+  float at() const;
+  void set_at(float value);
+  private:
+  float _internal_at() const;
+  void _internal_set_at(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.LinkScriptStep)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::swarm::game::LinkConditions* up_;
+    ::swarm::game::LinkConditions* down_;
+    ::swarm::game::LinkConditions* both_;
+    float at_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LinkScript final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:swarm.game.LinkScript) */ {
+ public:
+  inline LinkScript() : LinkScript(nullptr) {}
+  ~LinkScript() override;
+  explicit PROTOBUF_CONSTEXPR LinkScript(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LinkScript(const LinkScript& from);
+  LinkScript(LinkScript&& from) noexcept
+    : LinkScript() {
+    *this = ::std::move(from);
+  }
+
+  inline LinkScript& operator=(const LinkScript& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LinkScript& operator=(LinkScript&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LinkScript& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LinkScript* internal_default_instance() {
+    return reinterpret_cast<const LinkScript*>(
+               &_LinkScript_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(LinkScript& a, LinkScript& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LinkScript* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LinkScript* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LinkScript* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LinkScript>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LinkScript& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LinkScript& from) {
+    LinkScript::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LinkScript* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "swarm.game.LinkScript";
+  }
+  protected:
+  explicit LinkScript(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStepFieldNumber = 1,
+    kRepeatAfterFieldNumber = 2,
+  };
+  // repeated .swarm.game.LinkScriptStep step = 1;
+  int step_size() const;
+  private:
+  int _internal_step_size() const;
+  public:
+  void clear_step();
+  ::swarm::game::LinkScriptStep* mutable_step(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LinkScriptStep >*
+      mutable_step();
+  private:
+  const ::swarm::game::LinkScriptStep& _internal_step(int index) const;
+  ::swarm::game::LinkScriptStep* _internal_add_step();
+  public:
+  const ::swarm::game::LinkScriptStep& step(int index) const;
+  ::swarm::game::LinkScriptStep* add_step();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LinkScriptStep >&
+      step() const;
+
+  // optional float repeat_after = 2;
+  bool has_repeat_after() const;
+  private:
+  bool _internal_has_repeat_after() const;
+  public:
+  void clear_repeat_after();
+  float repeat_after() const;
+  void set_repeat_after(float value);
+  private:
+  float _internal_repeat_after() const;
+  void _internal_set_repeat_after(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:swarm.game.LinkScript)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LinkScriptStep > step_;
+    float repeat_after_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_game_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Vector2
+
+// optional float x = 1;
+inline bool Vector2::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Vector2::has_x() const {
+  return _internal_has_x();
+}
+inline void Vector2::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float Vector2::_internal_x() const {
+  return _impl_.x_;
+}
+inline float Vector2::x() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Vector2.x)
+  return _internal_x();
+}
+inline void Vector2::_internal_set_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void Vector2::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Vector2.x)
+}
+
+// optional float y = 2;
+inline bool Vector2::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Vector2::has_y() const {
+  return _internal_has_y();
+}
+inline void Vector2::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float Vector2::_internal_y() const {
+  return _impl_.y_;
+}
+inline float Vector2::y() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Vector2.y)
+  return _internal_y();
+}
+inline void Vector2::_internal_set_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void Vector2::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Vector2.y)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerJoined
+
+// optional string name = 1;
+inline bool PlayerJoined::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PlayerJoined::has_name() const {
+  return _internal_has_name();
+}
+inline void PlayerJoined::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PlayerJoined::name() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerJoined.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayerJoined::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerJoined.name)
+}
+inline std::string* PlayerJoined::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerJoined.name)
+  return _s;
+}
+inline const std::string& PlayerJoined::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PlayerJoined::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PlayerJoined::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PlayerJoined::release_name() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerJoined.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PlayerJoined::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerJoined.name)
+}
+
+// optional uint32 id = 2;
+inline bool PlayerJoined::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerJoined::has_id() const {
+  return _internal_has_id();
+}
+inline void PlayerJoined::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PlayerJoined::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t PlayerJoined::id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerJoined.id)
+  return _internal_id();
+}
+inline void PlayerJoined::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void PlayerJoined::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerJoined.id)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerLeft
+
+// optional string name = 1;
+inline bool PlayerLeft::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PlayerLeft::has_name() const {
+  return _internal_has_name();
+}
+inline void PlayerLeft::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PlayerLeft::name() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerLeft.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayerLeft::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerLeft.name)
+}
+inline std::string* PlayerLeft::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerLeft.name)
+  return _s;
+}
+inline const std::string& PlayerLeft::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PlayerLeft::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PlayerLeft::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PlayerLeft::release_name() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerLeft.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PlayerLeft::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerLeft.name)
+}
+
+// optional uint32 id = 2;
+inline bool PlayerLeft::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerLeft::has_id() const {
+  return _internal_has_id();
+}
+inline void PlayerLeft::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PlayerLeft::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t PlayerLeft::id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerLeft.id)
+  return _internal_id();
+}
+inline void PlayerLeft::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void PlayerLeft::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerLeft.id)
+}
+
+// -------------------------------------------------------------------
+
+// Monster
+
+// optional .swarm.game.Vector2 acc = 1;
+inline bool Monster::_internal_has_acc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.acc_ != nullptr);
+  return value;
+}
+inline bool Monster::has_acc() const {
+  return _internal_has_acc();
+}
+inline void Monster::clear_acc() {
+  if (_impl_.acc_ != nullptr) _impl_.acc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::Vector2& Monster::_internal_acc() const {
+  const ::swarm::game::Vector2* p = _impl_.acc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& Monster::acc() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Monster.acc)
+  return _internal_acc();
+}
+inline void Monster::unsafe_arena_set_allocated_acc(
+    ::swarm::game::Vector2* acc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acc_);
+  }
+  _impl_.acc_ = acc;
+  if (acc) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.Monster.acc)
+}
+inline ::swarm::game::Vector2* Monster::release_acc() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.acc_;
+  _impl_.acc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* Monster::unsafe_arena_release_acc() {
+  // @@protoc_insertion_point(field_release:swarm.game.Monster.acc)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.acc_;
+  _impl_.acc_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* Monster::_internal_mutable_acc() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.acc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.acc_ = p;
+  }
+  return _impl_.acc_;
+}
+inline ::swarm::game::Vector2* Monster::mutable_acc() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_acc();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Monster.acc)
+  return _msg;
+}
+inline void Monster::set_allocated_acc(::swarm::game::Vector2* acc) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.acc_;
+  }
+  if (acc) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acc);
+    if (message_arena != submessage_arena) {
+      acc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.acc_ = acc;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Monster.acc)
+}
+
+// optional .swarm.game.Vector2 vel = 2;
+inline bool Monster::_internal_has_vel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.vel_ != nullptr);
+  return value;
+}
+inline bool Monster::has_vel() const {
+  return _internal_has_vel();
+}
+inline void Monster::clear_vel() {
+  if (_impl_.vel_ != nullptr) _impl_.vel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::swarm::game::Vector2& Monster::_internal_vel() const {
+  const ::swarm::game::Vector2* p = _impl_.vel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& Monster::vel() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Monster.vel)
+  return _internal_vel();
+}
+inline void Monster::unsafe_arena_set_allocated_vel(
+    ::swarm::game::Vector2* vel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vel_);
+  }
+  _impl_.vel_ = vel;
+  if (vel) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.Monster.vel)
+}
+inline ::swarm::game::Vector2* Monster::release_vel() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::Vector2* temp = _impl_.vel_;
+  _impl_.vel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* Monster::unsafe_arena_release_vel() {
+  // @@protoc_insertion_point(field_release:swarm.game.Monster.vel)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::Vector2* temp = _impl_.vel_;
+  _impl_.vel_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* Monster::_internal_mutable_vel() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.vel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.vel_ = p;
+  }
+  return _impl_.vel_;
+}
+inline ::swarm::game::Vector2* Monster::mutable_vel() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_vel();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Monster.vel)
+  return _msg;
+}
+inline void Monster::set_allocated_vel(::swarm::game::Vector2* vel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.vel_;
+  }
+  if (vel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vel);
+    if (message_arena != submessage_arena) {
+      vel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.vel_ = vel;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Monster.vel)
+}
+
+// optional .swarm.game.Vector2 pos = 3;
+inline bool Monster::_internal_has_pos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pos_ != nullptr);
+  return value;
+}
+inline bool Monster::has_pos() const {
+  return _internal_has_pos();
+}
+inline void Monster::clear_pos() {
+  if (_impl_.pos_ != nullptr) _impl_.pos_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::swarm::game::Vector2& Monster::_internal_pos() const {
+  const ::swarm::game::Vector2* p = _impl_.pos_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& Monster::pos() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Monster.pos)
+  return _internal_pos();
+}
+inline void Monster::unsafe_arena_set_allocated_pos(
+    ::swarm::game::Vector2* pos) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pos_);
+  }
+  _impl_.pos_ = pos;
+  if (pos) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.Monster.pos)
+}
+inline ::swarm::game::Vector2* Monster::release_pos() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::Vector2* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* Monster::unsafe_arena_release_pos() {
+  // @@protoc_insertion_point(field_release:swarm.game.Monster.pos)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::Vector2* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* Monster::_internal_mutable_pos() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.pos_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.pos_ = p;
+  }
+  return _impl_.pos_;
+}
+inline ::swarm::game::Vector2* Monster::mutable_pos() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_pos();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Monster.pos)
+  return _msg;
+}
+inline void Monster::set_allocated_pos(::swarm::game::Vector2* pos) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pos_;
+  }
+  if (pos) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pos);
+    if (message_arena != submessage_arena) {
+      pos = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pos, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.pos_ = pos;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Monster.pos)
+}
+
+// optional float size = 4;
+inline bool Monster::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Monster::has_size() const {
+  return _internal_has_size();
+}
+inline void Monster::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float Monster::_internal_size() const {
+  return _impl_.size_;
+}
+inline float Monster::size() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Monster.size)
+  return _internal_size();
+}
+inline void Monster::_internal_set_size(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.size_ = value;
+}
+inline void Monster::set_size(float value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Monster.size)
+}
+
+// optional uint32 id = 5;
+inline bool Monster::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Monster::has_id() const {
+  return _internal_has_id();
+}
+inline void Monster::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Monster::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Monster::id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Monster.id)
+  return _internal_id();
+}
+inline void Monster::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.id_ = value;
+}
+inline void Monster::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Monster.id)
+}
+
+// repeated sint32 fixed_state = 6 [packed = true];
+inline int Monster::_internal_fixed_state_size() const {
+  return _impl_.fixed_state_.size();
+}
+inline int Monster::fixed_state_size() const {
+  return _internal_fixed_state_size();
+}
+inline void Monster::clear_fixed_state() {
+  _impl_.fixed_state_.Clear();
+}
+inline int32_t Monster::_internal_fixed_state(int index) const {
+  return _impl_.fixed_state_.Get(index);
+}
+inline int32_t Monster::fixed_state(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.Monster.fixed_state)
+  return _internal_fixed_state(index);
+}
+inline void Monster::set_fixed_state(int index, int32_t value) {
+  _impl_.fixed_state_.Set(index, value);
+  // @@protoc_insertion_point(field_set:swarm.game.Monster.fixed_state)
+}
+inline void Monster::_internal_add_fixed_state(int32_t value) {
+  _impl_.fixed_state_.Add(value);
+}
+inline void Monster::add_fixed_state(int32_t value) {
+  _internal_add_fixed_state(value);
+  // @@protoc_insertion_point(field_add:swarm.game.Monster.fixed_state)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Monster::_internal_fixed_state() const {
+  return _impl_.fixed_state_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Monster::fixed_state() const {
+  // @@protoc_insertion_point(field_list:swarm.game.Monster.fixed_state)
+  return _internal_fixed_state();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Monster::_internal_mutable_fixed_state() {
+  return &_impl_.fixed_state_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Monster::mutable_fixed_state() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.Monster.fixed_state)
+  return _internal_mutable_fixed_state();
+}
+
+// -------------------------------------------------------------------
+
+// SwarmAggregate
+
+// optional uint32 id = 1;
+inline bool SwarmAggregate::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SwarmAggregate::has_id() const {
+  return _internal_has_id();
+}
+inline void SwarmAggregate::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t SwarmAggregate::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t SwarmAggregate::id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmAggregate.id)
+  return _internal_id();
+}
+inline void SwarmAggregate::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
+}
+inline void SwarmAggregate::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmAggregate.id)
+}
+
+// optional .swarm.game.Vector2 pos = 2;
+inline bool SwarmAggregate::_internal_has_pos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pos_ != nullptr);
+  return value;
+}
+inline bool SwarmAggregate::has_pos() const {
+  return _internal_has_pos();
+}
+inline void SwarmAggregate::clear_pos() {
+  if (_impl_.pos_ != nullptr) _impl_.pos_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::Vector2& SwarmAggregate::_internal_pos() const {
+  const ::swarm::game::Vector2* p = _impl_.pos_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& SwarmAggregate::pos() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmAggregate.pos)
+  return _internal_pos();
+}
+inline void SwarmAggregate::unsafe_arena_set_allocated_pos(
+    ::swarm::game::Vector2* pos) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pos_);
+  }
+  _impl_.pos_ = pos;
+  if (pos) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.SwarmAggregate.pos)
+}
+inline ::swarm::game::Vector2* SwarmAggregate::release_pos() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* SwarmAggregate::unsafe_arena_release_pos() {
+  // @@protoc_insertion_point(field_release:swarm.game.SwarmAggregate.pos)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* SwarmAggregate::_internal_mutable_pos() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.pos_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.pos_ = p;
+  }
+  return _impl_.pos_;
+}
+inline ::swarm::game::Vector2* SwarmAggregate::mutable_pos() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_pos();
+  // @@protoc_insertion_point(field_mutable:swarm.game.SwarmAggregate.pos)
+  return _msg;
+}
+inline void SwarmAggregate::set_allocated_pos(::swarm::game::Vector2* pos) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pos_;
+  }
+  if (pos) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pos);
+    if (message_arena != submessage_arena) {
+      pos = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pos, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.pos_ = pos;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.SwarmAggregate.pos)
+}
+
+// optional .swarm.game.Vector2 vel = 3;
+inline bool SwarmAggregate::_internal_has_vel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.vel_ != nullptr);
+  return value;
+}
+inline bool SwarmAggregate::has_vel() const {
+  return _internal_has_vel();
+}
+inline void SwarmAggregate::clear_vel() {
+  if (_impl_.vel_ != nullptr) _impl_.vel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::swarm::game::Vector2& SwarmAggregate::_internal_vel() const {
+  const ::swarm::game::Vector2* p = _impl_.vel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& SwarmAggregate::vel() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmAggregate.vel)
+  return _internal_vel();
+}
+inline void SwarmAggregate::unsafe_arena_set_allocated_vel(
+    ::swarm::game::Vector2* vel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vel_);
+  }
+  _impl_.vel_ = vel;
+  if (vel) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.SwarmAggregate.vel)
+}
+inline ::swarm::game::Vector2* SwarmAggregate::release_vel() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::Vector2* temp = _impl_.vel_;
+  _impl_.vel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* SwarmAggregate::unsafe_arena_release_vel() {
+  // @@protoc_insertion_point(field_release:swarm.game.SwarmAggregate.vel)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::Vector2* temp = _impl_.vel_;
+  _impl_.vel_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* SwarmAggregate::_internal_mutable_vel() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.vel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.vel_ = p;
+  }
+  return _impl_.vel_;
+}
+inline ::swarm::game::Vector2* SwarmAggregate::mutable_vel() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_vel();
+  // @@protoc_insertion_point(field_mutable:swarm.game.SwarmAggregate.vel)
+  return _msg;
+}
+inline void SwarmAggregate::set_allocated_vel(::swarm::game::Vector2* vel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.vel_;
+  }
+  if (vel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vel);
+    if (message_arena != submessage_arena) {
+      vel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.vel_ = vel;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.SwarmAggregate.vel)
+}
+
+// optional float extent = 4;
+inline bool SwarmAggregate::_internal_has_extent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SwarmAggregate::has_extent() const {
+  return _internal_has_extent();
+}
+inline void SwarmAggregate::clear_extent() {
+  _impl_.extent_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float SwarmAggregate::_internal_extent() const {
+  return _impl_.extent_;
+}
+inline float SwarmAggregate::extent() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmAggregate.extent)
+  return _internal_extent();
+}
+inline void SwarmAggregate::_internal_set_extent(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.extent_ = value;
+}
+inline void SwarmAggregate::set_extent(float value) {
+  _internal_set_extent(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmAggregate.extent)
+}
+
+// optional uint32 count = 5;
+inline bool SwarmAggregate::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SwarmAggregate::has_count() const {
+  return _internal_has_count();
+}
+inline void SwarmAggregate::clear_count() {
+  _impl_.count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t SwarmAggregate::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t SwarmAggregate::count() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmAggregate.count)
+  return _internal_count();
+}
+inline void SwarmAggregate::_internal_set_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.count_ = value;
+}
+inline void SwarmAggregate::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmAggregate.count)
+}
+
+// -------------------------------------------------------------------
+
+// SwarmState
+
+// repeated .swarm.game.Monster monster = 1;
+inline int SwarmState::_internal_monster_size() const {
+  return _impl_.monster_.size();
+}
+inline int SwarmState::monster_size() const {
+  return _internal_monster_size();
+}
+inline void SwarmState::clear_monster() {
+  _impl_.monster_.Clear();
+}
+inline ::swarm::game::Monster* SwarmState::mutable_monster(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.SwarmState.monster)
+  return _impl_.monster_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Monster >*
+SwarmState::mutable_monster() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.SwarmState.monster)
+  return &_impl_.monster_;
+}
+inline const ::swarm::game::Monster& SwarmState::_internal_monster(int index) const {
+  return _impl_.monster_.Get(index);
+}
+inline const ::swarm::game::Monster& SwarmState::monster(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.monster)
+  return _internal_monster(index);
+}
+inline ::swarm::game::Monster* SwarmState::_internal_add_monster() {
+  return _impl_.monster_.Add();
+}
+inline ::swarm::game::Monster* SwarmState::add_monster() {
+  ::swarm::game::Monster* _add = _internal_add_monster();
+  // @@protoc_insertion_point(field_add:swarm.game.SwarmState.monster)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Monster >&
+SwarmState::monster() const {
+  // @@protoc_insertion_point(field_list:swarm.game.SwarmState.monster)
+  return _impl_.monster_;
+}
+
+// optional uint32 tick = 2;
+inline bool SwarmState::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SwarmState::has_tick() const {
+  return _internal_has_tick();
+}
+inline void SwarmState::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t SwarmState::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t SwarmState::tick() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.tick)
+  return _internal_tick();
+}
+inline void SwarmState::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.tick_ = value;
+}
+inline void SwarmState::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.tick)
+}
+
+// optional double server_time = 3;
+inline bool SwarmState::_internal_has_server_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SwarmState::has_server_time() const {
+  return _internal_has_server_time();
+}
+inline void SwarmState::clear_server_time() {
+  _impl_.server_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SwarmState::_internal_server_time() const {
+  return _impl_.server_time_;
+}
+inline double SwarmState::server_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.server_time)
+  return _internal_server_time();
+}
+inline void SwarmState::_internal_set_server_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.server_time_ = value;
+}
+inline void SwarmState::set_server_time(double value) {
+  _internal_set_server_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.server_time)
+}
+
+// optional bool full = 4;
+inline bool SwarmState::_internal_has_full() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SwarmState::has_full() const {
+  return _internal_has_full();
+}
+inline void SwarmState::clear_full() {
+  _impl_.full_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool SwarmState::_internal_full() const {
+  return _impl_.full_;
+}
+inline bool SwarmState::full() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.full)
+  return _internal_full();
+}
+inline void SwarmState::_internal_set_full(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.full_ = value;
+}
+inline void SwarmState::set_full(bool value) {
+  _internal_set_full(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.full)
+}
+
+// repeated uint32 removed_id = 5;
+inline int SwarmState::_internal_removed_id_size() const {
+  return _impl_.removed_id_.size();
+}
+inline int SwarmState::removed_id_size() const {
+  return _internal_removed_id_size();
+}
+inline void SwarmState::clear_removed_id() {
+  _impl_.removed_id_.Clear();
+}
+inline uint32_t SwarmState::_internal_removed_id(int index) const {
+  return _impl_.removed_id_.Get(index);
+}
+inline uint32_t SwarmState::removed_id(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.removed_id)
+  return _internal_removed_id(index);
+}
+inline void SwarmState::set_removed_id(int index, uint32_t value) {
+  _impl_.removed_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.removed_id)
+}
+inline void SwarmState::_internal_add_removed_id(uint32_t value) {
+  _impl_.removed_id_.Add(value);
+}
+inline void SwarmState::add_removed_id(uint32_t value) {
+  _internal_add_removed_id(value);
+  // @@protoc_insertion_point(field_add:swarm.game.SwarmState.removed_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SwarmState::_internal_removed_id() const {
+  return _impl_.removed_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SwarmState::removed_id() const {
+  // @@protoc_insertion_point(field_list:swarm.game.SwarmState.removed_id)
+  return _internal_removed_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SwarmState::_internal_mutable_removed_id() {
+  return &_impl_.removed_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SwarmState::mutable_removed_id() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.SwarmState.removed_id)
+  return _internal_mutable_removed_id();
+}
+
+// optional uint32 chunk = 6;
+inline bool SwarmState::_internal_has_chunk() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SwarmState::has_chunk() const {
+  return _internal_has_chunk();
+}
+inline void SwarmState::clear_chunk() {
+  _impl_.chunk_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t SwarmState::_internal_chunk() const {
+  return _impl_.chunk_;
+}
+inline uint32_t SwarmState::chunk() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.chunk)
+  return _internal_chunk();
+}
+inline void SwarmState::_internal_set_chunk(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.chunk_ = value;
+}
+inline void SwarmState::set_chunk(uint32_t value) {
+  _internal_set_chunk(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.chunk)
+}
+
+// optional uint32 num_chunks = 7;
+inline bool SwarmState::_internal_has_num_chunks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SwarmState::has_num_chunks() const {
+  return _internal_has_num_chunks();
+}
+inline void SwarmState::clear_num_chunks() {
+  _impl_.num_chunks_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t SwarmState::_internal_num_chunks() const {
+  return _impl_.num_chunks_;
+}
+inline uint32_t SwarmState::num_chunks() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.num_chunks)
+  return _internal_num_chunks();
+}
+inline void SwarmState::_internal_set_num_chunks(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.num_chunks_ = value;
+}
+inline void SwarmState::set_num_chunks(uint32_t value) {
+  _internal_set_num_chunks(value);
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.num_chunks)
+}
+
+// optional bytes packed_monsters = 8;
+inline bool SwarmState::_internal_has_packed_monsters() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SwarmState::has_packed_monsters() const {
+  return _internal_has_packed_monsters();
+}
+inline void SwarmState::clear_packed_monsters() {
+  _impl_.packed_monsters_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SwarmState::packed_monsters() const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.packed_monsters)
+  return _internal_packed_monsters();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SwarmState::set_packed_monsters(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.packed_monsters_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:swarm.game.SwarmState.packed_monsters)
+}
+inline std::string* SwarmState::mutable_packed_monsters() {
+  std::string* _s = _internal_mutable_packed_monsters();
+  // @@protoc_insertion_point(field_mutable:swarm.game.SwarmState.packed_monsters)
+  return _s;
+}
+inline const std::string& SwarmState::_internal_packed_monsters() const {
+  return _impl_.packed_monsters_.Get();
+}
+inline void SwarmState::_internal_set_packed_monsters(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.packed_monsters_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SwarmState::_internal_mutable_packed_monsters() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.packed_monsters_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SwarmState::release_packed_monsters() {
+  // @@protoc_insertion_point(field_release:swarm.game.SwarmState.packed_monsters)
+  if (!_internal_has_packed_monsters()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.packed_monsters_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.packed_monsters_.IsDefault()) {
+    _impl_.packed_monsters_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SwarmState::set_allocated_packed_monsters(std::string* packed_monsters) {
+  if (packed_monsters != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.packed_monsters_.SetAllocated(packed_monsters, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.packed_monsters_.IsDefault()) {
+    _impl_.packed_monsters_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.SwarmState.packed_monsters)
+}
+
+// repeated .swarm.game.SwarmAggregate aggregate = 9;
+inline int SwarmState::_internal_aggregate_size() const {
+  return _impl_.aggregate_.size();
+}
+inline int SwarmState::aggregate_size() const {
+  return _internal_aggregate_size();
+}
+inline void SwarmState::clear_aggregate() {
+  _impl_.aggregate_.Clear();
+}
+inline ::swarm::game::SwarmAggregate* SwarmState::mutable_aggregate(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.SwarmState.aggregate)
+  return _impl_.aggregate_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::SwarmAggregate >*
+SwarmState::mutable_aggregate() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.SwarmState.aggregate)
+  return &_impl_.aggregate_;
+}
+inline const ::swarm::game::SwarmAggregate& SwarmState::_internal_aggregate(int index) const {
+  return _impl_.aggregate_.Get(index);
+}
+inline const ::swarm::game::SwarmAggregate& SwarmState::aggregate(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.SwarmState.aggregate)
+  return _internal_aggregate(index);
+}
+inline ::swarm::game::SwarmAggregate* SwarmState::_internal_add_aggregate() {
+  return _impl_.aggregate_.Add();
+}
+inline ::swarm::game::SwarmAggregate* SwarmState::add_aggregate() {
+  ::swarm::game::SwarmAggregate* _add = _internal_add_aggregate();
+  // @@protoc_insertion_point(field_add:swarm.game.SwarmState.aggregate)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::SwarmAggregate >&
+SwarmState::aggregate() const {
+  // @@protoc_insertion_point(field_list:swarm.game.SwarmState.aggregate)
+  return _impl_.aggregate_;
+}
+
+// -------------------------------------------------------------------
+
+// Player
+
+// optional uint32 id = 1;
+inline bool Player::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Player::has_id() const {
+  return _internal_has_id();
+}
+inline void Player::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Player::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Player::id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Player.id)
+  return _internal_id();
+}
+inline void Player::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.id_ = value;
+}
+inline void Player::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Player.id)
+}
+
+// optional .swarm.game.Vector2 acc = 2;
+inline bool Player::_internal_has_acc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.acc_ != nullptr);
+  return value;
+}
+inline bool Player::has_acc() const {
+  return _internal_has_acc();
+}
+inline void Player::clear_acc() {
+  if (_impl_.acc_ != nullptr) _impl_.acc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::Vector2& Player::_internal_acc() const {
+  const ::swarm::game::Vector2* p = _impl_.acc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& Player::acc() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Player.acc)
+  return _internal_acc();
+}
+inline void Player::unsafe_arena_set_allocated_acc(
+    ::swarm::game::Vector2* acc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acc_);
+  }
+  _impl_.acc_ = acc;
+  if (acc) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.Player.acc)
+}
+inline ::swarm::game::Vector2* Player::release_acc() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.acc_;
+  _impl_.acc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* Player::unsafe_arena_release_acc() {
+  // @@protoc_insertion_point(field_release:swarm.game.Player.acc)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.acc_;
+  _impl_.acc_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* Player::_internal_mutable_acc() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.acc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.acc_ = p;
+  }
+  return _impl_.acc_;
+}
+inline ::swarm::game::Vector2* Player::mutable_acc() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_acc();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Player.acc)
+  return _msg;
+}
+inline void Player::set_allocated_acc(::swarm::game::Vector2* acc) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.acc_;
+  }
+  if (acc) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acc);
+    if (message_arena != submessage_arena) {
+      acc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.acc_ = acc;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Player.acc)
+}
+
+// optional .swarm.game.Vector2 vel = 3;
+inline bool Player::_internal_has_vel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.vel_ != nullptr);
+  return value;
+}
+inline bool Player::has_vel() const {
+  return _internal_has_vel();
+}
+inline void Player::clear_vel() {
+  if (_impl_.vel_ != nullptr) _impl_.vel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::swarm::game::Vector2& Player::_internal_vel() const {
+  const ::swarm::game::Vector2* p = _impl_.vel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& Player::vel() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Player.vel)
+  return _internal_vel();
+}
+inline void Player::unsafe_arena_set_allocated_vel(
+    ::swarm::game::Vector2* vel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vel_);
+  }
+  _impl_.vel_ = vel;
+  if (vel) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.Player.vel)
+}
+inline ::swarm::game::Vector2* Player::release_vel() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::Vector2* temp = _impl_.vel_;
+  _impl_.vel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* Player::unsafe_arena_release_vel() {
+  // @@protoc_insertion_point(field_release:swarm.game.Player.vel)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::Vector2* temp = _impl_.vel_;
+  _impl_.vel_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* Player::_internal_mutable_vel() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.vel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.vel_ = p;
+  }
+  return _impl_.vel_;
+}
+inline ::swarm::game::Vector2* Player::mutable_vel() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_vel();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Player.vel)
+  return _msg;
+}
+inline void Player::set_allocated_vel(::swarm::game::Vector2* vel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.vel_;
+  }
+  if (vel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vel);
+    if (message_arena != submessage_arena) {
+      vel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.vel_ = vel;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Player.vel)
+}
+
+// optional .swarm.game.Vector2 pos = 4;
+inline bool Player::_internal_has_pos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pos_ != nullptr);
+  return value;
+}
+inline bool Player::has_pos() const {
+  return _internal_has_pos();
+}
+inline void Player::clear_pos() {
+  if (_impl_.pos_ != nullptr) _impl_.pos_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::swarm::game::Vector2& Player::_internal_pos() const {
+  const ::swarm::game::Vector2* p = _impl_.pos_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& Player::pos() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Player.pos)
+  return _internal_pos();
+}
+inline void Player::unsafe_arena_set_allocated_pos(
+    ::swarm::game::Vector2* pos) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pos_);
+  }
+  _impl_.pos_ = pos;
+  if (pos) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.Player.pos)
+}
+inline ::swarm::game::Vector2* Player::release_pos() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::Vector2* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* Player::unsafe_arena_release_pos() {
+  // @@protoc_insertion_point(field_release:swarm.game.Player.pos)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::Vector2* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* Player::_internal_mutable_pos() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.pos_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.pos_ = p;
+  }
+  return _impl_.pos_;
+}
+inline ::swarm::game::Vector2* Player::mutable_pos() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_pos();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Player.pos)
+  return _msg;
+}
+inline void Player::set_allocated_pos(::swarm::game::Vector2* pos) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pos_;
+  }
+  if (pos) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pos);
+    if (message_arena != submessage_arena) {
+      pos = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pos, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.pos_ = pos;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Player.pos)
+}
+
+// optional int32 health = 5;
+inline bool Player::_internal_has_health() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Player::has_health() const {
+  return _internal_has_health();
+}
+inline void Player::clear_health() {
+  _impl_.health_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t Player::_internal_health() const {
+  return _impl_.health_;
+}
+inline int32_t Player::health() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Player.health)
+  return _internal_health();
+}
+inline void Player::_internal_set_health(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.health_ = value;
+}
+inline void Player::set_health(int32_t value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Player.health)
+}
+
+// optional uint32 last_input_seq = 6;
+inline bool Player::_internal_has_last_input_seq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Player::has_last_input_seq() const {
+  return _internal_has_last_input_seq();
+}
+inline void Player::clear_last_input_seq() {
+  _impl_.last_input_seq_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Player::_internal_last_input_seq() const {
+  return _impl_.last_input_seq_;
+}
+inline uint32_t Player::last_input_seq() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Player.last_input_seq)
+  return _internal_last_input_seq();
+}
+inline void Player::_internal_set_last_input_seq(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.last_input_seq_ = value;
+}
+inline void Player::set_last_input_seq(uint32_t value) {
+  _internal_set_last_input_seq(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Player.last_input_seq)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerClick
+
+// optional .swarm.game.Vector2 click_pos = 1;
+inline bool PlayerClick::_internal_has_click_pos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.click_pos_ != nullptr);
+  return value;
+}
+inline bool PlayerClick::has_click_pos() const {
+  return _internal_has_click_pos();
+}
+inline void PlayerClick::clear_click_pos() {
+  if (_impl_.click_pos_ != nullptr) _impl_.click_pos_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::Vector2& PlayerClick::_internal_click_pos() const {
+  const ::swarm::game::Vector2* p = _impl_.click_pos_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& PlayerClick::click_pos() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerClick.click_pos)
+  return _internal_click_pos();
+}
+inline void PlayerClick::unsafe_arena_set_allocated_click_pos(
+    ::swarm::game::Vector2* click_pos) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.click_pos_);
+  }
+  _impl_.click_pos_ = click_pos;
+  if (click_pos) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.PlayerClick.click_pos)
+}
+inline ::swarm::game::Vector2* PlayerClick::release_click_pos() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.click_pos_;
+  _impl_.click_pos_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* PlayerClick::unsafe_arena_release_click_pos() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerClick.click_pos)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.click_pos_;
+  _impl_.click_pos_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* PlayerClick::_internal_mutable_click_pos() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.click_pos_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.click_pos_ = p;
+  }
+  return _impl_.click_pos_;
+}
+inline ::swarm::game::Vector2* PlayerClick::mutable_click_pos() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_click_pos();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerClick.click_pos)
+  return _msg;
+}
+inline void PlayerClick::set_allocated_click_pos(::swarm::game::Vector2* click_pos) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.click_pos_;
+  }
+  if (click_pos) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(click_pos);
+    if (message_arena != submessage_arena) {
+      click_pos = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, click_pos, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.click_pos_ = click_pos;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerClick.click_pos)
+}
+
+// optional float click_size = 2;
+inline bool PlayerClick::_internal_has_click_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerClick::has_click_size() const {
+  return _internal_has_click_size();
+}
+inline void PlayerClick::clear_click_size() {
+  _impl_.click_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float PlayerClick::_internal_click_size() const {
+  return _impl_.click_size_;
+}
+inline float PlayerClick::click_size() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerClick.click_size)
+  return _internal_click_size();
+}
+inline void PlayerClick::_internal_set_click_size(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.click_size_ = value;
+}
+inline void PlayerClick::set_click_size(float value) {
+  _internal_set_click_size(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerClick.click_size)
+}
+
+// optional uint32 render_tick = 3;
+inline bool PlayerClick::_internal_has_render_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PlayerClick::has_render_tick() const {
+  return _internal_has_render_tick();
+}
+inline void PlayerClick::clear_render_tick() {
+  _impl_.render_tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PlayerClick::_internal_render_tick() const {
+  return _impl_.render_tick_;
+}
+inline uint32_t PlayerClick::render_tick() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerClick.render_tick)
+  return _internal_render_tick();
+}
+inline void PlayerClick::_internal_set_render_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.render_tick_ = value;
+}
+inline void PlayerClick::set_render_tick(uint32_t value) {
+  _internal_set_render_tick(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerClick.render_tick)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerInput
+
+// optional uint32 seq = 1;
+inline bool PlayerInput::_internal_has_seq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerInput::has_seq() const {
+  return _internal_has_seq();
+}
+inline void PlayerInput::clear_seq() {
+  _impl_.seq_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PlayerInput::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint32_t PlayerInput::seq() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerInput.seq)
+  return _internal_seq();
+}
+inline void PlayerInput::_internal_set_seq(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.seq_ = value;
+}
+inline void PlayerInput::set_seq(uint32_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerInput.seq)
+}
+
+// optional .swarm.game.Vector2 acc = 2;
+inline bool PlayerInput::_internal_has_acc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.acc_ != nullptr);
+  return value;
+}
+inline bool PlayerInput::has_acc() const {
+  return _internal_has_acc();
+}
+inline void PlayerInput::clear_acc() {
+  if (_impl_.acc_ != nullptr) _impl_.acc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::Vector2& PlayerInput::_internal_acc() const {
+  const ::swarm::game::Vector2* p = _impl_.acc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Vector2&>(
+      ::swarm::game::_Vector2_default_instance_);
+}
+inline const ::swarm::game::Vector2& PlayerInput::acc() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerInput.acc)
+  return _internal_acc();
+}
+inline void PlayerInput::unsafe_arena_set_allocated_acc(
+    ::swarm::game::Vector2* acc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acc_);
+  }
+  _impl_.acc_ = acc;
+  if (acc) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.PlayerInput.acc)
+}
+inline ::swarm::game::Vector2* PlayerInput::release_acc() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.acc_;
+  _impl_.acc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Vector2* PlayerInput::unsafe_arena_release_acc() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerInput.acc)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::Vector2* temp = _impl_.acc_;
+  _impl_.acc_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Vector2* PlayerInput::_internal_mutable_acc() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.acc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Vector2>(GetArenaForAllocation());
+    _impl_.acc_ = p;
+  }
+  return _impl_.acc_;
+}
+inline ::swarm::game::Vector2* PlayerInput::mutable_acc() {
+  ::swarm::game::Vector2* _msg = _internal_mutable_acc();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerInput.acc)
+  return _msg;
+}
+inline void PlayerInput::set_allocated_acc(::swarm::game::Vector2* acc) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.acc_;
+  }
+  if (acc) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acc);
+    if (message_arena != submessage_arena) {
+      acc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.acc_ = acc;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerInput.acc)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerHello
+
+// optional uint64 session_token = 1;
+inline bool PlayerHello::_internal_has_session_token() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PlayerHello::has_session_token() const {
+  return _internal_has_session_token();
+}
+inline void PlayerHello::clear_session_token() {
+  _impl_.session_token_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PlayerHello::_internal_session_token() const {
+  return _impl_.session_token_;
+}
+inline uint64_t PlayerHello::session_token() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerHello.session_token)
+  return _internal_session_token();
+}
+inline void PlayerHello::_internal_set_session_token(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.session_token_ = value;
+}
+inline void PlayerHello::set_session_token(uint64_t value) {
+  _internal_set_session_token(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerHello.session_token)
+}
+
+// optional uint32 last_tick = 2;
+inline bool PlayerHello::_internal_has_last_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerHello::has_last_tick() const {
+  return _internal_has_last_tick();
+}
+inline void PlayerHello::clear_last_tick() {
+  _impl_.last_tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PlayerHello::_internal_last_tick() const {
+  return _impl_.last_tick_;
+}
+inline uint32_t PlayerHello::last_tick() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerHello.last_tick)
+  return _internal_last_tick();
+}
+inline void PlayerHello::_internal_set_last_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.last_tick_ = value;
+}
+inline void PlayerHello::set_last_tick(uint32_t value) {
+  _internal_set_last_tick(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerHello.last_tick)
+}
+
+// optional bool spectator = 3;
+inline bool PlayerHello::_internal_has_spectator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PlayerHello::has_spectator() const {
+  return _internal_has_spectator();
+}
+inline void PlayerHello::clear_spectator() {
+  _impl_.spectator_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool PlayerHello::_internal_spectator() const {
+  return _impl_.spectator_;
+}
+inline bool PlayerHello::spectator() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerHello.spectator)
+  return _internal_spectator();
+}
+inline void PlayerHello::_internal_set_spectator(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.spectator_ = value;
+}
+inline void PlayerHello::set_spectator(bool value) {
+  _internal_set_spectator(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerHello.spectator)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerState
+
+// repeated .swarm.game.Player player = 1;
+inline int PlayerState::_internal_player_size() const {
+  return _impl_.player_.size();
+}
+inline int PlayerState::player_size() const {
+  return _internal_player_size();
+}
+inline void PlayerState::clear_player() {
+  _impl_.player_.Clear();
+}
+inline ::swarm::game::Player* PlayerState::mutable_player(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerState.player)
+  return _impl_.player_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Player >*
+PlayerState::mutable_player() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.PlayerState.player)
+  return &_impl_.player_;
+}
+inline const ::swarm::game::Player& PlayerState::_internal_player(int index) const {
+  return _impl_.player_.Get(index);
+}
+inline const ::swarm::game::Player& PlayerState::player(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerState.player)
+  return _internal_player(index);
+}
+inline ::swarm::game::Player* PlayerState::_internal_add_player() {
+  return _impl_.player_.Add();
+}
+inline ::swarm::game::Player* PlayerState::add_player() {
+  ::swarm::game::Player* _add = _internal_add_player();
+  // @@protoc_insertion_point(field_add:swarm.game.PlayerState.player)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Player >&
+PlayerState::player() const {
+  // @@protoc_insertion_point(field_list:swarm.game.PlayerState.player)
+  return _impl_.player_;
+}
+
+// optional uint32 tick = 2;
+inline bool PlayerState::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerState::has_tick() const {
+  return _internal_has_tick();
+}
+inline void PlayerState::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PlayerState::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t PlayerState::tick() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerState.tick)
+  return _internal_tick();
+}
+inline void PlayerState::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tick_ = value;
+}
+inline void PlayerState::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerState.tick)
+}
+
+// optional double server_time = 3;
+inline bool PlayerState::_internal_has_server_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PlayerState::has_server_time() const {
+  return _internal_has_server_time();
+}
+inline void PlayerState::clear_server_time() {
+  _impl_.server_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double PlayerState::_internal_server_time() const {
+  return _impl_.server_time_;
+}
+inline double PlayerState::server_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerState.server_time)
+  return _internal_server_time();
+}
+inline void PlayerState::_internal_set_server_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.server_time_ = value;
+}
+inline void PlayerState::set_server_time(double value) {
+  _internal_set_server_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerState.server_time)
+}
+
+// -------------------------------------------------------------------
+
+// GameStarted
+
+// optional uint32 player_id = 1;
+inline bool GameStarted::_internal_has_player_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GameStarted::has_player_id() const {
+  return _internal_has_player_id();
+}
+inline void GameStarted::clear_player_id() {
+  _impl_.player_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t GameStarted::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint32_t GameStarted::player_id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.player_id)
+  return _internal_player_id();
+}
+inline void GameStarted::_internal_set_player_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.player_id_ = value;
+}
+inline void GameStarted::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.player_id)
+}
+
+// optional uint32 health = 2;
+inline bool GameStarted::_internal_has_health() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool GameStarted::has_health() const {
+  return _internal_has_health();
+}
+inline void GameStarted::clear_health() {
+  _impl_.health_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t GameStarted::_internal_health() const {
+  return _impl_.health_;
+}
+inline uint32_t GameStarted::health() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.health)
+  return _internal_health();
+}
+inline void GameStarted::_internal_set_health(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.health_ = value;
+}
+inline void GameStarted::set_health(uint32_t value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.health)
+}
+
+// optional string map_name = 3;
+inline bool GameStarted::_internal_has_map_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GameStarted::has_map_name() const {
+  return _internal_has_map_name();
+}
+inline void GameStarted::clear_map_name() {
+  _impl_.map_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GameStarted::map_name() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.map_name)
+  return _internal_map_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameStarted::set_map_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.map_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.map_name)
+}
+inline std::string* GameStarted::mutable_map_name() {
+  std::string* _s = _internal_mutable_map_name();
+  // @@protoc_insertion_point(field_mutable:swarm.game.GameStarted.map_name)
+  return _s;
+}
+inline const std::string& GameStarted::_internal_map_name() const {
+  return _impl_.map_name_.Get();
+}
+inline void GameStarted::_internal_set_map_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.map_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameStarted::_internal_mutable_map_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.map_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameStarted::release_map_name() {
+  // @@protoc_insertion_point(field_release:swarm.game.GameStarted.map_name)
+  if (!_internal_has_map_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.map_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GameStarted::set_allocated_map_name(std::string* map_name) {
+  if (map_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.map_name_.SetAllocated(map_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.GameStarted.map_name)
+}
+
+// optional .swarm.game.PlayerState player_state = 4;
+inline bool GameStarted::_internal_has_player_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.player_state_ != nullptr);
+  return value;
+}
+inline bool GameStarted::has_player_state() const {
+  return _internal_has_player_state();
+}
+inline void GameStarted::clear_player_state() {
+  if (_impl_.player_state_ != nullptr) _impl_.player_state_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::swarm::game::PlayerState& GameStarted::_internal_player_state() const {
+  const ::swarm::game::PlayerState* p = _impl_.player_state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerState&>(
+      ::swarm::game::_PlayerState_default_instance_);
+}
+inline const ::swarm::game::PlayerState& GameStarted::player_state() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.player_state)
+  return _internal_player_state();
+}
+inline void GameStarted::unsafe_arena_set_allocated_player_state(
+    ::swarm::game::PlayerState* player_state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_state_);
+  }
+  _impl_.player_state_ = player_state;
+  if (player_state) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.GameStarted.player_state)
+}
+inline ::swarm::game::PlayerState* GameStarted::release_player_state() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::PlayerState* temp = _impl_.player_state_;
+  _impl_.player_state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::PlayerState* GameStarted::unsafe_arena_release_player_state() {
+  // @@protoc_insertion_point(field_release:swarm.game.GameStarted.player_state)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::PlayerState* temp = _impl_.player_state_;
+  _impl_.player_state_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::PlayerState* GameStarted::_internal_mutable_player_state() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.player_state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerState>(GetArenaForAllocation());
+    _impl_.player_state_ = p;
+  }
+  return _impl_.player_state_;
+}
+inline ::swarm::game::PlayerState* GameStarted::mutable_player_state() {
+  ::swarm::game::PlayerState* _msg = _internal_mutable_player_state();
+  // @@protoc_insertion_point(field_mutable:swarm.game.GameStarted.player_state)
+  return _msg;
+}
+inline void GameStarted::set_allocated_player_state(::swarm::game::PlayerState* player_state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.player_state_;
+  }
+  if (player_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_state);
+    if (message_arena != submessage_arena) {
+      player_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_state, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.player_state_ = player_state;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.GameStarted.player_state)
+}
+
+// optional .swarm.game.SwarmState swarm_state = 5;
+inline bool GameStarted::_internal_has_swarm_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.swarm_state_ != nullptr);
+  return value;
+}
+inline bool GameStarted::has_swarm_state() const {
+  return _internal_has_swarm_state();
+}
+inline void GameStarted::clear_swarm_state() {
+  if (_impl_.swarm_state_ != nullptr) _impl_.swarm_state_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::swarm::game::SwarmState& GameStarted::_internal_swarm_state() const {
+  const ::swarm::game::SwarmState* p = _impl_.swarm_state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::SwarmState&>(
+      ::swarm::game::_SwarmState_default_instance_);
+}
+inline const ::swarm::game::SwarmState& GameStarted::swarm_state() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.swarm_state)
+  return _internal_swarm_state();
+}
+inline void GameStarted::unsafe_arena_set_allocated_swarm_state(
+    ::swarm::game::SwarmState* swarm_state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.swarm_state_);
+  }
+  _impl_.swarm_state_ = swarm_state;
+  if (swarm_state) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.GameStarted.swarm_state)
+}
+inline ::swarm::game::SwarmState* GameStarted::release_swarm_state() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::SwarmState* temp = _impl_.swarm_state_;
+  _impl_.swarm_state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::SwarmState* GameStarted::unsafe_arena_release_swarm_state() {
+  // @@protoc_insertion_point(field_release:swarm.game.GameStarted.swarm_state)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::SwarmState* temp = _impl_.swarm_state_;
+  _impl_.swarm_state_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::SwarmState* GameStarted::_internal_mutable_swarm_state() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.swarm_state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::SwarmState>(GetArenaForAllocation());
+    _impl_.swarm_state_ = p;
+  }
+  return _impl_.swarm_state_;
+}
+inline ::swarm::game::SwarmState* GameStarted::mutable_swarm_state() {
+  ::swarm::game::SwarmState* _msg = _internal_mutable_swarm_state();
+  // @@protoc_insertion_point(field_mutable:swarm.game.GameStarted.swarm_state)
+  return _msg;
+}
+inline void GameStarted::set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.swarm_state_;
+  }
+  if (swarm_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(swarm_state);
+    if (message_arena != submessage_arena) {
+      swarm_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, swarm_state, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.swarm_state_ = swarm_state;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.GameStarted.swarm_state)
+}
+
+// optional uint32 snapshot_interval_ms = 6;
+inline bool GameStarted::_internal_has_snapshot_interval_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool GameStarted::has_snapshot_interval_ms() const {
+  return _internal_has_snapshot_interval_ms();
+}
+inline void GameStarted::clear_snapshot_interval_ms() {
+  _impl_.snapshot_interval_ms_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t GameStarted::_internal_snapshot_interval_ms() const {
+  return _impl_.snapshot_interval_ms_;
+}
+inline uint32_t GameStarted::snapshot_interval_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.snapshot_interval_ms)
+  return _internal_snapshot_interval_ms();
+}
+inline void GameStarted::_internal_set_snapshot_interval_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.snapshot_interval_ms_ = value;
+}
+inline void GameStarted::set_snapshot_interval_ms(uint32_t value) {
+  _internal_set_snapshot_interval_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.snapshot_interval_ms)
+}
+
+// optional uint32 udp_port = 7;
+inline bool GameStarted::_internal_has_udp_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool GameStarted::has_udp_port() const {
+  return _internal_has_udp_port();
+}
+inline void GameStarted::clear_udp_port() {
+  _impl_.udp_port_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t GameStarted::_internal_udp_port() const {
+  return _impl_.udp_port_;
+}
+inline uint32_t GameStarted::udp_port() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.udp_port)
+  return _internal_udp_port();
+}
+inline void GameStarted::_internal_set_udp_port(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.udp_port_ = value;
+}
+inline void GameStarted::set_udp_port(uint32_t value) {
+  _internal_set_udp_port(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.udp_port)
+}
+
+// optional uint32 udp_token = 8;
+inline bool GameStarted::_internal_has_udp_token() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool GameStarted::has_udp_token() const {
+  return _internal_has_udp_token();
+}
+inline void GameStarted::clear_udp_token() {
+  _impl_.udp_token_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t GameStarted::_internal_udp_token() const {
+  return _impl_.udp_token_;
+}
+inline uint32_t GameStarted::udp_token() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.udp_token)
+  return _internal_udp_token();
+}
+inline void GameStarted::_internal_set_udp_token(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.udp_token_ = value;
+}
+inline void GameStarted::set_udp_token(uint32_t value) {
+  _internal_set_udp_token(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.udp_token)
+}
+
+// optional uint64 session_token = 9;
+inline bool GameStarted::_internal_has_session_token() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool GameStarted::has_session_token() const {
+  return _internal_has_session_token();
+}
+inline void GameStarted::clear_session_token() {
+  _impl_.session_token_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t GameStarted::_internal_session_token() const {
+  return _impl_.session_token_;
+}
+inline uint64_t GameStarted::session_token() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.session_token)
+  return _internal_session_token();
+}
+inline void GameStarted::_internal_set_session_token(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.session_token_ = value;
+}
+inline void GameStarted::set_session_token(uint64_t value) {
+  _internal_set_session_token(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.session_token)
+}
+
+// optional bool resumed = 10;
+inline bool GameStarted::_internal_has_resumed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool GameStarted::has_resumed() const {
+  return _internal_has_resumed();
+}
+inline void GameStarted::clear_resumed() {
+  _impl_.resumed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline bool GameStarted::_internal_resumed() const {
+  return _impl_.resumed_;
+}
+inline bool GameStarted::resumed() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.resumed)
+  return _internal_resumed();
+}
+inline void GameStarted::_internal_set_resumed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.resumed_ = value;
+}
+inline void GameStarted::set_resumed(bool value) {
+  _internal_set_resumed(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.resumed)
+}
+
+// optional uint32 initial_state_chunks = 11;
+inline bool GameStarted::_internal_has_initial_state_chunks() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool GameStarted::has_initial_state_chunks() const {
+  return _internal_has_initial_state_chunks();
+}
+inline void GameStarted::clear_initial_state_chunks() {
+  _impl_.initial_state_chunks_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t GameStarted::_internal_initial_state_chunks() const {
+  return _impl_.initial_state_chunks_;
+}
+inline uint32_t GameStarted::initial_state_chunks() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.initial_state_chunks)
+  return _internal_initial_state_chunks();
+}
+inline void GameStarted::_internal_set_initial_state_chunks(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.initial_state_chunks_ = value;
+}
+inline void GameStarted::set_initial_state_chunks(uint32_t value) {
+  _internal_set_initial_state_chunks(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.initial_state_chunks)
+}
+
+// optional bool lockstep = 12;
+inline bool GameStarted::_internal_has_lockstep() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool GameStarted::has_lockstep() const {
+  return _internal_has_lockstep();
+}
+inline void GameStarted::clear_lockstep() {
+  _impl_.lockstep_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool GameStarted::_internal_lockstep() const {
+  return _impl_.lockstep_;
+}
+inline bool GameStarted::lockstep() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameStarted.lockstep)
+  return _internal_lockstep();
+}
+inline void GameStarted::_internal_set_lockstep(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.lockstep_ = value;
+}
+inline void GameStarted::set_lockstep(bool value) {
+  _internal_set_lockstep(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameStarted.lockstep)
+}
+
+// -------------------------------------------------------------------
+
+// GameEnded
+
+// optional uint32 winner_id = 1;
+inline bool GameEnded::_internal_has_winner_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GameEnded::has_winner_id() const {
+  return _internal_has_winner_id();
+}
+inline void GameEnded::clear_winner_id() {
+  _impl_.winner_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t GameEnded::_internal_winner_id() const {
+  return _impl_.winner_id_;
+}
+inline uint32_t GameEnded::winner_id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.GameEnded.winner_id)
+  return _internal_winner_id();
+}
+inline void GameEnded::_internal_set_winner_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.winner_id_ = value;
+}
+inline void GameEnded::set_winner_id(uint32_t value) {
+  _internal_set_winner_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.GameEnded.winner_id)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerDied
+
+// optional uint32 player_id = 1;
+inline bool PlayerDied::_internal_has_player_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PlayerDied::has_player_id() const {
+  return _internal_has_player_id();
+}
+inline void PlayerDied::clear_player_id() {
+  _impl_.player_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t PlayerDied::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint32_t PlayerDied::player_id() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerDied.player_id)
+  return _internal_player_id();
+}
+inline void PlayerDied::_internal_set_player_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.player_id_ = value;
+}
+inline void PlayerDied::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerDied.player_id)
+}
+
+// -------------------------------------------------------------------
+
+// MonsterDied
+
+// repeated .swarm.game.Vector2 pos = 1;
+inline int MonsterDied::_internal_pos_size() const {
+  return _impl_.pos_.size();
+}
+inline int MonsterDied::pos_size() const {
+  return _internal_pos_size();
+}
+inline void MonsterDied::clear_pos() {
+  _impl_.pos_.Clear();
+}
+inline ::swarm::game::Vector2* MonsterDied::mutable_pos(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.MonsterDied.pos)
+  return _impl_.pos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Vector2 >*
+MonsterDied::mutable_pos() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.MonsterDied.pos)
+  return &_impl_.pos_;
+}
+inline const ::swarm::game::Vector2& MonsterDied::_internal_pos(int index) const {
+  return _impl_.pos_.Get(index);
+}
+inline const ::swarm::game::Vector2& MonsterDied::pos(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.MonsterDied.pos)
+  return _internal_pos(index);
+}
+inline ::swarm::game::Vector2* MonsterDied::_internal_add_pos() {
+  return _impl_.pos_.Add();
+}
+inline ::swarm::game::Vector2* MonsterDied::add_pos() {
+  ::swarm::game::Vector2* _add = _internal_add_pos();
+  // @@protoc_insertion_point(field_add:swarm.game.MonsterDied.pos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::Vector2 >&
+MonsterDied::pos() const {
+  // @@protoc_insertion_point(field_list:swarm.game.MonsterDied.pos)
+  return _impl_.pos_;
+}
+
+// repeated uint32 id = 2;
+inline int MonsterDied::_internal_id_size() const {
+  return _impl_.id_.size();
+}
+inline int MonsterDied::id_size() const {
+  return _internal_id_size();
+}
+inline void MonsterDied::clear_id() {
+  _impl_.id_.Clear();
+}
+inline uint32_t MonsterDied::_internal_id(int index) const {
+  return _impl_.id_.Get(index);
+}
+inline uint32_t MonsterDied::id(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.MonsterDied.id)
+  return _internal_id(index);
+}
+inline void MonsterDied::set_id(int index, uint32_t value) {
+  _impl_.id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:swarm.game.MonsterDied.id)
+}
+inline void MonsterDied::_internal_add_id(uint32_t value) {
+  _impl_.id_.Add(value);
+}
+inline void MonsterDied::add_id(uint32_t value) {
+  _internal_add_id(value);
+  // @@protoc_insertion_point(field_add:swarm.game.MonsterDied.id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MonsterDied::_internal_id() const {
+  return _impl_.id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MonsterDied::id() const {
+  // @@protoc_insertion_point(field_list:swarm.game.MonsterDied.id)
+  return _internal_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MonsterDied::_internal_mutable_id() {
+  return &_impl_.id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MonsterDied::mutable_id() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.MonsterDied.id)
+  return _internal_mutable_id();
+}
+
+// -------------------------------------------------------------------
+
+// Ping
+
+// optional uint32 seq = 1;
+inline bool Ping::_internal_has_seq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Ping::has_seq() const {
+  return _internal_has_seq();
+}
+inline void Ping::clear_seq() {
+  _impl_.seq_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Ping::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint32_t Ping::seq() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Ping.seq)
+  return _internal_seq();
+}
+inline void Ping::_internal_set_seq(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.seq_ = value;
+}
+inline void Ping::set_seq(uint32_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Ping.seq)
+}
+
+// optional double client_time = 2;
+inline bool Ping::_internal_has_client_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Ping::has_client_time() const {
+  return _internal_has_client_time();
+}
+inline void Ping::clear_client_time() {
+  _impl_.client_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Ping::_internal_client_time() const {
+  return _impl_.client_time_;
+}
+inline double Ping::client_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Ping.client_time)
+  return _internal_client_time();
+}
+inline void Ping::_internal_set_client_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.client_time_ = value;
+}
+inline void Ping::set_client_time(double value) {
+  _internal_set_client_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Ping.client_time)
+}
+
+// optional float rtt_ms = 3;
+inline bool Ping::_internal_has_rtt_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Ping::has_rtt_ms() const {
+  return _internal_has_rtt_ms();
+}
+inline void Ping::clear_rtt_ms() {
+  _impl_.rtt_ms_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Ping::_internal_rtt_ms() const {
+  return _impl_.rtt_ms_;
+}
+inline float Ping::rtt_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Ping.rtt_ms)
+  return _internal_rtt_ms();
+}
+inline void Ping::_internal_set_rtt_ms(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.rtt_ms_ = value;
+}
+inline void Ping::set_rtt_ms(float value) {
+  _internal_set_rtt_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Ping.rtt_ms)
+}
+
+// -------------------------------------------------------------------
+
+// Pong
+
+// optional uint32 seq = 1;
+inline bool Pong::_internal_has_seq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Pong::has_seq() const {
+  return _internal_has_seq();
+}
+inline void Pong::clear_seq() {
+  _impl_.seq_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Pong::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint32_t Pong::seq() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Pong.seq)
+  return _internal_seq();
+}
+inline void Pong::_internal_set_seq(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.seq_ = value;
+}
+inline void Pong::set_seq(uint32_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Pong.seq)
+}
+
+// optional double client_time = 2;
+inline bool Pong::_internal_has_client_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Pong::has_client_time() const {
+  return _internal_has_client_time();
+}
+inline void Pong::clear_client_time() {
+  _impl_.client_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Pong::_internal_client_time() const {
+  return _impl_.client_time_;
+}
+inline double Pong::client_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Pong.client_time)
+  return _internal_client_time();
+}
+inline void Pong::_internal_set_client_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.client_time_ = value;
+}
+inline void Pong::set_client_time(double value) {
+  _internal_set_client_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Pong.client_time)
+}
+
+// optional double server_receive_time = 3;
+inline bool Pong::_internal_has_server_receive_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Pong::has_server_receive_time() const {
+  return _internal_has_server_receive_time();
+}
+inline void Pong::clear_server_receive_time() {
+  _impl_.server_receive_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Pong::_internal_server_receive_time() const {
+  return _impl_.server_receive_time_;
+}
+inline double Pong::server_receive_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Pong.server_receive_time)
+  return _internal_server_receive_time();
+}
+inline void Pong::_internal_set_server_receive_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.server_receive_time_ = value;
+}
+inline void Pong::set_server_receive_time(double value) {
+  _internal_set_server_receive_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Pong.server_receive_time)
+}
+
+// optional double server_send_time = 4;
+inline bool Pong::_internal_has_server_send_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Pong::has_server_send_time() const {
+  return _internal_has_server_send_time();
+}
+inline void Pong::clear_server_send_time() {
+  _impl_.server_send_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double Pong::_internal_server_send_time() const {
+  return _impl_.server_send_time_;
+}
+inline double Pong::server_send_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Pong.server_send_time)
+  return _internal_server_send_time();
+}
+inline void Pong::_internal_set_server_send_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_send_time_ = value;
+}
+inline void Pong::set_server_send_time(double value) {
+  _internal_set_server_send_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Pong.server_send_time)
+}
+
+// -------------------------------------------------------------------
+
+// LockstepAttractor
+
+// optional sint32 x = 1;
+inline bool LockstepAttractor::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LockstepAttractor::has_x() const {
+  return _internal_has_x();
+}
+inline void LockstepAttractor::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t LockstepAttractor::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t LockstepAttractor::x() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepAttractor.x)
+  return _internal_x();
+}
+inline void LockstepAttractor::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void LockstepAttractor::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepAttractor.x)
+}
+
+// optional sint32 y = 2;
+inline bool LockstepAttractor::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LockstepAttractor::has_y() const {
+  return _internal_has_y();
+}
+inline void LockstepAttractor::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t LockstepAttractor::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t LockstepAttractor::y() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepAttractor.y)
+  return _internal_y();
+}
+inline void LockstepAttractor::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void LockstepAttractor::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepAttractor.y)
+}
+
+// optional sint32 radius = 3;
+inline bool LockstepAttractor::_internal_has_radius() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool LockstepAttractor::has_radius() const {
+  return _internal_has_radius();
+}
+inline void LockstepAttractor::clear_radius() {
+  _impl_.radius_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t LockstepAttractor::_internal_radius() const {
+  return _impl_.radius_;
+}
+inline int32_t LockstepAttractor::radius() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepAttractor.radius)
+  return _internal_radius();
+}
+inline void LockstepAttractor::_internal_set_radius(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.radius_ = value;
+}
+inline void LockstepAttractor::set_radius(int32_t value) {
+  _internal_set_radius(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepAttractor.radius)
+}
+
+// -------------------------------------------------------------------
+
+// LockstepFrame
+
+// optional uint32 tick = 1;
+inline bool LockstepFrame::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LockstepFrame::has_tick() const {
+  return _internal_has_tick();
+}
+inline void LockstepFrame::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t LockstepFrame::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t LockstepFrame::tick() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrame.tick)
+  return _internal_tick();
+}
+inline void LockstepFrame::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tick_ = value;
+}
+inline void LockstepFrame::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepFrame.tick)
+}
+
+// repeated uint32 removed_id = 2;
+inline int LockstepFrame::_internal_removed_id_size() const {
+  return _impl_.removed_id_.size();
+}
+inline int LockstepFrame::removed_id_size() const {
+  return _internal_removed_id_size();
+}
+inline void LockstepFrame::clear_removed_id() {
+  _impl_.removed_id_.Clear();
+}
+inline uint32_t LockstepFrame::_internal_removed_id(int index) const {
+  return _impl_.removed_id_.Get(index);
+}
+inline uint32_t LockstepFrame::removed_id(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrame.removed_id)
+  return _internal_removed_id(index);
+}
+inline void LockstepFrame::set_removed_id(int index, uint32_t value) {
+  _impl_.removed_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepFrame.removed_id)
+}
+inline void LockstepFrame::_internal_add_removed_id(uint32_t value) {
+  _impl_.removed_id_.Add(value);
+}
+inline void LockstepFrame::add_removed_id(uint32_t value) {
+  _internal_add_removed_id(value);
+  // @@protoc_insertion_point(field_add:swarm.game.LockstepFrame.removed_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LockstepFrame::_internal_removed_id() const {
+  return _impl_.removed_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LockstepFrame::removed_id() const {
+  // @@protoc_insertion_point(field_list:swarm.game.LockstepFrame.removed_id)
+  return _internal_removed_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LockstepFrame::_internal_mutable_removed_id() {
+  return &_impl_.removed_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LockstepFrame::mutable_removed_id() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.LockstepFrame.removed_id)
+  return _internal_mutable_removed_id();
+}
+
+// repeated .swarm.game.LockstepAttractor attractor = 3;
+inline int LockstepFrame::_internal_attractor_size() const {
+  return _impl_.attractor_.size();
+}
+inline int LockstepFrame::attractor_size() const {
+  return _internal_attractor_size();
+}
+inline void LockstepFrame::clear_attractor() {
+  _impl_.attractor_.Clear();
+}
+inline ::swarm::game::LockstepAttractor* LockstepFrame::mutable_attractor(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.LockstepFrame.attractor)
+  return _impl_.attractor_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepAttractor >*
+LockstepFrame::mutable_attractor() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.LockstepFrame.attractor)
+  return &_impl_.attractor_;
+}
+inline const ::swarm::game::LockstepAttractor& LockstepFrame::_internal_attractor(int index) const {
+  return _impl_.attractor_.Get(index);
+}
+inline const ::swarm::game::LockstepAttractor& LockstepFrame::attractor(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrame.attractor)
+  return _internal_attractor(index);
+}
+inline ::swarm::game::LockstepAttractor* LockstepFrame::_internal_add_attractor() {
+  return _impl_.attractor_.Add();
+}
+inline ::swarm::game::LockstepAttractor* LockstepFrame::add_attractor() {
+  ::swarm::game::LockstepAttractor* _add = _internal_add_attractor();
+  // @@protoc_insertion_point(field_add:swarm.game.LockstepFrame.attractor)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepAttractor >&
+LockstepFrame::attractor() const {
+  // @@protoc_insertion_point(field_list:swarm.game.LockstepFrame.attractor)
+  return _impl_.attractor_;
+}
+
+// optional uint64 hash = 4;
+inline bool LockstepFrame::_internal_has_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LockstepFrame::has_hash() const {
+  return _internal_has_hash();
+}
+inline void LockstepFrame::clear_hash() {
+  _impl_.hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t LockstepFrame::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint64_t LockstepFrame::hash() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrame.hash)
+  return _internal_hash();
+}
+inline void LockstepFrame::_internal_set_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hash_ = value;
+}
+inline void LockstepFrame::set_hash(uint64_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepFrame.hash)
+}
+
+// -------------------------------------------------------------------
+
+// LockstepFrames
+
+// repeated .swarm.game.LockstepFrame frame = 1;
+inline int LockstepFrames::_internal_frame_size() const {
+  return _impl_.frame_.size();
+}
+inline int LockstepFrames::frame_size() const {
+  return _internal_frame_size();
+}
+inline void LockstepFrames::clear_frame() {
+  _impl_.frame_.Clear();
+}
+inline ::swarm::game::LockstepFrame* LockstepFrames::mutable_frame(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.LockstepFrames.frame)
+  return _impl_.frame_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepFrame >*
+LockstepFrames::mutable_frame() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.LockstepFrames.frame)
+  return &_impl_.frame_;
+}
+inline const ::swarm::game::LockstepFrame& LockstepFrames::_internal_frame(int index) const {
+  return _impl_.frame_.Get(index);
+}
+inline const ::swarm::game::LockstepFrame& LockstepFrames::frame(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrames.frame)
+  return _internal_frame(index);
+}
+inline ::swarm::game::LockstepFrame* LockstepFrames::_internal_add_frame() {
+  return _impl_.frame_.Add();
+}
+inline ::swarm::game::LockstepFrame* LockstepFrames::add_frame() {
+  ::swarm::game::LockstepFrame* _add = _internal_add_frame();
+  // @@protoc_insertion_point(field_add:swarm.game.LockstepFrames.frame)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LockstepFrame >&
+LockstepFrames::frame() const {
+  // @@protoc_insertion_point(field_list:swarm.game.LockstepFrames.frame)
+  return _impl_.frame_;
+}
+
+// optional uint32 tick = 2;
+inline bool LockstepFrames::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LockstepFrames::has_tick() const {
+  return _internal_has_tick();
+}
+inline void LockstepFrames::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t LockstepFrames::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t LockstepFrames::tick() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrames.tick)
+  return _internal_tick();
+}
+inline void LockstepFrames::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tick_ = value;
+}
+inline void LockstepFrames::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepFrames.tick)
+}
+
+// optional double server_time = 3;
+inline bool LockstepFrames::_internal_has_server_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LockstepFrames::has_server_time() const {
+  return _internal_has_server_time();
+}
+inline void LockstepFrames::clear_server_time() {
+  _impl_.server_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double LockstepFrames::_internal_server_time() const {
+  return _impl_.server_time_;
+}
+inline double LockstepFrames::server_time() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LockstepFrames.server_time)
+  return _internal_server_time();
+}
+inline void LockstepFrames::_internal_set_server_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.server_time_ = value;
+}
+inline void LockstepFrames::set_server_time(double value) {
+  _internal_set_server_time(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LockstepFrames.server_time)
+}
+
+// -------------------------------------------------------------------
+
+// ServerMessage
+
+// required .swarm.game.ServerMessage.Type type = 1;
+inline bool ServerMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ServerMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void ServerMessage::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::swarm::game::ServerMessage_Type ServerMessage::_internal_type() const {
+  return static_cast< ::swarm::game::ServerMessage_Type >(_impl_.type_);
+}
+inline ::swarm::game::ServerMessage_Type ServerMessage::type() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.type)
+  return _internal_type();
+}
+inline void ServerMessage::_internal_set_type(::swarm::game::ServerMessage_Type value) {
+  assert(::swarm::game::ServerMessage_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.type_ = value;
+}
+inline void ServerMessage::set_type(::swarm::game::ServerMessage_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:swarm.game.ServerMessage.type)
+}
+
+// optional .swarm.game.GameStarted game_started = 2;
+inline bool ServerMessage::_internal_has_game_started() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.game_started_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_game_started() const {
+  return _internal_has_game_started();
+}
+inline void ServerMessage::clear_game_started() {
+  if (_impl_.game_started_ != nullptr) _impl_.game_started_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::GameStarted& ServerMessage::_internal_game_started() const {
+  const ::swarm::game::GameStarted* p = _impl_.game_started_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::GameStarted&>(
+      ::swarm::game::_GameStarted_default_instance_);
+}
+inline const ::swarm::game::GameStarted& ServerMessage::game_started() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.game_started)
+  return _internal_game_started();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_game_started(
+    ::swarm::game::GameStarted* game_started) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_started_);
+  }
+  _impl_.game_started_ = game_started;
+  if (game_started) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.game_started)
+}
+inline ::swarm::game::GameStarted* ServerMessage::release_game_started() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::GameStarted* temp = _impl_.game_started_;
+  _impl_.game_started_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::GameStarted* ServerMessage::unsafe_arena_release_game_started() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.game_started)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::GameStarted* temp = _impl_.game_started_;
+  _impl_.game_started_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::GameStarted* ServerMessage::_internal_mutable_game_started() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.game_started_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::GameStarted>(GetArenaForAllocation());
+    _impl_.game_started_ = p;
+  }
+  return _impl_.game_started_;
+}
+inline ::swarm::game::GameStarted* ServerMessage::mutable_game_started() {
+  ::swarm::game::GameStarted* _msg = _internal_mutable_game_started();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.game_started)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_game_started(::swarm::game::GameStarted* game_started) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.game_started_;
+  }
+  if (game_started) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_started);
+    if (message_arena != submessage_arena) {
+      game_started = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game_started, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.game_started_ = game_started;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.game_started)
+}
+
+// optional .swarm.game.PlayerJoined player_joined = 3;
+inline bool ServerMessage::_internal_has_player_joined() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.player_joined_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_player_joined() const {
+  return _internal_has_player_joined();
+}
+inline void ServerMessage::clear_player_joined() {
+  if (_impl_.player_joined_ != nullptr) _impl_.player_joined_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::swarm::game::PlayerJoined& ServerMessage::_internal_player_joined() const {
+  const ::swarm::game::PlayerJoined* p = _impl_.player_joined_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerJoined&>(
+      ::swarm::game::_PlayerJoined_default_instance_);
+}
+inline const ::swarm::game::PlayerJoined& ServerMessage::player_joined() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.player_joined)
+  return _internal_player_joined();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_player_joined(
+    ::swarm::game::PlayerJoined* player_joined) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_joined_);
+  }
+  _impl_.player_joined_ = player_joined;
+  if (player_joined) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.player_joined)
+}
+inline ::swarm::game::PlayerJoined* ServerMessage::release_player_joined() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::PlayerJoined* temp = _impl_.player_joined_;
+  _impl_.player_joined_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::PlayerJoined* ServerMessage::unsafe_arena_release_player_joined() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.player_joined)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::PlayerJoined* temp = _impl_.player_joined_;
+  _impl_.player_joined_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::PlayerJoined* ServerMessage::_internal_mutable_player_joined() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.player_joined_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerJoined>(GetArenaForAllocation());
+    _impl_.player_joined_ = p;
+  }
+  return _impl_.player_joined_;
+}
+inline ::swarm::game::PlayerJoined* ServerMessage::mutable_player_joined() {
+  ::swarm::game::PlayerJoined* _msg = _internal_mutable_player_joined();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.player_joined)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_player_joined(::swarm::game::PlayerJoined* player_joined) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.player_joined_;
+  }
+  if (player_joined) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_joined);
+    if (message_arena != submessage_arena) {
+      player_joined = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_joined, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.player_joined_ = player_joined;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.player_joined)
+}
+
+// optional .swarm.game.PlayerLeft player_left = 4;
+inline bool ServerMessage::_internal_has_player_left() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.player_left_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_player_left() const {
+  return _internal_has_player_left();
+}
+inline void ServerMessage::clear_player_left() {
+  if (_impl_.player_left_ != nullptr) _impl_.player_left_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::swarm::game::PlayerLeft& ServerMessage::_internal_player_left() const {
+  const ::swarm::game::PlayerLeft* p = _impl_.player_left_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerLeft&>(
+      ::swarm::game::_PlayerLeft_default_instance_);
+}
+inline const ::swarm::game::PlayerLeft& ServerMessage::player_left() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.player_left)
+  return _internal_player_left();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_player_left(
+    ::swarm::game::PlayerLeft* player_left) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_left_);
+  }
+  _impl_.player_left_ = player_left;
+  if (player_left) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.player_left)
+}
+inline ::swarm::game::PlayerLeft* ServerMessage::release_player_left() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::PlayerLeft* temp = _impl_.player_left_;
+  _impl_.player_left_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::PlayerLeft* ServerMessage::unsafe_arena_release_player_left() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.player_left)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::PlayerLeft* temp = _impl_.player_left_;
+  _impl_.player_left_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::PlayerLeft* ServerMessage::_internal_mutable_player_left() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.player_left_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerLeft>(GetArenaForAllocation());
+    _impl_.player_left_ = p;
+  }
+  return _impl_.player_left_;
+}
+inline ::swarm::game::PlayerLeft* ServerMessage::mutable_player_left() {
+  ::swarm::game::PlayerLeft* _msg = _internal_mutable_player_left();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.player_left)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_player_left(::swarm::game::PlayerLeft* player_left) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.player_left_;
+  }
+  if (player_left) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_left);
+    if (message_arena != submessage_arena) {
+      player_left = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_left, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.player_left_ = player_left;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.player_left)
+}
+
+// optional .swarm.game.SwarmState swarm_state = 5;
+inline bool ServerMessage::_internal_has_swarm_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.swarm_state_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_swarm_state() const {
+  return _internal_has_swarm_state();
+}
+inline void ServerMessage::clear_swarm_state() {
+  if (_impl_.swarm_state_ != nullptr) _impl_.swarm_state_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::swarm::game::SwarmState& ServerMessage::_internal_swarm_state() const {
+  const ::swarm::game::SwarmState* p = _impl_.swarm_state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::SwarmState&>(
+      ::swarm::game::_SwarmState_default_instance_);
+}
+inline const ::swarm::game::SwarmState& ServerMessage::swarm_state() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.swarm_state)
+  return _internal_swarm_state();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_swarm_state(
+    ::swarm::game::SwarmState* swarm_state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.swarm_state_);
+  }
+  _impl_.swarm_state_ = swarm_state;
+  if (swarm_state) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.swarm_state)
+}
+inline ::swarm::game::SwarmState* ServerMessage::release_swarm_state() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::swarm::game::SwarmState* temp = _impl_.swarm_state_;
+  _impl_.swarm_state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::SwarmState* ServerMessage::unsafe_arena_release_swarm_state() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.swarm_state)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::swarm::game::SwarmState* temp = _impl_.swarm_state_;
+  _impl_.swarm_state_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::SwarmState* ServerMessage::_internal_mutable_swarm_state() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.swarm_state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::SwarmState>(GetArenaForAllocation());
+    _impl_.swarm_state_ = p;
+  }
+  return _impl_.swarm_state_;
+}
+inline ::swarm::game::SwarmState* ServerMessage::mutable_swarm_state() {
+  ::swarm::game::SwarmState* _msg = _internal_mutable_swarm_state();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.swarm_state)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.swarm_state_;
+  }
+  if (swarm_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(swarm_state);
+    if (message_arena != submessage_arena) {
+      swarm_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, swarm_state, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.swarm_state_ = swarm_state;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.swarm_state)
+}
+
+// optional .swarm.game.PlayerState player_state = 6;
+inline bool ServerMessage::_internal_has_player_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.player_state_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_player_state() const {
+  return _internal_has_player_state();
+}
+inline void ServerMessage::clear_player_state() {
+  if (_impl_.player_state_ != nullptr) _impl_.player_state_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::swarm::game::PlayerState& ServerMessage::_internal_player_state() const {
+  const ::swarm::game::PlayerState* p = _impl_.player_state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerState&>(
+      ::swarm::game::_PlayerState_default_instance_);
+}
+inline const ::swarm::game::PlayerState& ServerMessage::player_state() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.player_state)
+  return _internal_player_state();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_player_state(
+    ::swarm::game::PlayerState* player_state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_state_);
+  }
+  _impl_.player_state_ = player_state;
+  if (player_state) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.player_state)
+}
+inline ::swarm::game::PlayerState* ServerMessage::release_player_state() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::swarm::game::PlayerState* temp = _impl_.player_state_;
+  _impl_.player_state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::PlayerState* ServerMessage::unsafe_arena_release_player_state() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.player_state)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::swarm::game::PlayerState* temp = _impl_.player_state_;
+  _impl_.player_state_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::PlayerState* ServerMessage::_internal_mutable_player_state() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.player_state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerState>(GetArenaForAllocation());
+    _impl_.player_state_ = p;
+  }
+  return _impl_.player_state_;
+}
+inline ::swarm::game::PlayerState* ServerMessage::mutable_player_state() {
+  ::swarm::game::PlayerState* _msg = _internal_mutable_player_state();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.player_state)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_player_state(::swarm::game::PlayerState* player_state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.player_state_;
+  }
+  if (player_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_state);
+    if (message_arena != submessage_arena) {
+      player_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_state, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.player_state_ = player_state;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.player_state)
+}
+
+// optional .swarm.game.PlayerDied player_died = 7;
+inline bool ServerMessage::_internal_has_player_died() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.player_died_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_player_died() const {
+  return _internal_has_player_died();
+}
+inline void ServerMessage::clear_player_died() {
+  if (_impl_.player_died_ != nullptr) _impl_.player_died_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::swarm::game::PlayerDied& ServerMessage::_internal_player_died() const {
+  const ::swarm::game::PlayerDied* p = _impl_.player_died_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerDied&>(
+      ::swarm::game::_PlayerDied_default_instance_);
+}
+inline const ::swarm::game::PlayerDied& ServerMessage::player_died() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.player_died)
+  return _internal_player_died();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_player_died(
+    ::swarm::game::PlayerDied* player_died) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.player_died_);
+  }
+  _impl_.player_died_ = player_died;
+  if (player_died) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.player_died)
+}
+inline ::swarm::game::PlayerDied* ServerMessage::release_player_died() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::swarm::game::PlayerDied* temp = _impl_.player_died_;
+  _impl_.player_died_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::PlayerDied* ServerMessage::unsafe_arena_release_player_died() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.player_died)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::swarm::game::PlayerDied* temp = _impl_.player_died_;
+  _impl_.player_died_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::PlayerDied* ServerMessage::_internal_mutable_player_died() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.player_died_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerDied>(GetArenaForAllocation());
+    _impl_.player_died_ = p;
+  }
+  return _impl_.player_died_;
+}
+inline ::swarm::game::PlayerDied* ServerMessage::mutable_player_died() {
+  ::swarm::game::PlayerDied* _msg = _internal_mutable_player_died();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.player_died)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_player_died(::swarm::game::PlayerDied* player_died) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.player_died_;
+  }
+  if (player_died) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(player_died);
+    if (message_arena != submessage_arena) {
+      player_died = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, player_died, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.player_died_ = player_died;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.player_died)
+}
+
+// optional .swarm.game.GameEnded game_ended = 8;
+inline bool ServerMessage::_internal_has_game_ended() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.game_ended_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_game_ended() const {
+  return _internal_has_game_ended();
+}
+inline void ServerMessage::clear_game_ended() {
+  if (_impl_.game_ended_ != nullptr) _impl_.game_ended_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::swarm::game::GameEnded& ServerMessage::_internal_game_ended() const {
+  const ::swarm::game::GameEnded* p = _impl_.game_ended_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::GameEnded&>(
+      ::swarm::game::_GameEnded_default_instance_);
+}
+inline const ::swarm::game::GameEnded& ServerMessage::game_ended() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.game_ended)
+  return _internal_game_ended();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_game_ended(
+    ::swarm::game::GameEnded* game_ended) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_ended_);
+  }
+  _impl_.game_ended_ = game_ended;
+  if (game_ended) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.game_ended)
+}
+inline ::swarm::game::GameEnded* ServerMessage::release_game_ended() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::swarm::game::GameEnded* temp = _impl_.game_ended_;
+  _impl_.game_ended_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::GameEnded* ServerMessage::unsafe_arena_release_game_ended() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.game_ended)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::swarm::game::GameEnded* temp = _impl_.game_ended_;
+  _impl_.game_ended_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::GameEnded* ServerMessage::_internal_mutable_game_ended() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.game_ended_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::GameEnded>(GetArenaForAllocation());
+    _impl_.game_ended_ = p;
+  }
+  return _impl_.game_ended_;
+}
+inline ::swarm::game::GameEnded* ServerMessage::mutable_game_ended() {
+  ::swarm::game::GameEnded* _msg = _internal_mutable_game_ended();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.game_ended)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_game_ended(::swarm::game::GameEnded* game_ended) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.game_ended_;
+  }
+  if (game_ended) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_ended);
+    if (message_arena != submessage_arena) {
+      game_ended = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game_ended, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.game_ended_ = game_ended;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.game_ended)
+}
+
+// optional .swarm.game.MonsterDied monster_died = 9;
+inline bool ServerMessage::_internal_has_monster_died() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.monster_died_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_monster_died() const {
+  return _internal_has_monster_died();
+}
+inline void ServerMessage::clear_monster_died() {
+  if (_impl_.monster_died_ != nullptr) _impl_.monster_died_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::swarm::game::MonsterDied& ServerMessage::_internal_monster_died() const {
+  const ::swarm::game::MonsterDied* p = _impl_.monster_died_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::MonsterDied&>(
+      ::swarm::game::_MonsterDied_default_instance_);
+}
+inline const ::swarm::game::MonsterDied& ServerMessage::monster_died() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.monster_died)
+  return _internal_monster_died();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_monster_died(
+    ::swarm::game::MonsterDied* monster_died) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.monster_died_);
+  }
+  _impl_.monster_died_ = monster_died;
+  if (monster_died) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.monster_died)
+}
+inline ::swarm::game::MonsterDied* ServerMessage::release_monster_died() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::swarm::game::MonsterDied* temp = _impl_.monster_died_;
+  _impl_.monster_died_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::MonsterDied* ServerMessage::unsafe_arena_release_monster_died() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.monster_died)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::swarm::game::MonsterDied* temp = _impl_.monster_died_;
+  _impl_.monster_died_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::MonsterDied* ServerMessage::_internal_mutable_monster_died() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.monster_died_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::MonsterDied>(GetArenaForAllocation());
+    _impl_.monster_died_ = p;
+  }
+  return _impl_.monster_died_;
+}
+inline ::swarm::game::MonsterDied* ServerMessage::mutable_monster_died() {
+  ::swarm::game::MonsterDied* _msg = _internal_mutable_monster_died();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.monster_died)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_monster_died(::swarm::game::MonsterDied* monster_died) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.monster_died_;
+  }
+  if (monster_died) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(monster_died);
+    if (message_arena != submessage_arena) {
+      monster_died = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, monster_died, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.monster_died_ = monster_died;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.monster_died)
+}
+
+// optional .swarm.game.Pong pong = 10;
+inline bool ServerMessage::_internal_has_pong() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pong_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_pong() const {
+  return _internal_has_pong();
+}
+inline void ServerMessage::clear_pong() {
+  if (_impl_.pong_ != nullptr) _impl_.pong_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::swarm::game::Pong& ServerMessage::_internal_pong() const {
+  const ::swarm::game::Pong* p = _impl_.pong_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Pong&>(
+      ::swarm::game::_Pong_default_instance_);
+}
+inline const ::swarm::game::Pong& ServerMessage::pong() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.pong)
+  return _internal_pong();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_pong(
+    ::swarm::game::Pong* pong) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pong_);
+  }
+  _impl_.pong_ = pong;
+  if (pong) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.pong)
+}
+inline ::swarm::game::Pong* ServerMessage::release_pong() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::swarm::game::Pong* temp = _impl_.pong_;
+  _impl_.pong_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::Pong* ServerMessage::unsafe_arena_release_pong() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.pong)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::swarm::game::Pong* temp = _impl_.pong_;
+  _impl_.pong_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::Pong* ServerMessage::_internal_mutable_pong() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.pong_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Pong>(GetArenaForAllocation());
+    _impl_.pong_ = p;
+  }
+  return _impl_.pong_;
+}
+inline ::swarm::game::Pong* ServerMessage::mutable_pong() {
+  ::swarm::game::Pong* _msg = _internal_mutable_pong();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.pong)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_pong(::swarm::game::Pong* pong) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pong_;
+  }
+  if (pong) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pong);
+    if (message_arena != submessage_arena) {
+      pong = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pong, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.pong_ = pong;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.pong)
+}
+
+// optional .swarm.game.LockstepFrames lockstep_frames = 11;
+inline bool ServerMessage::_internal_has_lockstep_frames() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.lockstep_frames_ != nullptr);
+  return value;
+}
+inline bool ServerMessage::has_lockstep_frames() const {
+  return _internal_has_lockstep_frames();
+}
+inline void ServerMessage::clear_lockstep_frames() {
+  if (_impl_.lockstep_frames_ != nullptr) _impl_.lockstep_frames_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::swarm::game::LockstepFrames& ServerMessage::_internal_lockstep_frames() const {
+  const ::swarm::game::LockstepFrames* p = _impl_.lockstep_frames_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::LockstepFrames&>(
+      ::swarm::game::_LockstepFrames_default_instance_);
+}
+inline const ::swarm::game::LockstepFrames& ServerMessage::lockstep_frames() const {
+  // @@protoc_insertion_point(field_get:swarm.game.ServerMessage.lockstep_frames)
+  return _internal_lockstep_frames();
+}
+inline void ServerMessage::unsafe_arena_set_allocated_lockstep_frames(
+    ::swarm::game::LockstepFrames* lockstep_frames) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lockstep_frames_);
+  }
+  _impl_.lockstep_frames_ = lockstep_frames;
+  if (lockstep_frames) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.ServerMessage.lockstep_frames)
+}
+inline ::swarm::game::LockstepFrames* ServerMessage::release_lockstep_frames() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::swarm::game::LockstepFrames* temp = _impl_.lockstep_frames_;
+  _impl_.lockstep_frames_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::LockstepFrames* ServerMessage::unsafe_arena_release_lockstep_frames() {
+  // @@protoc_insertion_point(field_release:swarm.game.ServerMessage.lockstep_frames)
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::swarm::game::LockstepFrames* temp = _impl_.lockstep_frames_;
+  _impl_.lockstep_frames_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::LockstepFrames* ServerMessage::_internal_mutable_lockstep_frames() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.lockstep_frames_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::LockstepFrames>(GetArenaForAllocation());
+    _impl_.lockstep_frames_ = p;
+  }
+  return _impl_.lockstep_frames_;
+}
+inline ::swarm::game::LockstepFrames* ServerMessage::mutable_lockstep_frames() {
+  ::swarm::game::LockstepFrames* _msg = _internal_mutable_lockstep_frames();
+  // @@protoc_insertion_point(field_mutable:swarm.game.ServerMessage.lockstep_frames)
+  return _msg;
+}
+inline void ServerMessage::set_allocated_lockstep_frames(::swarm::game::LockstepFrames* lockstep_frames) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lockstep_frames_;
+  }
+  if (lockstep_frames) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lockstep_frames);
+    if (message_arena != submessage_arena) {
+      lockstep_frames = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lockstep_frames, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  _impl_.lockstep_frames_ = lockstep_frames;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.ServerMessage.lockstep_frames)
+}
 
 // -------------------------------------------------------------------
 
-// PlayerLeft
+// PlayerMessage
 
-// optional string name = 1;
-inline bool PlayerLeft::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required .swarm.game.PlayerMessage.Type type = 1;
+inline bool PlayerMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void PlayerLeft::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool PlayerMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void PlayerMessage::clear_type() {
+  _impl_.type_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::swarm::game::PlayerMessage_Type PlayerMessage::_internal_type() const {
+  return static_cast< ::swarm::game::PlayerMessage_Type >(_impl_.type_);
+}
+inline ::swarm::game::PlayerMessage_Type PlayerMessage::type() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerMessage.type)
+  return _internal_type();
+}
+inline void PlayerMessage::_internal_set_type(::swarm::game::PlayerMessage_Type value) {
+  assert(::swarm::game::PlayerMessage_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.type_ = value;
+}
+inline void PlayerMessage::set_type(::swarm::game::PlayerMessage_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:swarm.game.PlayerMessage.type)
+}
+
+// optional .swarm.game.PlayerClick click = 3;
+inline bool PlayerMessage::_internal_has_click() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.click_ != nullptr);
+  return value;
+}
+inline bool PlayerMessage::has_click() const {
+  return _internal_has_click();
+}
+inline void PlayerMessage::clear_click() {
+  if (_impl_.click_ != nullptr) _impl_.click_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::swarm::game::PlayerClick& PlayerMessage::_internal_click() const {
+  const ::swarm::game::PlayerClick* p = _impl_.click_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerClick&>(
+      ::swarm::game::_PlayerClick_default_instance_);
+}
+inline const ::swarm::game::PlayerClick& PlayerMessage::click() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerMessage.click)
+  return _internal_click();
+}
+inline void PlayerMessage::unsafe_arena_set_allocated_click(
+    ::swarm::game::PlayerClick* click) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.click_);
+  }
+  _impl_.click_ = click;
+  if (click) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.PlayerMessage.click)
+}
+inline ::swarm::game::PlayerClick* PlayerMessage::release_click() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::PlayerClick* temp = _impl_.click_;
+  _impl_.click_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::swarm::game::PlayerClick* PlayerMessage::unsafe_arena_release_click() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerMessage.click)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::PlayerClick* temp = _impl_.click_;
+  _impl_.click_ = nullptr;
+  return temp;
+}
+inline ::swarm::game::PlayerClick* PlayerMessage::_internal_mutable_click() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.click_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerClick>(GetArenaForAllocation());
+    _impl_.click_ = p;
+  }
+  return _impl_.click_;
+}
+inline ::swarm::game::PlayerClick* PlayerMessage::mutable_click() {
+  ::swarm::game::PlayerClick* _msg = _internal_mutable_click();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerMessage.click)
+  return _msg;
+}
+inline void PlayerMessage::set_allocated_click(::swarm::game::PlayerClick* click) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.click_;
+  }
+  if (click) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(click);
+    if (message_arena != submessage_arena) {
+      click = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, click, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.click_ = click;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerMessage.click)
+}
+
+// repeated .swarm.game.PlayerInput input = 4;
+inline int PlayerMessage::_internal_input_size() const {
+  return _impl_.input_.size();
+}
+inline int PlayerMessage::input_size() const {
+  return _internal_input_size();
+}
+inline void PlayerMessage::clear_input() {
+  _impl_.input_.Clear();
+}
+inline ::swarm::game::PlayerInput* PlayerMessage::mutable_input(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerMessage.input)
+  return _impl_.input_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::PlayerInput >*
+PlayerMessage::mutable_input() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.PlayerMessage.input)
+  return &_impl_.input_;
+}
+inline const ::swarm::game::PlayerInput& PlayerMessage::_internal_input(int index) const {
+  return _impl_.input_.Get(index);
+}
+inline const ::swarm::game::PlayerInput& PlayerMessage::input(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerMessage.input)
+  return _internal_input(index);
+}
+inline ::swarm::game::PlayerInput* PlayerMessage::_internal_add_input() {
+  return _impl_.input_.Add();
+}
+inline ::swarm::game::PlayerInput* PlayerMessage::add_input() {
+  ::swarm::game::PlayerInput* _add = _internal_add_input();
+  // @@protoc_insertion_point(field_add:swarm.game.PlayerMessage.input)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::PlayerInput >&
+PlayerMessage::input() const {
+  // @@protoc_insertion_point(field_list:swarm.game.PlayerMessage.input)
+  return _impl_.input_;
+}
+
+// optional .swarm.game.PlayerHello hello = 5;
+inline bool PlayerMessage::_internal_has_hello() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hello_ != nullptr);
+  return value;
+}
+inline bool PlayerMessage::has_hello() const {
+  return _internal_has_hello();
+}
+inline void PlayerMessage::clear_hello() {
+  if (_impl_.hello_ != nullptr) _impl_.hello_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::swarm::game::PlayerHello& PlayerMessage::_internal_hello() const {
+  const ::swarm::game::PlayerHello* p = _impl_.hello_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::PlayerHello&>(
+      ::swarm::game::_PlayerHello_default_instance_);
+}
+inline const ::swarm::game::PlayerHello& PlayerMessage::hello() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerMessage.hello)
+  return _internal_hello();
+}
+inline void PlayerMessage::unsafe_arena_set_allocated_hello(
+    ::swarm::game::PlayerHello* hello) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hello_);
+  }
+  _impl_.hello_ = hello;
+  if (hello) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.PlayerMessage.hello)
+}
+inline ::swarm::game::PlayerHello* PlayerMessage::release_hello() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::PlayerHello* temp = _impl_.hello_;
+  _impl_.hello_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void PlayerLeft::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline ::swarm::game::PlayerHello* PlayerMessage::unsafe_arena_release_hello() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerMessage.hello)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::PlayerHello* temp = _impl_.hello_;
+  _impl_.hello_ = nullptr;
+  return temp;
 }
-inline void PlayerLeft::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+inline ::swarm::game::PlayerHello* PlayerMessage::_internal_mutable_hello() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.hello_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::PlayerHello>(GetArenaForAllocation());
+    _impl_.hello_ = p;
   }
-  clear_has_name();
+  return _impl_.hello_;
 }
-inline const ::std::string& PlayerLeft::name() const {
-  return *name_;
+inline ::swarm::game::PlayerHello* PlayerMessage::mutable_hello() {
+  ::swarm::game::PlayerHello* _msg = _internal_mutable_hello();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerMessage.hello)
+  return _msg;
 }
-inline void PlayerLeft::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+inline void PlayerMessage::set_allocated_hello(::swarm::game::PlayerHello* hello) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hello_;
   }
-  name_->assign(value);
-}
-inline void PlayerLeft::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  if (hello) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hello);
+    if (message_arena != submessage_arena) {
+      hello = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hello, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  name_->assign(value);
+  _impl_.hello_ = hello;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerMessage.hello)
 }
-inline void PlayerLeft::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional .swarm.game.Ping ping = 6;
+inline bool PlayerMessage::_internal_has_ping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ping_ != nullptr);
+  return value;
 }
-inline ::std::string* PlayerLeft::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline bool PlayerMessage::has_ping() const {
+  return _internal_has_ping();
 }
-inline ::std::string* PlayerLeft::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void PlayerMessage::clear_ping() {
+  if (_impl_.ping_ != nullptr) _impl_.ping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::swarm::game::Ping& PlayerMessage::_internal_ping() const {
+  const ::swarm::game::Ping* p = _impl_.ping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::Ping&>(
+      ::swarm::game::_Ping_default_instance_);
 }
-inline void PlayerLeft::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+inline const ::swarm::game::Ping& PlayerMessage::ping() const {
+  // @@protoc_insertion_point(field_get:swarm.game.PlayerMessage.ping)
+  return _internal_ping();
+}
+inline void PlayerMessage::unsafe_arena_set_allocated_ping(
+    ::swarm::game::Ping* ping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ping_);
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
+  _impl_.ping_ = ping;
+  if (ping) {
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.PlayerMessage.ping)
+}
+inline ::swarm::game::Ping* PlayerMessage::release_ping() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-
-// optional uint32 id = 2;
-inline bool PlayerLeft::has_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PlayerLeft::set_has_id() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PlayerLeft::clear_has_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline ::swarm::game::Ping* PlayerMessage::unsafe_arena_release_ping() {
+  // @@protoc_insertion_point(field_release:swarm.game.PlayerMessage.ping)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+  return temp;
 }
-inline void PlayerLeft::clear_id() {
-  id_ = 0u;
-  clear_has_id();
+inline ::swarm::game::Ping* PlayerMessage::_internal_mutable_ping() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.ping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::Ping>(GetArenaForAllocation());
+    _impl_.ping_ = p;
+  }
+  return _impl_.ping_;
 }
-inline ::google::protobuf::uint32 PlayerLeft::id() const {
-  return id_;
+inline ::swarm::game::Ping* PlayerMessage::mutable_ping() {
+  ::swarm::game::Ping* _msg = _internal_mutable_ping();
+  // @@protoc_insertion_point(field_mutable:swarm.game.PlayerMessage.ping)
+  return _msg;
 }
-inline void PlayerLeft::set_id(::google::protobuf::uint32 value) {
-  set_has_id();
-  id_ = value;
+inline void PlayerMessage::set_allocated_ping(::swarm::game::Ping* ping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ping_;
+  }
+  if (ping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ping);
+    if (message_arena != submessage_arena) {
+      ping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.ping_ = ping;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.PlayerMessage.ping)
 }
 
 // -------------------------------------------------------------------
 
-// Monster
+// Config
 
-// optional .swarm.game.Vector2 acc = 1;
-inline bool Monster::has_acc() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional string map_name = 1;
+inline bool Config::_internal_has_map_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Monster::set_has_acc() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Config::has_map_name() const {
+  return _internal_has_map_name();
 }
-inline void Monster::clear_has_acc() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Config::clear_map_name() {
+  _impl_.map_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Config::map_name() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.map_name)
+  return _internal_map_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Config::set_map_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.map_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:swarm.game.Config.map_name)
+}
+inline std::string* Config::mutable_map_name() {
+  std::string* _s = _internal_mutable_map_name();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Config.map_name)
+  return _s;
+}
+inline const std::string& Config::_internal_map_name() const {
+  return _impl_.map_name_.Get();
+}
+inline void Config::_internal_set_map_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.map_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Config::_internal_mutable_map_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.map_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Config::release_map_name() {
+  // @@protoc_insertion_point(field_release:swarm.game.Config.map_name)
+  if (!_internal_has_map_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.map_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void Monster::clear_acc() {
-  if (acc_ != NULL) acc_->::swarm::game::Vector2::Clear();
-  clear_has_acc();
+inline void Config::set_allocated_map_name(std::string* map_name) {
+  if (map_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.map_name_.SetAllocated(map_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Config.map_name)
 }
-inline const ::swarm::game::Vector2& Monster::acc() const {
-  return acc_ != NULL ? *acc_ : *default_instance_->acc_;
+
+// optional uint32 num_swarms = 2 [default = 5];
+inline bool Config::_internal_has_num_swarms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline ::swarm::game::Vector2* Monster::mutable_acc() {
-  set_has_acc();
-  if (acc_ == NULL) acc_ = new ::swarm::game::Vector2;
-  return acc_;
+inline bool Config::has_num_swarms() const {
+  return _internal_has_num_swarms();
 }
-inline ::swarm::game::Vector2* Monster::release_acc() {
-  clear_has_acc();
-  ::swarm::game::Vector2* temp = acc_;
-  acc_ = NULL;
-  return temp;
+inline void Config::clear_num_swarms() {
+  _impl_.num_swarms_ = 5u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void Monster::set_allocated_acc(::swarm::game::Vector2* acc) {
-  delete acc_;
-  acc_ = acc;
-  if (acc) {
-    set_has_acc();
-  } else {
-    clear_has_acc();
-  }
+inline uint32_t Config::_internal_num_swarms() const {
+  return _impl_.num_swarms_;
 }
-
-// optional .swarm.game.Vector2 vel = 2;
-inline bool Monster::has_vel() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline uint32_t Config::num_swarms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.num_swarms)
+  return _internal_num_swarms();
 }
-inline void Monster::set_has_vel() {
-  _has_bits_[0] |= 0x00000002u;
+inline void Config::_internal_set_num_swarms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.num_swarms_ = value;
 }
-inline void Monster::clear_has_vel() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Config::set_num_swarms(uint32_t value) {
+  _internal_set_num_swarms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.num_swarms)
 }
-inline void Monster::clear_vel() {
-  if (vel_ != NULL) vel_->::swarm::game::Vector2::Clear();
-  clear_has_vel();
+
+// optional uint32 monsters_per_swarm = 3 [default = 10];
+inline bool Config::_internal_has_monsters_per_swarm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline const ::swarm::game::Vector2& Monster::vel() const {
-  return vel_ != NULL ? *vel_ : *default_instance_->vel_;
+inline bool Config::has_monsters_per_swarm() const {
+  return _internal_has_monsters_per_swarm();
 }
-inline ::swarm::game::Vector2* Monster::mutable_vel() {
-  set_has_vel();
-  if (vel_ == NULL) vel_ = new ::swarm::game::Vector2;
-  return vel_;
+inline void Config::clear_monsters_per_swarm() {
+  _impl_.monsters_per_swarm_ = 10u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline ::swarm::game::Vector2* Monster::release_vel() {
-  clear_has_vel();
-  ::swarm::game::Vector2* temp = vel_;
-  vel_ = NULL;
-  return temp;
+inline uint32_t Config::_internal_monsters_per_swarm() const {
+  return _impl_.monsters_per_swarm_;
 }
-inline void Monster::set_allocated_vel(::swarm::game::Vector2* vel) {
-  delete vel_;
-  vel_ = vel;
-  if (vel) {
-    set_has_vel();
-  } else {
-    clear_has_vel();
-  }
+inline uint32_t Config::monsters_per_swarm() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.monsters_per_swarm)
+  return _internal_monsters_per_swarm();
 }
-
-// optional .swarm.game.Vector2 pos = 3;
-inline bool Monster::has_pos() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline void Config::_internal_set_monsters_per_swarm(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.monsters_per_swarm_ = value;
 }
-inline void Monster::set_has_pos() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Config::set_monsters_per_swarm(uint32_t value) {
+  _internal_set_monsters_per_swarm(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.monsters_per_swarm)
 }
-inline void Monster::clear_has_pos() {
-  _has_bits_[0] &= ~0x00000004u;
+
+// optional uint32 min_players = 4 [default = 2];
+inline bool Config::_internal_has_min_players() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void Monster::clear_pos() {
-  if (pos_ != NULL) pos_->::swarm::game::Vector2::Clear();
-  clear_has_pos();
+inline bool Config::has_min_players() const {
+  return _internal_has_min_players();
 }
-inline const ::swarm::game::Vector2& Monster::pos() const {
-  return pos_ != NULL ? *pos_ : *default_instance_->pos_;
+inline void Config::clear_min_players() {
+  _impl_.min_players_ = 2u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline ::swarm::game::Vector2* Monster::mutable_pos() {
-  set_has_pos();
-  if (pos_ == NULL) pos_ = new ::swarm::game::Vector2;
-  return pos_;
+inline uint32_t Config::_internal_min_players() const {
+  return _impl_.min_players_;
 }
-inline ::swarm::game::Vector2* Monster::release_pos() {
-  clear_has_pos();
-  ::swarm::game::Vector2* temp = pos_;
-  pos_ = NULL;
-  return temp;
+inline uint32_t Config::min_players() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.min_players)
+  return _internal_min_players();
 }
-inline void Monster::set_allocated_pos(::swarm::game::Vector2* pos) {
-  delete pos_;
-  pos_ = pos;
-  if (pos) {
-    set_has_pos();
-  } else {
-    clear_has_pos();
-  }
+inline void Config::_internal_set_min_players(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.min_players_ = value;
+}
+inline void Config::set_min_players(uint32_t value) {
+  _internal_set_min_players(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.min_players)
 }
 
-// optional float size = 4;
-inline bool Monster::has_size() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional uint32 max_players = 5 [default = 4];
+inline bool Config::_internal_has_max_players() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void Monster::set_has_size() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Config::has_max_players() const {
+  return _internal_has_max_players();
 }
-inline void Monster::clear_has_size() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void Config::clear_max_players() {
+  _impl_.max_players_ = 4u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void Monster::clear_size() {
-  size_ = 0;
-  clear_has_size();
+inline uint32_t Config::_internal_max_players() const {
+  return _impl_.max_players_;
 }
-inline float Monster::size() const {
-  return size_;
+inline uint32_t Config::max_players() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.max_players)
+  return _internal_max_players();
 }
-inline void Monster::set_size(float value) {
-  set_has_size();
-  size_ = value;
+inline void Config::_internal_set_max_players(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.max_players_ = value;
+}
+inline void Config::set_max_players(uint32_t value) {
+  _internal_set_max_players(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.max_players)
 }
 
-// -------------------------------------------------------------------
-
-// SwarmState
-
-// repeated .swarm.game.Monster monster = 1;
-inline int SwarmState::monster_size() const {
-  return monster_.size();
+// optional uint32 initial_health = 6 [default = 10];
+inline bool Config::_internal_has_initial_health() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
 }
-inline void SwarmState::clear_monster() {
-  monster_.Clear();
+inline bool Config::has_initial_health() const {
+  return _internal_has_initial_health();
 }
-inline const ::swarm::game::Monster& SwarmState::monster(int index) const {
-  return monster_.Get(index);
+inline void Config::clear_initial_health() {
+  _impl_.initial_health_ = 10u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
-inline ::swarm::game::Monster* SwarmState::mutable_monster(int index) {
-  return monster_.Mutable(index);
+inline uint32_t Config::_internal_initial_health() const {
+  return _impl_.initial_health_;
 }
-inline ::swarm::game::Monster* SwarmState::add_monster() {
-  return monster_.Add();
+inline uint32_t Config::initial_health() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.initial_health)
+  return _internal_initial_health();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::swarm::game::Monster >&
-SwarmState::monster() const {
-  return monster_;
+inline void Config::_internal_set_initial_health(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.initial_health_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField< ::swarm::game::Monster >*
-SwarmState::mutable_monster() {
-  return &monster_;
+inline void Config::set_initial_health(uint32_t value) {
+  _internal_set_initial_health(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.initial_health)
 }
 
-// -------------------------------------------------------------------
-
-// Player
-
-// optional uint32 id = 1;
-inline bool Player::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint32 snapshot_interval_ms = 7 [default = 100];
+inline bool Config::_internal_has_snapshot_interval_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
 }
-inline void Player::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Config::has_snapshot_interval_ms() const {
+  return _internal_has_snapshot_interval_ms();
 }
-inline void Player::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Config::clear_snapshot_interval_ms() {
+  _impl_.snapshot_interval_ms_ = 100u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
 }
-inline void Player::clear_id() {
-  id_ = 0u;
-  clear_has_id();
+inline uint32_t Config::_internal_snapshot_interval_ms() const {
+  return _impl_.snapshot_interval_ms_;
 }
-inline ::google::protobuf::uint32 Player::id() const {
-  return id_;
+inline uint32_t Config::snapshot_interval_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.snapshot_interval_ms)
+  return _internal_snapshot_interval_ms();
 }
-inline void Player::set_id(::google::protobuf::uint32 value) {
-  set_has_id();
-  id_ = value;
+inline void Config::_internal_set_snapshot_interval_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.snapshot_interval_ms_ = value;
 }
-
-// optional .swarm.game.Vector2 acc = 2;
-inline bool Player::has_acc() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline void Config::set_snapshot_interval_ms(uint32_t value) {
+  _internal_set_snapshot_interval_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.snapshot_interval_ms)
 }
-inline void Player::set_has_acc() {
-  _has_bits_[0] |= 0x00000002u;
+
+// optional uint32 max_rewind_ms = 8 [default = 400];
+inline bool Config::_internal_has_max_rewind_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
 }
-inline void Player::clear_has_acc() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Config::has_max_rewind_ms() const {
+  return _internal_has_max_rewind_ms();
 }
-inline void Player::clear_acc() {
-  if (acc_ != NULL) acc_->::swarm::game::Vector2::Clear();
-  clear_has_acc();
+inline void Config::clear_max_rewind_ms() {
+  _impl_.max_rewind_ms_ = 400u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
 }
-inline const ::swarm::game::Vector2& Player::acc() const {
-  return acc_ != NULL ? *acc_ : *default_instance_->acc_;
+inline uint32_t Config::_internal_max_rewind_ms() const {
+  return _impl_.max_rewind_ms_;
 }
-inline ::swarm::game::Vector2* Player::mutable_acc() {
-  set_has_acc();
-  if (acc_ == NULL) acc_ = new ::swarm::game::Vector2;
-  return acc_;
+inline uint32_t Config::max_rewind_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.max_rewind_ms)
+  return _internal_max_rewind_ms();
 }
-inline ::swarm::game::Vector2* Player::release_acc() {
-  clear_has_acc();
-  ::swarm::game::Vector2* temp = acc_;
-  acc_ = NULL;
-  return temp;
+inline void Config::_internal_set_max_rewind_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.max_rewind_ms_ = value;
 }
-inline void Player::set_allocated_acc(::swarm::game::Vector2* acc) {
-  delete acc_;
-  acc_ = acc;
-  if (acc) {
-    set_has_acc();
-  } else {
-    clear_has_acc();
-  }
+inline void Config::set_max_rewind_ms(uint32_t value) {
+  _internal_set_max_rewind_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.max_rewind_ms)
 }
 
-// optional .swarm.game.Vector2 vel = 3;
-inline bool Player::has_vel() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional uint32 max_history_kb = 9;
+inline bool Config::_internal_has_max_history_kb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Player::set_has_vel() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Config::has_max_history_kb() const {
+  return _internal_has_max_history_kb();
 }
-inline void Player::clear_has_vel() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void Config::clear_max_history_kb() {
+  _impl_.max_history_kb_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Player::clear_vel() {
-  if (vel_ != NULL) vel_->::swarm::game::Vector2::Clear();
-  clear_has_vel();
-}
-inline const ::swarm::game::Vector2& Player::vel() const {
-  return vel_ != NULL ? *vel_ : *default_instance_->vel_;
+inline uint32_t Config::_internal_max_history_kb() const {
+  return _impl_.max_history_kb_;
 }
-inline ::swarm::game::Vector2* Player::mutable_vel() {
-  set_has_vel();
-  if (vel_ == NULL) vel_ = new ::swarm::game::Vector2;
-  return vel_;
+inline uint32_t Config::max_history_kb() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.max_history_kb)
+  return _internal_max_history_kb();
 }
-inline ::swarm::game::Vector2* Player::release_vel() {
-  clear_has_vel();
-  ::swarm::game::Vector2* temp = vel_;
-  vel_ = NULL;
-  return temp;
+inline void Config::_internal_set_max_history_kb(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_history_kb_ = value;
 }
-inline void Player::set_allocated_vel(::swarm::game::Vector2* vel) {
-  delete vel_;
-  vel_ = vel;
-  if (vel) {
-    set_has_vel();
-  } else {
-    clear_has_vel();
-  }
+inline void Config::set_max_history_kb(uint32_t value) {
+  _internal_set_max_history_kb(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.max_history_kb)
 }
 
-// optional .swarm.game.Vector2 pos = 4;
-inline bool Player::has_pos() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional float dead_reckoning_tolerance = 10 [default = 1];
+inline bool Config::_internal_has_dead_reckoning_tolerance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
 }
-inline void Player::set_has_pos() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Config::has_dead_reckoning_tolerance() const {
+  return _internal_has_dead_reckoning_tolerance();
 }
-inline void Player::clear_has_pos() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void Config::clear_dead_reckoning_tolerance() {
+  _impl_.dead_reckoning_tolerance_ = 1;
+  _impl_._has_bits_[0] &= ~0x00002000u;
 }
-inline void Player::clear_pos() {
-  if (pos_ != NULL) pos_->::swarm::game::Vector2::Clear();
-  clear_has_pos();
-}
-inline const ::swarm::game::Vector2& Player::pos() const {
-  return pos_ != NULL ? *pos_ : *default_instance_->pos_;
+inline float Config::_internal_dead_reckoning_tolerance() const {
+  return _impl_.dead_reckoning_tolerance_;
 }
-inline ::swarm::game::Vector2* Player::mutable_pos() {
-  set_has_pos();
-  if (pos_ == NULL) pos_ = new ::swarm::game::Vector2;
-  return pos_;
+inline float Config::dead_reckoning_tolerance() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.dead_reckoning_tolerance)
+  return _internal_dead_reckoning_tolerance();
 }
-inline ::swarm::game::Vector2* Player::release_pos() {
-  clear_has_pos();
-  ::swarm::game::Vector2* temp = pos_;
-  pos_ = NULL;
-  return temp;
+inline void Config::_internal_set_dead_reckoning_tolerance(float value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.dead_reckoning_tolerance_ = value;
 }
-inline void Player::set_allocated_pos(::swarm::game::Vector2* pos) {
-  delete pos_;
-  pos_ = pos;
-  if (pos) {
-    set_has_pos();
-  } else {
-    clear_has_pos();
-  }
+inline void Config::set_dead_reckoning_tolerance(float value) {
+  _internal_set_dead_reckoning_tolerance(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.dead_reckoning_tolerance)
 }
 
-// optional int32 health = 5;
-inline bool Player::has_health() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional uint32 monster_refresh_ms = 11 [default = 1000];
+inline bool Config::_internal_has_monster_refresh_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
 }
-inline void Player::set_has_health() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool Config::has_monster_refresh_ms() const {
+  return _internal_has_monster_refresh_ms();
 }
-inline void Player::clear_has_health() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void Config::clear_monster_refresh_ms() {
+  _impl_.monster_refresh_ms_ = 1000u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
 }
-inline void Player::clear_health() {
-  health_ = 0;
-  clear_has_health();
+inline uint32_t Config::_internal_monster_refresh_ms() const {
+  return _impl_.monster_refresh_ms_;
 }
-inline ::google::protobuf::int32 Player::health() const {
-  return health_;
+inline uint32_t Config::monster_refresh_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.monster_refresh_ms)
+  return _internal_monster_refresh_ms();
 }
-inline void Player::set_health(::google::protobuf::int32 value) {
-  set_has_health();
-  health_ = value;
+inline void Config::_internal_set_monster_refresh_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.monster_refresh_ms_ = value;
 }
-
-// -------------------------------------------------------------------
-
-// PlayerClick
-
-// optional .swarm.game.Vector2 click_pos = 1;
-inline bool PlayerClick::has_click_pos() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline void Config::set_monster_refresh_ms(uint32_t value) {
+  _internal_set_monster_refresh_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.monster_refresh_ms)
 }
-inline void PlayerClick::set_has_click_pos() {
-  _has_bits_[0] |= 0x00000001u;
+
+// optional uint32 client_bytes_per_sec = 12 [default = 64000];
+inline bool Config::_internal_has_client_bytes_per_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
 }
-inline void PlayerClick::clear_has_click_pos() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Config::has_client_bytes_per_sec() const {
+  return _internal_has_client_bytes_per_sec();
 }
-inline void PlayerClick::clear_click_pos() {
-  if (click_pos_ != NULL) click_pos_->::swarm::game::Vector2::Clear();
-  clear_has_click_pos();
+inline void Config::clear_client_bytes_per_sec() {
+  _impl_.client_bytes_per_sec_ = 64000u;
+  _impl_._has_bits_[0] &= ~0x00008000u;
 }
-inline const ::swarm::game::Vector2& PlayerClick::click_pos() const {
-  return click_pos_ != NULL ? *click_pos_ : *default_instance_->click_pos_;
+inline uint32_t Config::_internal_client_bytes_per_sec() const {
+  return _impl_.client_bytes_per_sec_;
 }
-inline ::swarm::game::Vector2* PlayerClick::mutable_click_pos() {
-  set_has_click_pos();
-  if (click_pos_ == NULL) click_pos_ = new ::swarm::game::Vector2;
-  return click_pos_;
+inline uint32_t Config::client_bytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.client_bytes_per_sec)
+  return _internal_client_bytes_per_sec();
 }
-inline ::swarm::game::Vector2* PlayerClick::release_click_pos() {
-  clear_has_click_pos();
-  ::swarm::game::Vector2* temp = click_pos_;
-  click_pos_ = NULL;
-  return temp;
+inline void Config::_internal_set_client_bytes_per_sec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.client_bytes_per_sec_ = value;
 }
-inline void PlayerClick::set_allocated_click_pos(::swarm::game::Vector2* click_pos) {
-  delete click_pos_;
-  click_pos_ = click_pos;
-  if (click_pos) {
-    set_has_click_pos();
-  } else {
-    clear_has_click_pos();
-  }
+inline void Config::set_client_bytes_per_sec(uint32_t value) {
+  _internal_set_client_bytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.client_bytes_per_sec)
 }
 
-// optional float click_size = 2;
-inline bool PlayerClick::has_click_size() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional bool udp_enabled = 13 [default = true];
+inline bool Config::_internal_has_udp_enabled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
 }
-inline void PlayerClick::set_has_click_size() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Config::has_udp_enabled() const {
+  return _internal_has_udp_enabled();
 }
-inline void PlayerClick::clear_has_click_size() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Config::clear_udp_enabled() {
+  _impl_.udp_enabled_ = true;
+  _impl_._has_bits_[0] &= ~0x00010000u;
 }
-inline void PlayerClick::clear_click_size() {
-  click_size_ = 0;
-  clear_has_click_size();
+inline bool Config::_internal_udp_enabled() const {
+  return _impl_.udp_enabled_;
 }
-inline float PlayerClick::click_size() const {
-  return click_size_;
+inline bool Config::udp_enabled() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.udp_enabled)
+  return _internal_udp_enabled();
 }
-inline void PlayerClick::set_click_size(float value) {
-  set_has_click_size();
-  click_size_ = value;
+inline void Config::_internal_set_udp_enabled(bool value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.udp_enabled_ = value;
+}
+inline void Config::set_udp_enabled(bool value) {
+  _internal_set_udp_enabled(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.udp_enabled)
 }
 
-// -------------------------------------------------------------------
-
-// PlayerState
-
-// repeated .swarm.game.Player player = 1;
-inline int PlayerState::player_size() const {
-  return player_.size();
+// optional uint32 session_timeout_ms = 14 [default = 30000];
+inline bool Config::_internal_has_session_timeout_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
 }
-inline void PlayerState::clear_player() {
-  player_.Clear();
+inline bool Config::has_session_timeout_ms() const {
+  return _internal_has_session_timeout_ms();
 }
-inline const ::swarm::game::Player& PlayerState::player(int index) const {
-  return player_.Get(index);
+inline void Config::clear_session_timeout_ms() {
+  _impl_.session_timeout_ms_ = 30000u;
+  _impl_._has_bits_[0] &= ~0x00020000u;
 }
-inline ::swarm::game::Player* PlayerState::mutable_player(int index) {
-  return player_.Mutable(index);
+inline uint32_t Config::_internal_session_timeout_ms() const {
+  return _impl_.session_timeout_ms_;
 }
-inline ::swarm::game::Player* PlayerState::add_player() {
-  return player_.Add();
+inline uint32_t Config::session_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.session_timeout_ms)
+  return _internal_session_timeout_ms();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::swarm::game::Player >&
-PlayerState::player() const {
-  return player_;
+inline void Config::_internal_set_session_timeout_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.session_timeout_ms_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField< ::swarm::game::Player >*
-PlayerState::mutable_player() {
-  return &player_;
+inline void Config::set_session_timeout_ms(uint32_t value) {
+  _internal_set_session_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.session_timeout_ms)
 }
 
-// -------------------------------------------------------------------
-
-// GameStarted
-
-// optional uint32 player_id = 1;
-inline bool GameStarted::has_player_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint32 hello_timeout_ms = 15 [default = 5000];
+inline bool Config::_internal_has_hello_timeout_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
 }
-inline void GameStarted::set_has_player_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Config::has_hello_timeout_ms() const {
+  return _internal_has_hello_timeout_ms();
 }
-inline void GameStarted::clear_has_player_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Config::clear_hello_timeout_ms() {
+  _impl_.hello_timeout_ms_ = 5000u;
+  _impl_._has_bits_[0] &= ~0x00040000u;
 }
-inline void GameStarted::clear_player_id() {
-  player_id_ = 0u;
-  clear_has_player_id();
+inline uint32_t Config::_internal_hello_timeout_ms() const {
+  return _impl_.hello_timeout_ms_;
+}
+inline uint32_t Config::hello_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.hello_timeout_ms)
+  return _internal_hello_timeout_ms();
 }
-inline ::google::protobuf::uint32 GameStarted::player_id() const {
-  return player_id_;
+inline void Config::_internal_set_hello_timeout_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.hello_timeout_ms_ = value;
 }
-inline void GameStarted::set_player_id(::google::protobuf::uint32 value) {
-  set_has_player_id();
-  player_id_ = value;
+inline void Config::set_hello_timeout_ms(uint32_t value) {
+  _internal_set_hello_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.hello_timeout_ms)
 }
 
-// optional uint32 health = 2;
-inline bool GameStarted::has_health() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional uint32 initial_state_bytes_per_sec = 16 [default = 256000];
+inline bool Config::_internal_has_initial_state_bytes_per_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
 }
-inline void GameStarted::set_has_health() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Config::has_initial_state_bytes_per_sec() const {
+  return _internal_has_initial_state_bytes_per_sec();
 }
-inline void GameStarted::clear_has_health() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Config::clear_initial_state_bytes_per_sec() {
+  _impl_.initial_state_bytes_per_sec_ = 256000u;
+  _impl_._has_bits_[0] &= ~0x00080000u;
 }
-inline void GameStarted::clear_health() {
-  health_ = 0u;
-  clear_has_health();
+inline uint32_t Config::_internal_initial_state_bytes_per_sec() const {
+  return _impl_.initial_state_bytes_per_sec_;
+}
+inline uint32_t Config::initial_state_bytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.initial_state_bytes_per_sec)
+  return _internal_initial_state_bytes_per_sec();
 }
-inline ::google::protobuf::uint32 GameStarted::health() const {
-  return health_;
+inline void Config::_internal_set_initial_state_bytes_per_sec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.initial_state_bytes_per_sec_ = value;
 }
-inline void GameStarted::set_health(::google::protobuf::uint32 value) {
-  set_has_health();
-  health_ = value;
+inline void Config::set_initial_state_bytes_per_sec(uint32_t value) {
+  _internal_set_initial_state_bytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.initial_state_bytes_per_sec)
 }
 
-// optional string map_name = 3;
-inline bool GameStarted::has_map_name() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional string shared_snapshot_name = 17;
+inline bool Config::_internal_has_shared_snapshot_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void GameStarted::set_has_map_name() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Config::has_shared_snapshot_name() const {
+  return _internal_has_shared_snapshot_name();
 }
-inline void GameStarted::clear_has_map_name() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void Config::clear_shared_snapshot_name() {
+  _impl_.shared_snapshot_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void GameStarted::clear_map_name() {
-  if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-    map_name_->clear();
-  }
-  clear_has_map_name();
+inline const std::string& Config::shared_snapshot_name() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.shared_snapshot_name)
+  return _internal_shared_snapshot_name();
 }
-inline const ::std::string& GameStarted::map_name() const {
-  return *map_name_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Config::set_shared_snapshot_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.shared_snapshot_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:swarm.game.Config.shared_snapshot_name)
 }
-inline void GameStarted::set_map_name(const ::std::string& value) {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
-  }
-  map_name_->assign(value);
+inline std::string* Config::mutable_shared_snapshot_name() {
+  std::string* _s = _internal_mutable_shared_snapshot_name();
+  // @@protoc_insertion_point(field_mutable:swarm.game.Config.shared_snapshot_name)
+  return _s;
 }
-inline void GameStarted::set_map_name(const char* value) {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
-  }
-  map_name_->assign(value);
+inline const std::string& Config::_internal_shared_snapshot_name() const {
+  return _impl_.shared_snapshot_name_.Get();
 }
-inline void GameStarted::set_map_name(const char* value, size_t size) {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
-  }
-  map_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void Config::_internal_set_shared_snapshot_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shared_snapshot_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GameStarted::mutable_map_name() {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
-  }
-  return map_name_;
+inline std::string* Config::_internal_mutable_shared_snapshot_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.shared_snapshot_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GameStarted::release_map_name() {
-  clear_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = map_name_;
-    map_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline std::string* Config::release_shared_snapshot_name() {
+  // @@protoc_insertion_point(field_release:swarm.game.Config.shared_snapshot_name)
+  if (!_internal_has_shared_snapshot_name()) {
+    return nullptr;
   }
-}
-inline void GameStarted::set_allocated_map_name(::std::string* map_name) {
-  if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete map_name_;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.shared_snapshot_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shared_snapshot_name_.IsDefault()) {
+    _impl_.shared_snapshot_name_.Set("", GetArenaForAllocation());
   }
-  if (map_name) {
-    set_has_map_name();
-    map_name_ = map_name;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Config::set_allocated_shared_snapshot_name(std::string* shared_snapshot_name) {
+  if (shared_snapshot_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_map_name();
-    map_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.shared_snapshot_name_.SetAllocated(shared_snapshot_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shared_snapshot_name_.IsDefault()) {
+    _impl_.shared_snapshot_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.Config.shared_snapshot_name)
 }
 
-// optional .swarm.game.PlayerState player_state = 4;
-inline bool GameStarted::has_player_state() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional bool lockstep = 18;
+inline bool Config::_internal_has_lockstep() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void GameStarted::set_has_player_state() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Config::has_lockstep() const {
+  return _internal_has_lockstep();
 }
-inline void GameStarted::clear_has_player_state() {
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline void GameStarted::clear_player_state() {
-  if (player_state_ != NULL) player_state_->::swarm::game::PlayerState::Clear();
-  clear_has_player_state();
+inline void Config::clear_lockstep() {
+  _impl_.lockstep_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline const ::swarm::game::PlayerState& GameStarted::player_state() const {
-  return player_state_ != NULL ? *player_state_ : *default_instance_->player_state_;
+inline bool Config::_internal_lockstep() const {
+  return _impl_.lockstep_;
 }
-inline ::swarm::game::PlayerState* GameStarted::mutable_player_state() {
-  set_has_player_state();
-  if (player_state_ == NULL) player_state_ = new ::swarm::game::PlayerState;
-  return player_state_;
+inline bool Config::lockstep() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.lockstep)
+  return _internal_lockstep();
 }
-inline ::swarm::game::PlayerState* GameStarted::release_player_state() {
-  clear_has_player_state();
-  ::swarm::game::PlayerState* temp = player_state_;
-  player_state_ = NULL;
-  return temp;
+inline void Config::_internal_set_lockstep(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lockstep_ = value;
 }
-inline void GameStarted::set_allocated_player_state(::swarm::game::PlayerState* player_state) {
-  delete player_state_;
-  player_state_ = player_state;
-  if (player_state) {
-    set_has_player_state();
-  } else {
-    clear_has_player_state();
-  }
+inline void Config::set_lockstep(bool value) {
+  _internal_set_lockstep(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.lockstep)
 }
 
-// optional .swarm.game.SwarmState swarm_state = 5;
-inline bool GameStarted::has_swarm_state() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional uint32 lockstep_hash_interval_ms = 19 [default = 1000];
+inline bool Config::_internal_has_lockstep_hash_interval_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
 }
-inline void GameStarted::set_has_swarm_state() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool Config::has_lockstep_hash_interval_ms() const {
+  return _internal_has_lockstep_hash_interval_ms();
 }
-inline void GameStarted::clear_has_swarm_state() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void GameStarted::clear_swarm_state() {
-  if (swarm_state_ != NULL) swarm_state_->::swarm::game::SwarmState::Clear();
-  clear_has_swarm_state();
+inline void Config::clear_lockstep_hash_interval_ms() {
+  _impl_.lockstep_hash_interval_ms_ = 1000u;
+  _impl_._has_bits_[0] &= ~0x00100000u;
 }
-inline const ::swarm::game::SwarmState& GameStarted::swarm_state() const {
-  return swarm_state_ != NULL ? *swarm_state_ : *default_instance_->swarm_state_;
+inline uint32_t Config::_internal_lockstep_hash_interval_ms() const {
+  return _impl_.lockstep_hash_interval_ms_;
 }
-inline ::swarm::game::SwarmState* GameStarted::mutable_swarm_state() {
-  set_has_swarm_state();
-  if (swarm_state_ == NULL) swarm_state_ = new ::swarm::game::SwarmState;
-  return swarm_state_;
+inline uint32_t Config::lockstep_hash_interval_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.lockstep_hash_interval_ms)
+  return _internal_lockstep_hash_interval_ms();
 }
-inline ::swarm::game::SwarmState* GameStarted::release_swarm_state() {
-  clear_has_swarm_state();
-  ::swarm::game::SwarmState* temp = swarm_state_;
-  swarm_state_ = NULL;
-  return temp;
+inline void Config::_internal_set_lockstep_hash_interval_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.lockstep_hash_interval_ms_ = value;
 }
-inline void GameStarted::set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state) {
-  delete swarm_state_;
-  swarm_state_ = swarm_state;
-  if (swarm_state) {
-    set_has_swarm_state();
-  } else {
-    clear_has_swarm_state();
-  }
+inline void Config::set_lockstep_hash_interval_ms(uint32_t value) {
+  _internal_set_lockstep_hash_interval_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.lockstep_hash_interval_ms)
 }
 
-// -------------------------------------------------------------------
-
-// GameEnded
-
-// optional uint32 winner_id = 1;
-inline bool GameEnded::has_winner_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .swarm.game.Config.MonsterCompression monster_compression = 20;
+inline bool Config::_internal_has_monster_compression() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void GameEnded::set_has_winner_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Config::has_monster_compression() const {
+  return _internal_has_monster_compression();
 }
-inline void GameEnded::clear_has_winner_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Config::clear_monster_compression() {
+  _impl_.monster_compression_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void GameEnded::clear_winner_id() {
-  winner_id_ = 0u;
-  clear_has_winner_id();
+inline ::swarm::game::Config_MonsterCompression Config::_internal_monster_compression() const {
+  return static_cast< ::swarm::game::Config_MonsterCompression >(_impl_.monster_compression_);
 }
-inline ::google::protobuf::uint32 GameEnded::winner_id() const {
-  return winner_id_;
+inline ::swarm::game::Config_MonsterCompression Config::monster_compression() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.monster_compression)
+  return _internal_monster_compression();
 }
-inline void GameEnded::set_winner_id(::google::protobuf::uint32 value) {
-  set_has_winner_id();
-  winner_id_ = value;
+inline void Config::_internal_set_monster_compression(::swarm::game::Config_MonsterCompression value) {
+  assert(::swarm::game::Config_MonsterCompression_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.monster_compression_ = value;
+}
+inline void Config::set_monster_compression(::swarm::game::Config_MonsterCompression value) {
+  _internal_set_monster_compression(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.monster_compression)
 }
 
-// -------------------------------------------------------------------
-
-// PlayerDied
+// optional float aggregate_distance = 21;
+inline bool Config::_internal_has_aggregate_distance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Config::has_aggregate_distance() const {
+  return _internal_has_aggregate_distance();
+}
+inline void Config::clear_aggregate_distance() {
+  _impl_.aggregate_distance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float Config::_internal_aggregate_distance() const {
+  return _impl_.aggregate_distance_;
+}
+inline float Config::aggregate_distance() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.aggregate_distance)
+  return _internal_aggregate_distance();
+}
+inline void Config::_internal_set_aggregate_distance(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.aggregate_distance_ = value;
+}
+inline void Config::set_aggregate_distance(float value) {
+  _internal_set_aggregate_distance(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.aggregate_distance)
+}
 
-// optional uint32 player_id = 1;
-inline bool PlayerDied::has_player_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional float aggregate_cell_size = 22 [default = 64];
+inline bool Config::_internal_has_aggregate_cell_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
 }
-inline void PlayerDied::set_has_player_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Config::has_aggregate_cell_size() const {
+  return _internal_has_aggregate_cell_size();
 }
-inline void PlayerDied::clear_has_player_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Config::clear_aggregate_cell_size() {
+  _impl_.aggregate_cell_size_ = 64;
+  _impl_._has_bits_[0] &= ~0x00200000u;
 }
-inline void PlayerDied::clear_player_id() {
-  player_id_ = 0u;
-  clear_has_player_id();
+inline float Config::_internal_aggregate_cell_size() const {
+  return _impl_.aggregate_cell_size_;
+}
+inline float Config::aggregate_cell_size() const {
+  // @@protoc_insertion_point(field_get:swarm.game.Config.aggregate_cell_size)
+  return _internal_aggregate_cell_size();
 }
-inline ::google::protobuf::uint32 PlayerDied::player_id() const {
-  return player_id_;
+inline void Config::_internal_set_aggregate_cell_size(float value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.aggregate_cell_size_ = value;
 }
-inline void PlayerDied::set_player_id(::google::protobuf::uint32 value) {
-  set_has_player_id();
-  player_id_ = value;
+inline void Config::set_aggregate_cell_size(float value) {
+  _internal_set_aggregate_cell_size(value);
+  // @@protoc_insertion_point(field_set:swarm.game.Config.aggregate_cell_size)
 }
 
 // -------------------------------------------------------------------
 
-// MonsterDied
+// LinkConditions
 
-// repeated .swarm.game.Vector2 pos = 1;
-inline int MonsterDied::pos_size() const {
-  return pos_.size();
+// optional uint32 delay_ms = 1;
+inline bool LinkConditions::_internal_has_delay_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void MonsterDied::clear_pos() {
-  pos_.Clear();
+inline bool LinkConditions::has_delay_ms() const {
+  return _internal_has_delay_ms();
 }
-inline const ::swarm::game::Vector2& MonsterDied::pos(int index) const {
-  return pos_.Get(index);
+inline void LinkConditions::clear_delay_ms() {
+  _impl_.delay_ms_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::swarm::game::Vector2* MonsterDied::mutable_pos(int index) {
-  return pos_.Mutable(index);
+inline uint32_t LinkConditions::_internal_delay_ms() const {
+  return _impl_.delay_ms_;
 }
-inline ::swarm::game::Vector2* MonsterDied::add_pos() {
-  return pos_.Add();
+inline uint32_t LinkConditions::delay_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.delay_ms)
+  return _internal_delay_ms();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::swarm::game::Vector2 >&
-MonsterDied::pos() const {
-  return pos_;
+inline void LinkConditions::_internal_set_delay_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.delay_ms_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField< ::swarm::game::Vector2 >*
-MonsterDied::mutable_pos() {
-  return &pos_;
+inline void LinkConditions::set_delay_ms(uint32_t value) {
+  _internal_set_delay_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.delay_ms)
 }
 
-// -------------------------------------------------------------------
-
-// ServerMessage
-
-// required .swarm.game.ServerMessage.Type type = 1;
-inline bool ServerMessage::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional uint32 jitter_ms = 2;
+inline bool LinkConditions::_internal_has_jitter_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool LinkConditions::has_jitter_ms() const {
+  return _internal_has_jitter_ms();
 }
-inline void ServerMessage::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void LinkConditions::clear_jitter_ms() {
+  _impl_.jitter_ms_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void ServerMessage::clear_type() {
-  type_ = 0;
-  clear_has_type();
+inline uint32_t LinkConditions::_internal_jitter_ms() const {
+  return _impl_.jitter_ms_;
 }
-inline ::swarm::game::ServerMessage_Type ServerMessage::type() const {
-  return static_cast< ::swarm::game::ServerMessage_Type >(type_);
+inline uint32_t LinkConditions::jitter_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.jitter_ms)
+  return _internal_jitter_ms();
 }
-inline void ServerMessage::set_type(::swarm::game::ServerMessage_Type value) {
-  assert(::swarm::game::ServerMessage_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+inline void LinkConditions::_internal_set_jitter_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.jitter_ms_ = value;
 }
-
-// optional .swarm.game.GameStarted game_started = 2;
-inline bool ServerMessage::has_game_started() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline void LinkConditions::set_jitter_ms(uint32_t value) {
+  _internal_set_jitter_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.jitter_ms)
 }
-inline void ServerMessage::set_has_game_started() {
-  _has_bits_[0] |= 0x00000002u;
+
+// optional .swarm.game.LinkConditions.Distribution jitter_distribution = 3 [default = NORMAL];
+inline bool LinkConditions::_internal_has_jitter_distribution() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void ServerMessage::clear_has_game_started() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool LinkConditions::has_jitter_distribution() const {
+  return _internal_has_jitter_distribution();
 }
-inline void ServerMessage::clear_game_started() {
-  if (game_started_ != NULL) game_started_->::swarm::game::GameStarted::Clear();
-  clear_has_game_started();
+inline void LinkConditions::clear_jitter_distribution() {
+  _impl_.jitter_distribution_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline const ::swarm::game::GameStarted& ServerMessage::game_started() const {
-  return game_started_ != NULL ? *game_started_ : *default_instance_->game_started_;
+inline ::swarm::game::LinkConditions_Distribution LinkConditions::_internal_jitter_distribution() const {
+  return static_cast< ::swarm::game::LinkConditions_Distribution >(_impl_.jitter_distribution_);
 }
-inline ::swarm::game::GameStarted* ServerMessage::mutable_game_started() {
-  set_has_game_started();
-  if (game_started_ == NULL) game_started_ = new ::swarm::game::GameStarted;
-  return game_started_;
+inline ::swarm::game::LinkConditions_Distribution LinkConditions::jitter_distribution() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.jitter_distribution)
+  return _internal_jitter_distribution();
 }
-inline ::swarm::game::GameStarted* ServerMessage::release_game_started() {
-  clear_has_game_started();
-  ::swarm::game::GameStarted* temp = game_started_;
-  game_started_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_jitter_distribution(::swarm::game::LinkConditions_Distribution value) {
+  assert(::swarm::game::LinkConditions_Distribution_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.jitter_distribution_ = value;
 }
-inline void ServerMessage::set_allocated_game_started(::swarm::game::GameStarted* game_started) {
-  delete game_started_;
-  game_started_ = game_started;
-  if (game_started) {
-    set_has_game_started();
-  } else {
-    clear_has_game_started();
-  }
+inline void LinkConditions::set_jitter_distribution(::swarm::game::LinkConditions_Distribution value) {
+  _internal_set_jitter_distribution(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.jitter_distribution)
 }
 
-// optional .swarm.game.PlayerJoined player_joined = 3;
-inline bool ServerMessage::has_player_joined() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional float loss = 4;
+inline bool LinkConditions::_internal_has_loss() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_player_joined() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool LinkConditions::has_loss() const {
+  return _internal_has_loss();
 }
-inline void ServerMessage::clear_has_player_joined() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void LinkConditions::clear_loss() {
+  _impl_.loss_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void ServerMessage::clear_player_joined() {
-  if (player_joined_ != NULL) player_joined_->::swarm::game::PlayerJoined::Clear();
-  clear_has_player_joined();
-}
-inline const ::swarm::game::PlayerJoined& ServerMessage::player_joined() const {
-  return player_joined_ != NULL ? *player_joined_ : *default_instance_->player_joined_;
+inline float LinkConditions::_internal_loss() const {
+  return _impl_.loss_;
 }
-inline ::swarm::game::PlayerJoined* ServerMessage::mutable_player_joined() {
-  set_has_player_joined();
-  if (player_joined_ == NULL) player_joined_ = new ::swarm::game::PlayerJoined;
-  return player_joined_;
+inline float LinkConditions::loss() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.loss)
+  return _internal_loss();
 }
-inline ::swarm::game::PlayerJoined* ServerMessage::release_player_joined() {
-  clear_has_player_joined();
-  ::swarm::game::PlayerJoined* temp = player_joined_;
-  player_joined_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_loss(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.loss_ = value;
 }
-inline void ServerMessage::set_allocated_player_joined(::swarm::game::PlayerJoined* player_joined) {
-  delete player_joined_;
-  player_joined_ = player_joined;
-  if (player_joined) {
-    set_has_player_joined();
-  } else {
-    clear_has_player_joined();
-  }
+inline void LinkConditions::set_loss(float value) {
+  _internal_set_loss(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.loss)
 }
 
-// optional .swarm.game.PlayerLeft player_left = 4;
-inline bool ServerMessage::has_player_left() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional float loss_burst = 5;
+inline bool LinkConditions::_internal_has_loss_burst() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_player_left() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool LinkConditions::has_loss_burst() const {
+  return _internal_has_loss_burst();
 }
-inline void ServerMessage::clear_has_player_left() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void LinkConditions::clear_loss_burst() {
+  _impl_.loss_burst_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void ServerMessage::clear_player_left() {
-  if (player_left_ != NULL) player_left_->::swarm::game::PlayerLeft::Clear();
-  clear_has_player_left();
-}
-inline const ::swarm::game::PlayerLeft& ServerMessage::player_left() const {
-  return player_left_ != NULL ? *player_left_ : *default_instance_->player_left_;
+inline float LinkConditions::_internal_loss_burst() const {
+  return _impl_.loss_burst_;
 }
-inline ::swarm::game::PlayerLeft* ServerMessage::mutable_player_left() {
-  set_has_player_left();
-  if (player_left_ == NULL) player_left_ = new ::swarm::game::PlayerLeft;
-  return player_left_;
+inline float LinkConditions::loss_burst() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.loss_burst)
+  return _internal_loss_burst();
 }
-inline ::swarm::game::PlayerLeft* ServerMessage::release_player_left() {
-  clear_has_player_left();
-  ::swarm::game::PlayerLeft* temp = player_left_;
-  player_left_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_loss_burst(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.loss_burst_ = value;
 }
-inline void ServerMessage::set_allocated_player_left(::swarm::game::PlayerLeft* player_left) {
-  delete player_left_;
-  player_left_ = player_left;
-  if (player_left) {
-    set_has_player_left();
-  } else {
-    clear_has_player_left();
-  }
+inline void LinkConditions::set_loss_burst(float value) {
+  _internal_set_loss_burst(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.loss_burst)
 }
 
-// optional .swarm.game.SwarmState swarm_state = 5;
-inline bool ServerMessage::has_swarm_state() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional float reorder = 6;
+inline bool LinkConditions::_internal_has_reorder() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_swarm_state() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool LinkConditions::has_reorder() const {
+  return _internal_has_reorder();
 }
-inline void ServerMessage::clear_has_swarm_state() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void LinkConditions::clear_reorder() {
+  _impl_.reorder_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void ServerMessage::clear_swarm_state() {
-  if (swarm_state_ != NULL) swarm_state_->::swarm::game::SwarmState::Clear();
-  clear_has_swarm_state();
-}
-inline const ::swarm::game::SwarmState& ServerMessage::swarm_state() const {
-  return swarm_state_ != NULL ? *swarm_state_ : *default_instance_->swarm_state_;
+inline float LinkConditions::_internal_reorder() const {
+  return _impl_.reorder_;
 }
-inline ::swarm::game::SwarmState* ServerMessage::mutable_swarm_state() {
-  set_has_swarm_state();
-  if (swarm_state_ == NULL) swarm_state_ = new ::swarm::game::SwarmState;
-  return swarm_state_;
+inline float LinkConditions::reorder() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.reorder)
+  return _internal_reorder();
 }
-inline ::swarm::game::SwarmState* ServerMessage::release_swarm_state() {
-  clear_has_swarm_state();
-  ::swarm::game::SwarmState* temp = swarm_state_;
-  swarm_state_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_reorder(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.reorder_ = value;
 }
-inline void ServerMessage::set_allocated_swarm_state(::swarm::game::SwarmState* swarm_state) {
-  delete swarm_state_;
-  swarm_state_ = swarm_state;
-  if (swarm_state) {
-    set_has_swarm_state();
-  } else {
-    clear_has_swarm_state();
-  }
+inline void LinkConditions::set_reorder(float value) {
+  _internal_set_reorder(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.reorder)
 }
 
-// optional .swarm.game.PlayerState player_state = 6;
-inline bool ServerMessage::has_player_state() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// optional uint32 reorder_ms = 7 [default = 20];
+inline bool LinkConditions::_internal_has_reorder_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_player_state() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool LinkConditions::has_reorder_ms() const {
+  return _internal_has_reorder_ms();
 }
-inline void ServerMessage::clear_has_player_state() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void LinkConditions::clear_reorder_ms() {
+  _impl_.reorder_ms_ = 20u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void ServerMessage::clear_player_state() {
-  if (player_state_ != NULL) player_state_->::swarm::game::PlayerState::Clear();
-  clear_has_player_state();
-}
-inline const ::swarm::game::PlayerState& ServerMessage::player_state() const {
-  return player_state_ != NULL ? *player_state_ : *default_instance_->player_state_;
+inline uint32_t LinkConditions::_internal_reorder_ms() const {
+  return _impl_.reorder_ms_;
 }
-inline ::swarm::game::PlayerState* ServerMessage::mutable_player_state() {
-  set_has_player_state();
-  if (player_state_ == NULL) player_state_ = new ::swarm::game::PlayerState;
-  return player_state_;
+inline uint32_t LinkConditions::reorder_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.reorder_ms)
+  return _internal_reorder_ms();
 }
-inline ::swarm::game::PlayerState* ServerMessage::release_player_state() {
-  clear_has_player_state();
-  ::swarm::game::PlayerState* temp = player_state_;
-  player_state_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_reorder_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.reorder_ms_ = value;
 }
-inline void ServerMessage::set_allocated_player_state(::swarm::game::PlayerState* player_state) {
-  delete player_state_;
-  player_state_ = player_state;
-  if (player_state) {
-    set_has_player_state();
-  } else {
-    clear_has_player_state();
-  }
+inline void LinkConditions::set_reorder_ms(uint32_t value) {
+  _internal_set_reorder_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.reorder_ms)
 }
 
-// optional .swarm.game.PlayerDied player_died = 7;
-inline bool ServerMessage::has_player_died() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+// optional float duplicate = 8;
+inline bool LinkConditions::_internal_has_duplicate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_player_died() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool LinkConditions::has_duplicate() const {
+  return _internal_has_duplicate();
 }
-inline void ServerMessage::clear_has_player_died() {
-  _has_bits_[0] &= ~0x00000040u;
+inline void LinkConditions::clear_duplicate() {
+  _impl_.duplicate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void ServerMessage::clear_player_died() {
-  if (player_died_ != NULL) player_died_->::swarm::game::PlayerDied::Clear();
-  clear_has_player_died();
-}
-inline const ::swarm::game::PlayerDied& ServerMessage::player_died() const {
-  return player_died_ != NULL ? *player_died_ : *default_instance_->player_died_;
+inline float LinkConditions::_internal_duplicate() const {
+  return _impl_.duplicate_;
 }
-inline ::swarm::game::PlayerDied* ServerMessage::mutable_player_died() {
-  set_has_player_died();
-  if (player_died_ == NULL) player_died_ = new ::swarm::game::PlayerDied;
-  return player_died_;
+inline float LinkConditions::duplicate() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.duplicate)
+  return _internal_duplicate();
 }
-inline ::swarm::game::PlayerDied* ServerMessage::release_player_died() {
-  clear_has_player_died();
-  ::swarm::game::PlayerDied* temp = player_died_;
-  player_died_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_duplicate(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.duplicate_ = value;
 }
-inline void ServerMessage::set_allocated_player_died(::swarm::game::PlayerDied* player_died) {
-  delete player_died_;
-  player_died_ = player_died;
-  if (player_died) {
-    set_has_player_died();
-  } else {
-    clear_has_player_died();
-  }
+inline void LinkConditions::set_duplicate(float value) {
+  _internal_set_duplicate(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.duplicate)
 }
 
-// optional .swarm.game.GameEnded game_ended = 8;
-inline bool ServerMessage::has_game_ended() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+// optional uint32 bytes_per_sec = 9;
+inline bool LinkConditions::_internal_has_bytes_per_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_game_ended() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool LinkConditions::has_bytes_per_sec() const {
+  return _internal_has_bytes_per_sec();
 }
-inline void ServerMessage::clear_has_game_ended() {
-  _has_bits_[0] &= ~0x00000080u;
+inline void LinkConditions::clear_bytes_per_sec() {
+  _impl_.bytes_per_sec_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void ServerMessage::clear_game_ended() {
-  if (game_ended_ != NULL) game_ended_->::swarm::game::GameEnded::Clear();
-  clear_has_game_ended();
-}
-inline const ::swarm::game::GameEnded& ServerMessage::game_ended() const {
-  return game_ended_ != NULL ? *game_ended_ : *default_instance_->game_ended_;
+inline uint32_t LinkConditions::_internal_bytes_per_sec() const {
+  return _impl_.bytes_per_sec_;
 }
-inline ::swarm::game::GameEnded* ServerMessage::mutable_game_ended() {
-  set_has_game_ended();
-  if (game_ended_ == NULL) game_ended_ = new ::swarm::game::GameEnded;
-  return game_ended_;
+inline uint32_t LinkConditions::bytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.bytes_per_sec)
+  return _internal_bytes_per_sec();
 }
-inline ::swarm::game::GameEnded* ServerMessage::release_game_ended() {
-  clear_has_game_ended();
-  ::swarm::game::GameEnded* temp = game_ended_;
-  game_ended_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_bytes_per_sec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.bytes_per_sec_ = value;
 }
-inline void ServerMessage::set_allocated_game_ended(::swarm::game::GameEnded* game_ended) {
-  delete game_ended_;
-  game_ended_ = game_ended;
-  if (game_ended) {
-    set_has_game_ended();
-  } else {
-    clear_has_game_ended();
-  }
+inline void LinkConditions::set_bytes_per_sec(uint32_t value) {
+  _internal_set_bytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.bytes_per_sec)
 }
 
-// optional .swarm.game.MonsterDied monster_died = 9;
-inline bool ServerMessage::has_monster_died() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+// optional uint32 queue_ms = 10 [default = 200];
+inline bool LinkConditions::_internal_has_queue_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void ServerMessage::set_has_monster_died() {
-  _has_bits_[0] |= 0x00000100u;
+inline bool LinkConditions::has_queue_ms() const {
+  return _internal_has_queue_ms();
 }
-inline void ServerMessage::clear_has_monster_died() {
-  _has_bits_[0] &= ~0x00000100u;
+inline void LinkConditions::clear_queue_ms() {
+  _impl_.queue_ms_ = 200u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void ServerMessage::clear_monster_died() {
-  if (monster_died_ != NULL) monster_died_->::swarm::game::MonsterDied::Clear();
-  clear_has_monster_died();
-}
-inline const ::swarm::game::MonsterDied& ServerMessage::monster_died() const {
-  return monster_died_ != NULL ? *monster_died_ : *default_instance_->monster_died_;
+inline uint32_t LinkConditions::_internal_queue_ms() const {
+  return _impl_.queue_ms_;
 }
-inline ::swarm::game::MonsterDied* ServerMessage::mutable_monster_died() {
-  set_has_monster_died();
-  if (monster_died_ == NULL) monster_died_ = new ::swarm::game::MonsterDied;
-  return monster_died_;
+inline uint32_t LinkConditions::queue_ms() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkConditions.queue_ms)
+  return _internal_queue_ms();
 }
-inline ::swarm::game::MonsterDied* ServerMessage::release_monster_died() {
-  clear_has_monster_died();
-  ::swarm::game::MonsterDied* temp = monster_died_;
-  monster_died_ = NULL;
-  return temp;
+inline void LinkConditions::_internal_set_queue_ms(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.queue_ms_ = value;
 }
-inline void ServerMessage::set_allocated_monster_died(::swarm::game::MonsterDied* monster_died) {
-  delete monster_died_;
-  monster_died_ = monster_died;
-  if (monster_died) {
-    set_has_monster_died();
-  } else {
-    clear_has_monster_died();
-  }
+inline void LinkConditions::set_queue_ms(uint32_t value) {
+  _internal_set_queue_ms(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkConditions.queue_ms)
 }
 
 // -------------------------------------------------------------------
 
-// PlayerMessage
+// LinkScriptStep
 
-// required .swarm.game.PlayerMessage.Type type = 1;
-inline bool PlayerMessage::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void PlayerMessage::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+// optional float at = 1;
+inline bool LinkScriptStep::_internal_has_at() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void PlayerMessage::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool LinkScriptStep::has_at() const {
+  return _internal_has_at();
 }
-inline void PlayerMessage::clear_type() {
-  type_ = 1;
-  clear_has_type();
+inline void LinkScriptStep::clear_at() {
+  _impl_.at_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::swarm::game::PlayerMessage_Type PlayerMessage::type() const {
-  return static_cast< ::swarm::game::PlayerMessage_Type >(type_);
+inline float LinkScriptStep::_internal_at() const {
+  return _impl_.at_;
 }
-inline void PlayerMessage::set_type(::swarm::game::PlayerMessage_Type value) {
-  assert(::swarm::game::PlayerMessage_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+inline float LinkScriptStep::at() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkScriptStep.at)
+  return _internal_at();
 }
-
-// optional .swarm.game.Vector2 pos = 2;
-inline bool PlayerMessage::has_pos() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline void LinkScriptStep::_internal_set_at(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.at_ = value;
 }
-inline void PlayerMessage::set_has_pos() {
-  _has_bits_[0] |= 0x00000002u;
+inline void LinkScriptStep::set_at(float value) {
+  _internal_set_at(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkScriptStep.at)
 }
-inline void PlayerMessage::clear_has_pos() {
-  _has_bits_[0] &= ~0x00000002u;
+
+// optional .swarm.game.LinkConditions up = 2;
+inline bool LinkScriptStep::_internal_has_up() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.up_ != nullptr);
+  return value;
 }
-inline void PlayerMessage::clear_pos() {
-  if (pos_ != NULL) pos_->::swarm::game::Vector2::Clear();
-  clear_has_pos();
+inline bool LinkScriptStep::has_up() const {
+  return _internal_has_up();
 }
-inline const ::swarm::game::Vector2& PlayerMessage::pos() const {
-  return pos_ != NULL ? *pos_ : *default_instance_->pos_;
+inline void LinkScriptStep::clear_up() {
+  if (_impl_.up_ != nullptr) _impl_.up_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::swarm::game::Vector2* PlayerMessage::mutable_pos() {
-  set_has_pos();
-  if (pos_ == NULL) pos_ = new ::swarm::game::Vector2;
-  return pos_;
+inline const ::swarm::game::LinkConditions& LinkScriptStep::_internal_up() const {
+  const ::swarm::game::LinkConditions* p = _impl_.up_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::LinkConditions&>(
+      ::swarm::game::_LinkConditions_default_instance_);
 }
-inline ::swarm::game::Vector2* PlayerMessage::release_pos() {
-  clear_has_pos();
-  ::swarm::game::Vector2* temp = pos_;
-  pos_ = NULL;
-  return temp;
+inline const ::swarm::game::LinkConditions& LinkScriptStep::up() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkScriptStep.up)
+  return _internal_up();
 }
-inline void PlayerMessage::set_allocated_pos(::swarm::game::Vector2* pos) {
-  delete pos_;
-  pos_ = pos;
-  if (pos) {
-    set_has_pos();
+inline void LinkScriptStep::unsafe_arena_set_allocated_up(
+    ::swarm::game::LinkConditions* up) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.up_);
+  }
+  _impl_.up_ = up;
+  if (up) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_pos();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.LinkScriptStep.up)
+}
+inline ::swarm::game::LinkConditions* LinkScriptStep::release_up() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::LinkConditions* temp = _impl_.up_;
+  _impl_.up_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-
-// optional .swarm.game.PlayerClick click = 3;
-inline bool PlayerMessage::has_click() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void PlayerMessage::set_has_click() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void PlayerMessage::clear_has_click() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void PlayerMessage::clear_click() {
-  if (click_ != NULL) click_->::swarm::game::PlayerClick::Clear();
-  clear_has_click();
-}
-inline const ::swarm::game::PlayerClick& PlayerMessage::click() const {
-  return click_ != NULL ? *click_ : *default_instance_->click_;
+inline ::swarm::game::LinkConditions* LinkScriptStep::unsafe_arena_release_up() {
+  // @@protoc_insertion_point(field_release:swarm.game.LinkScriptStep.up)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::swarm::game::LinkConditions* temp = _impl_.up_;
+  _impl_.up_ = nullptr;
+  return temp;
 }
-inline ::swarm::game::PlayerClick* PlayerMessage::mutable_click() {
-  set_has_click();
-  if (click_ == NULL) click_ = new ::swarm::game::PlayerClick;
-  return click_;
+inline ::swarm::game::LinkConditions* LinkScriptStep::_internal_mutable_up() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.up_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::LinkConditions>(GetArenaForAllocation());
+    _impl_.up_ = p;
+  }
+  return _impl_.up_;
 }
-inline ::swarm::game::PlayerClick* PlayerMessage::release_click() {
-  clear_has_click();
-  ::swarm::game::PlayerClick* temp = click_;
-  click_ = NULL;
-  return temp;
+inline ::swarm::game::LinkConditions* LinkScriptStep::mutable_up() {
+  ::swarm::game::LinkConditions* _msg = _internal_mutable_up();
+  // @@protoc_insertion_point(field_mutable:swarm.game.LinkScriptStep.up)
+  return _msg;
 }
-inline void PlayerMessage::set_allocated_click(::swarm::game::PlayerClick* click) {
-  delete click_;
-  click_ = click;
-  if (click) {
-    set_has_click();
+inline void LinkScriptStep::set_allocated_up(::swarm::game::LinkConditions* up) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.up_;
+  }
+  if (up) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(up);
+    if (message_arena != submessage_arena) {
+      up = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, up, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_click();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.up_ = up;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.LinkScriptStep.up)
 }
 
-// -------------------------------------------------------------------
-
-// Config
-
-// optional string map_name = 1;
-inline bool Config::has_map_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .swarm.game.LinkConditions down = 3;
+inline bool LinkScriptStep::_internal_has_down() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.down_ != nullptr);
+  return value;
 }
-inline void Config::set_has_map_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool LinkScriptStep::has_down() const {
+  return _internal_has_down();
 }
-inline void Config::clear_has_map_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void LinkScriptStep::clear_down() {
+  if (_impl_.down_ != nullptr) _impl_.down_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Config::clear_map_name() {
-  if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-    map_name_->clear();
-  }
-  clear_has_map_name();
+inline const ::swarm::game::LinkConditions& LinkScriptStep::_internal_down() const {
+  const ::swarm::game::LinkConditions* p = _impl_.down_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::LinkConditions&>(
+      ::swarm::game::_LinkConditions_default_instance_);
 }
-inline const ::std::string& Config::map_name() const {
-  return *map_name_;
+inline const ::swarm::game::LinkConditions& LinkScriptStep::down() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkScriptStep.down)
+  return _internal_down();
 }
-inline void Config::set_map_name(const ::std::string& value) {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
+inline void LinkScriptStep::unsafe_arena_set_allocated_down(
+    ::swarm::game::LinkConditions* down) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.down_);
   }
-  map_name_->assign(value);
-}
-inline void Config::set_map_name(const char* value) {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
+  _impl_.down_ = down;
+  if (down) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  map_name_->assign(value);
-}
-inline void Config::set_map_name(const char* value, size_t size) {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.LinkScriptStep.down)
+}
+inline ::swarm::game::LinkConditions* LinkScriptStep::release_down() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::LinkConditions* temp = _impl_.down_;
+  _impl_.down_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  map_name_->assign(reinterpret_cast<const char*>(value), size);
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* Config::mutable_map_name() {
-  set_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    map_name_ = new ::std::string;
-  }
-  return map_name_;
+inline ::swarm::game::LinkConditions* LinkScriptStep::unsafe_arena_release_down() {
+  // @@protoc_insertion_point(field_release:swarm.game.LinkScriptStep.down)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::swarm::game::LinkConditions* temp = _impl_.down_;
+  _impl_.down_ = nullptr;
+  return temp;
 }
-inline ::std::string* Config::release_map_name() {
-  clear_has_map_name();
-  if (map_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = map_name_;
-    map_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline ::swarm::game::LinkConditions* LinkScriptStep::_internal_mutable_down() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.down_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::LinkConditions>(GetArenaForAllocation());
+    _impl_.down_ = p;
   }
+  return _impl_.down_;
 }
-inline void Config::set_allocated_map_name(::std::string* map_name) {
-  if (map_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete map_name_;
+inline ::swarm::game::LinkConditions* LinkScriptStep::mutable_down() {
+  ::swarm::game::LinkConditions* _msg = _internal_mutable_down();
+  // @@protoc_insertion_point(field_mutable:swarm.game.LinkScriptStep.down)
+  return _msg;
+}
+inline void LinkScriptStep::set_allocated_down(::swarm::game::LinkConditions* down) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.down_;
   }
-  if (map_name) {
-    set_has_map_name();
-    map_name_ = map_name;
+  if (down) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(down);
+    if (message_arena != submessage_arena) {
+      down = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, down, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_map_name();
-    map_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.down_ = down;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.LinkScriptStep.down)
 }
 
-// optional uint32 num_swarms = 2 [default = 5];
-inline bool Config::has_num_swarms() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Config::set_has_num_swarms() {
-  _has_bits_[0] |= 0x00000002u;
+// optional .swarm.game.LinkConditions both = 4;
+inline bool LinkScriptStep::_internal_has_both() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.both_ != nullptr);
+  return value;
 }
-inline void Config::clear_has_num_swarms() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Config::clear_num_swarms() {
-  num_swarms_ = 5u;
-  clear_has_num_swarms();
+inline bool LinkScriptStep::has_both() const {
+  return _internal_has_both();
 }
-inline ::google::protobuf::uint32 Config::num_swarms() const {
-  return num_swarms_;
+inline void LinkScriptStep::clear_both() {
+  if (_impl_.both_ != nullptr) _impl_.both_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Config::set_num_swarms(::google::protobuf::uint32 value) {
-  set_has_num_swarms();
-  num_swarms_ = value;
+inline const ::swarm::game::LinkConditions& LinkScriptStep::_internal_both() const {
+  const ::swarm::game::LinkConditions* p = _impl_.both_;
+  return p != nullptr ? *p : reinterpret_cast<const ::swarm::game::LinkConditions&>(
+      ::swarm::game::_LinkConditions_default_instance_);
 }
-
-// optional uint32 monsters_per_swarm = 3 [default = 10];
-inline bool Config::has_monsters_per_swarm() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline const ::swarm::game::LinkConditions& LinkScriptStep::both() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkScriptStep.both)
+  return _internal_both();
 }
-inline void Config::set_has_monsters_per_swarm() {
-  _has_bits_[0] |= 0x00000004u;
+inline void LinkScriptStep::unsafe_arena_set_allocated_both(
+    ::swarm::game::LinkConditions* both) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.both_);
+  }
+  _impl_.both_ = both;
+  if (both) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:swarm.game.LinkScriptStep.both)
+}
+inline ::swarm::game::LinkConditions* LinkScriptStep::release_both() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::LinkConditions* temp = _impl_.both_;
+  _impl_.both_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Config::clear_has_monsters_per_swarm() {
-  _has_bits_[0] &= ~0x00000004u;
+inline ::swarm::game::LinkConditions* LinkScriptStep::unsafe_arena_release_both() {
+  // @@protoc_insertion_point(field_release:swarm.game.LinkScriptStep.both)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::swarm::game::LinkConditions* temp = _impl_.both_;
+  _impl_.both_ = nullptr;
+  return temp;
 }
-inline void Config::clear_monsters_per_swarm() {
-  monsters_per_swarm_ = 10u;
-  clear_has_monsters_per_swarm();
+inline ::swarm::game::LinkConditions* LinkScriptStep::_internal_mutable_both() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.both_ == nullptr) {
+    auto* p = CreateMaybeMessage<::swarm::game::LinkConditions>(GetArenaForAllocation());
+    _impl_.both_ = p;
+  }
+  return _impl_.both_;
 }
-inline ::google::protobuf::uint32 Config::monsters_per_swarm() const {
-  return monsters_per_swarm_;
+inline ::swarm::game::LinkConditions* LinkScriptStep::mutable_both() {
+  ::swarm::game::LinkConditions* _msg = _internal_mutable_both();
+  // @@protoc_insertion_point(field_mutable:swarm.game.LinkScriptStep.both)
+  return _msg;
 }
-inline void Config::set_monsters_per_swarm(::google::protobuf::uint32 value) {
-  set_has_monsters_per_swarm();
-  monsters_per_swarm_ = value;
+inline void LinkScriptStep::set_allocated_both(::swarm::game::LinkConditions* both) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.both_;
+  }
+  if (both) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(both);
+    if (message_arena != submessage_arena) {
+      both = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, both, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.both_ = both;
+  // @@protoc_insertion_point(field_set_allocated:swarm.game.LinkScriptStep.both)
 }
 
-// optional uint32 min_players = 4 [default = 2];
-inline bool Config::has_min_players() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void Config::set_has_min_players() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void Config::clear_has_min_players() {
-  _has_bits_[0] &= ~0x00000008u;
+// -------------------------------------------------------------------
+
+// LinkScript
+
+// repeated .swarm.game.LinkScriptStep step = 1;
+inline int LinkScript::_internal_step_size() const {
+  return _impl_.step_.size();
 }
-inline void Config::clear_min_players() {
-  min_players_ = 2u;
-  clear_has_min_players();
+inline int LinkScript::step_size() const {
+  return _internal_step_size();
 }
-inline ::google::protobuf::uint32 Config::min_players() const {
-  return min_players_;
+inline void LinkScript::clear_step() {
+  _impl_.step_.Clear();
 }
-inline void Config::set_min_players(::google::protobuf::uint32 value) {
-  set_has_min_players();
-  min_players_ = value;
+inline ::swarm::game::LinkScriptStep* LinkScript::mutable_step(int index) {
+  // @@protoc_insertion_point(field_mutable:swarm.game.LinkScript.step)
+  return _impl_.step_.Mutable(index);
 }
-
-// optional uint32 max_players = 5 [default = 4];
-inline bool Config::has_max_players() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LinkScriptStep >*
+LinkScript::mutable_step() {
+  // @@protoc_insertion_point(field_mutable_list:swarm.game.LinkScript.step)
+  return &_impl_.step_;
 }
-inline void Config::set_has_max_players() {
-  _has_bits_[0] |= 0x00000010u;
+inline const ::swarm::game::LinkScriptStep& LinkScript::_internal_step(int index) const {
+  return _impl_.step_.Get(index);
 }
-inline void Config::clear_has_max_players() {
-  _has_bits_[0] &= ~0x00000010u;
+inline const ::swarm::game::LinkScriptStep& LinkScript::step(int index) const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkScript.step)
+  return _internal_step(index);
 }
-inline void Config::clear_max_players() {
-  max_players_ = 4u;
-  clear_has_max_players();
+inline ::swarm::game::LinkScriptStep* LinkScript::_internal_add_step() {
+  return _impl_.step_.Add();
 }
-inline ::google::protobuf::uint32 Config::max_players() const {
-  return max_players_;
+inline ::swarm::game::LinkScriptStep* LinkScript::add_step() {
+  ::swarm::game::LinkScriptStep* _add = _internal_add_step();
+  // @@protoc_insertion_point(field_add:swarm.game.LinkScript.step)
+  return _add;
 }
-inline void Config::set_max_players(::google::protobuf::uint32 value) {
-  set_has_max_players();
-  max_players_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::swarm::game::LinkScriptStep >&
+LinkScript::step() const {
+  // @@protoc_insertion_point(field_list:swarm.game.LinkScript.step)
+  return _impl_.step_;
 }
 
-// optional uint32 initial_health = 6 [default = 10];
-inline bool Config::has_initial_health() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// optional float repeat_after = 2;
+inline bool LinkScript::_internal_has_repeat_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Config::set_has_initial_health() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool LinkScript::has_repeat_after() const {
+  return _internal_has_repeat_after();
 }
-inline void Config::clear_has_initial_health() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void LinkScript::clear_repeat_after() {
+  _impl_.repeat_after_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Config::clear_initial_health() {
-  initial_health_ = 10u;
-  clear_has_initial_health();
+inline float LinkScript::_internal_repeat_after() const {
+  return _impl_.repeat_after_;
+}
+inline float LinkScript::repeat_after() const {
+  // @@protoc_insertion_point(field_get:swarm.game.LinkScript.repeat_after)
+  return _internal_repeat_after();
 }
-inline ::google::protobuf::uint32 Config::initial_health() const {
-  return initial_health_;
+inline void LinkScript::_internal_set_repeat_after(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.repeat_after_ = value;
 }
-inline void Config::set_initial_health(::google::protobuf::uint32 value) {
-  set_has_initial_health();
-  initial_health_ = value;
+inline void LinkScript::set_repeat_after(float value) {
+  _internal_set_repeat_after(value);
+  // @@protoc_insertion_point(field_set:swarm.game.LinkScript.repeat_after)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace game
 }  // namespace swarm
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::swarm::game::ServerMessage_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::swarm::game::ServerMessage_Type>() {
   return ::swarm::game::ServerMessage_Type_descriptor();
 }
+template <> struct is_proto_enum< ::swarm::game::PlayerMessage_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::swarm::game::PlayerMessage_Type>() {
   return ::swarm::game::PlayerMessage_Type_descriptor();
 }
+template <> struct is_proto_enum< ::swarm::game::Config_MonsterCompression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::swarm::game::Config_MonsterCompression>() {
+  return ::swarm::game::Config_MonsterCompression_descriptor();
+}
+template <> struct is_proto_enum< ::swarm::game::LinkConditions_Distribution> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::swarm::game::LinkConditions_Distribution>() {
+  return ::swarm::game::LinkConditions_Distribution_descriptor();
+}
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_game_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_game_2eproto
@@ -1,305 +1,279 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: settings.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "settings.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
-
-namespace {
-
-const ::google::protobuf::Descriptor* Settings_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Settings_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_settings_2eproto() {
-  protobuf_AddDesc_settings_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "settings.proto");
-  GOOGLE_CHECK(file != NULL);
-  Settings_descriptor_ = file->message_type(0);
-  static const int Settings_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Settings, test_),
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR Settings::Settings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.test_)*/0u} {}
+struct SettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SettingsDefaultTypeInternal() {}
+  union {
+    Settings _instance;
   };
-  Settings_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Settings_descriptor_,
-      Settings::default_instance_,
-      Settings_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Settings, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Settings, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Settings));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_settings_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Settings_descriptor_, &Settings::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_settings_2eproto() {
-  delete Settings::default_instance_;
-  delete Settings_reflection_;
-}
-
-void protobuf_AddDesc_settings_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\016settings.proto\"\030\n\010Settings\022\014\n\004test\030\001 \001"
-    "(\r", 42);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "settings.proto", &protobuf_RegisterTypes);
-  Settings::default_instance_ = new Settings();
-  Settings::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_settings_2eproto);
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SettingsDefaultTypeInternal _Settings_default_instance_;
+static ::_pb::Metadata file_level_metadata_settings_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_settings_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_settings_2eproto = nullptr;
+
+const uint32_t TableStruct_settings_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::Settings, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Settings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Settings, _impl_.test_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::Settings)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_Settings_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_settings_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016settings.proto\"\030\n\010Settings\022\014\n\004test\030\001 \001"
+  "(\r"
+  ;
+static ::_pbi::once_flag descriptor_table_settings_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_settings_2eproto = {
+    false, false, 42, descriptor_table_protodef_settings_2eproto,
+    "settings.proto",
+    &descriptor_table_settings_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_settings_2eproto::offsets,
+    file_level_metadata_settings_2eproto, file_level_enum_descriptors_settings_2eproto,
+    file_level_service_descriptors_settings_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_settings_2eproto_getter() {
+  return &descriptor_table_settings_2eproto;
 }
 
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_settings_2eproto {
-  StaticDescriptorInitializer_settings_2eproto() {
-    protobuf_AddDesc_settings_2eproto();
-  }
-} static_descriptor_initializer_settings_2eproto_;
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_settings_2eproto(&descriptor_table_settings_2eproto);
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Settings::kTestFieldNumber;
-#endif  // !_MSC_VER
-
-Settings::Settings()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Settings::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Settings>()._impl_._has_bits_);
+  static void set_has_test(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void Settings::InitAsDefaultInstance() {
+Settings::Settings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Settings)
 }
-
 Settings::Settings(const Settings& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Settings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.test_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.test_ = from._impl_.test_;
+  // @@protoc_insertion_point(copy_constructor:Settings)
 }
 
-void Settings::SharedCtor() {
-  _cached_size_ = 0;
-  test_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void Settings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.test_){0u}
+  };
 }
 
 Settings::~Settings() {
+  // @@protoc_insertion_point(destructor:Settings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Settings::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Settings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Settings::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Settings::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Settings_descriptor_;
-}
-
-const Settings& Settings::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_settings_2eproto();
-  return *default_instance_;
-}
-
-Settings* Settings::default_instance_ = NULL;
-
-Settings* Settings::New() const {
-  return new Settings;
+  _impl_._cached_size_.Set(size);
 }
 
 void Settings::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    test_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:Settings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.test_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Settings::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Settings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional uint32 test = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &test_)));
-          set_has_test();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_test(&has_bits);
+          _impl_.test_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Settings::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional uint32 test = 1;
-  if (has_test()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->test(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+uint8_t* Settings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Settings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* Settings::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+  cached_has_bits = _impl_._has_bits_[0];
   // optional uint32 test = 1;
-  if (has_test()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->test(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_test(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:Settings)
   return target;
 }
 
-int Settings::ByteSize() const {
-  int total_size = 0;
+size_t Settings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Settings)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional uint32 test = 1;
-    if (has_test()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->test());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  // optional uint32 test = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_test());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Settings::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Settings* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Settings*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Settings::MergeFrom(const Settings& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_test()) {
-      set_test(from.test());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Settings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Settings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Settings::GetClassData() const { return &_class_data_; }
 
-void Settings::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void Settings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Settings*>(&to_msg);
+  auto& from = static_cast<const Settings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Settings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_test()) {
+    _this->_internal_set_test(from._internal_test());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Settings::CopyFrom(const Settings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Settings)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Settings::IsInitialized() const {
-
   return true;
 }
 
-void Settings::Swap(Settings* other) {
-  if (other != this) {
-    std::swap(test_, other->test_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Settings::InternalSwap(Settings* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.test_, other->_impl_.test_);
 }
 
-::google::protobuf::Metadata Settings::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Settings_descriptor_;
-  metadata.reflection = Settings_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Settings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_settings_2eproto_getter, &descriptor_table_settings_2eproto_once,
+      file_level_metadata_settings_2eproto[0]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Settings*
+Arena::CreateMaybeMessage< ::Settings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Settings >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,232 @@
+#include "range_coder.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  const u32 RANGE_TOP = 1 << 24;
+  const u32 PROB_ONE = 1 << RANGE_PROB_BITS;
+  const int LENGTH_TREE_BITS = 6;
+
+  u32 ZigZag(s32 v)
+  {
+    return ((u32)v << 1) ^ (u32)(v >> 31);
+  }
+
+  s32 UnZigZag(u32 v)
+  {
+    return (s32)(v >> 1) ^ -(s32)(v & 1);
+  }
+}
+
+//-----------------------------------------------------------------------------
+RangeEncoder::RangeEncoder(vector<char>* out)
+  : _out(out)
+  , _low(0)
+  , _range(0xffffffff)
+  , _cache(0)
+  , _cacheSize(1)
+{
+}
+
+//-----------------------------------------------------------------------------
+void RangeEncoder::ShiftLow()
+{
+  // a carry can still ripple into the bytes held back in the cache, so they
+  // only go out once the top byte of low is settled
+  if ((u32)_low < 0xff000000 || (_low >> 32) != 0)
+  {
+    u8 carry = (u8)(_low >> 32);
+    u8 temp = _cache;
+    do
+    {
+      _out->push_back((char)(u8)(temp + carry));
+      temp = 0xff;
+    } while (--_cacheSize != 0);
+    _cache = (u8)(_low >> 24);
+  }
+
+  ++_cacheSize;
+  _low = (_low & 0x00ffffff) << 8;
+}
+
+//-----------------------------------------------------------------------------
+void RangeEncoder::EncodeBit(BitModel* model, u32 bit)
+{
+  u32 bound = (_range >> RANGE_PROB_BITS) * model->prob;
+  if (bit == 0)
+  {
+    _range = bound;
+    model->prob += (PROB_ONE - model->prob) >> RANGE_MOVE_BITS;
+  }
+  else
+  {
+    _low += bound;
+    _range -= bound;
+    model->prob -= model->prob >> RANGE_MOVE_BITS;
+  }
+
+  while (_range < RANGE_TOP)
+  {
+    _range <<= 8;
+    ShiftLow();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RangeEncoder::EncodeDirect(u32 value, int numBits)
+{
+  for (int i = numBits - 1; i >= 0; --i)
+  {
+    _range >>= 1;
+    if ((value >> i) & 1)
+      _low += _range;
+
+    while (_range < RANGE_TOP)
+    {
+      _range <<= 8;
+      ShiftLow();
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void RangeEncoder::EncodeUInt(IntModel* model, u32 value)
+{
+  // value + 1 has a leading one, so the length says where it is
+  u64 v = (u64)value + 1;
+  u32 length = 0;
+  while ((v >> length) > 1)
+    ++length;
+
+  u32 node = 1;
+  for (int i = LENGTH_TREE_BITS - 1; i >= 0; --i)
+  {
+    u32 bit = (length >> i) & 1;
+    EncodeBit(&model->length[node], bit);
+    node = node * 2 + bit;
+  }
+
+  if (length == 0)
+    return;
+
+  EncodeBit(&model->mantissa[length], (u32)(v >> (length - 1)) & 1);
+  if (length > 1)
+    EncodeDirect((u32)v & ((1u << (length - 1)) - 1), length - 1);
+}
+
+//-----------------------------------------------------------------------------
+void RangeEncoder::EncodeSInt(IntModel* model, s32 value)
+{
+  EncodeUInt(model, ZigZag(value));
+}
+
+//-----------------------------------------------------------------------------
+void RangeEncoder::Flush()
+{
+  for (int i = 0; i < 5; ++i)
+    ShiftLow();
+}
+
+//-----------------------------------------------------------------------------
+RangeDecoder::RangeDecoder(const char* data, size_t size)
+  : _ptr((const u8*)data)
+  , _end((const u8*)data + size)
+  , _range(0xffffffff)
+  , _code(0)
+  , _corrupt(false)
+{
+  // the encoder's first byte is always 0
+  for (int i = 0; i < 5; ++i)
+    _code = (_code << 8) | NextByte();
+}
+
+//-----------------------------------------------------------------------------
+u8 RangeDecoder::NextByte()
+{
+  if (_ptr == _end)
+  {
+    _corrupt = true;
+    return 0;
+  }
+  return *_ptr++;
+}
+
+//-----------------------------------------------------------------------------
+void RangeDecoder::Normalize()
+{
+  while (_range < RANGE_TOP)
+  {
+    _range <<= 8;
+    _code = (_code << 8) | NextByte();
+  }
+}
+
+//-----------------------------------------------------------------------------
+u32 RangeDecoder::DecodeBit(BitModel* model)
+{
+  u32 bound = (_range >> RANGE_PROB_BITS) * model->prob;
+  u32 bit;
+  if (_code < bound)
+  {
+    _range = bound;
+    model->prob += (PROB_ONE - model->prob) >> RANGE_MOVE_BITS;
+    bit = 0;
+  }
+  else
+  {
+    _code -= bound;
+    _range -= bound;
+    model->prob -= model->prob >> RANGE_MOVE_BITS;
+    bit = 1;
+  }
+
+  Normalize();
+  return bit;
+}
+
+//-----------------------------------------------------------------------------
+u32 RangeDecoder::DecodeDirect(int numBits)
+{
+  u32 value = 0;
+  for (int i = 0; i < numBits; ++i)
+  {
+    _range >>= 1;
+    u32 bit = _code >= _range ? 1 : 0;
+    if (bit)
+      _code -= _range;
+    value = (value << 1) | bit;
+    Normalize();
+  }
+  return value;
+}
+
+//-----------------------------------------------------------------------------
+u32 RangeDecoder::DecodeUInt(IntModel* model)
+{
+  u32 node = 1;
+  for (int i = 0; i < LENGTH_TREE_BITS; ++i)
+    node = node * 2 + DecodeBit(&model->length[node]);
+
+  u32 length = node - (1 << LENGTH_TREE_BITS);
+  if (length == 0)
+    return 0;
+
+  // lengths past 32 only come from corrupt data
+  if (length > 32)
+  {
+    _corrupt = true;
+    return 0;
+  }
+
+  u64 v = 2 | DecodeBit(&model->mantissa[length]);
+  if (length > 1)
+    v = (v << (length - 1)) | DecodeDirect(length - 1);
+  return (u32)(v - 1);
+}
+
+//-----------------------------------------------------------------------------
+s32 RangeDecoder::DecodeSInt(IntModel* model)
+{
+  return UnZigZag(DecodeUInt(model));
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Adaptive binary range coder, in the style of LZMA's. Each modelled bit has
+  // a probability that moves towards the bits it sees, so a bit that is nearly
+  // always the same costs a small fraction of a bit. Integers are coded as
+  // their bit length, through a tree of modelled bits, followed by the bits
+  // below the leading one.
+  const int RANGE_PROB_BITS = 11;
+  const int RANGE_MOVE_BITS = 5;
+
+  struct BitModel
+  {
+    BitModel() : prob(1 << (RANGE_PROB_BITS - 1)) {}
+    u16 prob;
+  };
+
+  // Models for unsigned integers up to 32 bits
+  struct IntModel
+  {
+    // indexed by the bit length, as a tree of 6 bits
+    BitModel length[64];
+    // the bit below the leading one, for each length
+    BitModel mantissa[33];
+  };
+
+  //-----------------------------------------------------------------------------
+  class RangeEncoder
+  {
+  public:
+    // Appends to the buffer
+    explicit RangeEncoder(vector<char>* out);
+
+    void EncodeBit(BitModel* model, u32 bit);
+    void EncodeDirect(u32 value, int numBits);
+    void EncodeUInt(IntModel* model, u32 value);
+    void EncodeSInt(IntModel* model, s32 value);
+
+    // Writes out what's left. Nothing can be encoded afterwards.
+    void Flush();
+
+  private:
+    void ShiftLow();
+
+    vector<char>* _out;
+    u64 _low;
+    u32 _range;
+    u8 _cache;
+    u64 _cacheSize;
+  };
+
+  //-----------------------------------------------------------------------------
+  class RangeDecoder
+  {
+  public:
+    RangeDecoder(const char* data, size_t size);
+
+    u32 DecodeBit(BitModel* model);
+    u32 DecodeDirect(int numBits);
+    u32 DecodeUInt(IntModel* model);
+    s32 DecodeSInt(IntModel* model);
+
+    // True if the data is corrupt, eg the decoder has read past the end,
+    // which a flushed stream never needs
+    bool IsCorrupt() const { return _corrupt; }
+
+  private:
+    u8 NextByte();
+    void Normalize();
+
+    const u8* _ptr;
+    const u8* _end;
+    u32 _range;
+    u32 _code;
+    bool _corrupt;
+  };
+}
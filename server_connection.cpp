@@ -0,0 +1,411 @@
+#include "server_connection.hpp"
+#include "physics.hpp"
+#include "shared.hpp"
+
+using namespace swarm;
+
+//-----------------------------------------------------------------------------
+void ServerMessageHandler::HandleSwarmState(const wire::SwarmState& msg)
+{
+  ToProtocol(&_convertedSwarmState, msg);
+  HandleSwarmState(_convertedSwarmState);
+}
+
+//-----------------------------------------------------------------------------
+void ServerMessageHandler::HandlePlayerState(const wire::PlayerState& msg)
+{
+  ToProtocol(&_convertedPlayerState, msg);
+  HandlePlayerState(_convertedPlayerState);
+}
+
+//-----------------------------------------------------------------------------
+ServerConnection::ServerConnection()
+  : _serverPort(0)
+  , _sessionToken(0)
+  , _lastTick(0)
+  , _hasLastTick(false)
+  , _pendingChunks(0)
+  , _bytesSent(0)
+  , _bytesReceived(0)
+  , _connected(false)
+  , _udpActive(false)
+  , _spectator(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::Connect(const IpAddress& addr, u16 port)
+{
+  // a session, and the server's clock, are only good for the server that
+  // issued them
+  if (_local || addr != _serverAddr || port != _serverPort)
+  {
+    _sessionToken = 0;
+    _hasLastTick = false;
+    _clockSync.Reset();
+  }
+
+  Disconnect();
+  _reader = MessageReader();
+  if (_socket.connect(addr, port) != Socket::Done)
+  {
+    LOG_WARN("Unable to connect to server"
+        << LogKeyValue("addr", addr.toString())
+        << LogKeyValue("port", port));
+    return false;
+  }
+
+  _socket.setBlocking(false);
+  _serverAddr = addr;
+  _serverPort = port;
+  _connected = true;
+  return SendHello();
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::ConnectLocal(const shared_ptr<LocalChannel>& channel)
+{
+  Disconnect();
+  _sessionToken = 0;
+  _hasLastTick = false;
+  _clockSync.Reset();
+  _local = channel;
+  _connected = true;
+  return SendHello();
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::Reconnect()
+{
+  // a local channel only closes when the server goes away
+  if (_local)
+    return false;
+
+  return Connect(_serverAddr, _serverPort);
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::SendHello()
+{
+  game::PlayerMessage msg;
+  msg.set_type(game::PlayerMessage_Type_PLAYER_HELLO);
+  game::PlayerHello* hello = msg.mutable_hello();
+  if (_spectator)
+    hello->set_spectator(true);
+  if (_sessionToken)
+  {
+    hello->set_session_token(_sessionToken);
+    if (_hasLastTick && _pendingChunks == 0)
+      hello->set_last_tick(_lastTick);
+  }
+
+  return Send(msg);
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::Disconnect()
+{
+  if (_local)
+    exch_null(_local)->Close();
+
+  _socket.disconnect();
+  _udpSocket.Close();
+  _connected = false;
+  _udpActive = false;
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::OpenUdp(u16 port, u32 token)
+{
+  if (!_udpSocket.Open(0))
+    return;
+
+  _udp.Reset(token);
+  _udpServer = UdpAddress(_serverAddr.toInteger(), port);
+  _udpActive = false;
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::SendDatagram(u8 stream, const game::PlayerMessage& msg)
+{
+  if (!msg.SerializeToString(&_serialized))
+    return false;
+
+  return SendDatagram(stream, _serialized.data(), _serialized.size());
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::SendDatagram(u8 stream, const char* data, size_t size)
+{
+  _udpSendBuf.clear();
+  _datagrams.clear();
+  if (!_udp.Write(stream, data, size, _udpServer, &_udpSendBuf, &_datagrams, nullptr))
+    return false;
+
+  _udpSocket.SendBatch(_udpSendBuf, _datagrams);
+  _bytesSent += _udpSendBuf.size();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::SendToSocket(const vector<char>& buf)
+{
+  Socket::Status status = _socket.send(buf.data(), buf.size());
+  if (status == Socket::Disconnected)
+  {
+    _connected = false;
+    return false;
+  }
+
+  _bytesSent += buf.size();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::Send(const game::PlayerMessage& msg)
+{
+  if (!_connected)
+    return false;
+
+  if (_local)
+  {
+    if (_local->SendToServer(make_shared<game::PlayerMessage>(msg)))
+      return true;
+
+    Disconnect();
+    return false;
+  }
+
+  // inputs are resent in every message, so they can go over udp
+  if (_udpSocket.IsOpen() && msg.type() == game::PlayerMessage_Type_PLAYER_INPUT)
+  {
+    if (SendDatagram(UDP_STREAM_INPUT, msg) && _udpActive)
+      return true;
+  }
+
+  // a lost ping is just a missed sample, so once udp works they only go there
+  if (_udpActive && msg.type() == game::PlayerMessage_Type_PLAYER_PING)
+    return SendDatagram(UDP_STREAM_CLOCK, msg);
+
+  if (!PackMessage(_sendBuffer, msg))
+    return false;
+
+  return SendToSocket(_sendBuffer);
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::SendInputs(const wire::PlayerInput* inputs, size_t count)
+{
+  if (!_connected)
+    return false;
+
+  // the local channel takes the messages as is
+  if (_local)
+  {
+    game::PlayerMessage msg;
+    msg.set_type(game::PlayerMessage_Type_PLAYER_INPUT);
+    for (size_t i = 0; i < count; ++i)
+    {
+      game::PlayerInput* input = msg.add_input();
+      input->set_seq(inputs[i].seq);
+      ToProtocol(input->mutable_acc(), inputs[i].acc);
+    }
+    return Send(msg);
+  }
+
+  // the message is framed for tcp, and udp keeps the message boundaries
+  wire::EncodePlayerInputs(&_sendBuffer, inputs, count);
+  if (_udpSocket.IsOpen())
+  {
+    if (SendDatagram(UDP_STREAM_INPUT, _sendBuffer.data() + sizeof(u32), _sendBuffer.size() - sizeof(u32)) && _udpActive)
+      return true;
+  }
+
+  return SendToSocket(_sendBuffer);
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::ProcessMessages(ServerMessageHandler* handler)
+{
+  if (!_connected)
+    return false;
+
+  if (_local)
+    return ProcessLocalMessages(handler);
+
+  size_t bytesReceived = 0;
+  Socket::Status status = _reader.Receive(&_socket, &bytesReceived);
+  _bytesReceived += bytesReceived;
+
+  if (status == Socket::Disconnected || status == Socket::Error)
+  {
+    _connected = false;
+    return false;
+  }
+
+  const char* data;
+  u32 size;
+  while (_reader.NextMessage(&data, &size))
+    ReceiveMessage(data, size, handler);
+
+  if (_reader.IsCorrupt())
+  {
+    Disconnect();
+    return false;
+  }
+
+  ProcessDatagrams(handler);
+  SendPing();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::SendPing()
+{
+  // the server only answers once the game is on
+  if (!HasSession())
+    return;
+
+  game::PlayerMessage msg;
+  if (!_clockSync.FillPing(GetLocalTime(), msg.mutable_ping()))
+    return;
+
+  msg.set_type(game::PlayerMessage_Type_PLAYER_PING);
+  Send(msg);
+}
+
+//-----------------------------------------------------------------------------
+bool ServerConnection::ProcessLocalMessages(ServerMessageHandler* handler)
+{
+  ServerMessagePtr msg;
+  while (_local->ReceiveFromServer(&msg))
+    DispatchMessage(*msg, handler);
+
+  if (_local->IsClosed())
+  {
+    _connected = false;
+    return false;
+  }
+
+  SendPing();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::ProcessDatagrams(ServerMessageHandler* handler)
+{
+  char buf[MAX_DATAGRAM_SIZE];
+  UdpAddress from;
+  size_t size;
+  while (_udpSocket.ReceiveFrom(&from, buf, sizeof(buf), &size))
+  {
+    _bytesReceived += size;
+    if (from != _udpServer)
+      continue;
+
+    u8 stream;
+    const char* data;
+    size_t msgSize;
+    if (!_udp.Receive(buf, size, &stream, &data, &msgSize))
+      continue;
+
+    _udpActive = true;
+    ReceiveMessage(data, msgSize, handler);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::ReceiveMessage(const char* data, size_t size, ServerMessageHandler* handler)
+{
+  // the states make up nearly all the traffic, so they skip protobuf
+  int type;
+  if (wire::DecodeServerMessage(data, size, &type, &_swarmState, &_playerState))
+  {
+    if (type == game::ServerMessage_Type_SWARM_STATE)
+    {
+      SwarmStateReceived(_swarmState.tick, _swarmState.hasNumChunks);
+      handler->HandleSwarmState(_swarmState);
+    }
+    else
+    {
+      handler->HandlePlayerState(_playerState);
+    }
+    return;
+  }
+
+  if (!_message.ParseFromArray(data, (int)size))
+  {
+    LOG_WARN("Unable to parse server message" << LogKeyValue("size", size));
+    return;
+  }
+
+  DispatchMessage(_message, handler);
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::SwarmStateReceived(u32 tick, bool chunk)
+{
+  // a late state from tcp can turn up after a newer one over udp
+  if (!_hasLastTick || (s32)(tick - _lastTick) > 0)
+    _lastTick = tick;
+  _hasLastTick = true;
+  if (chunk && _pendingChunks > 0)
+    --_pendingChunks;
+}
+
+//-----------------------------------------------------------------------------
+void ServerConnection::DispatchMessage(const game::ServerMessage& msg, ServerMessageHandler* handler)
+{
+  switch (msg.type())
+  {
+    case game::ServerMessage_Type_GAME_STARTED:
+      {
+        const game::GameStarted& started = msg.game_started();
+        if (started.has_udp_port() && !_local)
+          OpenUdp((u16)started.udp_port(), started.udp_token());
+        _sessionToken = started.session_token();
+        _lastTick = started.swarm_state().tick();
+        _hasLastTick = true;
+        _pendingChunks = started.initial_state_chunks();
+        handler->HandleGameStarted(started);
+      }
+      break;
+
+    case game::ServerMessage_Type_PLAYER_JOINED:
+      handler->HandlePlayerJoined(msg.player_joined());
+      break;
+
+    case game::ServerMessage_Type_PLAYER_LEFT:
+      handler->HandlePlayerLeft(msg.player_left());
+      break;
+
+    case game::ServerMessage_Type_SWARM_STATE:
+      SwarmStateReceived(msg.swarm_state().tick(), msg.swarm_state().has_num_chunks());
+      handler->HandleSwarmState(msg.swarm_state());
+      break;
+
+    case game::ServerMessage_Type_PLAYER_STATE:
+      handler->HandlePlayerState(msg.player_state());
+      break;
+
+    case game::ServerMessage_Type_GAME_ENDED:
+      handler->HandleGameEnded(msg.game_ended());
+      break;
+
+    case game::ServerMessage_Type_PLAYER_DIED:
+      handler->HandlePlayerDied(msg.player_died());
+      break;
+
+    case game::ServerMessage_Type_MONSTER_DIED:
+      handler->HandleMonsterDied(msg.monster_died());
+      break;
+
+    case game::ServerMessage_Type_PONG:
+      _clockSync.HandlePong(msg.pong(), GetLocalTime());
+      break;
+
+    case game::ServerMessage_Type_LOCKSTEP_FRAMES:
+      handler->HandleLockstepFrames(msg.lockstep_frames());
+      break;
+  }
+}
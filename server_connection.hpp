@@ -0,0 +1,139 @@
+#pragma once
+#include "protocol.hpp"
+#include "wire_codec.hpp"
+#include "udp_channel.hpp"
+#include "local_channel.hpp"
+#include "clock_sync.hpp"
+
+namespace swarm
+{
+  // Callbacks for the messages the server sends. Implemented by the game
+  // client and by the headless bots.
+  struct ServerMessageHandler
+  {
+    virtual ~ServerMessageHandler() {}
+    virtual bool HandleGameStarted(const game::GameStarted& msg) { return true; }
+    virtual void HandlePlayerJoined(const game::PlayerJoined& msg) {}
+    virtual void HandlePlayerLeft(const game::PlayerLeft& msg) {}
+    virtual void HandleSwarmState(const game::SwarmState& msg) {}
+    virtual void HandlePlayerState(const game::PlayerState& msg) {}
+    virtual void HandleGameEnded(const game::GameEnded& msg) {}
+    virtual void HandleMonsterDied(const game::MonsterDied& msg) {}
+    virtual void HandlePlayerDied(const game::PlayerDied& msg) {}
+    virtual void HandleLockstepFrames(const game::LockstepFrames& msg) {}
+
+    // The states from a remote server are decoded without protobuf. By
+    // default they're converted, and passed on to the protobuf versions.
+    virtual void HandleSwarmState(const wire::SwarmState& msg);
+    virtual void HandlePlayerState(const wire::PlayerState& msg);
+
+  private:
+    game::SwarmState _convertedSwarmState;
+    game::PlayerState _convertedPlayerState;
+  };
+
+  // Client side of the connection to the server. Handles the message framing,
+  // and dispatches the incoming messages to a ServerMessageHandler.
+  //
+  // If the server offers udp in GameStarted, inputs are sent over udp, and the
+  // server sends the swarm and player states the same way. Inputs also go
+  // over tcp until the first datagram from the server shows udp gets through.
+  //
+  // The server hands out a session token in GameStarted. If the connection
+  // drops, Reconnect presents it with the tick of the last swarm state, and
+  // the server resumes the session with only what changed since.
+  //
+  // A client hosting its own server connects through a LocalChannel instead,
+  // and the messages are passed as is, without a socket.
+  //
+  // Once the game has started, the connection pings the server to keep track
+  // of the round trip time, and of the server's clock. The pings go over udp
+  // when that works, as that's the way the states come.
+  class ServerConnection
+  {
+  public:
+    ServerConnection();
+
+    bool Connect(const IpAddress& addr, u16 port);
+    bool ConnectLocal(const shared_ptr<LocalChannel>& channel);
+    void Disconnect();
+    bool IsConnected() const { return _connected; }
+
+    // Connects to the same server again, and resumes the session if the
+    // server still has it
+    bool Reconnect();
+    bool HasSession() const { return _sessionToken != 0; }
+
+    // A spectator gets the states, but doesn't join the game. Set before
+    // connecting.
+    void SetSpectator(bool spectator) { _spectator = spectator; }
+
+    bool Send(const game::PlayerMessage& msg);
+    // Sends a PLAYER_INPUT, encoded without protobuf
+    bool SendInputs(const wire::PlayerInput* inputs, size_t count);
+
+    // Reads any pending data from the server, and dispatches all the complete
+    // messages. Returns false if the connection has been lost.
+    bool ProcessMessages(ServerMessageHandler* handler);
+
+    u64 GetBytesSent() const { return _bytesSent; }
+    u64 GetBytesReceived() const { return _bytesReceived; }
+
+    bool IsUdpActive() const { return _udpActive; }
+
+    const ClockSync& GetClockSync() const { return _clockSync; }
+    // The current server time, in the same seconds as the states'
+    // server_time. Only valid once the clock is synced.
+    double GetServerTime() const { return _clockSync.GetServerTime(GetLocalTime()); }
+    // messages dropped because a newer one of the same kind arrived first
+    u64 GetNumStaleDatagrams() const { return _udp.GetNumStale(); }
+
+  private:
+    void ReceiveMessage(const char* data, size_t size, ServerMessageHandler* handler);
+    void DispatchMessage(const game::ServerMessage& msg, ServerMessageHandler* handler);
+    void SwarmStateReceived(u32 tick, bool chunk);
+    bool SendHello();
+    void OpenUdp(u16 port, u32 token);
+    bool SendDatagram(u8 stream, const game::PlayerMessage& msg);
+    bool SendDatagram(u8 stream, const char* data, size_t size);
+    bool SendToSocket(const vector<char>& buf);
+    void SendPing();
+    double GetLocalTime() const { return _clock.getElapsedTime().asMicroseconds() / 1e6; }
+    void ProcessDatagrams(ServerMessageHandler* handler);
+    bool ProcessLocalMessages(ServerMessageHandler* handler);
+
+    TcpSocket _socket;
+    shared_ptr<LocalChannel> _local;
+    MessageReader _reader;
+    vector<char> _sendBuffer;
+    string _serialized;
+    game::ServerMessage _message;
+    // the states decoded by the wire codec
+    wire::SwarmState _swarmState;
+    wire::PlayerState _playerState;
+    IpAddress _serverAddr;
+    u16 _serverPort;
+
+    // the session to resume, and the tick of the last swarm state handled
+    u64 _sessionToken;
+    u32 _lastTick;
+    bool _hasLastTick;
+    // chunks of the initial state still to come. the swarm isn't complete
+    // until they're in, so there's nothing to resume from before that
+    u32 _pendingChunks;
+    DatagramSocket _udpSocket;
+    UdpChannel _udp;
+    UdpAddress _udpServer;
+    vector<char> _udpSendBuf;
+    vector<Datagram> _datagrams;
+
+    Clock _clock;
+    ClockSync _clockSync;
+
+    u64 _bytesSent;
+    u64 _bytesReceived;
+    bool _connected;
+    bool _udpActive;
+    bool _spectator;
+  };
+}
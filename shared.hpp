@@ -4,11 +4,16 @@
 
 namespace swarm
 {
-  struct MonsterState
-  {
-    PhysicsState _curState;
-    PhysicsState _prevState;
-  };
+  // Number of the most recent inputs the client sends with every input message
+  const int INPUT_REDUNDANCY = 10;
+
+  // Each kind of message sent over udp has its own stream, so a late message
+  // is only dropped in favour of a newer one of the same kind
+  const u8 UDP_STREAM_SWARM_STATE = 0;
+  const u8 UDP_STREAM_PLAYER_STATE = 1;
+  const u8 UDP_STREAM_INPUT = 2;
+  // pings and pongs
+  const u8 UDP_STREAM_CLOCK = 3;
 
   struct PlayerState
   {
@@ -0,0 +1,289 @@
+#include "shared_snapshot.hpp"
+#include "error.hpp"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
+using namespace swarm;
+
+namespace
+{
+  // a reader gives up if it keeps overlapping writes for this many attempts
+  const u32 MAX_READ_ATTEMPTS = 1000;
+
+  //-----------------------------------------------------------------------------
+  size_t RegionSize(u32 maxMonsters, u32 maxPlayers)
+  {
+    return sizeof(SharedSnapshotHeader) + maxMonsters * sizeof(SharedMonster) + maxPlayers * sizeof(SharedPlayer);
+  }
+}
+
+//-----------------------------------------------------------------------------
+SharedMemory::SharedMemory()
+  : _data(nullptr)
+  , _size(0)
+  , _owner(false)
+#ifdef _WIN32
+  , _mapping(NULL)
+#endif
+{
+}
+
+//-----------------------------------------------------------------------------
+SharedMemory::~SharedMemory()
+{
+  Close();
+}
+
+#ifdef _WIN32
+
+//-----------------------------------------------------------------------------
+bool SharedMemory::Create(const string& name, size_t size)
+{
+  Close();
+  _mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+      (DWORD)((u64)size >> 32), (DWORD)size, name.c_str());
+  if (!_mapping)
+    return false;
+
+  _data = MapViewOfFile(_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  if (!_data)
+  {
+    Close();
+    return false;
+  }
+
+  _name = name;
+  _size = size;
+  _owner = true;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SharedMemory::Open(const string& name)
+{
+  Close();
+  _mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+  if (!_mapping)
+    return false;
+
+  _data = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+  MEMORY_BASIC_INFORMATION info;
+  if (!_data || !VirtualQuery(_data, &info, sizeof(info)))
+  {
+    Close();
+    return false;
+  }
+
+  _name = name;
+  _size = info.RegionSize;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void SharedMemory::Close()
+{
+  if (_data)
+    UnmapViewOfFile(_data);
+  if (_mapping)
+    CloseHandle(_mapping);
+
+  _mapping = NULL;
+  _data = nullptr;
+  _size = 0;
+  _owner = false;
+}
+
+#else
+
+//-----------------------------------------------------------------------------
+bool SharedMemory::Create(const string& name, size_t size)
+{
+  Close();
+  string path = "/" + name;
+  shm_unlink(path.c_str());
+  int fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0)
+    return false;
+
+  void* data = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (data == MAP_FAILED)
+  {
+    shm_unlink(path.c_str());
+    return false;
+  }
+
+  _name = name;
+  _data = data;
+  _size = size;
+  _owner = true;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SharedMemory::Open(const string& name)
+{
+  Close();
+  string path = "/" + name;
+  int fd = shm_open(path.c_str(), O_RDONLY, 0);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  void* data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+    data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (data == MAP_FAILED)
+    return false;
+
+  _name = name;
+  _data = data;
+  _size = st.st_size;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void SharedMemory::Close()
+{
+  if (!_data)
+    return;
+
+  munmap(_data, _size);
+  if (_owner)
+    shm_unlink(("/" + _name).c_str());
+
+  _data = nullptr;
+  _size = 0;
+  _owner = false;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+bool SharedSnapshotWriter::Open(const string& name, u32 maxMonsters, u32 maxPlayers)
+{
+  if (!_memory.Create(name, RegionSize(maxMonsters, maxPlayers)))
+  {
+    LOG_WARN("Unable to create shared snapshot" << LogKeyValue("name", name));
+    return false;
+  }
+
+  // a new region is zero filled, so the seq starts out even, with no
+  // monsters or players
+  SharedSnapshotHeader* header = Header();
+  header->maxMonsters = maxMonsters;
+  header->maxPlayers = maxPlayers;
+  header->version = SHARED_SNAPSHOT_VERSION;
+  // the magic goes in last, and readers check it before the rest, so they
+  // never see a half initialized header
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = SHARED_SNAPSHOT_MAGIC;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void SharedSnapshotWriter::BeginWrite()
+{
+  SharedSnapshotHeader* header = Header();
+  header->seq.store(header->seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  // the odd seq must be visible before any of the data changes
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+SharedMonster* SharedSnapshotWriter::GetMonsters() const
+{
+  return (SharedMonster*)((char*)_memory.GetData() + sizeof(SharedSnapshotHeader));
+}
+
+//-----------------------------------------------------------------------------
+SharedPlayer* SharedSnapshotWriter::GetPlayers() const
+{
+  return (SharedPlayer*)(GetMonsters() + Header()->maxMonsters);
+}
+
+//-----------------------------------------------------------------------------
+void SharedSnapshotWriter::EndWrite(u32 tick, double serverTime, u32 numMonsters, u32 numPlayers)
+{
+  SharedSnapshotHeader* header = Header();
+  header->tick = tick;
+  header->serverTime = serverTime;
+  header->numMonsters = min(numMonsters, header->maxMonsters);
+  header->numPlayers = min(numPlayers, header->maxPlayers);
+  header->seq.store(header->seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+bool SharedSnapshotReader::Open(const string& name)
+{
+  if (!_memory.Open(name))
+    return false;
+
+  // the size check comes first, so a bad header can't send the reads past
+  // the end of the region. the rest of the header is only read once the
+  // magic shows the writer has filled it in
+  const SharedSnapshotHeader* header = Header();
+  bool valid = _memory.GetSize() >= sizeof(SharedSnapshotHeader)
+      && header->magic == SHARED_SNAPSHOT_MAGIC;
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  valid = valid
+      && header->version == SHARED_SNAPSHOT_VERSION
+      && _memory.GetSize() >= RegionSize(header->maxMonsters, header->maxPlayers);
+
+  if (!valid)
+  {
+    LOG_WARN("Not a shared snapshot" << LogKeyValue("name", name));
+    _memory.Close();
+    return false;
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool SharedSnapshotReader::Read(SharedSnapshot* snapshot)
+{
+  const SharedSnapshotHeader* header = Header();
+  if (!header)
+    return false;
+
+  const SharedMonster* monsters = (const SharedMonster*)((const char*)header + sizeof(SharedSnapshotHeader));
+  const SharedPlayer* players = (const SharedPlayer*)(monsters + header->maxMonsters);
+
+  for (u32 i = 0; i < MAX_READ_ATTEMPTS; ++i)
+  {
+    u32 seq = header->seq.load(std::memory_order_acquire);
+    if (seq & 1)
+    {
+      ++_numRetries;
+      std::this_thread::yield();
+      continue;
+    }
+
+    // the counts can be torn mid write, so they're clamped before use, and
+    // the whole copy is thrown away if the seq moved
+    snapshot->tick = header->tick;
+    snapshot->serverTime = header->serverTime;
+    u32 numMonsters = min(header->numMonsters, header->maxMonsters);
+    u32 numPlayers = min(header->numPlayers, header->maxPlayers);
+    snapshot->monsters.assign(monsters, monsters + numMonsters);
+    snapshot->players.assign(players, players + numPlayers);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header->seq.load(std::memory_order_relaxed) == seq)
+      return true;
+
+    ++_numRetries;
+  }
+
+  return false;
+}
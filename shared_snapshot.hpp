@@ -0,0 +1,150 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // The latest monster and player state, published by the server into a named
+  // shared memory region, so observers on the same host (stats collectors,
+  // spectators, bots) can read it without a connection or any decoding.
+  //
+  // The region has a fixed layout. All values are in host byte order:
+  //
+  //  offset  size  field
+  //  0       4     magic, SHARED_SNAPSHOT_MAGIC
+  //  4       4     version, SHARED_SNAPSHOT_VERSION
+  //  8       4     maxMonsters, the capacity of the monster array
+  //  12      4     maxPlayers, the capacity of the player array
+  //  16      4     seq, odd while the server is writing a snapshot
+  //  20      4     tick
+  //  24      8     serverTime, in seconds
+  //  32      4     numMonsters
+  //  36      4     numPlayers
+  //  40      24    reserved
+  //  64            SharedMonster[maxMonsters], sorted by id
+  //  ...           SharedPlayer[maxPlayers], sorted by id
+  //
+  // The region is protected by a seqlock. The server never waits for the
+  // readers, and a reader only retries if it overlaps a write, so any number
+  // of them add no load to the tick thread.
+  const u32 SHARED_SNAPSHOT_MAGIC = 0x4d535753;   // "SWSM"
+  const u32 SHARED_SNAPSHOT_VERSION = 1;
+  const u32 SHARED_SNAPSHOT_MAX_PLAYERS = 64;
+
+  struct SharedMonster
+  {
+    u32 id;
+    float size;
+    float pos[2];
+    float vel[2];
+  };
+
+  struct SharedPlayer
+  {
+    u32 id;
+    s32 health;
+    float pos[2];
+    float vel[2];
+  };
+
+  struct SharedSnapshotHeader
+  {
+    u32 magic;
+    u32 version;
+    u32 maxMonsters;
+    u32 maxPlayers;
+    atomic<u32> seq;
+    u32 tick;
+    double serverTime;
+    u32 numMonsters;
+    u32 numPlayers;
+    u8 reserved[24];
+  };
+
+  static_assert(sizeof(SharedMonster) == 24, "SharedMonster is part of the shared layout");
+  static_assert(sizeof(SharedPlayer) == 24, "SharedPlayer is part of the shared layout");
+  static_assert(sizeof(SharedSnapshotHeader) == 64, "SharedSnapshotHeader is part of the shared layout");
+
+  //-----------------------------------------------------------------------------
+  // A named shared memory region, mapped into this process
+  class SharedMemory
+  {
+  public:
+    SharedMemory();
+    ~SharedMemory();
+
+    // Creates the region, replacing any left over from an earlier run
+    bool Create(const string& name, size_t size);
+    // Maps an existing region read only
+    bool Open(const string& name);
+    void Close();
+
+    void* GetData() const { return _data; }
+    size_t GetSize() const { return _size; }
+
+  private:
+    string _name;
+    void* _data;
+    size_t _size;
+    bool _owner;
+#ifdef _WIN32
+    HANDLE _mapping;
+#endif
+
+    DISALLOW_COPY_AND_ASSIGN(SharedMemory);
+  };
+
+  //-----------------------------------------------------------------------------
+  // Server side. The monsters and players are written straight into the
+  // region between BeginWrite and EndWrite.
+  class SharedSnapshotWriter
+  {
+  public:
+    bool Open(const string& name, u32 maxMonsters, u32 maxPlayers);
+    void Close() { _memory.Close(); }
+    bool IsOpen() const { return _memory.GetData() != nullptr; }
+
+    u32 GetMaxMonsters() const { return Header()->maxMonsters; }
+    u32 GetMaxPlayers() const { return Header()->maxPlayers; }
+
+    void BeginWrite();
+    SharedMonster* GetMonsters() const;
+    SharedPlayer* GetPlayers() const;
+    void EndWrite(u32 tick, double serverTime, u32 numMonsters, u32 numPlayers);
+
+  private:
+    SharedSnapshotHeader* Header() const { return (SharedSnapshotHeader*)_memory.GetData(); }
+    SharedMemory _memory;
+  };
+
+  struct SharedSnapshot
+  {
+    u32 tick;
+    double serverTime;
+    vector<SharedMonster> monsters;
+    vector<SharedPlayer> players;
+  };
+
+  //-----------------------------------------------------------------------------
+  // Observer side
+  class SharedSnapshotReader
+  {
+  public:
+    SharedSnapshotReader() : _numRetries(0) {}
+
+    bool Open(const string& name);
+    void Close() { _memory.Close(); }
+
+    // Copies out a consistent snapshot. Returns false if the server kept
+    // writing for the whole time.
+    bool Read(SharedSnapshot* snapshot);
+
+    // reads that overlapped a write, and had to start over
+    u64 GetNumRetries() const { return _numRetries; }
+
+  private:
+    const SharedSnapshotHeader* Header() const { return (const SharedSnapshotHeader*)_memory.GetData(); }
+    SharedMemory _memory;
+    u64 _numRetries;
+  };
+}
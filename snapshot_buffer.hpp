@@ -0,0 +1,128 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Jitter buffer of the most recent server snapshots. The client renders a
+  // fixed delay behind the server, and interpolates between the two snapshots
+  // around the render time, which gives smooth motion regardless of the
+  // snapshot rate, and hides snapshots that arrive late.
+  //
+  // T needs an _id and a _pos, and the entities in each snapshot must be
+  // sorted by id. Entities that only exist in the newer of the two snapshots
+  // are shown at their new position, and entities that are missing from it
+  // are dropped.
+  template <typename T>
+  class SnapshotBuffer
+  {
+  public:
+    SnapshotBuffer(size_t capacity)
+      : _snapshots(capacity)
+      , _first(0)
+      , _count(0)
+    {
+    }
+
+    void Clear()
+    {
+      _first = 0;
+      _count = 0;
+    }
+
+    // Returns the entity list to fill in for the new snapshot, or nullptr if
+    // the tick isn't newer than the latest snapshot. Replaces the oldest
+    // snapshot if the buffer is full.
+    vector<T>* AddSnapshot(u32 tick, double time)
+    {
+      if (_count > 0 && (s32)(tick - Newest().tick) <= 0)
+        return nullptr;
+
+      if (_count == _snapshots.size())
+      {
+        _first = (_first + 1) % _snapshots.size();
+        --_count;
+      }
+
+      Snapshot& snapshot = _snapshots[(_first + _count) % _snapshots.size()];
+      ++_count;
+      snapshot.tick = tick;
+      snapshot.time = time;
+      snapshot.entities.clear();
+      return &snapshot.entities;
+    }
+
+    // Returns the entity list of the newest snapshot, for a snapshot that
+    // arrives in several parts, or nullptr if it isn't for the given tick
+    vector<T>* GetNewestSnapshot(u32 tick)
+    {
+      if (_count == 0 || At(_count - 1).tick != tick)
+        return nullptr;
+      return &_snapshots[(_first + _count - 1) % _snapshots.size()].entities;
+    }
+
+    bool IsEmpty() const { return _count == 0; }
+    double GetNewestTime() const { return Newest().time; }
+    double GetOldestTime() const { return At(0).time; }
+
+    // Interpolates the entities at the given server time. Times outside the
+    // buffer are clamped to the oldest or newest snapshot.
+    bool Interpolate(double time, vector<T>* out) const
+    {
+      out->clear();
+      if (_count == 0)
+        return false;
+
+      if (time <= At(0).time)
+      {
+        *out = At(0).entities;
+        return true;
+      }
+
+      if (time >= Newest().time)
+      {
+        *out = Newest().entities;
+        return true;
+      }
+
+      // find the snapshots on either side of the render time
+      size_t idx = 1;
+      while (At(idx).time < time)
+        ++idx;
+
+      const Snapshot& a = At(idx - 1);
+      const Snapshot& b = At(idx);
+      float alpha = (float)((time - a.time) / (b.time - a.time));
+
+      // both lists are sorted by id, so walk them in lock step
+      out->reserve(b.entities.size());
+      auto itA = a.entities.begin();
+      for (const T& entity : b.entities)
+      {
+        while (itA != a.entities.end() && itA->_id < entity._id)
+          ++itA;
+
+        out->push_back(entity);
+        if (itA != a.entities.end() && itA->_id == entity._id)
+          out->back()._pos = lerp(itA->_pos, entity._pos, alpha);
+      }
+
+      return true;
+    }
+
+  private:
+    struct Snapshot
+    {
+      u32 tick;
+      double time;
+      vector<T> entities;
+    };
+
+    const Snapshot& At(size_t idx) const { return _snapshots[(_first + idx) % _snapshots.size()]; }
+    const Snapshot& Newest() const { return At(_count - 1); }
+
+    vector<Snapshot> _snapshots;
+    size_t _first;
+    size_t _count;
+  };
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "utils.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Bounded single producer, single consumer queue. With only one thread on
+  // either end, each position is only ever written by its own side, so a push
+  // or pop is a load and a store, with no CAS.
+  template <typename T>
+  class SpscQueue
+  {
+  public:
+    // capacity is rounded up to a power of two
+    SpscQueue(size_t capacity)
+      : _writePos(0)
+      , _readPos(0)
+    {
+      size_t size = 1;
+      while (size < capacity)
+        size <<= 1;
+
+      _mask = size - 1;
+      _slots = new T[size];
+    }
+
+    ~SpscQueue()
+    {
+      delete[] _slots;
+    }
+
+    // Must only be called from the producer thread. Returns false if the
+    // queue is full
+    bool TryPush(const T& value)
+    {
+      size_t pos = _writePos.load(std::memory_order_relaxed);
+      if (pos - _readPos.load(std::memory_order_acquire) > _mask)
+        return false;
+
+      _slots[pos & _mask] = value;
+      _writePos.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    // Must only be called from the consumer thread
+    bool TryPop(T* value)
+    {
+      size_t pos = _readPos.load(std::memory_order_relaxed);
+      if (pos == _writePos.load(std::memory_order_acquire))
+        return false;
+
+      // moved out, so the slot doesn't hang on to the value until it's reused
+      *value = std::move(_slots[pos & _mask]);
+      _readPos.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+  private:
+    T* _slots;
+    size_t _mask;
+
+    // keep the producer and consumer positions on separate cache lines
+    char _pad0[64];
+    atomic<size_t> _writePos;
+    char _pad1[64];
+    atomic<size_t> _readPos;
+
+    DISALLOW_COPY_AND_ASSIGN(SpscQueue);
+  };
+}
@@ -9,6 +9,15 @@
 using namespace sf;
 using namespace swarm;
 
+namespace
+{
+  // 10 seconds of inputs at the fixed step
+  const size_t MAX_PENDING_INPUTS = 500;
+
+  // how often to try getting back into the game after losing the connection
+  const s32 RECONNECT_INTERVAL_MS = 1000;
+}
+
 //----------------------------------------------------------------------------------
 int CreateTextRects(const char* str, const Vector2f& center, float scale, vector<RectangleShape>* out)
 {
@@ -149,11 +158,15 @@ MainWindow::MainWindow(const string& title, const Vector2f& pos, const Vector2f&
   , _game(game)
   , _playerCircle(5, 100)
   , _monsterCircle(5, 50)
+  , _aggregateCircle(5, 50)
   , _lastUpdate(microsec_clock::local_time())
   , _textureRects(50*8*8*5)
 {
   _playerCircle.setFillColor(Color::Green);
   _monsterCircle.setFillColor(Color::Red);
+  _aggregateCircle.setFillColor(Color(0xff, 0, 0, 0x60));
+  _aggregateCircle.setOutlineColor(Color::Red);
+  _aggregateCircle.setOutlineThickness(1);
   _selectionCircle.setFillColor(Color(0xcc, 0xcc, 0, 0x80));
 
   game->_windowManager->RegisterHandler(Event::MouseButtonReleased, this, bind(&MainWindow::OnMouseButtonReleased, this, _1));
@@ -211,19 +224,22 @@ void MainWindow::Draw()
       _texture.draw(_playerCircle);
     }
 
-    RenderMonster* monster = _game->_renderMonsters.data();
-    MonsterState* state = _game->_monsterState.data();
-    for (size_t i = 0; i < _game->_renderMonsters.size(); ++i)
+    for (const RenderMonster& monster : _game->_renderMonsters)
     {
-      Vector2f p(monster->_pos);
-      p.x -= monster->_size;
-      p.y -= monster->_size;
+      Vector2f p(monster._pos);
+      p.x -= monster._size;
+      p.y -= monster._size;
       _monsterCircle.setPosition(p);
-      _monsterCircle.setRadius(monster->_size);
+      _monsterCircle.setRadius(monster._size);
       _texture.draw(_monsterCircle);
+    }
 
-      ++monster;
-      ++state;
+    // far monsters are only known as a blob, so that's how they're drawn
+    for (const RenderAggregate& aggregate : _game->_renderAggregates)
+    {
+      _aggregateCircle.setPosition(aggregate._pos - aggregate._extent * Vector2f(1, 1));
+      _aggregateCircle.setRadius(aggregate._extent);
+      _texture.draw(_aggregateCircle);
     }
 
     if (!_clickStart.is_not_a_date_time())
@@ -291,7 +307,9 @@ void DebugWindow::Draw()
   Text frameTime("", _game->_font, 10);
   frameTime.setColor(Color::Blue);
 
-  frameTime.setString(toString("%.2f ms", _game->_frameTime.GetAverage() / 1000.0f));
+  const Histogram<>& h = _game->_lastFrameTime;
+  frameTime.setString(toString("p50: %.2f ms, p99: %.2f ms, max: %.2f ms",
+      h.GetPercentile(0.5) / 1000.0f, h.GetPercentile(0.99) / 1000.0f, h.GetMax() / 1000.0f));
   frameTime.setPosition(20, 20);
   _texture.draw(frameTime);
 
@@ -299,6 +317,15 @@ void DebugWindow::Draw()
   frameTime.setPosition(20, 30);
   _texture.draw(frameTime);
 
+  const ClockSync& clockSync = _game->_connection.GetClockSync();
+  if (clockSync.IsSynced())
+  {
+    frameTime.setString(toString("rtt: %.1f ms (+-%.1f), server time: %.3f",
+        clockSync.GetRtt() * 1000, clockSync.GetRttDeviation() * 1000, _game->_connection.GetServerTime()));
+    frameTime.setPosition(20, 40);
+    _texture.draw(frameTime);
+  }
+
   _texture.display();
 }
 
@@ -309,7 +336,15 @@ Game::Game(u16 serverPort, const string& serverAddr)
   , _gameEnded(false)
   , _done(false)
   , _winnerId(~0)
-  , _frameTime(100)
+  , _nextInputSeq(1)
+  , _lockstepMode(false)
+  , _numDesyncs(0)
+  , _monsterSnapshots(16)
+  , _playerSnapshots(16)
+  , _aggregateSnapshots(16)
+  , _serverTimeOffset(0)
+  , _hasServerTime(false)
+  , _renderDelay(0.2)
   , _mainWindow(nullptr)
   , _playerWindow(nullptr)
   , _debugWindow(nullptr)
@@ -370,19 +405,18 @@ bool Game::Init()
  // _windowManager->AddWindow(_debugWindow);
   _windowManager->AddWindow(_mainWindow);
 
-  // Only run a local server if one wasn't specified
+  // Only run a local server if one wasn't specified. Other players can still
+  // join it over the network, but this client talks to it directly.
   if (_serverAddr.empty())
   {
     if (!_server.Init("config.pb"))
       return false;
 
     _serverPort = _server.GetPort();
+    return _connection.ConnectLocal(_server.ConnectLocal());
   }
 
-  _socket.connect(IpAddress(_serverAddr.empty() ? "localhost" : _serverAddr), _serverPort);
-  _socket.setBlocking(false);
-
-  return true;
+  return _connection.Connect(IpAddress(_serverAddr), _serverPort);
 }
 
 //----------------------------------------------------------------------------------
@@ -409,6 +443,10 @@ bool Game::OnKeyPressed(const Event& event)
     case Keyboard::Escape:
       _done = true;
       break;
+
+    case Keyboard::P:
+      _server.GetTickProfiler().LogStats("requested");
+      break;
   }
 
   return true;
@@ -430,13 +468,13 @@ bool Game::OnMouseReleased(const Event& event)
 //----------------------------------------------------------------------------------
 void Game::UpdatePlayers()
 {
+  Vector2f& acc = _localPlayer._state._acc;
+  acc = Vector2f(0,0);
+
   if (!_focus || _gameEnded)
     return;
 
-  float s = 30;
-
-  Vector2f& acc = _localPlayer._state._acc;
-  acc = Vector2f(0,0);
+  float s = PLAYER_ACCELERATION;
 
   if (Keyboard::isKeyPressed(Keyboard::Left) || Keyboard::isKeyPressed(Keyboard::A))
     acc += Vector2f(-s, 0);
@@ -454,6 +492,16 @@ void Game::UpdatePlayers()
 //----------------------------------------------------------------------------------
 bool Game::HandleGameStarted(const game::GameStarted& msg)
 {
+  // a resumed session carries on with the current swarm, and the local
+  // player is corrected by reconciling against the player state as usual
+  if (msg.resumed())
+  {
+    _hasServerTime = false;
+    HandlePlayerState(msg.player_state());
+    HandleSwarmState(msg.swarm_state());
+    return true;
+  }
+
   if (!_level.Load(msg.map_name()))
     return false;
 
@@ -462,58 +510,33 @@ bool Game::HandleGameStarted(const game::GameStarted& msg)
   _localPlayer._id = _playerId;
   _localPlayer._health = msg.health();
 
-  // Initial player state
-  const game::PlayerState& playerState = msg.player_state();
+  // render two snapshots behind, so a single late snapshot doesn't stall
+  u32 snapshotIntervalMs = msg.has_snapshot_interval_ms() ? msg.snapshot_interval_ms() : 100;
+  _renderDelay = 2 * snapshotIntervalMs / 1000.0;
 
+  // copy the initial local player state
+  const game::PlayerState& playerState = msg.player_state();
   for (int i = 0; i < playerState.player_size(); ++i)
   {
     const game::Player& player = playerState.player(i);
-    u32 id = player.id();
-
-    // copy the initial local player state
     if (player.id() == _playerId)
     {
       FromProtocol(&_localPlayer._state._acc, player.acc());
       FromProtocol(&_localPlayer._state._vel, player.vel());
       FromProtocol(&_localPlayer._state._pos, player.pos());
     }
-    else
-    {
-      RenderPlayer& remotePlayer = _remotePlayers[id];
-
-      remotePlayer._id = player.id();
-      remotePlayer._health = player.health();
-
-      FromProtocol(&remotePlayer._state._acc, player.acc());
-      FromProtocol(&remotePlayer._state._vel, player.vel());
-      FromProtocol(&remotePlayer._state._pos, player.pos());
-    }
   }
 
-  // Initial swarm state
-  const game::SwarmState& swarmState = msg.swarm_state();
-  if (_renderMonsters.size() != swarmState.monster_size())
-  {
-    _renderMonsters.resize(swarmState.monster_size());
-    _monsterState.resize(swarmState.monster_size());
-  }
-
-  RenderMonster* monster = _renderMonsters.data();
-  MonsterState* state = _monsterState.data();
-  for (int i = 0; i < swarmState.monster_size(); ++i)
-  {
-    const game::Monster& m = swarmState.monster(i);
-    FromProtocol(&monster->_pos, m.pos());
-    monster->_size = m.size();
-
-    FromProtocol(&state->_curState._acc, m.acc());
-    FromProtocol(&state->_curState._vel, m.vel());
-    FromProtocol(&state->_curState._pos, m.pos());
-    state->_prevState = state->_curState;
-
-    monster++;
-    state++;
-  }
+  _pendingInputs.clear();
+  _swarm.Clear();
+  _lockstepMode = msg.lockstep();
+  _lockstep.Clear(msg.swarm_state().tick());
+  _monsterSnapshots.Clear();
+  _playerSnapshots.Clear();
+  _aggregateSnapshots.Clear();
+  _hasServerTime = false;
+  HandlePlayerState(playerState);
+  HandleSwarmState(msg.swarm_state());
   return true;
 }
 
@@ -532,36 +555,109 @@ void Game::HandlePlayerLeft(const game::PlayerLeft& msg)
 //----------------------------------------------------------------------------------
 void Game::HandlePlayerState(const game::PlayerState& msg)
 {
-  //LOG_INFO(__FUNCTION__ << LogKeyValue("num_players", msg.player_size()));
+  FromProtocol(&_localPlayerState, msg);
+  HandlePlayerState(_localPlayerState);
+}
 
-  for (int i = 0; i < msg.player_size(); ++i)
+//----------------------------------------------------------------------------------
+void Game::HandlePlayerState(const wire::PlayerState& msg)
+{
+  //LOG_INFO(__FUNCTION__ << LogKeyValue("num_players", msg.players.size()));
+
+  for (const wire::Player& player : msg.players)
   {
-    const game::Player& player = msg.player(i);
-    u32 id = player.id();
+    u32 id = player.id;
 
     // Don't update position of local player..
-    if (player.id() != _playerId)
+    if (player.id != _playerId)
     {
       RenderPlayer& remotePlayer = _remotePlayers[id];
 
-      remotePlayer._id = player.id();
-      remotePlayer._health = player.health();
-
-      FromProtocol(&remotePlayer._state._acc, player.acc());
-      FromProtocol(&remotePlayer._state._vel, player.vel());
-      FromProtocol(&remotePlayer._state._pos, player.pos());
+      remotePlayer._id = player.id;
+      remotePlayer._health = player.health;
+      remotePlayer._pos = player.pos;
     }
     else
     {
-      _localPlayer._health = player.health();
+      _localPlayer._health = player.health;
+      ReconcileLocalPlayer(player);
     }
   }
+
+  UpdateServerClock(msg.serverTime);
+  AddPlayerSnapshot(msg);
 }
 
 //----------------------------------------------------------------------------------
-void Game::HandleMonsterDied(const game::MonsterDied& msg)
+void Game::SendInputs()
+{
+  // send the newest unacked inputs, so every input goes out several times
+  // and a lost message is covered by the next one
+  _sendInputs.clear();
+  size_t first = _pendingInputs.size() - min<size_t>(_pendingInputs.size(), INPUT_REDUNDANCY);
+  for (size_t i = first; i < _pendingInputs.size(); ++i)
+  {
+    wire::PlayerInput input;
+    input.seq = _pendingInputs[i].seq;
+    input.acc = _pendingInputs[i].acc;
+    _sendInputs.push_back(input);
+  }
+
+  _connection.SendInputs(_sendInputs.data(), _sendInputs.size());
+}
+
+//----------------------------------------------------------------------------------
+void Game::ReconcileLocalPlayer(const wire::Player& player)
+{
+  // drop the inputs the server has applied
+  while (!_pendingInputs.empty() && _pendingInputs.front().seq <= player.lastInputSeq)
+    _pendingInputs.pop_front();
+
+  // start from the authoritative state, and replay the inputs the server
+  // hasn't seen yet on top of it
+  PhysicsState state;
+  state._vel = player.vel;
+  state._pos = player.pos;
+  for (const PendingInput& input : _pendingInputs)
+  {
+    state._acc = input.acc;
+    UpdateState(_level, PLAYER_FRICTION, TIMESTEP, &state);
+  }
+
+  state._acc = _localPlayer._state._acc;
+  _localPlayer._state = state;
+}
+
+//----------------------------------------------------------------------------------
+void Game::AddPlayerSnapshot(const wire::PlayerState& msg)
 {
+  vector<RenderPlayer>* players = _playerSnapshots.AddSnapshot(msg.tick, msg.serverTime);
+  if (!players)
+    return;
+
+  for (const wire::Player& player : msg.players)
+  {
+    if (player.id == _playerId)
+      continue;
 
+    RenderPlayer p;
+    p._id = player.id;
+    p._health = player.health;
+    p._pos = player.pos;
+    players->push_back(p);
+  }
+
+  auto byId = [](const RenderPlayer& a, const RenderPlayer& b) { return a._id < b._id; };
+  if (!std::is_sorted(players->begin(), players->end(), byId))
+    std::sort(players->begin(), players->end(), byId);
+}
+
+//----------------------------------------------------------------------------------
+void Game::HandleMonsterDied(const game::MonsterDied& msg)
+{
+  // the lockstep frames remove the monsters at the right tick
+  if (!_lockstepMode)
+    _swarm.Remove(msg);
 }
 
 //----------------------------------------------------------------------------------
@@ -580,146 +676,176 @@ void Game::HandleGameEnded(const game::GameEnded& msg)
 //----------------------------------------------------------------------------------
 void Game::HandleSwarmState(const game::SwarmState& msg)
 {
-  if (_renderMonsters.size() != msg.monster_size())
-  {
-    _renderMonsters.resize(msg.monster_size());
-    _monsterState.resize(msg.monster_size());
-  }
+  FromProtocol(&_localSwarmState, msg);
+  HandleSwarmState(_localSwarmState);
+}
 
-  RenderMonster* monster = _renderMonsters.data();
-  MonsterState* state = _monsterState.data();
-  for (int i = 0; i < msg.monster_size(); ++i)
-  {
-    const game::Monster& m = msg.monster(i);
-    FromProtocol(&monster->_pos, m.pos());
-    monster->_size = m.size();
+//----------------------------------------------------------------------------------
+void Game::HandleSwarmState(const wire::SwarmState& msg)
+{
+  // the chunks of the initial state are all from the join, so they'd only
+  // drag the clock back
+  if (!msg.hasNumChunks)
+    UpdateServerClock(msg.serverTime);
+
+  // in lockstep mode, the only swarm states are the one the client starts
+  // from, and it can't miss any of them
+  if (_lockstepMode)
+    _lockstep.Add(msg);
+  AddSwarmSnapshot(msg);
+}
 
-    FromProtocol(&state->_curState._acc, m.acc());
-    FromProtocol(&state->_curState._vel, m.vel());
-    FromProtocol(&state->_curState._pos, m.pos());
-    state->_prevState = state->_curState;
+//----------------------------------------------------------------------------------
+void Game::HandleLockstepFrames(const game::LockstepFrames& msg)
+{
+  if (!_lockstepMode)
+    return;
 
-    monster++;
-    state++;
+  if (!_lockstep.Advance(_level, msg))
+  {
+    // start over from a fresh state
+    ++_numDesyncs;
+    LOG_WARN("Lockstep swarm out of sync" << LogKeyValue("tick", _lockstep.GetTick()) << LogKeyValue("count", _numDesyncs));
+    _connection.Reconnect();
+    return;
   }
+
+  UpdateServerClock(msg.server_time());
+  vector<RenderMonster>* monsters = _monsterSnapshots.AddSnapshot(msg.tick(), msg.server_time());
+  if (monsters)
+    FillRenderMonsters(monsters);
 }
 
 //----------------------------------------------------------------------------------
-void Game::UpdateState(PhysicsState& state, float dt)
+void Game::AddSwarmSnapshot(const wire::SwarmState& msg)
 {
-  // Velocity Verlet integration
-  float friction = 0.99f;
-  float scale = _level._scale;
-  Vector2f oldVel = state._vel;
-  Vector2f p = state._pos;
-  Vector2f v = friction * (state._vel + state._acc * dt);
+  // the initial state streams in as chunks of the same snapshot, which is
+  // rendered as soon as the first one is in
+  vector<RenderMonster>* monsters = _monsterSnapshots.AddSnapshot(msg.tick, msg.serverTime);
+  if (!monsters && msg.hasNumChunks)
+    monsters = _monsterSnapshots.GetNewestSnapshot(msg.tick);
+  if (!monsters)
+    return;
 
-  Vector2f newPos = state._pos + (oldVel + state._vel) * 0.5f * dt;
+  // the state only has the monsters that changed, so fill in the rest
+  if (!_lockstepMode)
+    _swarm.Apply(_level, msg);
 
-  u8 b;
-  // check horizontal collisions
-  if (!(_level.PosToBackground(1/scale * (p + dt * Vector2f(v.x, 0)), &b) && b == 0))
-  {
-    newPos.x = p.x;
-    v.x = -v.x;
-  }
+  FillRenderMonsters(monsters);
 
-  // check vertical
-  if (!(_level.PosToBackground(1/scale * (p + dt * Vector2f(0, v.y)), &b) && b == 0))
+  // every delta has all the aggregates, so they're a snapshot of their own
+  vector<RenderAggregate>* aggregates = msg.hasNumChunks ? nullptr : _aggregateSnapshots.AddSnapshot(msg.tick, msg.serverTime);
+  if (aggregates)
   {
-    newPos.y = p.y;
-    v.y = -v.y;
+    aggregates->resize(msg.aggregates.size());
+    for (size_t i = 0; i < msg.aggregates.size(); ++i)
+    {
+      const wire::Aggregate& a = msg.aggregates[i];
+      RenderAggregate& aggregate = (*aggregates)[i];
+      aggregate._id = a.id;
+      aggregate._pos = a.pos;
+      aggregate._extent = a.extent;
+      aggregate._count = a.count;
+    }
   }
-
-  state._vel = v;
-  state._pos = newPos;
 }
 
 //----------------------------------------------------------------------------------
-void Game::ProcessNetworkPackets()
+void Game::FillRenderMonsters(vector<RenderMonster>* monsters) const
 {
-  static char buf[64*1024];
-
-  size_t bytesReceived = 0;
-  Socket::Status status = _socket.receive(buf, sizeof(buf), bytesReceived);
-  if (status == Socket::Done)
+  if (_lockstepMode)
   {
-    //LOG_INFO("received from server" << LogKeyValue("num_bytes", bytesReceived));
-    char *ptr = buf;
-    while (ptr < buf + bytesReceived)
+    const vector<LockstepSwarm::Monster>& swarm = _lockstep.GetMonsters();
+    monsters->resize(swarm.size());
+    for (size_t i = 0; i < swarm.size(); ++i)
     {
-      u32 msgSize = ntohl(*(u32*)ptr);
-      // break if this message isn't complete
-      if (ptr + msgSize >= buf + bytesReceived)
-        break;
-
-      ptr += sizeof(u32);
-      game::ServerMessage msg;
-      if (msg.ParseFromArray(ptr, msgSize))
-      {
-        ptr += msgSize;
-        switch (msg.type())
-        {
-          case game::ServerMessage_Type_GAME_STARTED:
-            HandleGameStarted(msg.game_started());
-            break;
+      RenderMonster& monster = (*monsters)[i];
+      monster._id = swarm[i].id;
+      monster._size = FixedToFloat(swarm[i].size);
+      monster._pos = FixedToFloat(swarm[i].state._pos);
+    }
+    return;
+  }
 
-          case game::ServerMessage_Type_PLAYER_JOINED:
-            HandlePlayerJoined(msg.player_joined());
-            break;
+  const vector<ReckonedSwarm::Monster>& swarm = _swarm.GetMonsters();
+  monsters->resize(swarm.size());
+  for (size_t i = 0; i < swarm.size(); ++i)
+  {
+    RenderMonster& monster = (*monsters)[i];
+    monster._id = swarm[i].id;
+    monster._size = swarm[i].size;
+    monster._pos = swarm[i].state._pos;
+  }
+}
 
-          case game::ServerMessage_Type_PLAYER_LEFT:
-            HandlePlayerLeft(msg.player_left());
-            break;
+//----------------------------------------------------------------------------------
+void Game::UpdateServerClock(double serverTime)
+{
+  // Only used until the pings have synced the clock. The snapshot that was
+  // delayed the least gives the best estimate of the server clock, so jump to
+  // any estimate that is ahead of the current one, but only drift slowly
+  // towards ones behind it to follow clock drift.
+  double offset = serverTime - _clock.getElapsedTime().asMicroseconds() / 1e6;
+  if (!_hasServerTime || offset > _serverTimeOffset)
+    _serverTimeOffset = offset;
+  else
+    _serverTimeOffset += 0.01 * (offset - _serverTimeOffset);
 
-          case game::ServerMessage_Type_SWARM_STATE:
-            HandleSwarmState(msg.swarm_state());
-            break;
+  _hasServerTime = true;
+}
 
-          case game::ServerMessage_Type_PLAYER_STATE:
-            HandlePlayerState(msg.player_state());
-            break;
+//----------------------------------------------------------------------------------
+double Game::GetServerTime() const
+{
+  if (_connection.GetClockSync().IsSynced())
+    return _connection.GetServerTime();
 
-          case game::ServerMessage_Type_GAME_ENDED:
-            HandleGameEnded(msg.game_ended());
-            break;
+  return _clock.getElapsedTime().asMicroseconds() / 1e6 + _serverTimeOffset;
+}
 
-          case game::ServerMessage_Type_PLAYER_DIED:
-            HandlePlayerDied(msg.player_died());
-            break;
+//----------------------------------------------------------------------------------
+double Game::GetRenderTime() const
+{
+  // the synced clock is the server's actual time, so the snapshots are also
+  // half a round trip old by the time they arrive. the snapshot estimate
+  // already has that delay baked in
+  const ClockSync& clockSync = _connection.GetClockSync();
+  if (clockSync.IsSynced())
+    return GetServerTime() - clockSync.GetRtt() / 2 - _renderDelay;
+
+  return GetServerTime() - _renderDelay;
+}
 
-          case game::ServerMessage_Type_MONSTER_DIED:
-            HandleMonsterDied(msg.monster_died());
-            break;
-        }
-      }
-      else
-      {
-        break;
-      }
-    }
+//----------------------------------------------------------------------------------
+void Game::ProcessNetworkPackets()
+{
+  if (_connection.ProcessMessages(this) || !_connection.HasSession())
+    return;
+
+  Time now = _clock.getElapsedTime();
+  if ((now - _lastReconnect).asMilliseconds() >= RECONNECT_INTERVAL_MS)
+  {
+    _lastReconnect = now;
+    _connection.Reconnect();
   }
 }
 
 //----------------------------------------------------------------------------------
 void Game::Run()
 {
-  Clock clock;
-  clock.restart();
-
   vector<char> buf(16 * 1024);
 
-  Time lastUpdate = clock.getElapsedTime();
-  Time lastSend = clock.getElapsedTime();
+  Time lastUpdate = _clock.getElapsedTime();
+  Time lastFrameTimeSwap = _clock.getElapsedTime();
 
   // rendering time adds to the accumulator, and the physics update
   // subtracts from it (using a fixed timestep)
-  double timestep = 1/50.0;
+  double timestep = TIMESTEP;
   double accumulator = 0;
 
   while (_renderWindow->isOpen() && !_done)
   {
-    Time start = clock.getElapsedTime();
+    Time start = _clock.getElapsedTime();
     _renderWindow->clear();
     _eventManager->Poll();
     _windowManager->Update();
@@ -740,78 +866,66 @@ void Game::Run()
         pos->set_x(_mainWindow->_clickPos.x);
         pos->set_y(_mainWindow->_clickPos.y);
         click->set_click_size(r);
+        // let the server evaluate the click against the monsters we're showing
+        click->set_render_tick((u32)max(0.0, GetRenderTime() / TIMESTEP + 0.5));
 
-        string str;
-        if (msg.SerializePartialToString(&str))
-        {
-          _socket.send(str.data(), str.size());
-        }
+        _connection.Send(msg);
       }
 
-      Time end = clock.getElapsedTime();
+      Time end = _clock.getElapsedTime();
       Time computeTime = end - start;
-      _frameTime.AddSample(computeTime.asMicroseconds());
+      _frameTime.Record(computeTime.asMicroseconds());
+      if ((end - lastFrameTimeSwap).asMilliseconds() > 1000)
+      {
+        // the debug window shows the frame times over the last second
+        _lastFrameTime = _frameTime;
+        _frameTime.Reset();
+        lastFrameTimeSwap = end;
+      }
       Time delta = end - lastUpdate;
       lastUpdate = end;
 
       UpdatePlayers();
 
       accumulator += delta.asMicroseconds() / 1e6;
+      bool newInput = false;
       while (accumulator >= timestep)
       {
-        // Update all the remote players
-        for (auto& kv : _remotePlayers)
-        {
-          RenderPlayer& player = kv.second;
-          player._prevState = player._state;
-          UpdateState(player._state, (float)timestep);
-        }
+        // Predict the local player, and keep the input around until the
+        // server has acknowledged it
+        PendingInput input;
+        input.seq = _nextInputSeq++;
+        input.acc = _localPlayer._state._acc;
+        _pendingInputs.push_back(input);
+        // if the server stops acking, don't let the replay grow without bound
+        if (_pendingInputs.size() > MAX_PENDING_INPUTS)
+          _pendingInputs.pop_front();
+        newInput = true;
 
-        // Update the local player
         _localPlayer._prevState = _localPlayer._state;
-        UpdateState(_localPlayer._state, (float)timestep);
-
-        for (MonsterState& state : _monsterState)
-        {
-          state._prevState = state._curState;
-          UpdateState(state._curState, (float)timestep);
-        }
-
+        UpdateState(_level, PLAYER_FRICTION, (float)timestep, &_localPlayer._state);
         accumulator -= timestep;
       }
 
+      if (newInput)
+        SendInputs();
+
       // Do the lerp approximation step
       float alpha = (float)(accumulator / timestep);
-
-      for (auto& kv : _remotePlayers)
-      {
-        RenderPlayer& player = kv.second;
-        player._pos = lerp(player._prevState._pos, player._state._pos, alpha);
-      }
-
       _localPlayer._pos = lerp(_localPlayer._prevState._pos, _localPlayer._state._pos, alpha);
 
-
-      for (size_t i = 0; i < _monsterState.size(); ++i)
+      // Monsters and remote players are interpolated from the server snapshots
+      double renderTime = GetRenderTime();
+      _monsterSnapshots.Interpolate(renderTime, &_renderMonsters);
+      _aggregateSnapshots.Interpolate(renderTime, &_renderAggregates);
+      _playerSnapshots.Interpolate(renderTime, &_interpolatedPlayers);
+      for (const RenderPlayer& player : _interpolatedPlayers)
       {
-        MonsterState& state = _monsterState[i];
-        _renderMonsters[i]._pos = lerp(state._prevState._pos, state._curState._pos, alpha);
+        auto it = _remotePlayers.find(player._id);
+        if (it != _remotePlayers.end())
+          it->second._pos = player._pos;
       }
 
-      if ((end - lastSend).asMilliseconds() > 100)
-      {
-        // send player state
-        game::PlayerMessage msg;
-        msg.set_type(game::PlayerMessage_Type_PLAYER_POS);
-        ToProtocol(msg.mutable_pos(), _localPlayer._state._pos);
-
-        string str;
-        if (msg.SerializePartialToString(&str))
-        {
-          _socket.send(str.data(), str.size());
-        }
-        lastSend = end;
-      }
     }
     else
     {
@@ -1,7 +1,11 @@
 #pragma once
 #include "virtual_window.hpp"
-#include "rolling_average.hpp"
+#include "histogram.hpp"
 #include "swarm_server.hpp"
+#include "server_connection.hpp"
+#include "snapshot_buffer.hpp"
+#include "dead_reckoning.hpp"
+#include "lockstep.hpp"
 #include "world.hpp"
 
 namespace swarm
@@ -21,6 +25,14 @@ namespace swarm
     class GameStarted;
   }
 
+  // An input the local player has been predicted with, but the server hasn't
+  // acknowledged yet
+  struct PendingInput
+  {
+    u32 seq;
+    Vector2f acc;
+  };
+
   struct LocalPlayer
   {
     PhysicsState _state;
@@ -43,6 +55,7 @@ namespace swarm
     ptime _clickStart;
     CircleShape _playerCircle;
     CircleShape _monsterCircle;
+    CircleShape _aggregateCircle;
     CircleShape _selectionCircle;
 
     vector<RectangleShape> _textureRects;
@@ -68,21 +81,28 @@ namespace swarm
 
   struct RenderPlayer
   {
-    PhysicsState _prevState;
-    PhysicsState _state;
     Vector2f _pos;
-    int _id;
+    u32 _id;
     int _health;
-    float _size;
   };
 
   struct RenderMonster
   {
     Vector2f _pos;
+    u32 _id;
     float _size;
   };
 
-  class Game
+  // A clump of far monsters the server only sends a summary of
+  struct RenderAggregate
+  {
+    Vector2f _pos;
+    u32 _id;
+    float _extent;
+    u32 _count;
+  };
+
+  class Game : public ServerMessageHandler
   {
     friend class MainWindow;
     friend class PlayerWindow;
@@ -107,16 +127,29 @@ namespace swarm
     bool OnGainedFocus(const Event& event);
 
     void UpdatePlayers();
-    void UpdateState(PhysicsState& state, float dt);
-
-    void HandlePlayerJoined(const game::PlayerJoined& msg);
-    void HandlePlayerLeft(const game::PlayerLeft& msg);
-    void HandleSwarmState(const game::SwarmState& msg);
-    void HandlePlayerState(const game::PlayerState& msg);
-    bool HandleGameStarted(const game::GameStarted& msg);
-    void HandleGameEnded(const game::GameEnded& msg);
-    void HandleMonsterDied(const game::MonsterDied& msg);
-    void HandlePlayerDied(const game::PlayerDied& msg);
+    void SendInputs();
+    void ReconcileLocalPlayer(const wire::Player& player);
+
+    void UpdateServerClock(double serverTime);
+    // the synced server clock, or the estimate from the snapshots until the
+    // pings have synced it
+    double GetServerTime() const;
+    double GetRenderTime() const;
+    void AddSwarmSnapshot(const wire::SwarmState& msg);
+    void FillRenderMonsters(vector<RenderMonster>* monsters) const;
+    void AddPlayerSnapshot(const wire::PlayerState& msg);
+
+    virtual void HandlePlayerJoined(const game::PlayerJoined& msg);
+    virtual void HandlePlayerLeft(const game::PlayerLeft& msg);
+    virtual void HandleSwarmState(const game::SwarmState& msg);
+    virtual void HandleSwarmState(const wire::SwarmState& msg);
+    virtual void HandlePlayerState(const game::PlayerState& msg);
+    virtual void HandlePlayerState(const wire::PlayerState& msg);
+    virtual bool HandleGameStarted(const game::GameStarted& msg);
+    virtual void HandleGameEnded(const game::GameEnded& msg);
+    virtual void HandleMonsterDied(const game::MonsterDied& msg);
+    virtual void HandlePlayerDied(const game::PlayerDied& msg);
+    virtual void HandleLockstepFrames(const game::LockstepFrames& msg);
 
     bool _gameStarted;
     bool _gameEnded;
@@ -126,24 +159,47 @@ namespace swarm
 
     unordered_map<u32, RenderPlayer> _remotePlayers;
     LocalPlayer _localPlayer;
-
+    deque<PendingInput> _pendingInputs;
+    vector<wire::PlayerInput> _sendInputs;
+    u32 _nextInputSeq;
+
+    // monsters and remote players are rendered by interpolating between
+    // buffered snapshots, _renderDelay behind the estimated server time
+    ReckonedSwarm _swarm;
+    // in lockstep mode the swarm is simulated here instead
+    LockstepSwarm _lockstep;
+    bool _lockstepMode;
+    u32 _numDesyncs;
+    SnapshotBuffer<RenderMonster> _monsterSnapshots;
+    SnapshotBuffer<RenderPlayer> _playerSnapshots;
+    SnapshotBuffer<RenderAggregate> _aggregateSnapshots;
     vector<RenderMonster> _renderMonsters;
+    vector<RenderAggregate> _renderAggregates;
+    vector<RenderPlayer> _interpolatedPlayers;
+    // the states from a local server, converted
+    wire::SwarmState _localSwarmState;
+    wire::PlayerState _localPlayerState;
+    Clock _clock;
+    double _serverTimeOffset;
+    bool _hasServerTime;
+    double _renderDelay;
+
     unique_ptr<RenderWindow> _renderWindow;
     unique_ptr<WindowEventManager> _eventManager;
     unique_ptr<VirtualWindowManager> _windowManager;
-    RollingAverage<s64> _frameTime;
+    Histogram<> _frameTime;
+    Histogram<> _lastFrameTime;
     Font _font;
 
     Vector2f _mousePos;
 
-    vector<MonsterState> _monsterState;
-
     Level _level;
     MainWindow* _mainWindow;
     PlayerWindow* _playerWindow;
     DebugWindow* _debugWindow;
 
-    TcpSocket _socket;
+    ServerConnection _connection;
+    Time _lastReconnect;
     Server _server;
     time_duration _clickDuration;
     bool _sendClick;
@@ -0,0 +1,188 @@
+#include "swarm_compression.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  // a corrupt count mustn't make the decoder allocate without bound
+  const u32 MAX_COMPRESSED_MONSTERS = 1 << 22;
+
+  // the spatial order's grid, in position steps
+  const int SPATIAL_CELL_SHIFT = 6;
+
+  struct Models
+  {
+    IntModel count;
+    IntModel id;
+    IntModel pos[2];
+    IntModel vel[2];
+    IntModel size;
+  };
+
+  s32 Quantize(float v, float step)
+  {
+    return (s32)floor((double)v / step + 0.5);
+  }
+
+  //-----------------------------------------------------------------------------
+  u32 SpreadBits(u32 v)
+  {
+    v &= 0xffff;
+    v = (v | (v << 8)) & 0x00ff00ff;
+    v = (v | (v << 4)) & 0x0f0f0f0f;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+  }
+
+  //-----------------------------------------------------------------------------
+  u32 SpatialKey(s32 x, s32 y)
+  {
+    u32 cx = (u32)Clamp((x >> SPATIAL_CELL_SHIFT) + 0x8000, 0, 0xffff);
+    u32 cy = (u32)Clamp((y >> SPATIAL_CELL_SHIFT) + 0x8000, 0, 0xffff);
+    return SpreadBits(cx) | (SpreadBits(cy) << 1);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void swarm::QuantizeMonster(wire::Monster* monster)
+{
+  monster->pos.x = Quantize(monster->pos.x, COMPRESSED_POS_STEP) * COMPRESSED_POS_STEP;
+  monster->pos.y = Quantize(monster->pos.y, COMPRESSED_POS_STEP) * COMPRESSED_POS_STEP;
+  monster->vel.x = Quantize(monster->vel.x, COMPRESSED_VEL_STEP) * COMPRESSED_VEL_STEP;
+  monster->vel.y = Quantize(monster->vel.y, COMPRESSED_VEL_STEP) * COMPRESSED_VEL_STEP;
+  monster->size = Quantize(monster->size, COMPRESSED_SIZE_STEP) * COMPRESSED_SIZE_STEP;
+}
+
+//-----------------------------------------------------------------------------
+void SwarmCompressor::Compress(const vector<wire::Monster>& monsters, MonsterOrder order, vector<char>* out)
+{
+  _quantized.resize(monsters.size());
+  for (size_t i = 0; i < monsters.size(); ++i)
+  {
+    const wire::Monster& m = monsters[i];
+    Quantized& q = _quantized[i];
+    q.id = m.id;
+    q.pos[0] = Quantize(m.pos.x, COMPRESSED_POS_STEP);
+    q.pos[1] = Quantize(m.pos.y, COMPRESSED_POS_STEP);
+    q.vel[0] = Quantize(m.vel.x, COMPRESSED_VEL_STEP);
+    q.vel[1] = Quantize(m.vel.y, COMPRESSED_VEL_STEP);
+    q.size = Quantize(m.size, COMPRESSED_SIZE_STEP);
+    q.key = order == MONSTER_ORDER_SPATIAL ? SpatialKey(q.pos[0], q.pos[1]) : 0;
+  }
+
+  // the ids are only increasing in id order, so they're coded as gaps there
+  if (order == MONSTER_ORDER_SPATIAL)
+  {
+    std::sort(_quantized.begin(), _quantized.end(),
+        [](const Quantized& a, const Quantized& b) { return a.key < b.key || (a.key == b.key && a.id < b.id); });
+  }
+
+  out->push_back((char)order);
+  Models models;
+  RangeEncoder encoder(out);
+  encoder.EncodeUInt(&models.count, (u32)_quantized.size());
+
+  Quantized prev = {};
+  prev.id = ~0u;
+  for (const Quantized& q : _quantized)
+  {
+    if (order == MONSTER_ORDER_SPATIAL)
+      encoder.EncodeSInt(&models.id, (s32)(q.id - prev.id));
+    else
+      encoder.EncodeUInt(&models.id, q.id - prev.id - 1);
+
+    for (int i = 0; i < 2; ++i)
+      encoder.EncodeSInt(&models.pos[i], q.pos[i] - prev.pos[i]);
+    for (int i = 0; i < 2; ++i)
+      encoder.EncodeSInt(&models.vel[i], q.vel[i] - prev.vel[i]);
+    encoder.EncodeSInt(&models.size, q.size - prev.size);
+    prev = q;
+  }
+
+  encoder.Flush();
+}
+
+//-----------------------------------------------------------------------------
+void SwarmCompressor::EncodeSwarmState(vector<char>* buf, const wire::SwarmState& state, MonsterOrder order)
+{
+  _packed.clear();
+  Compress(state.monsters, order, &_packed);
+
+  buf->clear();
+  wire::Writer w(buf);
+  w.BeginFrame();
+  w.WriteVarint(game::ServerMessage::kTypeFieldNumber, game::ServerMessage_Type_SWARM_STATE);
+  w.BeginNested(game::ServerMessage::kSwarmStateFieldNumber);
+  w.WriteVarint(game::SwarmState::kTickFieldNumber, state.tick);
+  w.WriteDouble(game::SwarmState::kServerTimeFieldNumber, state.serverTime);
+  if (state.full)
+    w.WriteVarint(game::SwarmState::kFullFieldNumber, 1);
+  for (u32 id : state.removedIds)
+    w.WriteVarint(game::SwarmState::kRemovedIdFieldNumber, id);
+  w.WriteBytes(game::SwarmState::kPackedMonstersFieldNumber, _packed.data(), _packed.size());
+  for (const wire::Aggregate& a : state.aggregates)
+    w.WriteAggregate(game::SwarmState::kAggregateFieldNumber, a);
+  w.End();
+  w.End();
+}
+
+//-----------------------------------------------------------------------------
+bool swarm::DecompressMonsters(const char* data, size_t size, vector<wire::Monster>* monsters)
+{
+  if (size < 1)
+    return false;
+
+  MonsterOrder order = (MonsterOrder)data[0];
+  if (order != MONSTER_ORDER_ID && order != MONSTER_ORDER_SPATIAL)
+    return false;
+
+  Models models;
+  RangeDecoder decoder(data + 1, size - 1);
+  u32 count = decoder.DecodeUInt(&models.count);
+  if (decoder.IsCorrupt() || count > MAX_COMPRESSED_MONSTERS)
+    return false;
+
+  size_t first = monsters->size();
+  monsters->resize(first + count);
+
+  u32 id = ~0u;
+  s32 pos[2] = { 0, 0 };
+  s32 vel[2] = { 0, 0 };
+  s32 monsterSize = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    if (order == MONSTER_ORDER_SPATIAL)
+      id += (u32)decoder.DecodeSInt(&models.id);
+    else
+      id += decoder.DecodeUInt(&models.id) + 1;
+
+    for (int j = 0; j < 2; ++j)
+      pos[j] += decoder.DecodeSInt(&models.pos[j]);
+    for (int j = 0; j < 2; ++j)
+      vel[j] += decoder.DecodeSInt(&models.vel[j]);
+    monsterSize += decoder.DecodeSInt(&models.size);
+
+    // running out of data means the count was off, so stop before it runs on
+    if (decoder.IsCorrupt())
+    {
+      monsters->resize(first);
+      return false;
+    }
+
+    wire::Monster& m = (*monsters)[first + i];
+    m.id = id;
+    m.pos = Vector2f(pos[0] * COMPRESSED_POS_STEP, pos[1] * COMPRESSED_POS_STEP);
+    m.vel = Vector2f(vel[0] * COMPRESSED_VEL_STEP, vel[1] * COMPRESSED_VEL_STEP);
+    m.size = monsterSize * COMPRESSED_SIZE_STEP;
+    m.hasFixedState = false;
+  }
+
+  if (order == MONSTER_ORDER_SPATIAL)
+  {
+    std::sort(monsters->begin() + first, monsters->end(),
+        [](const wire::Monster& a, const wire::Monster& b) { return a.id < b.id; });
+  }
+
+  return true;
+}
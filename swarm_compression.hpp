@@ -0,0 +1,56 @@
+#pragma once
+#include "wire_codec.hpp"
+#include "range_coder.hpp"
+
+namespace swarm
+{
+  // The monsters are rounded to these steps, in world units. That's well
+  // inside the dead reckoning tolerance, and the server keeps track of the
+  // rounded state as the one the client has.
+  const float COMPRESSED_POS_STEP = 1 / 64.0f;
+  const float COMPRESSED_VEL_STEP = 1 / 64.0f;
+  const float COMPRESSED_SIZE_STEP = 1 / 256.0f;
+
+  enum MonsterOrder
+  {
+    // in id order, where the monsters of a swarm are next to each other as
+    // they were spawned together
+    MONSTER_ORDER_ID = 0,
+    // along a z-order curve through the positions
+    MONSTER_ORDER_SPATIAL = 1,
+  };
+
+  // Rounds a monster to what survives compression
+  void QuantizeMonster(wire::Monster* monster);
+
+  //-----------------------------------------------------------------------------
+  // Compresses the monsters of a swarm state for SwarmState.packed_monsters.
+  // Each monster is predicted from the one before it, and the differences are
+  // range coded with adaptive models, so neighbours that are alike cost a few
+  // bits. The fixed point lockstep state isn't included.
+  class SwarmCompressor
+  {
+  public:
+    // Appends the compressed monsters, which must be sorted by id
+    void Compress(const vector<wire::Monster>& monsters, MonsterOrder order, vector<char>* out);
+
+    // Like wire::EncodeSwarmState, but with the monsters packed
+    void EncodeSwarmState(vector<char>* buf, const wire::SwarmState& state, MonsterOrder order);
+
+  private:
+    struct Quantized
+    {
+      u32 id;
+      s32 pos[2];
+      s32 vel[2];
+      s32 size;
+      u32 key;
+    };
+
+    vector<Quantized> _quantized;
+    vector<char> _packed;
+  };
+
+  // Appends the monsters, sorted by id. Returns false if the data is corrupt.
+  bool DecompressMonsters(const char* data, size_t size, vector<wire::Monster>* monsters);
+}
@@ -1,23 +1,58 @@
 #include "swarm_server.hpp"
 #include "error.hpp"
 #include "protocol.hpp"
+#include <random>
 
 using namespace swarm;
 
 namespace
 {
-  //-----------------------------------------------------------------------------
-  pair<u32, u16> KeyFromSocket(const TcpSocket* socket)
-  {
-    return make_pair(socket->getRemoteAddress().toInteger(), socket->getRemotePort());
-  }
+  // max inputs buffered per player, ie how far ahead of the server a client
+  // can get before its oldest inputs are dropped
+  const size_t MAX_QUEUED_INPUTS = 10;
+
+  // monsters this close to a player get up to twice the priority of far ones
+  const float PRIORITY_NEAR_DISTANCE = 100;
+
+  // how many snapshots worth of unused bandwidth a client can save up
+  const float MAX_BUDGET_SNAPSHOTS = 2;
+
+  // rough size of a monster in a swarm state, used to fill the budget until
+  // a client's states show what they really cost
+  const float MONSTER_BYTES_ESTIMATE = 38;
+
+  // weight of the latest swarm state in a client's bytes per monster
+  const float BYTES_PER_MONSTER_WEIGHT = 0.2f;
+
+  // an aggregated monster is sent on its own again once it's within the
+  // aggregate distance, but only aggregated once it's this much further out,
+  // so monsters on the edge don't flip every snapshot
+  const float AGGREGATE_HYSTERESIS = 1.1f;
+
+  // swarm states sent over udp that are remembered, in case they're lost
+  const size_t UDP_SENT_HISTORY = 64;
+
+  // messages sent over udp without an ack before a client is moved back to
+  // tcp, as its datagrams get to the server, but the server's don't get back
+  const u32 UDP_FALLBACK_MESSAGES = 40;
+
+  // a client whose socket falls this far behind is dropped
+  const size_t MAX_PENDING_BYTES = 4 * 1024 * 1024;
 }
 
 //-----------------------------------------------------------------------------
 Server::Server()
-  : _serverThread(nullptr)
+  : _deathsLoggedAfter(0)
+  , _clusterTick(0)
+  , _profiler(milliseconds(20), seconds(5))
+  , _serverThread(nullptr)
   , _done(false)
   , _nextPlayerId(1)
+  , _nextConnectionId(1)
+  , _nextMonsterId(1)
+  , _tick(0)
+  , _simTime(0)
+  , _accumulator(0)
   , _gameStarted(false)
 {
 }
@@ -26,74 +61,479 @@ Server::Server()
 Server::~Server()
 {
   delete exch_null(_serverThread);
+  SeqDelete(&_pendingClients);
   SeqDelete(&_connectedClients);
 }
 
+//-----------------------------------------------------------------------------
+Server::ClientConnection::ClientConnection(TcpSocket* socket, u32 playerId)
+  : socket(socket)
+  , playerId(playerId)
+  , udpReady(false)
+  , udpFailed(false)
+  , rttMs(0)
+  , chunksToSend(0)
+  , chunkBudget(0)
+  , streaming(false)
+  , disconnected(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+Server::ClientConnection::~ClientConnection()
+{
+  delete exch_null(socket);
+  if (local)
+    local->Close();
+}
+
 //-----------------------------------------------------------------------------
 void Server::HandleClientMessages()
 {
-  for (TcpSocket* socket : _connectedClients)
+  for (ClientConnection* client : _connectedClients)
   {
+    if (client->local)
+    {
+      PlayerMessagePtr playerMsg;
+      while (client->local->ReceiveFromClient(&playerMsg))
+        HandlePlayerMessage(client, *playerMsg, false);
+
+      if (client->local->IsClosed())
+        client->disconnected = true;
+      continue;
+    }
+
     size_t receivedBytes = 0;
-    Socket::Status status = socket->receive(_networkBuffer, sizeof(_networkBuffer), receivedBytes);
-    if (status == Socket::Done)
+    Socket::Status status = client->reader.Receive(client->socket, &receivedBytes);
+    if (status == Socket::Disconnected || status == Socket::Error)
+    {
+      client->disconnected = true;
+      continue;
+    }
+
+    u32 id = client->playerId;
+    const char* data;
+    u32 size;
+    while (client->reader.NextMessage(&data, &size))
     {
+      // inputs are most of what the clients send, so they skip protobuf
+      if (wire::DecodePlayerInputs(data, size, &_decodedInputs))
+      {
+        HandlePlayerInputs(client, _decodedInputs);
+        continue;
+      }
+
       game::PlayerMessage playerMsg;
-      if (playerMsg.ParseFromArray(_networkBuffer, receivedBytes))
+      if (!playerMsg.ParseFromArray(data, size))
+        continue;
+
+      LOG_DEBUG("Client message"
+          << LogKeyValue("id", id)
+          << LogKeyValue("type", playerMsg.type())
+          << LogKeyValue("size", size));
+
+      HandlePlayerMessage(client, playerMsg, false);
+    }
+
+    if (client->reader.IsCorrupt())
+      client->disconnected = true;
+  }
+
+  HandleDatagrams();
+}
+
+//-----------------------------------------------------------------------------
+void Server::HandleDatagrams()
+{
+  char buf[MAX_DATAGRAM_SIZE];
+  UdpAddress from;
+  size_t size;
+  while (_udpSocket.ReceiveFrom(&from, buf, sizeof(buf), &size))
+  {
+    u32 token;
+    if (!UdpChannel::PeekToken(buf, size, &token))
+      continue;
+
+    ClientConnection* client = nullptr;
+    for (ClientConnection* c : _connectedClients)
+    {
+      if (c->udp.GetToken() == token && !c->disconnected)
       {
-        auto it = _addrToId.find(KeyFromSocket(socket));
-        if (it == _addrToId.end())
-        {
-          LOG_WARN("Unknown client");
-          continue;
-        }
+        client = c;
+        break;
+      }
+    }
 
-        int id = it->second;
-        switch (playerMsg.type())
-        {
-        case game::PlayerMessage_Type_PLAYER_POS:
-          _playerData[id].pos = Vector2f(playerMsg.pos().x(), playerMsg.pos().y());
-          break;
+    if (!client)
+      continue;
 
-        case game::PlayerMessage_Type_PLAYER_CLICK:
-          {
-            Vector2f pos(playerMsg.click().click_pos().x(), playerMsg.click().click_pos().y());
-            _attractors.push_back(MonsterAttractor(pos, playerMsg.click().click_size()));
-          }
-          break;
-        }
+    auto it = _playerData.find(client->playerId);
+    if (it == _playerData.end())
+      continue;
+
+    u8 stream;
+    const char* data;
+    size_t msgSize;
+    bool complete = client->udp.Receive(buf, size, &stream, &data, &msgSize);
+
+    // monsters in a lost swarm state are sent again
+    u16 lostSeq;
+    while (client->udp.PopLost(&lostSeq))
+      SwarmStateLost(&it->second.view, lostSeq);
+
+    if (!complete)
+      continue;
+
+    // only a datagram with a valid message proves the path works. the client
+    // might have moved to a new address, eg after a NAT rebinding
+    client->udpAddr = from;
+    client->udpReady = !client->udpFailed;
+
+    if (stream != UDP_STREAM_INPUT && stream != UDP_STREAM_CLOCK)
+      continue;
+
+    if (wire::DecodePlayerInputs(data, msgSize, &_decodedInputs))
+    {
+      HandlePlayerInputs(client, _decodedInputs);
+      continue;
+    }
+
+    game::PlayerMessage playerMsg;
+    if (playerMsg.ParseFromArray(data, (int)msgSize))
+      HandlePlayerMessage(client, playerMsg, true);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void Server::HandlePlayerMessage(ClientConnection* client, const game::PlayerMessage& msg, bool udp)
+{
+  u32 playerId = client->playerId;
+  switch (msg.type())
+  {
+  case game::PlayerMessage_Type_PLAYER_INPUT:
+    _decodedInputs.resize(msg.input_size());
+    for (int i = 0; i < msg.input_size(); ++i)
+      FromProtocol(&_decodedInputs[i], msg.input(i));
+    HandlePlayerInputs(client, _decodedInputs);
+    break;
+
+  case game::PlayerMessage_Type_PLAYER_CLICK:
+    {
+      if (_playerData[playerId].spectator)
+        break;
+
+      const game::PlayerClick& click = msg.click();
+      Vector2f pos(click.click_pos().x(), click.click_pos().y());
+      u32 tick = click.has_render_tick() ? click.render_tick() : _tick;
+      _attractors.push_back(MonsterAttractor(pos, click.click_size(), tick));
+    }
+    break;
+
+  case game::PlayerMessage_Type_PLAYER_PING:
+    HandlePing(client, msg.ping(), udp);
+    break;
+
+  case game::PlayerMessage_Type_PLAYER_HELLO:
+    // the hello is handled while the client is pending, so a repeated one
+    // is ignored
+    break;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void Server::HandlePlayerInputs(ClientConnection* client, const vector<wire::PlayerInput>& inputs)
+{
+  PlayerData& player = _playerData[client->playerId];
+  if (player.spectator)
+    return;
+
+  for (const wire::PlayerInput& input : inputs)
+    QueuePlayerInput(&player, input);
+}
+
+//-----------------------------------------------------------------------------
+void Server::HandlePing(ClientConnection* client, const game::Ping& ping, bool udp)
+{
+  if (ping.has_rtt_ms())
+    client->rttMs = ping.rtt_ms();
+
+  game::ServerMessage msg;
+  msg.set_type(game::ServerMessage_Type_PONG);
+  game::Pong* pong = msg.mutable_pong();
+  pong->set_seq(ping.seq());
+  pong->set_client_time(ping.client_time());
+  pong->set_server_receive_time(GetServerTime());
+
+  if (client->local)
+  {
+    pong->set_server_send_time(GetServerTime());
+    SendToLocal(make_shared<game::ServerMessage>(msg), client);
+    return;
+  }
+
+  // the pong is answered the way the ping came. it doesn't touch the swarm,
+  // so it doesn't wait for the initial state either
+  vector<char> buf;
+  pong->set_server_send_time(GetServerTime());
+  if (!PackMessage(buf, msg))
+    return;
+
+  if (!udp || !client->udpReady)
+  {
+    SendToSocket(buf, client);
+    return;
+  }
+
+  _udpSendBuf.clear();
+  _datagrams.clear();
+  if (client->udp.Write(UDP_STREAM_CLOCK, buf.data() + sizeof(u32), buf.size() - sizeof(u32),
+      client->udpAddr, &_udpSendBuf, &_datagrams, nullptr))
+  {
+    _udpSocket.SendBatch(_udpSendBuf, _datagrams);
+  }
+}
+
+//-----------------------------------------------------------------------------
+double Server::GetServerTime() const
+{
+  // the simulation runs behind real time by the part of a tick it hasn't
+  // simulated yet
+  if (!_gameStarted)
+    return _simTime;
+
+  return _simTime + _accumulator + (_clock.getElapsedTime() - _lastUpdate).asMicroseconds() / 1e6;
+}
+
+//-----------------------------------------------------------------------------
+u32 Server::NewUdpToken() const
+{
+  // the token is all that ties a datagram to a client, so make it hard to guess
+  static std::random_device rd;
+  while (true)
+  {
+    u32 token = rd();
+    bool used = token == 0;
+    for (const ClientConnection* client : _connectedClients)
+      used |= client->udp.GetToken() == token;
+
+    if (!used)
+      return token;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void Server::RemoveDisconnectedClients(const Time& now)
+{
+  for (auto it = _connectedClients.begin(); it != _connectedClients.end(); )
+  {
+    ClientConnection* client = *it;
+    if (!client->disconnected)
+    {
+      ++it;
+      continue;
+    }
+
+    // the player stays in the game until its session expires, unless it has
+    // already reconnected on a new connection
+    bool reconnected = false;
+    for (const ClientConnection* other : _connectedClients)
+      reconnected |= other != client && !other->disconnected && other->playerId == client->playerId;
+
+    auto playerIt = _playerData.find(client->playerId);
+    if (!reconnected && playerIt != _playerData.end())
+    {
+      PlayerData& player = playerIt->second;
+      player.connected = false;
+      player.disconnectTime = now;
+      player.inputs.clear();
+      player.state._acc = Vector2f(0, 0);
+    }
+
+    delete client;
+    it = _connectedClients.erase(it);
+  }
+
+  ExpireSessions(now);
+}
+
+//-----------------------------------------------------------------------------
+void Server::ExpireSessions(const Time& now)
+{
+  for (auto it = _playerData.begin(); it != _playerData.end(); )
+  {
+    const PlayerData& player = it->second;
+    if (player.connected || (now - player.disconnectTime).asMilliseconds() < (s32)_config.session_timeout_ms())
+    {
+      ++it;
+      continue;
+    }
+
+    LOG_INFO("Session expired" << LogKeyValue("id", player.id));
+    _sessions.erase(player.sessionToken);
+    it = _playerData.erase(it);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void Server::HandlePendingClients(const Time& now)
+{
+  // the first message from a client says whether it's resuming a session
+  for (auto it = _pendingClients.begin(); it != _pendingClients.end(); )
+  {
+    ClientConnection* client = *it;
+    bool failed;
+    game::PlayerHello hello;
+    bool received = false;
+    if (client->local)
+    {
+      PlayerMessagePtr playerMsg;
+      if (client->local->ReceiveFromClient(&playerMsg))
+      {
+        if (playerMsg->type() == game::PlayerMessage_Type_PLAYER_HELLO)
+          hello = playerMsg->hello();
+        received = true;
+      }
+      failed = client->local->IsClosed();
+    }
+    else
+    {
+      size_t receivedBytes = 0;
+      Socket::Status status = client->reader.Receive(client->socket, &receivedBytes);
+
+      const char* data;
+      u32 size;
+      if (client->reader.NextMessage(&data, &size))
+      {
+        game::PlayerMessage playerMsg;
+        if (playerMsg.ParseFromArray(data, size) && playerMsg.type() == game::PlayerMessage_Type_PLAYER_HELLO)
+          hello = playerMsg.hello();
+        received = true;
       }
+      failed = status == Socket::Disconnected || status == Socket::Error || client->reader.IsCorrupt();
+    }
 
+    if (received)
+    {
+      it = _pendingClients.erase(it);
+      PlayerAdded(client, hello);
+      continue;
+    }
+
+    bool timedOut = (now - client->connectTime).asMilliseconds() >= (s32)_config.hello_timeout_ms();
+    if (failed || timedOut)
+    {
+      delete client;
+      it = _pendingClients.erase(it);
+      continue;
     }
+
+    ++it;
+  }
+}
+
+//-----------------------------------------------------------------------------
+u32 Server::NumPlayingClients() const
+{
+  u32 count = 0;
+  for (const ClientConnection* client : _connectedClients)
+  {
+    auto it = _playerData.find(client->playerId);
+    if (it != _playerData.end() && !it->second.spectator)
+      ++count;
   }
+  return count;
+}
 
+//-----------------------------------------------------------------------------
+u64 Server::NewSessionToken() const
+{
+  static std::random_device rd;
+  while (true)
+  {
+    u64 token = (u64)rd() << 32 | rd();
+    if (token != 0 && _sessions.find(token) == _sessions.end())
+      return token;
+  }
 }
 
 //-----------------------------------------------------------------------------
-void Server::PlayerAdded(TcpSocket* socket)
+bool Server::ResumeSession(PlayerData* player, u32 lastTick)
 {
-  int initialHealth = _config.initial_health();
+  // the frames since the client's last tick are gone, so a lockstep client
+  // always starts over from a full state
+  if (_config.lockstep())
+    return false;
 
-  _connectedClients.push_back(socket);
+  // the client must have had a state from this session, and every monster
+  // that died since then must still be in the log
+  if (!player->sentStartGame || (s32)(lastTick - _tick) > 0 || (s32)(lastTick - _deathsLoggedAfter) <= 0)
+    return false;
 
-  // save the address to id mapping
-  auto key = KeyFromSocket(socket);
-  auto it = _addrToId.find(key);
-  bool newPlayer = it == _addrToId.end();
-  u32 id = newPlayer ? _nextPlayerId++ : it->second;
-  _addrToId[key] = id;
+  // whatever was sent after the last state the client applied was lost with
+  // the old connection
+  for (MonsterView& monster : player->view.monsters)
+  {
+    if ((s32)(monster.sentTick - lastTick) > 0)
+      monster.known = false;
+    // the client may have missed being told to drop them
+    monster.aggregated = false;
+  }
 
-  LOG_INFO((newPlayer ? "New player connected" : "Existing player connected")
-      << LogKeyValue("addr", socket->getRemoteAddress().toString())
-      << LogKeyValue("port", socket->getRemotePort())
-      << LogKeyValue("id", id));
+  // the seqs restart on the new udp channel
+  player->view.udpSent.clear();
+  player->resumeTick = lastTick;
+  player->resuming = true;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void Server::PlayerAdded(ClientConnection* client, const game::PlayerHello& hello)
+{
+  int initialHealth = _config.initial_health();
+
+  auto sessionIt = hello.has_session_token() ? _sessions.find(hello.session_token()) : _sessions.end();
+  bool newPlayer = sessionIt == _sessions.end();
+  u32 id = newPlayer ? _nextPlayerId++ : sessionIt->second;
+
+  client->playerId = id;
+  client->udp.Reset(NewUdpToken());
+  _connectedClients.push_back(client);
 
   PlayerData& player = _playerData[id];
-  player.id = id;
-  player.pos = _level.GetPlayerPos();
-  player.health = initialHealth;
+  bool resumed = false;
+  if (newPlayer)
+  {
+    player.id = id;
+    player.sessionToken = NewSessionToken();
+    _sessions[player.sessionToken] = id;
+    player.state._pos = _level.GetPlayerPos();
+    player.health = initialHealth;
+    player.spectator = hello.spectator();
+    player.alive = !player.spectator;
+  }
+  else
+  {
+    // the old connection might not have noticed it's dead yet
+    for (ClientConnection* other : _connectedClients)
+    {
+      if (other != client && other->playerId == id)
+        other->disconnected = true;
+    }
+
+    resumed = hello.has_last_tick() && ResumeSession(&player, hello.last_tick());
+    if (!resumed)
+      player.view = ClientView();
+  }
+
+  player.connected = true;
+  player.sentStartGame = false;
+
+  LOG_INFO((newPlayer ? "New player connected" : resumed ? "Player resumed session" : "Player rejoined session")
+      << LogKeyValue("addr", client->local ? "local" : client->socket->getRemoteAddress().toString())
+      << LogKeyValue("port", client->local ? 0 : client->socket->getRemotePort())
+      << LogKeyValue("id", id));
 
-  if (!_gameStarted && _connectedClients.size() < _config.min_players())
+  if (!_gameStarted && NumPlayingClients() < _config.min_players())
     return;
 
   _gameStarted = true;
@@ -103,48 +543,67 @@ void Server::PlayerAdded(TcpSocket* socket)
   game::GameStarted& msg = *serverMsg.mutable_game_started();
   msg.set_map_name(_config.map_name());
 
-  // add initial player state
-  game::PlayerState* playerState = msg.mutable_player_state();
-  for (auto it = _playerData.begin(); it != _playerData.end(); ++it)
-  {
-    const PlayerData& data = it->second;
-    game::Player* player = playerState->add_player();
-    player->set_id(it->first);
-    player->set_health(data.health);
-    ToProtocol(player->mutable_pos(), data.pos);
-  }
-
-  // add initial swarm state
-  game::SwarmState* swarmState = msg.mutable_swarm_state();
-
-  for (size_t i = 0; i < _monsterData.size(); ++i)
-  {
-    MonsterData& data = _monsterData[i];
-    MonsterState& state = data._state;
+  msg.set_snapshot_interval_ms(_config.snapshot_interval_ms());
+  msg.set_lockstep(_config.lockstep());
+  if (_udpSocket.IsOpen())
+    msg.set_udp_port(_udpSocket.GetPort());
 
-    game::Monster* m = swarmState->add_monster();
-    ToProtocol(m->mutable_acc(), state._curState._acc);
-    ToProtocol(m->mutable_vel(), state._curState._vel);
-    ToProtocol(m->mutable_pos(), state._curState._pos);
-    m->set_size(data._size);
-  }
+  // add initial player state
+  FillPlayerState(msg.mutable_player_state());
 
   // send game started to each player who hasn't already got it
-  for (TcpSocket* socket : _connectedClients)
+  for (ClientConnection* client : _connectedClients)
   {
-    auto key = KeyFromSocket(socket);
-    u32 id = _addrToId[key];
-    PlayerData& player = _playerData[id];
+    // a replaced connection shares the player with the new one
+    if (client->disconnected)
+      continue;
+
+    PlayerData& player = _playerData[client->playerId];
     if (!player.sentStartGame)
     {
       player.sentStartGame = true;
-      msg.set_player_id(id);
-      msg.set_health(initialHealth);
+      msg.set_player_id(client->playerId);
+      msg.set_health(player.health);
+      msg.set_session_token(player.sessionToken);
+      if (_udpSocket.IsOpen())
+        msg.set_udp_token(client->udp.GetToken());
+
+      // a resumed client only needs what changed since its last state.
+      // otherwise the empty full state resets what the client has, and the
+      // monsters follow in chunks
+      msg.clear_swarm_state();
+      msg.set_resumed(player.resuming);
+      game::SwarmState* state = msg.mutable_swarm_state();
+      if (player.resuming)
+      {
+        FillSwarmState(state, &player);
+        for (const MonsterDeath& death : _monsterDeaths)
+        {
+          if ((s32)(death.tick - player.resumeTick) >= 0)
+            state->add_removed_id(death.id);
+        }
+        msg.clear_initial_state_chunks();
+        player.resuming = false;
+      }
+      else
+      {
+        state->set_tick(_tick);
+        state->set_server_time(_simTime);
+        state->set_full(true);
+        msg.set_initial_state_chunks(QueueInitialState(client, &player, state));
+      }
+
+      if (client->local)
+      {
+        SendToLocal(make_shared<game::ServerMessage>(serverMsg), client);
+        continue;
+      }
 
       vector<char> buf;
       if (PackMessage(buf, serverMsg))
       {
-        SendToClient(buf, socket);
+        SendToSocket(buf, client);
+        AddBytesSent(&player, buf.size());
       }
     }
   }
@@ -156,367 +615,1316 @@ void Server::ThreadProc()
   TcpSocket *socket = new TcpSocket();
   socket->setBlocking(false);
 
-  Clock clock;
-  clock.restart();
-  Time lastUpdate = clock.getElapsedTime();
-  Time lastSend = lastUpdate;
-  Time lastCollisionCheck = lastUpdate;
-  double timestep = 1/50.0;
-  double accumulator = 0;
+  _clock.restart();
+  _lastUpdate = _clock.getElapsedTime();
+  Time lastSend = _lastUpdate;
+  Time lastCollisionCheck = _lastUpdate;
+  double timestep = TIMESTEP;
+  _accumulator = 0;
+
+  vector<char> playerStateBuf;
 
   while (!_done)
   {
-    // Check for connected players
-    Socket::Status status = _listener.accept(*socket);
-    if (status == Socket::Done)
+    _profiler.BeginTick();
+
     {
-      PlayerAdded(socket);
-      socket = new TcpSocket();
-      socket->setBlocking(false);
+      // Check for connected players
+      ScopedPhaseTimer timer(&_profiler, TickPhase::Accept);
+      Socket::Status status = _listener.accept(*socket);
+      if (status == Socket::Done)
+      {
+        ClientConnection* client = new ClientConnection(socket, 0);
+        client->connectionId = _nextConnectionId++;
+        client->connectTime = _clock.getElapsedTime();
+        _pendingClients.push_back(client);
+        socket = new TcpSocket();
+        socket->setBlocking(false);
+      }
+
+      AcceptLocalClients(_clock.getElapsedTime());
+      HandlePendingClients(_clock.getElapsedTime());
+      SendInitialStates(_clock.getElapsedTime());
+
+      for (ClientConnection* client : _connectedClients)
+        FlushSocket(client);
     }
 
     if (_gameStarted)
     {
-      Time end = clock.getElapsedTime();
-      Time delta = end - lastUpdate;
-      lastUpdate = end;
+      Time end = _clock.getElapsedTime();
+      Time delta = end - _lastUpdate;
+      _lastUpdate = end;
+
+      {
+        ScopedPhaseTimer timer(&_profiler, TickPhase::Attractors);
+        ApplyAttractors();
+      }
+
+      _accumulator += delta.asMicroseconds() / 1e6;
+
+      if (_accumulator >= timestep)
+      {
+        ScopedPhaseTimer timer(&_profiler, TickPhase::Integration);
+        while (_accumulator >= timestep)
+        {
+          Integrate((float)timestep);
+          _accumulator -= timestep;
+        }
+        PublishSharedSnapshot();
+      }
 
-      for (MonsterData& data : _monsterData)
+      Time collisionDelta = end - lastCollisionCheck;
+      if (collisionDelta.asMilliseconds() > 50)
       {
-        data._state._curState._acc = Vector2f(0, 0);
+        ScopedPhaseTimer timer(&_profiler, TickPhase::Collisions);
+        HandleCollisions();
+        lastCollisionCheck = end;
       }
 
-      // apply attractors..
-      if (!_attractors.empty())
+      // send the state of the latest tick. the clients interpolate between
+      // these, so the send rate only affects latency, not smoothness
+      Time sendDelta = end - lastSend;
+      if (sendDelta.asMilliseconds() >= (s32)_config.snapshot_interval_ms())
       {
-        for (const MonsterAttractor& a : _attractors)
+        // every client gets its own swarm state, with what it needs most and
+        // can take
+        bool hasPlayerState;
+        {
+          ScopedPhaseTimer timer(&_profiler, TickPhase::Serialization);
+          // local clients get the message itself, so there's nothing to
+          // serialize if they're all there is
+          bool remoteClients = false;
+          for (const ClientConnection* client : _connectedClients)
+            remoteClients |= !client->local;
+          hasPlayerState = remoteClients && EncodePlayerState(playerStateBuf);
+          ServerMessagePtr localPlayerState;
+
+          // in lockstep mode every client gets the same frames instead of a
+          // swarm state
+          shared_ptr<game::ServerMessage> lockstepFrames;
+          vector<char> lockstepBuf;
+          if (_config.lockstep())
+          {
+            lockstepFrames = make_shared<game::ServerMessage>();
+            TakeLockstepFrames(lockstepFrames.get());
+            if (remoteClients)
+              PackMessage(lockstepBuf, *lockstepFrames);
+          }
+
+          _udpSendBuf.clear();
+          _datagrams.clear();
+          for (ClientConnection* client : _connectedClients)
+          {
+            client->snapshotBuf.clear();
+            auto it = _playerData.find(client->playerId);
+            if (it == _playerData.end() || !it->second.sentStartGame)
+              continue;
+
+            if (client->local)
+            {
+              SendLocalStates(client, lockstepFrames, &localPlayerState);
+              continue;
+            }
+
+            // a lockstep client can't miss a frame, so they're queued behind
+            // the initial state like the other events, and never go over udp
+            if (lockstepFrames)
+            {
+              client->snapshotBuf = lockstepBuf;
+              AddBytesSent(&it->second, lockstepBuf.size());
+              continue;
+            }
+
+            if (client->streaming)
+              continue;
+
+            if (!EncodeMonsterState(client->playerId, client->snapshotBuf))
+              continue;
+
+            // the clients on udp get their states in the batch below
+            if (client->udpReady && WriteDatagrams(client, &it->second, hasPlayerState ? &playerStateBuf : nullptr))
+              client->snapshotBuf.clear();
+          }
+        }
+
         {
-          ApplyAttractor(a.pos, a.radius);
+          ScopedPhaseTimer timer(&_profiler, TickPhase::Send);
+          for (ClientConnection* client : _connectedClients)
+          {
+            if (client->snapshotBuf.empty())
+              continue;
+
+            SendToClient(client->snapshotBuf, client);
+            if (hasPlayerState && SendToClient(playerStateBuf, client))
+              AddBytesSent(&_playerData[client->playerId], playerStateBuf.size());
+          }
+
+          _udpSocket.SendBatch(_udpSendBuf, _datagrams);
         }
+
+        UpdateClientStats();
+        lastSend = end;
+      }
+
+      {
+        ScopedPhaseTimer timer(&_profiler, TickPhase::ClientInput);
+        HandleClientMessages();
       }
+    }
+
+    RemoveDisconnectedClients(_clock.getElapsedTime());
+    _profiler.EndTick();
+  }
+
+  delete socket;
+}
+
+//-----------------------------------------------------------------------------
+u32 Server::AddSimulatedPlayer()
+{
+  u32 id = _nextPlayerId++;
+  PlayerData& player = _playerData[id];
+  player.id = id;
+  player.state._pos = _level.GetPlayerPos();
+  player.health = _config.initial_health();
+  return id;
+}
+
+//-----------------------------------------------------------------------------
+void Server::AddMonster(const Vector2f& pos, float size, u32 swarm)
+{
+  _monsterData.push_back(MonsterData());
+  MonsterData& data = _monsterData.back();
+  data._state._pos = pos;
+  data._id = _nextMonsterId++;
+  data._swarm = swarm;
+  data._size = size;
+}
+
+
+//-----------------------------------------------------------------------------
+bool Server::InitLevel()
+{
+  if (!_level.Load(_config.map_name().c_str()))
+    return false;
+
+  float scale = _level._scale;
+  // create the swarms
+
+  for (size_t i = 0; i < _config.num_swarms(); ++i)
+  {
+    // find swarm center pos
+    int centerX, centerY;
+    while (true)
+    {
+      centerX = rand() % _level._width;
+      centerY = rand() % _level._height;
+      u8 val = _level._background[centerY*_level._width + centerX];
+      if (val == 0)
+        break;
+    }
+
+    int swarmRadius = 20;
+
+    // add the monsters around the swarm
+    for (size_t j = 0; j < _config.monsters_per_swarm(); ++j)
+    {
+      float s = 3 + 3 * rand() / (float)RAND_MAX;
+      while (true)
+      {
+        float x = centerX - swarmRadius / 2 + swarmRadius * (rand() / (float)RAND_MAX);
+        float y = centerY - swarmRadius / 2 + swarmRadius * (rand() / (float)RAND_MAX);
+
+        x = (int)Clamp<float>(x, 0, _level._width - 1);
+        y = (int)Clamp<float>(y, 0, _level._height - 1);
+
+        u8 val = _level._background[y*_level._width + x];
+        if (val == 0)
+        {
+          AddMonster(scale * Vector2f(x, y), s, (u32)i);
+          break;
+        }
+      }
+    }
+
+
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Server::InitSimulation(const game::Config& config)
+{
+  _config = config;
+
+  u32 rewindTicks = (u32)(config.max_rewind_ms() / (TIMESTEP * 1000)) + 1;
+  _history.Init(rewindTicks, config.max_history_kb() * 1024);
+
+  if (!InitLevel())
+  {
+    LOG_WARN("Error initialzing level");
+    return false;
+  }
+
+  if (_config.lockstep())
+    InitLockstep();
+
+  RecordHistory();
+  _deathsLoggedAfter = _tick - 1;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Server::Init(const char* configFile)
+{
+  game::Config config;
+  if (!ProtobufFromFile(configFile, &config))
+  {
+    LOG_WARN("Unable to load config file" << LogKeyValue("name", configFile));
+    return false;
+  }
+
+  if (!InitSimulation(config))
+    return false;
+
+  // Start listening on the first available port
+  _listener.setBlocking(false);
+  _port = 50000;
+  Socket::Status status = _listener.listen(_port);
+  while (status != Socket::Done)
+  {
+    (_port)++;
+    status = _listener.listen(_port);
+  }
+  printf("Server listening on port: %d\n", _port);
+
+  // use the same port number for udp if it's free. without udp, everything
+  // goes over tcp
+  if (_config.udp_enabled() && (_udpSocket.Open(_port) || _udpSocket.Open(0)))
+    printf("Server udp port: %d\n", _udpSocket.GetPort());
+
+  // monsters are never added once the game is running, so the initial
+  // count is enough room
+  if (!_config.shared_snapshot_name().empty()
+      && _sharedSnapshot.Open(_config.shared_snapshot_name(), (u32)_monsterData.size(), SHARED_SNAPSHOT_MAX_PLAYERS))
+    printf("Server shared snapshot: %s\n", _config.shared_snapshot_name().c_str());
+
+  _serverThread = new thread(bind(&Server::ThreadProc, this));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Server::Close()
+{
+  _done = true;
+
+  if (_serverThread)
+    _serverThread->join();
+
+  return true;
+}
+
+//----------------------------------------------------------------------------------
+bool Server::SendToClient(const vector<char>& buf, ClientConnection* client)
+{
+  // events about the swarm mustn't overtake the initial state
+  if (client->streaming && !client->disconnected)
+  {
+    client->deferred.push_back(buf);
+    return true;
+  }
+
+  return SendToSocket(buf, client);
+}
+
+//----------------------------------------------------------------------------------
+bool Server::SendToSocket(const vector<char>& buf, ClientConnection* client)
+{
+  if (client->disconnected || client->local)
+    return false;
+
+  // a message can't be sent until the ones before it are, or the stream
+  // would be misframed
+  if (client->pending.size() + buf.size() > MAX_PENDING_BYTES)
+  {
+    LOG_WARN("Client isn't keeping up" << LogKeyValue("id", client->playerId));
+    client->disconnected = true;
+    return false;
+  }
+
+  client->pending.insert(client->pending.end(), buf.begin(), buf.end());
+  FlushSocket(client);
+  return !client->disconnected;
+}
+
+//----------------------------------------------------------------------------------
+void Server::FlushSocket(ClientConnection* client)
+{
+  if (client->disconnected || client->local || client->pending.empty())
+    return;
+
+  size_t sent = 0;
+  Socket::Status status = client->socket->send(client->pending.data(), client->pending.size(), sent);
+  if (status == Socket::Disconnected || status == Socket::Error)
+  {
+    // unable to send, so flag the client for removal
+    client->disconnected = true;
+    return;
+  }
+
+  client->pending.erase(client->pending.begin(), client->pending.begin() + sent);
+}
+
+//----------------------------------------------------------------------------------
+bool Server::SendToLocal(const ServerMessagePtr& msg, ClientConnection* client)
+{
+  if (client->disconnected)
+    return false;
+
+  if (!client->local->SendToClient(msg))
+  {
+    LOG_WARN("Local client isn't keeping up" << LogKeyValue("id", client->playerId));
+    client->disconnected = true;
+    return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------------
+bool Server::SendMessageToClients(const game::ServerMessage& msg)
+{
+  // Send state to all connected clients. The message is only serialized if
+  // there's a client on a socket
+  vector<char> buf;
+  ServerMessagePtr localMsg;
+  for (ClientConnection* client : _connectedClients)
+  {
+    if (!client->local)
+    {
+      if (buf.empty() && !PackMessage(buf, msg))
+        return false;
+      SendToClient(buf, client);
+      continue;
+    }
+
+    if (!localMsg)
+      localMsg = make_shared<game::ServerMessage>(msg);
+    SendToLocal(localMsg, client);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------------
+void Server::SendLocalStates(ClientConnection* client, const ServerMessagePtr& lockstepFrames, ServerMessagePtr* playerState)
+{
+  if (lockstepFrames)
+  {
+    SendToLocal(lockstepFrames, client);
+  }
+  else
+  {
+    PlayerData& player = _playerData[client->playerId];
+    shared_ptr<game::ServerMessage> msg = make_shared<game::ServerMessage>();
+    msg->set_type(game::ServerMessage_Type_SWARM_STATE);
+    FillSwarmState(msg->mutable_swarm_state(), &player);
+    SendToLocal(msg, client);
+  }
+
+  // the player state is the same for every client, so it's only built once
+  if (!*playerState)
+  {
+    shared_ptr<game::ServerMessage> state = make_shared<game::ServerMessage>();
+    state->set_type(game::ServerMessage_Type_PLAYER_STATE);
+    FillPlayerState(state->mutable_player_state());
+    *playerState = state;
+  }
+  SendToLocal(*playerState, client);
+}
+
+//----------------------------------------------------------------------------------
+shared_ptr<LocalChannel> Server::ConnectLocal()
+{
+  shared_ptr<LocalChannel> channel = make_shared<LocalChannel>();
+  lock_guard<mutex> lock(_localMutex);
+  _newLocalClients.push_back(channel);
+  return channel;
+}
+
+//----------------------------------------------------------------------------------
+void Server::AcceptLocalClients(const Time& now)
+{
+  vector<shared_ptr<LocalChannel>> channels;
+  {
+    lock_guard<mutex> lock(_localMutex);
+    channels.swap(_newLocalClients);
+  }
+
+  // from here on, a local client goes through the same hello as the others
+  for (const shared_ptr<LocalChannel>& channel : channels)
+  {
+    ClientConnection* client = new ClientConnection(nullptr, 0);
+    client->local = channel;
+    client->connectionId = _nextConnectionId++;
+    client->connectTime = now;
+    _pendingClients.push_back(client);
+  }
+}
+
+
+//----------------------------------------------------------------------------------
+bool Server::WriteDatagrams(ClientConnection* client, PlayerData* player, const vector<char>* playerStateBuf)
+{
+  if (client->udp.GetNumSentSinceAck() >= UDP_FALLBACK_MESSAGES)
+  {
+    LOG_WARN("No udp acks from client, falling back to tcp" << LogKeyValue("id", client->playerId));
+    client->udpReady = false;
+    client->udpFailed = true;
+    return false;
+  }
+
+  // the messages are framed for tcp, and udp keeps the message boundaries
+  const vector<char>& swarmBuf = client->snapshotBuf;
+  u16 seq;
+  if (!client->udp.Write(UDP_STREAM_SWARM_STATE, swarmBuf.data() + sizeof(u32), swarmBuf.size() - sizeof(u32),
+      client->udpAddr, &_udpSendBuf, &_datagrams, &seq))
+  {
+    return false;
+  }
+
+  // FillSwarmState left the indices of the monsters it sent
+  ClientView& view = player->view;
+  if (view.udpSent.empty())
+    view.udpSent.resize(UDP_SENT_HISTORY);
+
+  SentSwarmState& sent = view.udpSent[seq % UDP_SENT_HISTORY];
+  sent.seq = seq;
+  sent.tick = _tick;
+  sent.ids.clear();
+  for (u32 idx : _sendCandidates)
+    sent.ids.push_back(_monsterData[idx]._id);
+  sent.aggregatedIds = _aggregatedIds;
+
+  if (playerStateBuf && client->udp.Write(UDP_STREAM_PLAYER_STATE, playerStateBuf->data() + sizeof(u32),
+      playerStateBuf->size() - sizeof(u32), client->udpAddr, &_udpSendBuf, &_datagrams, nullptr))
+  {
+    AddBytesSent(player, playerStateBuf->size());
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------------
+void Server::SwarmStateLost(ClientView* view, u16 seq)
+{
+  if (view->udpSent.empty())
+    return;
+
+  SentSwarmState& sent = view->udpSent[seq % UDP_SENT_HISTORY];
+  if (sent.seq != seq)
+    return;
+
+  ++view->swarmStatesLost;
+
+  // the client's copy of these monsters is whatever it had before, so they
+  // count as unknown until they're sent again. monsters that have been sent
+  // since are fine.
+  auto it = view->monsters.begin();
+  for (u32 id : sent.ids)
+  {
+    while (it != view->monsters.end() && it->id < id)
+      ++it;
+
+    if (it != view->monsters.end() && it->id == id && it->sentTick == sent.tick)
+      it->known = false;
+  }
+
+  // the client still has these, so they're dropped again in the next state,
+  // unless they've come back into range
+  it = view->monsters.begin();
+  for (u32 id : sent.aggregatedIds)
+  {
+    while (it != view->monsters.end() && it->id < id)
+      ++it;
+
+    if (it != view->monsters.end() && it->id == id)
+      it->aggregated = false;
+  }
+
+  sent.ids.clear();
+  sent.aggregatedIds.clear();
+  sent.seq = 0;
+}
+
+//----------------------------------------------------------------------------------
+void Server::UpdateClientView(ClientView* view)
+{
+  // drop the monsters that have died, and add the new ones, which the client
+  // doesn't know about yet. both lists are sorted by id.
+  _viewScratch.clear();
+  auto it = view->monsters.begin();
+  for (const MonsterData& data : _monsterData)
+  {
+    while (it != view->monsters.end() && it->id < data._id)
+      ++it;
+
+    if (it != view->monsters.end() && it->id == data._id)
+    {
+      _viewScratch.push_back(*it);
+      continue;
+    }
+
+    MonsterView monster;
+    monster.id = data._id;
+    monster.sentTick = _tick;
+    monster.priority = 0;
+    monster.known = false;
+    // the client has never had it, so there's nothing to drop
+    monster.aggregated = true;
+    _viewScratch.push_back(monster);
+  }
+  view->monsters.swap(_viewScratch);
+
+  // bring the client's copy up to the current tick
+  for (; (s32)(_tick - view->tick) > 0; ++view->tick)
+  {
+    for (MonsterView& monster : view->monsters)
+    {
+      if (monster.known)
+        ExtrapolateMonster(_level, &monster.sentState);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------
+void Server::SelectMonsters(PlayerData* player)
+{
+  ClientView& view = player->view;
+  UpdateClientView(&view);
+
+  u32 refreshTicks = MonsterRefreshTicks();
+  float tolerance = max(0.001f, _config.dead_reckoning_tolerance());
+  float snapshotInterval = _config.snapshot_interval_ms() / 1000.0f;
+
+  // top up the bandwidth budget for the time since the last snapshot
+  float bytesPerSec = (float)_config.client_bytes_per_sec();
+  float elapsed = (_tick - view.snapshotTick) * TIMESTEP;
+  float maxBudget = MAX_BUDGET_SNAPSHOTS * bytesPerSec * snapshotInterval;
+  view.budget = min(maxBudget, view.budget + bytesPerSec * elapsed);
+
+  // monsters far from the player are only summed up per swarm and cell
+  float aggregateDistance = AggregateDistance(*player);
+  bool aggregate = aggregateDistance > 0;
+  _aggregatedIds.clear();
+  _aggregates.clear();
+  if (aggregate)
+  {
+    AssignClusters();
+    _aggregateSums.assign(_clusterIds.size(), AggregateSum());
+  }
+
+  // find the monsters the client's extrapolation is too far off for. their
+  // priority grows every snapshot until they're sent, faster for monsters
+  // that are near the player, or have changed course a lot.
+  _sendCandidates.clear();
+  for (u32 i = 0; i < view.monsters.size(); ++i)
+  {
+    const MonsterData& data = _monsterData[i];
+    MonsterView& monster = view.monsters[i];
+
+    if (aggregate)
+    {
+      float dist = Length(data._state._pos - player->state._pos);
+      float limit = monster.aggregated ? aggregateDistance : aggregateDistance * AGGREGATE_HYSTERESIS;
+      if (dist > limit)
+      {
+        // the client drops its copy, if it has one, and gets the monster in
+        // full once it's back in range
+        if (!monster.aggregated)
+        {
+          _aggregatedIds.push_back(data._id);
+          monster.aggregated = true;
+          monster.known = false;
+          monster.priority = 0;
+        }
+
+        AggregateSum& sum = _aggregateSums[_monsterClusters[i]];
+        sum.pos[0] += data._state._pos.x;
+        sum.pos[1] += data._state._pos.y;
+        sum.vel[0] += data._state._vel.x;
+        sum.vel[1] += data._state._vel.y;
+        sum.distSq += (double)data._state._pos.x * data._state._pos.x + (double)data._state._pos.y * data._state._pos.y;
+        sum.size += data._size;
+        ++sum.count;
+        continue;
+      }
+
+      monster.aggregated = false;
+    }
+
+    // a velocity error shows up as position error before the next
+    // snapshot, so it counts as well
+    float error = 10 * tolerance;
+    if (monster.known)
+    {
+      float posError = Length(monster.sentState._pos - data._state._pos);
+      float velError = Length(monster.sentState._vel - data._state._vel) * snapshotInterval;
+      error = max(posError, velError);
+    }
+
+    bool refresh = _tick - monster.sentTick >= refreshTicks;
+    if (monster.known && !refresh && error <= tolerance)
+      continue;
+
+    float dist = Length(data._state._pos - player->state._pos);
+    float nearness = 1 + PRIORITY_NEAR_DISTANCE / (PRIORITY_NEAR_DISTANCE + dist);
+    monster.priority += (1 + error / tolerance) * nearness;
+    _sendCandidates.push_back(i);
+  }
+
+  // send as many of the highest priority monsters as the budget allows
+  size_t numCandidates = _sendCandidates.size();
+  size_t numToSend = numCandidates;
+  float bytesPerMonster = view.bytesPerMonster > 0 ? view.bytesPerMonster : MONSTER_BYTES_ESTIMATE;
+  if (bytesPerSec > 0)
+    numToSend = min(numToSend, (size_t)max(0.0f, view.budget / bytesPerMonster));
+
+  if (numToSend < _sendCandidates.size())
+  {
+    const vector<MonsterView>& monsters = view.monsters;
+    std::nth_element(_sendCandidates.begin(), _sendCandidates.begin() + numToSend, _sendCandidates.end(),
+        [&](u32 a, u32 b) { return monsters[a].priority > monsters[b].priority; });
+    _sendCandidates.resize(numToSend);
+    std::sort(_sendCandidates.begin(), _sendCandidates.end());
+  }
+
+  view.monstersDeferred = (u32)(numCandidates - numToSend);
+
+  view.snapshotTick = _tick;
+
+  // monsters are sent in id order, which the clients rely on
+  for (u32 idx : _sendCandidates)
+  {
+    const MonsterData& data = _monsterData[idx];
+    MonsterView& monster = view.monsters[idx];
+    monster.sentState = data._state;
+    monster.sentState._acc = Vector2f(0, 0);
+    monster.priority = 0;
+    monster.known = true;
+    monster.sentTick = _tick;
+  }
+
+  view.windowMonsters += (u32)_sendCandidates.size();
+
+  if (!aggregate)
+    return;
+
+  // the spread is the rms distance from the centroid, from the mean squared
+  // distance from the origin
+  for (size_t i = 0; i < _aggregateSums.size(); ++i)
+  {
+    const AggregateSum& sum = _aggregateSums[i];
+    if (sum.count == 0)
+      continue;
+
+    double n = sum.count;
+    double cx = sum.pos[0] / n;
+    double cy = sum.pos[1] / n;
+    wire::Aggregate a;
+    a.id = _clusterIds[i];
+    a.pos = Vector2f((float)cx, (float)cy);
+    a.vel = Vector2f((float)(sum.vel[0] / n), (float)(sum.vel[1] / n));
+    a.extent = (float)(sqrt(max(0.0, sum.distSq / n - cx * cx - cy * cy)) + sum.size / n);
+    a.count = sum.count;
+    _aggregates.push_back(a);
+  }
+}
 
-      accumulator += delta.asMicroseconds() / 1e6;
+//----------------------------------------------------------------------------------
+float Server::AggregateDistance(const PlayerData& player) const
+{
+  // spectators watch the whole map, and lockstep clients simulate every
+  // monster, so they get them all
+  if (player.spectator || _config.lockstep())
+    return 0;
+  return _config.aggregate_distance();
+}
 
-      while (accumulator >= timestep)
-      {
-        for (MonsterData& data : _monsterData)
-        {
-          MonsterState& state = data._state;
-          state._prevState = state._curState;
-          UpdateState(state._curState, (float)timestep);
-        }
-        accumulator -= timestep;
-        _attractors.clear();
-      }
+//----------------------------------------------------------------------------------
+void Server::AssignClusters()
+{
+  if (_clusterTick == _tick && _monsterClusters.size() == _monsterData.size())
+    return;
 
-      Time collisionDelta = end - lastCollisionCheck;
-      if (collisionDelta.asMilliseconds() > 50)
-      {
-        HandleCollisions();
-        lastCollisionCheck = end;
-      }
+  // the id of a cluster is its swarm and cell, so it stays the same while
+  // the monsters in it come and go, and the clients can interpolate it.
+  // cells past the 256th on either axis share the last one.
+  float cellSize = max(1.0f, _config.aggregate_cell_size());
+  _clusterIds.clear();
+  _monsterClusters.resize(_monsterData.size());
+  for (size_t i = 0; i < _monsterData.size(); ++i)
+  {
+    const MonsterData& data = _monsterData[i];
+    u32 cx = (u32)Clamp((int)(data._state._pos.x / cellSize), 0, 0xff);
+    u32 cy = (u32)Clamp((int)(data._state._pos.y / cellSize), 0, 0xff);
+    u32 id = (data._swarm << 16) | (cy << 8) | cx;
+    _monsterClusters[i] = id;
+    _clusterIds.push_back(id);
+  }
 
-      // send state 10 times/sec
-      Time sendDelta = end - lastSend;
-      if (sendDelta.asMilliseconds() > 100)
-      {
-        float alpha = (float)(accumulator / timestep);
-        SendMonsterState(alpha);
-        SendPlayerState();
-        lastSend = end;
-      }
+  std::sort(_clusterIds.begin(), _clusterIds.end());
+  _clusterIds.erase(std::unique(_clusterIds.begin(), _clusterIds.end()), _clusterIds.end());
+  for (u32& cluster : _monsterClusters)
+    cluster = (u32)(std::lower_bound(_clusterIds.begin(), _clusterIds.end(), cluster) - _clusterIds.begin());
 
-      HandleClientMessages();
+  _clusterTick = _tick;
+}
 
-    }
+//----------------------------------------------------------------------------------
+void Server::FillSwarmState(game::SwarmState* state, PlayerData* player)
+{
+  state->set_tick(_tick);
+  state->set_server_time(_simTime);
 
+  SelectMonsters(player);
+  for (u32 idx : _sendCandidates)
+  {
+    const MonsterData& data = _monsterData[idx];
+    game::Monster* m = state->add_monster();
+    m->set_id(data._id);
+    ToProtocol(m->mutable_vel(), data._state._vel);
+    ToProtocol(m->mutable_pos(), data._state._pos);
+    m->set_size(data._size);
   }
 
-  delete socket;
+  for (u32 id : _aggregatedIds)
+    state->add_removed_id(id);
+  for (const wire::Aggregate& a : _aggregates)
+    ToProtocol(state->add_aggregate(), a);
 }
 
-//-----------------------------------------------------------------------------
-void Server::AddMonster(const Vector2f& pos, float size)
+//----------------------------------------------------------------------------------
+u32 Server::QueueInitialState(ClientConnection* client, PlayerData* player, game::SwarmState* state)
 {
-  _monsterData.push_back(MonsterData());
-  MonsterData& data = _monsterData.back();
-  MonsterState& state = data._state;
-  state._curState._pos = pos;
-  state._prevState._pos = pos;
-  data._size = size;
-}
+  ClientView& view = player->view;
+  UpdateClientView(&view);
+  view.snapshotTick = _tick;
+
+  // the client's copy is the state at this tick, which is all the tick thread
+  // has to capture. the encoding is done by the worker.
+  InitialStateEncoder::Job job;
+  job.connectionId = client->connectionId;
+  job.tick = _tick;
+  job.serverTime = _simTime;
+  job.monsters.reserve(_monsterData.size());
+  if (_config.lockstep())
+    job.lockstepMonsters = _lockstep.GetMonsters();
+
+  // the far monsters are left to the aggregates in the first delta
+  float aggregateDistance = AggregateDistance(*player);
+  u32 refreshTicks = MonsterRefreshTicks();
+  u32 numSent = 0;
+  for (size_t i = 0; i < _monsterData.size(); ++i)
+  {
+    const MonsterData& data = _monsterData[i];
+    MonsterView& monster = view.monsters[i];
+    if (aggregateDistance > 0 && Length(data._state._pos - player->state._pos) > aggregateDistance)
+    {
+      monster.priority = 0;
+      monster.known = false;
+      monster.aggregated = true;
+      continue;
+    }
 
+    ++numSent;
+    monster.sentState = data._state;
+    monster.sentState._acc = Vector2f(0, 0);
+    monster.priority = 0;
+    monster.known = true;
+    monster.aggregated = false;
+    // spread the forced refreshes over the refresh interval
+    monster.sentTick = _tick - data._id % refreshTicks;
+
+    // a local client takes the whole state at once, as it costs nothing
+    // to send
+    if (client->local)
+    {
+      game::Monster* m = state->add_monster();
+      m->set_id(data._id);
+      ToProtocol(m->mutable_vel(), data._state._vel);
+      ToProtocol(m->mutable_pos(), data._state._pos);
+      m->set_size(data._size);
+      if (_config.lockstep())
+        ToProtocol(m, _lockstep.GetMonsters()[i]);
+      continue;
+    }
 
-//-----------------------------------------------------------------------------
-bool Server::InitLevel()
-{
-  if (!_level.Load(_config.map_name().c_str()))
-    return false;
+    InitialStateEncoder::Monster m;
+    m.pos = data._state._pos;
+    m.vel = data._state._vel;
+    m.id = data._id;
+    m.size = data._size;
+    job.monsters.push_back(m);
+  }
 
-  float scale = _level._scale;
-  // create the swarms
+  view.windowMonsters += numSent;
 
-  for (size_t i = 0; i < _config.num_swarms(); ++i)
+  u32 numChunks = InitialStateEncoder::NumChunks(job.monsters.size());
+  client->initialChunks.clear();
+  client->chunksToSend = numChunks;
+  // the first chunk goes out as soon as it's encoded
+  client->chunkBudget = 1;
+  client->lastChunkTime = client->connectTime;
+  client->streaming = numChunks > 0;
+  if (numChunks)
+    _initialStateEncoder.Encode(&job);
+
+  return numChunks;
+}
+
+//----------------------------------------------------------------------------------
+void Server::SendInitialStates(const Time& now)
+{
+  InitialStateEncoder::Chunk chunk;
+  while (_initialStateEncoder.PopChunk(&chunk))
   {
-    // find swarm center pos
-    int centerX, centerY;
-    while (true)
+    for (ClientConnection* client : _connectedClients)
     {
-      centerX = rand() % _level._width;
-      centerY = rand() % _level._height;
-      u8 val = _level._background[centerY*_level._width + centerX];
-      if (val == 0)
+      if (client->connectionId == chunk.connectionId && client->streaming)
+      {
+        client->initialChunks.push_back(vector<char>());
+        client->initialChunks.back().swap(chunk.buf);
         break;
+      }
     }
+  }
 
-    int swarmRadius = 20;
+  // pace each client's chunks, so a join doesn't flood its connection
+  float bytesPerSec = (float)_config.initial_state_bytes_per_sec();
+  for (ClientConnection* client : _connectedClients)
+  {
+    if (!client->streaming)
+      continue;
 
-    // add the monsters around the swarm
-    for (size_t j = 0; j < _config.monsters_per_swarm(); ++j)
+    float elapsed = (now - client->lastChunkTime).asMicroseconds() / 1e6f;
+    client->lastChunkTime = now;
+    client->chunkBudget = min(client->chunkBudget + bytesPerSec * elapsed, max(1.0f, bytesPerSec * 0.1f));
+
+    // a chunk waits while the socket still has a backlog, so a slow
+    // client isn't buried in chunks it can't take yet
+    PlayerData& player = _playerData[client->playerId];
+    while (!client->initialChunks.empty() && client->pending.empty() && (client->chunkBudget > 0 || bytesPerSec == 0))
     {
-      float s = 3 + 3 * rand() / (float)RAND_MAX;
-      while (true)
-      {
-        float x = centerX - swarmRadius / 2 + swarmRadius / 2.0f * (rand() / (float)RAND_MAX);
-        float y = centerY - swarmRadius / 2 + swarmRadius / 2.0f * (rand() / (float)RAND_MAX);
+      const vector<char>& buf = client->initialChunks.front();
+      SendToSocket(buf, client);
+      client->chunkBudget -= buf.size();
 
-        x = (int)Clamp<float>(x, 0, _level._width - 1);
-        y = (int)Clamp<float>(y, 0, _level._height - 1);
+      // the stream has its own budget, so it doesn't hold up the swarm
+      // states afterwards
+      player.view.windowBytes += (u32)buf.size();
+      player.view.totalBytesSent += buf.size();
+      client->initialChunks.pop_front();
 
-        u8 val = _level._background[y*_level._width + x];
-        if (val == 0)
-        {
-          AddMonster(scale * Vector2f(x, y), s);
-          break;
-        }
+      if (--client->chunksToSend == 0)
+      {
+        client->streaming = false;
+        for (const vector<char>& deferred : client->deferred)
+          SendToSocket(deferred, client);
+        client->deferred.clear();
       }
     }
-
-
   }
-
-  return true;
 }
 
-//-----------------------------------------------------------------------------
-bool Server::Init(const char* configFile)
+//----------------------------------------------------------------------------------
+void Server::PublishSharedSnapshot()
 {
-  if (!ProtobufFromFile(configFile, &_config))
-  {
-    LOG_WARN("Unable to load config file" << LogKeyValue("name", configFile));
-    return false;
-  }
+  if (!_sharedSnapshot.IsOpen())
+    return;
 
-  if (!InitLevel())
+  _sharedSnapshot.BeginWrite();
+
+  u32 numMonsters = min((u32)_monsterData.size(), _sharedSnapshot.GetMaxMonsters());
+  SharedMonster* monsters = _sharedSnapshot.GetMonsters();
+  for (u32 i = 0; i < numMonsters; ++i)
   {
-    LOG_WARN("Error initialzing level");
-    return false;
+    const MonsterData& data = _monsterData[i];
+    SharedMonster& m = monsters[i];
+    m.id = data._id;
+    m.size = data._size;
+    m.pos[0] = data._state._pos.x;
+    m.pos[1] = data._state._pos.y;
+    m.vel[0] = data._state._vel.x;
+    m.vel[1] = data._state._vel.y;
   }
 
-  // Start listening on the first available port
-  _listener.setBlocking(false);
-  _port = 50000;
-  Socket::Status status = _listener.listen(_port);
-  while (status != Socket::Done)
+  u32 numPlayers = 0;
+  SharedPlayer* players = _sharedSnapshot.GetPlayers();
+  for (auto& kv : _playerData)
   {
-    (_port)++;
-    status = _listener.listen(_port);
+    const PlayerData& data = kv.second;
+    if (data.spectator)
+      continue;
+
+    if (numPlayers == _sharedSnapshot.GetMaxPlayers())
+      break;
+
+    SharedPlayer& p = players[numPlayers++];
+    p.id = data.id;
+    p.health = data.health;
+    p.pos[0] = data.state._pos.x;
+    p.pos[1] = data.state._pos.y;
+    p.vel[0] = data.state._vel.x;
+    p.vel[1] = data.state._vel.y;
   }
-  printf("Server listening on port: %d\n", _port);
 
-  _serverThread = new thread(bind(&Server::ThreadProc, this));
-  return true;
+  _sharedSnapshot.EndWrite(_tick, _simTime, numMonsters, numPlayers);
 }
 
-//-----------------------------------------------------------------------------
-bool Server::Close()
+//----------------------------------------------------------------------------------
+void Server::FillPlayerState(game::PlayerState* state)
 {
-  _done = true;
+  state->set_tick(_tick);
+  state->set_server_time(_simTime);
 
-  if (_serverThread)
-    _serverThread->join();
+  for (auto it = _playerData.begin(); it != _playerData.end(); ++it)
+  {
+    const PlayerData& data = it->second;
+    if (data.spectator)
+      continue;
 
-  return true;
+    game::Player* player = state->add_player();
+    player->set_id(it->first);
+    player->set_health(data.health);
+    player->set_last_input_seq(data.lastInputSeq);
+    ToProtocol(player->mutable_acc(), data.state._acc);
+    ToProtocol(player->mutable_vel(), data.state._vel);
+    ToProtocol(player->mutable_pos(), data.state._pos);
+  }
 }
 
 //----------------------------------------------------------------------------------
-void Server::UpdateState(PhysicsState& state, float dt)
+u32 Server::MonsterRefreshTicks() const
 {
-  // Velocity Verlet integration
-  float friction = 0.999f;
-  float scale = _level._scale;
-  Vector2f oldVel = state._vel;
-  Vector2f p = state._pos;
-  Vector2f v = friction * (state._vel + state._acc * dt);
+  return max<u32>(1, (u32)(_config.monster_refresh_ms() / (TIMESTEP * 1000)));
+}
 
-  Vector2f newPos = state._pos + (oldVel + state._vel) * 0.5f * dt;
+//----------------------------------------------------------------------------------
+bool Server::EncodeMonsterState(u32 playerId, vector<char>& buf)
+{
+  auto it = _playerData.find(playerId);
+  if (it == _playerData.end())
+    return false;
 
-  u8 b;
-  // check horizontal collisions
-  if (!(_level.PosToBackground(1/scale * (p + dt * Vector2f(v.x, 0)), &b) && b == 0))
+  SelectMonsters(&it->second);
+  if (_config.monster_compression() != game::Config_MonsterCompression_UNCOMPRESSED)
+  {
+    EncodePackedMonsterState(&it->second.view, buf);
+  }
+  else
   {
-    newPos.x = p.x;
-    v.x = -v.x;
+    // written straight from the monster data, in the same bytes protobuf
+    // would give
+    buf.clear();
+    wire::Writer writer(&buf);
+    writer.BeginFrame();
+    writer.WriteVarint(game::ServerMessage::kTypeFieldNumber, game::ServerMessage_Type_SWARM_STATE);
+    writer.BeginNested(game::ServerMessage::kSwarmStateFieldNumber);
+    for (u32 idx : _sendCandidates)
+    {
+      const MonsterData& data = _monsterData[idx];
+      writer.WriteMonster(game::SwarmState::kMonsterFieldNumber,
+          data._id, data._state._pos, data._state._vel, data._size, nullptr);
+    }
+    writer.WriteVarint(game::SwarmState::kTickFieldNumber, _tick);
+    writer.WriteDouble(game::SwarmState::kServerTimeFieldNumber, _simTime);
+    for (u32 id : _aggregatedIds)
+      writer.WriteVarint(game::SwarmState::kRemovedIdFieldNumber, id);
+    for (const wire::Aggregate& a : _aggregates)
+      writer.WriteAggregate(game::SwarmState::kAggregateFieldNumber, a);
+    writer.End();
+    writer.End();
   }
 
-  // check vertical
-  if (!(_level.PosToBackground(1/scale * (p + dt * Vector2f(0, v.y)), &b) && b == 0))
+  // the overhead of the state is spread over its monsters, so a state with
+  // few monsters makes them look more expensive, which errs on the safe side
+  ClientView& view = it->second.view;
+  if (!_sendCandidates.empty())
   {
-    newPos.y = p.y;
-    v.y = -v.y;
+    float bytesPerMonster = buf.size() / (float)_sendCandidates.size();
+    if (view.bytesPerMonster > 0)
+      view.bytesPerMonster += (bytesPerMonster - view.bytesPerMonster) * BYTES_PER_MONSTER_WEIGHT;
+    else
+      view.bytesPerMonster = bytesPerMonster;
   }
 
-  state._vel = v;
-  state._pos = newPos;
+  AddBytesSent(&it->second, buf.size());
+  return true;
 }
 
 //----------------------------------------------------------------------------------
-bool Server::SendToClient(const vector<char>& buf, TcpSocket* socket)
+void Server::EncodePackedMonsterState(ClientView* view, vector<char>& buf)
 {
-  Socket::Status status = socket->send(buf.data(), buf.size());
-  if (status == Socket::Disconnected)
+  _packedState.Clear();
+  _packedState.tick = _tick;
+  _packedState.serverTime = _simTime;
+  _packedState.removedIds = _aggregatedIds;
+  _packedState.aggregates = _aggregates;
+  for (u32 idx : _sendCandidates)
   {
-    // unable to send, so remove the client
-    auto idIt = _addrToId.find(
-        make_pair(socket->getRemoteAddress().toInteger(), socket->getRemotePort()));
-    if (idIt != _addrToId.end())
-    {
-      int id = idIt->second;
-      _playerData.erase(id);
-    }
-
-    delete socket;
-    auto it = find(_connectedClients.begin(), _connectedClients.end(), socket);
-    if (it != _connectedClients.end())
-      _connectedClients.erase(it);
-    return false;
+    const MonsterData& data = _monsterData[idx];
+    wire::Monster m;
+    m.id = data._id;
+    m.pos = data._state._pos;
+    m.vel = data._state._vel;
+    m.size = data._size;
+    m.hasFixedState = false;
+    QuantizeMonster(&m);
+    _packedState.monsters.push_back(m);
+
+    // the client extrapolates from the rounded state, so the errors are
+    // measured against that
+    PhysicsState& sent = view->monsters[idx].sentState;
+    sent._pos = m.pos;
+    sent._vel = m.vel;
   }
 
-  return true;
+  MonsterOrder order = _config.monster_compression() == game::Config_MonsterCompression_SPATIAL_ORDER
+      ? MONSTER_ORDER_SPATIAL : MONSTER_ORDER_ID;
+  _compressor.EncodeSwarmState(&buf, _packedState, order);
 }
 
 //----------------------------------------------------------------------------------
-void Server::SendToClients(const vector<char>& buf)
+void Server::AddBytesSent(PlayerData* player, size_t bytes)
 {
-  for (auto it = _connectedClients.begin(); it != _connectedClients.end(); )
+  ClientView& view = player->view;
+  view.budget -= bytes;
+  view.windowBytes += (u32)bytes;
+  view.totalBytesSent += bytes;
+}
+
+//----------------------------------------------------------------------------------
+void Server::UpdateClientStats()
+{
+  vector<ClientStats> stats;
+  for (auto& kv : _playerData)
   {
-    TcpSocket* socket = *it;
-    Socket::Status status = socket->send(buf.data(), buf.size());
-    if (status == Socket::Disconnected)
+    ClientView& view = kv.second.view;
+    u32 windowTicks = _tick - view.statsTick;
+    if (windowTicks * TIMESTEP >= 1)
     {
-      // unable to send, so remove the client
-      auto idIt = _addrToId.find(
-          make_pair(socket->getRemoteAddress().toInteger(), socket->getRemotePort()));
-      if (idIt != _addrToId.end())
-      {
-        int id = idIt->second;
-        _playerData.erase(id);
-      }
-
-      delete socket;
-      it = _connectedClients.erase(it);
+      float secs = windowTicks * TIMESTEP;
+      view.bytesPerSec = (u32)(view.windowBytes / secs);
+      view.monstersPerSec = (u32)(view.windowMonsters / secs);
+      view.windowBytes = 0;
+      view.windowMonsters = 0;
+      view.statsTick = _tick;
     }
-    else
+
+    ClientStats s;
+    s.playerId = kv.first;
+    s.budgetBytesPerSec = _config.client_bytes_per_sec();
+    s.bytesPerSec = view.bytesPerSec;
+    s.monstersPerSec = view.monstersPerSec;
+    s.monstersDeferred = view.monstersDeferred;
+    s.totalBytesSent = view.totalBytesSent;
+    s.udp = false;
+    s.rttMs = 0;
+    for (const ClientConnection* client : _connectedClients)
     {
-      //LOG_INFO("Send to client" << LogKeyValue("num_bytes", buf.size()));
-      ++it;
+      if (client->playerId != kv.first)
+        continue;
+      s.udp |= client->udpReady;
+      s.rttMs = client->rttMs;
     }
+    s.swarmStatesLost = view.swarmStatesLost;
+    stats.push_back(s);
   }
+
+  lock_guard<mutex> lock(_statsMutex);
+  _clientStats.swap(stats);
 }
 
 //----------------------------------------------------------------------------------
-template <typename T>
-bool Server::PackMessage(vector<char>& buf, const T& msg)
+void Server::GetClientStats(vector<ClientStats>* stats) const
 {
-  buf.resize(msg.ByteSize() + sizeof(u32));
-  *(u32*)buf.data() = htonl(msg.ByteSize());
-  if (!msg.SerializeToArray(&buf[4], buf.size() - sizeof(u32)))
-  {
-    LOG_WARN("Unable to serialize state");
-    return false;
-  }
-  return true;
+  lock_guard<mutex> lock(_statsMutex);
+  *stats = _clientStats;
 }
 
 //----------------------------------------------------------------------------------
-template <typename T>
-bool Server::SendMessageToClients(const T& msg)
+bool Server::EncodePlayerState(vector<char>& buf)
 {
-  // Send state to all connected clients
-  vector<char> buf;
-  if (PackMessage(buf, msg))
+  // the same fields as FillPlayerState
+  buf.clear();
+  wire::Writer writer(&buf);
+  writer.BeginFrame();
+  writer.WriteVarint(game::ServerMessage::kTypeFieldNumber, game::ServerMessage_Type_PLAYER_STATE);
+  writer.BeginNested(game::ServerMessage::kPlayerStateFieldNumber);
+
+  for (auto it = _playerData.begin(); it != _playerData.end(); ++it)
   {
-    SendToClients(buf);
-    return true;
+    const PlayerData& data = it->second;
+    if (data.spectator)
+      continue;
+
+    wire::Player player;
+    player.id = it->first;
+    player.acc = data.state._acc;
+    player.vel = data.state._vel;
+    player.pos = data.state._pos;
+    player.health = data.health;
+    player.lastInputSeq = data.lastInputSeq;
+    writer.WritePlayer(game::PlayerState::kPlayerFieldNumber, player);
   }
-  return false;
+
+  writer.WriteVarint(game::PlayerState::kTickFieldNumber, _tick);
+  writer.WriteDouble(game::PlayerState::kServerTimeFieldNumber, _simTime);
+  writer.End();
+  writer.End();
+  return true;
 }
 
+//----------------------------------------------------------------------------------
+void Server::AddAttractor(const Vector2f& pos, float radius)
+{
+  _attractors.push_back(MonsterAttractor(pos, radius, _tick));
+}
 
 //----------------------------------------------------------------------------------
-void Server::SendMonsterState(float alpha)
+void Server::ApplyAttractors()
 {
-  game::ServerMessage msg;
-  msg.set_type(game::ServerMessage_Type_SWARM_STATE);
-  game::SwarmState& swarmState = *msg.mutable_swarm_state();
+  // in lockstep mode the clicks go in the frame, and act on the next tick
+  if (_config.lockstep())
+    return;
 
-  for (size_t i = 0; i < _monsterData.size(); ++i)
+  for (MonsterData& data : _monsterData)
   {
-    MonsterData& data = _monsterData[i];
-    MonsterState& state = data._state;
+    data._state._acc = Vector2f(0, 0);
+  }
 
-    // add monster to state
-    game::Monster* m = swarmState.add_monster();
-    Vector2f acc = lerp(state._prevState._acc, state._curState._acc, alpha);
-    Vector2f vel = lerp(state._prevState._vel, state._curState._vel, alpha);
-    Vector2f pos = lerp(state._prevState._pos, state._curState._pos, alpha);
+  for (const MonsterAttractor& a : _attractors)
+  {
+    ApplyAttractor(a.pos, a.radius, a.tick);
+  }
+}
 
-    ToProtocol(m->mutable_acc(), acc);
-    ToProtocol(m->mutable_vel(), vel);
-    ToProtocol(m->mutable_pos(), pos);
-    m->set_size(data._size);
+//----------------------------------------------------------------------------------
+void Server::Integrate(float dt)
+{
+  if (_config.lockstep())
+  {
+    StepLockstep();
+  }
+  else
+  {
+    for (MonsterData& data : _monsterData)
+      UpdateState(_level, MONSTER_FRICTION, dt, &data._state);
   }
 
-  SendMessageToClients(msg);
-}
+  IntegratePlayers(dt);
+
+  ++_tick;
+  _simTime += dt;
+  RecordHistory();
 
+  // attractors only act on the first step after they were applied
+  _attractors.clear();
+}
 
 //----------------------------------------------------------------------------------
-void Server::SendPlayerState()
+void Server::QueuePlayerInput(PlayerData* player, const wire::PlayerInput& input)
 {
-  game::ServerMessage msg;
-  msg.set_type(game::ServerMessage_Type_PLAYER_STATE);
-  game::PlayerState* state = msg.mutable_player_state();
+  // inputs are resent until acked, so skip the ones we already have
+  if (!player->alive || input.seq <= player->lastQueuedSeq)
+    return;
 
-  for (auto it = _playerData.begin(); it != _playerData.end(); ++it)
-  {
-    const PlayerData& data = it->second;
-    game::Player* player = state->add_player();
-    player->set_id(it->first);
-    player->set_health(data.health);
-    ToProtocol(player->mutable_pos(), data.pos);
-  }
+  // the server is authoritative for movement, so only the acceleration is
+  // taken from the client, and it is clamped to what the controls can give
+  PlayerInputFrame frame;
+  frame.seq = input.seq;
+  frame.acc = input.acc;
+  frame.acc.x = Clamp(frame.acc.x, -PLAYER_ACCELERATION, PLAYER_ACCELERATION);
+  frame.acc.y = Clamp(frame.acc.y, -PLAYER_ACCELERATION, PLAYER_ACCELERATION);
 
-  SendMessageToClients(msg);
+  player->inputs.push_back(frame);
+  player->lastQueuedSeq = frame.seq;
+
+  // a client running ahead of the server would otherwise build up latency
+  while (player->inputs.size() > MAX_QUEUED_INPUTS)
+    player->inputs.pop_front();
 }
 
 //----------------------------------------------------------------------------------
-void Server::ApplyAttractor(const Vector2f& pos, float radius)
+void Server::IntegratePlayers(float dt)
 {
-  for (MonsterData& data : _monsterData)
+  for (auto& kv : _playerData)
   {
-    MonsterState& state = data._state;
-    // Set acceleration for any mobs inside the click radius
-    if (radius > 0)
+    PlayerData& player = kv.second;
+    if (!player.alive)
+      continue;
+
+    // consume one input per tick. if none has arrived, the player keeps its
+    // last acceleration, and the client corrects when it gets the next state
+    if (!player.inputs.empty())
     {
-      Vector2f dir = pos - state._curState._pos;
-      float d = Length(dir);
-      if (d < radius)
-      {
-        // f = m * a, a = f / m
-        state._curState._acc += 1000.0f / data._size * Normalize(dir);
-      }
+      const PlayerInputFrame& frame = player.inputs.front();
+      player.state._acc = frame.acc;
+      player.lastInputSeq = frame.seq;
+      player.inputs.pop_front();
     }
+
+    UpdateState(_level, PLAYER_FRICTION, dt, &player.state);
+  }
+}
+
+//----------------------------------------------------------------------------------
+void Server::RecordHistory()
+{
+  vector<MonsterHistory::Entry>* entries = _history.BeginTick(_tick, _monsterData.size());
+  for (const MonsterData& data : _monsterData)
+  {
+    MonsterHistory::Entry entry;
+    entry.id = data._id;
+    entry.pos = data._state._pos;
+    entries->push_back(entry);
+  }
+}
+
+//----------------------------------------------------------------------------------
+void Server::ApplyAttractor(const Vector2f& pos, float radius, u32 tick)
+{
+  if (radius <= 0)
+    return;
+
+  // Find the monsters that were inside the click radius at the tick the
+  // player saw, and pull them towards the click from where they are now
+  const vector<MonsterHistory::Entry>* entries = _history.Find(tick);
+  if (!entries)
+    return;
+
+  // both the history and the monsters are sorted by id
+  auto it = _monsterData.begin();
+  for (const MonsterHistory::Entry& entry : *entries)
+  {
+    if (Length(pos - entry.pos) >= radius)
+      continue;
+
+    while (it != _monsterData.end() && it->_id < entry.id)
+      ++it;
+
+    if (it == _monsterData.end())
+      break;
+
+    // the monster has died since
+    if (it->_id != entry.id)
+      continue;
+
+    // f = m * a, a = f / m
+    it->_state._acc += 1000.0f / it->_size * Normalize(pos - it->_state._pos);
   }
 }
 
@@ -541,15 +1949,16 @@ void Server::HandleCollisions()
   for (auto it = _monsterData.begin(); it != _monsterData.end(); )
   {
     MonsterData& data = *it;
-    MonsterState& state = data._state;
-    const Vector2f& monsterPos = state._curState._pos;
+    const Vector2f& monsterPos = data._state._pos;
 
     bool deleteMonster = false;
     for (auto& kv : _playerData)
     {
       PlayerData& player = kv.second;
+      if (player.spectator)
+        continue;
 
-      Vector2f dir = player.pos - monsterPos;
+      Vector2f dir = player.state._pos - monsterPos;
       float d = Length(dir);
       if (d < data._size)
       {
@@ -561,11 +1970,22 @@ void Server::HandleCollisions()
         }
         deleteMonster = true;
         ToProtocol(m->mutable_pos()->Add(), monsterPos);
+        m->add_id(data._id);
+
+        MonsterDeath death;
+        death.tick = _tick;
+        death.id = data._id;
+        _monsterDeaths.push_back(death);
       }
     }
 
     if (deleteMonster)
     {
+      if (_config.lockstep())
+      {
+        _lockstep.RemoveMonster(data._id);
+        _lockstepFrame.add_removed_id(data._id);
+      }
       it = _monsterData.erase(it);
     }
     else
@@ -580,6 +2000,14 @@ void Server::HandleCollisions()
     SendMessageToClients(msg);
   }
 
+  // deaths are only needed for as long as a session can be resumed
+  u32 logTicks = (u32)(_config.session_timeout_ms() / (TIMESTEP * 1000)) + 1;
+  while (!_monsterDeaths.empty() && _tick - _monsterDeaths.front().tick > logTicks)
+  {
+    _deathsLoggedAfter = _monsterDeaths.front().tick;
+    _monsterDeaths.pop_front();
+  }
+
   int numPlayersAlive = 0;
   u32 firstLiving = ~0;
   for (auto& kv : _playerData)
@@ -592,8 +2020,9 @@ void Server::HandleCollisions()
     }
   }
 
-  if (_connectedClients.size() == 1 && numPlayersAlive == 0 ||
-      _connectedClients.size() > 1 && numPlayersAlive == 1)
+  u32 numPlaying = NumPlayingClients();
+  if (numPlaying == 1 && numPlayersAlive == 0 ||
+      numPlaying > 1 && numPlayersAlive == 1)
   {
     game::ServerMessage msg;
     msg.set_type(game::ServerMessage_Type_GAME_ENDED);
@@ -604,6 +2033,76 @@ void Server::HandleCollisions()
 
 }
 
+//----------------------------------------------------------------------------------
+void Server::InitLockstep()
+{
+  // the monsters are rounded to fixed point once, and the float copy follows
+  // the fixed point simulation from then on
+  _lockstep.Clear(_tick);
+  for (MonsterData& data : _monsterData)
+  {
+    LockstepSwarm::Monster monster;
+    monster.id = data._id;
+    monster.state._pos = FixedFromFloat(data._state._pos);
+    monster.state._vel = FixedFromFloat(data._state._vel);
+    monster.size = FixedFromFloat(data._size);
+    _lockstep.AddMonster(monster);
+
+    data._state._pos = FixedToFloat(monster.state._pos);
+    data._state._vel = FixedToFloat(monster.state._vel);
+  }
+
+  _lockstepFrame.Clear();
+  _lockstepFrames.Clear();
+}
+
+//----------------------------------------------------------------------------------
+void Server::StepLockstep()
+{
+  _lockstepFrame.set_tick(_tick);
+  for (const MonsterAttractor& a : _attractors)
+  {
+    if (a.radius <= 0)
+      continue;
+
+    game::LockstepAttractor* attractor = _lockstepFrame.add_attractor();
+    attractor->set_x(FixedFromFloat(a.pos.x));
+    attractor->set_y(FixedFromFloat(a.pos.y));
+    attractor->set_radius(FixedFromFloat(a.radius));
+  }
+
+  _lockstep.Step(_level, _lockstepFrame);
+
+  u32 hashTicks = max<u32>(1, (u32)(_config.lockstep_hash_interval_ms() / (TIMESTEP * 1000)));
+  if (_lockstep.GetTick() % hashTicks == 0)
+    _lockstepFrame.set_hash(_lockstep.Hash());
+
+  // the deaths are mirrored as they happen, so both lists are in the same order
+  const vector<LockstepSwarm::Monster>& monsters = _lockstep.GetMonsters();
+  for (size_t i = 0; i < monsters.size() && i < _monsterData.size(); ++i)
+  {
+    PhysicsState& state = _monsterData[i]._state;
+    state._acc = FixedToFloat(monsters[i].state._acc);
+    state._vel = FixedToFloat(monsters[i].state._vel);
+    state._pos = FixedToFloat(monsters[i].state._pos);
+  }
+
+  if (_lockstepFrame.removed_id_size() || _lockstepFrame.attractor_size() || _lockstepFrame.has_hash())
+    _lockstepFrames.add_frame()->Swap(&_lockstepFrame);
+  _lockstepFrame.Clear();
+}
+
+//----------------------------------------------------------------------------------
+void Server::TakeLockstepFrames(game::ServerMessage* msg)
+{
+  msg->set_type(game::ServerMessage_Type_LOCKSTEP_FRAMES);
+  game::LockstepFrames* frames = msg->mutable_lockstep_frames();
+  frames->Swap(&_lockstepFrames);
+  frames->set_tick(_tick);
+  frames->set_server_time(_simTime);
+  _lockstepFrames.Clear();
+}
+
 //----------------------------------------------------------------------------------
 void Server::ResetGame()
 {
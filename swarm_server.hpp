@@ -2,7 +2,17 @@
 #include "level.hpp"
 #include "physics.hpp"
 #include "shared.hpp"
-#include "protocol/game.pb.h"
+#include "protocol.hpp"
+#include "wire_codec.hpp"
+#include "swarm_compression.hpp"
+#include "tick_profiler.hpp"
+#include "monster_history.hpp"
+#include "dead_reckoning.hpp"
+#include "udp_channel.hpp"
+#include "initial_state_encoder.hpp"
+#include "local_channel.hpp"
+#include "shared_snapshot.hpp"
+#include "lockstep.hpp"
 
 namespace swarm
 {
@@ -18,79 +28,339 @@ namespace swarm
     bool Close();
 
     u16 GetPort() const { return _port; }
+    const TickProfiler& GetTickProfiler() const { return _profiler; }
+
+    struct ClientStats
+    {
+      u32 playerId;
+      u32 budgetBytesPerSec;
+      // rates over the last second
+      u32 bytesPerSec;
+      u32 monstersPerSec;
+      // monsters that needed sending, but didn't fit in the last snapshot
+      u32 monstersDeferred;
+      u64 totalBytesSent;
+      // states go over udp once a datagram has arrived from the client
+      bool udp;
+      u64 swarmStatesLost;
+      // as measured by the client, 0 until it has synced its clock
+      float rttMs;
+    };
+
+    // Can be called from any thread
+    void GetClientStats(vector<ClientStats>* stats) const;
+
+    // Connects a client in the same process, without a socket. Can be called
+    // from any thread.
+    shared_ptr<LocalChannel> ConnectLocal();
+
+    // The simulation phases of a tick. These are public so the benchmarks can
+    // drive the server without any sockets or server thread.
+    bool InitSimulation(const game::Config& config);
+    u32 AddSimulatedPlayer();
+    void AddAttractor(const Vector2f& pos, float radius);
+    void ApplyAttractors();
+    void Integrate(float dt);
+    void HandleCollisions();
+    bool EncodeMonsterState(u32 playerId, vector<char>& buf);
+    size_t GetNumMonsters() const { return _monsterData.size(); }
+    u32 GetTick() const { return _tick; }
 
   private:
+    struct PlayerData;
 
     bool InitLevel();
-    void PlayerAdded(TcpSocket* socket);
+    struct ClientConnection;
+    void AcceptLocalClients(const Time& now);
+    void HandlePendingClients(const Time& now);
+    void PlayerAdded(ClientConnection* client, const game::PlayerHello& hello);
+    bool ResumeSession(PlayerData* player, u32 lastTick);
+    void ExpireSessions(const Time& now);
+    u32 NumPlayingClients() const;
+    u64 NewSessionToken() const;
 
-    void UpdateState(PhysicsState& state, float dt);
+    struct ClientView;
+    void UpdateClientView(ClientView* view);
+    void SelectMonsters(PlayerData* player);
+    void EncodePackedMonsterState(ClientView* view, vector<char>& buf);
+    float AggregateDistance(const PlayerData& player) const;
+    void AssignClusters();
+    void FillSwarmState(game::SwarmState* state, PlayerData* player);
+    u32 QueueInitialState(ClientConnection* client, PlayerData* player, game::SwarmState* state);
+    void SendInitialStates(const Time& now);
+    u32 MonsterRefreshTicks() const;
+    void AddBytesSent(PlayerData* player, size_t bytes);
+    void UpdateClientStats();
+    void FillPlayerState(game::PlayerState* state);
+    void PublishSharedSnapshot();
+    bool EncodePlayerState(vector<char>& buf);
 
-    void SendPlayerState();
-    void SendMonsterState(float alpha);
-    void SendToClients(const vector<char>& buf);
-    bool SendToClient(const vector<char>& buf, TcpSocket* socket);
+    bool SendToClient(const vector<char>& buf, ClientConnection* client);
+    bool SendToSocket(const vector<char>& buf, ClientConnection* client);
+    void FlushSocket(ClientConnection* client);
+    bool SendToLocal(const ServerMessagePtr& msg, ClientConnection* client);
+    void SendLocalStates(ClientConnection* client, const ServerMessagePtr& lockstepFrames, ServerMessagePtr* playerState);
 
     void HandleClientMessages();
-    void ApplyAttractor(const Vector2f& pos, float radius);
+    void HandleDatagrams();
+    void HandlePlayerMessage(ClientConnection* client, const game::PlayerMessage& msg, bool udp);
+    void HandlePlayerInputs(ClientConnection* client, const vector<wire::PlayerInput>& inputs);
+    void HandlePing(ClientConnection* client, const game::Ping& ping, bool udp);
+    double GetServerTime() const;
+    bool WriteDatagrams(ClientConnection* client, PlayerData* player, const vector<char>* playerStateBuf);
+    void SwarmStateLost(ClientView* view, u16 seq);
+    u32 NewUdpToken() const;
+    void RemoveDisconnectedClients(const Time& now);
+    void ApplyAttractor(const Vector2f& pos, float radius, u32 tick);
+    void RecordHistory();
+    void QueuePlayerInput(PlayerData* player, const wire::PlayerInput& input);
+    void IntegratePlayers(float dt);
     void SendPlayerDied(u32 id);
 
-    void HandleCollisions();
+    void InitLockstep();
+    void StepLockstep();
+    void TakeLockstepFrames(game::ServerMessage* msg);
 
     void ResetGame();
 
     void ThreadProc();
 
-    template <typename T>
-    bool PackMessage(vector<char>& buf, const T& msg);
-
-    template <typename T>
-    bool SendMessageToClients(const T& msg);
+    bool SendMessageToClients(const game::ServerMessage& msg);
 
-    void AddMonster(const Vector2f& pos, float size);
+    void AddMonster(const Vector2f& pos, float size, u32 swarm);
 
     struct MonsterAttractor
     {
-      MonsterAttractor(const Vector2f& pos, float radius) : pos(pos), radius(radius) {}
+      MonsterAttractor(const Vector2f& pos, float radius, u32 tick) : pos(pos), radius(radius), tick(tick) {}
       Vector2f pos;
       float radius;
+      // the tick whose monster positions the click is evaluated against
+      u32 tick;
+    };
+
+    struct PlayerInputFrame
+    {
+      u32 seq;
+      Vector2f acc;
+    };
+
+    // What a client has been sent about a monster
+    struct MonsterView
+    {
+      // the last sent state, extrapolated like the client does
+      PhysicsState sentState;
+      u32 id;
+      u32 sentTick;
+      // grows every snapshot the monster needs sending but doesn't fit in
+      float priority;
+      bool known;
+      // the client has no copy of its own, as it's never been sent, or it's
+      // too far from the player and the client has been told to drop it.
+      // with aggregation on, it's then part of an aggregate
+      bool aggregated;
+    };
+
+    // The monsters in a swarm state sent over udp, so they can be resent if
+    // the state is lost
+    struct SentSwarmState
+    {
+      SentSwarmState() : seq(0), tick(0) {}
+      u16 seq;
+      u32 tick;
+      vector<u32> ids;
+      // the monsters the state moved into aggregates
+      vector<u32> aggregatedIds;
+    };
+
+    // Per client copy of the swarm as the client sees it, and its bandwidth
+    struct ClientView
+    {
+      ClientView()
+        : tick(0), snapshotTick(0), budget(0), bytesPerMonster(0), statsTick(0), windowBytes(0), windowMonsters(0)
+        , bytesPerSec(0), monstersPerSec(0), monstersDeferred(0), totalBytesSent(0), swarmStatesLost(0) {}
+
+      // sorted by id, and extrapolated to tick
+      vector<MonsterView> monsters;
+      u32 tick;
+      u32 snapshotTick;
+      float budget;
+      // running average of what a monster costs in this client's states,
+      // which depends on the compression and how alike the monsters are
+      float bytesPerMonster;
+      // indexed by seq, and overwritten once the state is too old to be lost
+      vector<SentSwarmState> udpSent;
+
+      u32 statsTick;
+      u32 windowBytes;
+      u32 windowMonsters;
+      u32 bytesPerSec;
+      u32 monstersPerSec;
+      u32 monstersDeferred;
+      u64 totalBytesSent;
+      u64 swarmStatesLost;
     };
 
     struct PlayerData
     {
-      PlayerData() : id(~0), sentStartGame(false), alive(true) {}
+      PlayerData()
+        : id(~0), sessionToken(0), resumeTick(0), lastInputSeq(0), lastQueuedSeq(0)
+        , sentStartGame(false), resuming(false), connected(true), alive(true), spectator(false) {}
       u32 id;
-      Vector2f pos;
+      u64 sessionToken;
+      // when the connection was lost. the session is kept for a while, so
+      // the client can reconnect and pick up where it left off
+      Time disconnectTime;
+      // the last tick the client applied before it reconnected
+      u32 resumeTick;
+      PhysicsState state;
+      ClientView view;
+      // inputs received but not yet simulated, one is consumed per tick
+      deque<PlayerInputFrame> inputs;
+      u32 lastInputSeq;
+      u32 lastQueuedSeq;
       int health;
       bool sentStartGame;
+      bool resuming;
+      bool connected;
       bool alive;
+      // watches without a player in the game
+      bool spectator;
     };
 
     struct MonsterData
     {
-      MonsterState _state;
+      PhysicsState _state;
+      u32 _id;
+      // the swarm it was spawned in
+      u32 _swarm;
       float _size;
       int _health;
     };
 
     vector<MonsterData> _monsterData;
     vector<MonsterAttractor> _attractors;
+    MonsterHistory _history;
+
+    // in lockstep mode the monsters are simulated here, and _monsterData is
+    // a copy. the frame for the current tick collects the deaths and clicks,
+    // and the frames since the last send are kept for the clients
+    LockstepSwarm _lockstep;
+    game::LockstepFrame _lockstepFrame;
+    game::LockstepFrames _lockstepFrames;
+
+    // recent monster deaths, so a resumed client can be told about the ones
+    // it missed. every death after _deathsLoggedAfter is in the log
+    struct MonsterDeath
+    {
+      u32 tick;
+      u32 id;
+    };
+    deque<MonsterDeath> _monsterDeaths;
+    u32 _deathsLoggedAfter;
 
     Level _level;
 
-    vector<TcpSocket *> _connectedClients;
-    map<pair<u32, u16>, u32> _addrToId;
+    struct ClientConnection
+    {
+      ClientConnection(TcpSocket* socket, u32 playerId);
+      ~ClientConnection();
+      // a local client has a channel instead of a socket
+      TcpSocket* socket;
+      shared_ptr<LocalChannel> local;
+      // 0 until the client has said hello
+      u32 playerId;
+      u32 connectionId;
+      Time connectTime;
+      vector<char> snapshotBuf;
+      MessageReader reader;
+      // the part of the stream the socket hasn't taken yet
+      vector<char> pending;
+      // the states go over udp once a datagram from the client has shown the
+      // server where to send them
+      UdpChannel udp;
+      UdpAddress udpAddr;
+      bool udpReady;
+      // set if the client stopped acking, in which case it stays on tcp
+      bool udpFailed;
+      // the round trip time the client last reported
+      float rttMs;
+
+      // while the initial state streams, the client gets no swarm states,
+      // and other messages wait until the state is complete
+      deque<vector<char>> initialChunks;
+      deque<vector<char>> deferred;
+      u32 chunksToSend;
+      float chunkBudget;
+      Time lastChunkTime;
+      bool streaming;
+
+      bool disconnected;
+    };
+
+    // connections that haven't said hello yet
+    vector<ClientConnection*> _pendingClients;
+    vector<ClientConnection*> _connectedClients;
+    // session token to player id
+    map<u64, u32> _sessions;
 
     typedef map<u32, PlayerData> PlayerDataById;
     PlayerDataById _playerData;
 
+    // scratch space for building snapshots
+    vector<MonsterView> _viewScratch;
+    vector<u32> _sendCandidates;
+    wire::SwarmState _packedState;
+    SwarmCompressor _compressor;
+
+    // the aggregate each monster falls in, by swarm and grid cell. they're
+    // the same for every client, so they're worked out once per tick, and
+    // each client only sums up the monsters that are far from it.
+    struct AggregateSum
+    {
+      double pos[2];
+      double vel[2];
+      double distSq;
+      double size;
+      u32 count;
+    };
+    vector<u32> _monsterClusters;
+    vector<u32> _clusterIds;
+    u32 _clusterTick;
+    vector<AggregateSum> _aggregateSums;
+    // what SelectMonsters leaves for the swarm state, next to the candidates
+    vector<u32> _aggregatedIds;
+    vector<wire::Aggregate> _aggregates;
+    // inputs decoded by the wire codec
+    vector<wire::PlayerInput> _decodedInputs;
+
+    mutable mutex _statsMutex;
+    vector<ClientStats> _clientStats;
+
+    mutex _localMutex;
+    vector<shared_ptr<LocalChannel>> _newLocalClients;
+
+    InitialStateEncoder _initialStateEncoder;
+    TickProfiler _profiler;
     thread* _serverThread;
-    u8 _networkBuffer[32*1024];
 
     TcpListener _listener;
+    DatagramSocket _udpSocket;
+    SharedSnapshotWriter _sharedSnapshot;
+    vector<char> _udpSendBuf;
+    vector<Datagram> _datagrams;
     u16 _port;
     atomic<bool> _done;
     u32 _nextPlayerId;
+    u32 _nextConnectionId;
+    u32 _nextMonsterId;
+
+    // the simulation tick, and time in seconds
+    u32 _tick;
+    double _simTime;
+    // real time since the last tick, that hasn't been simulated yet
+    Clock _clock;
+    Time _lastUpdate;
+    double _accumulator;
     game::Config _config;
     bool _gameStarted;
   };
@@ -0,0 +1,159 @@
+#include "tick_profiler.hpp"
+#include "error.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock ProfileClock;
+
+  u64 NsBetween(const ProfileClock::time_point& a, const ProfileClock::time_point& b)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count();
+  }
+}
+
+//-----------------------------------------------------------------------------
+TickProfiler::TickProfiler(time_duration tickBudget, time_duration windowLength)
+  : _windows(new Window[2])
+  , _currentWindow(0)
+  , _tickStart(ProfileClock::now())
+  , _windowStart(_tickStart)
+  , _lastOverrunLog(_tickStart)
+  , _tickBudgetNs(tickBudget.total_microseconds() * 1000)
+  , _windowLengthNs(windowLength.total_microseconds() * 1000)
+  , _overruns(0)
+{
+  memset(_lastTickPhaseNs, 0, sizeof(_lastTickPhaseNs));
+}
+
+//-----------------------------------------------------------------------------
+TickProfiler::~TickProfiler()
+{
+  delete[] _windows;
+}
+
+//-----------------------------------------------------------------------------
+void TickProfiler::BeginTick()
+{
+  _tickStart = ProfileClock::now();
+  memset(_lastTickPhaseNs, 0, sizeof(_lastTickPhaseNs));
+}
+
+//-----------------------------------------------------------------------------
+void TickProfiler::AddSample(TickPhase phase, u64 ns)
+{
+  _windows[_currentWindow.load(std::memory_order_relaxed)].phases[(int)phase].Record(ns);
+  _lastTickPhaseNs[(int)phase] += ns;
+}
+
+//-----------------------------------------------------------------------------
+void TickProfiler::EndTick()
+{
+  ProfileClock::time_point now = ProfileClock::now();
+  u64 tickNs = NsBetween(_tickStart, now);
+  int cur = _currentWindow.load(std::memory_order_relaxed);
+  _windows[cur].ticks.Record(tickNs);
+
+  if (tickNs > _tickBudgetNs)
+  {
+    // log the overrunning tick, but at most once a second
+    ++_overruns;
+    if (NsBetween(_lastOverrunLog, now) > 1000 * 1000 * 1000)
+    {
+      LOG_WARN("Tick over budget"
+          << LogKeyValue("tick_us", tickNs / 1000)
+          << LogKeyValue("budget_us", _tickBudgetNs / 1000)
+          << LogKeyValue("overruns", _overruns)
+          << LogKeyValue("accept_us", _lastTickPhaseNs[(int)TickPhase::Accept] / 1000)
+          << LogKeyValue("client_input_us", _lastTickPhaseNs[(int)TickPhase::ClientInput] / 1000)
+          << LogKeyValue("attractors_us", _lastTickPhaseNs[(int)TickPhase::Attractors] / 1000)
+          << LogKeyValue("integration_us", _lastTickPhaseNs[(int)TickPhase::Integration] / 1000)
+          << LogKeyValue("collisions_us", _lastTickPhaseNs[(int)TickPhase::Collisions] / 1000)
+          << LogKeyValue("serialization_us", _lastTickPhaseNs[(int)TickPhase::Serialization] / 1000)
+          << LogKeyValue("send_us", _lastTickPhaseNs[(int)TickPhase::Send] / 1000));
+      LogStats("overrun");
+      _lastOverrunLog = now;
+      _overruns = 0;
+    }
+  }
+
+  // start recording into the other window, which becomes readable once this
+  // one is complete
+  if (NsBetween(_windowStart, now) > _windowLengthNs)
+  {
+    int next = 1 - cur;
+    for (AtomicHistogram<>& h : _windows[next].phases)
+      h.Reset();
+    _windows[next].ticks.Reset();
+    _currentWindow.store(next, std::memory_order_release);
+    _windowStart = now;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TickProfiler::PhaseStats TickProfiler::StatsFromHistogram(const AtomicHistogram<>& h)
+{
+  Histogram<> snapshot;
+  h.Snapshot(&snapshot);
+
+  PhaseStats stats;
+  stats.count = snapshot.GetCount();
+  stats.p50 = snapshot.GetPercentile(0.5);
+  stats.p99 = snapshot.GetPercentile(0.99);
+  stats.max = snapshot.GetMax();
+  return stats;
+}
+
+//-----------------------------------------------------------------------------
+TickProfiler::PhaseStats TickProfiler::GetPhaseStats(TickPhase phase) const
+{
+  int prev = 1 - _currentWindow.load(std::memory_order_acquire);
+  return StatsFromHistogram(_windows[prev].phases[(int)phase]);
+}
+
+//-----------------------------------------------------------------------------
+TickProfiler::PhaseStats TickProfiler::GetTickStats() const
+{
+  int prev = 1 - _currentWindow.load(std::memory_order_acquire);
+  return StatsFromHistogram(_windows[prev].ticks);
+}
+
+//-----------------------------------------------------------------------------
+void TickProfiler::LogStats(const char* reason) const
+{
+  PhaseStats tick = GetTickStats();
+  LOG_INFO("Tick stats"
+      << LogKeyValue("reason", reason)
+      << LogKeyValue("ticks", tick.count)
+      << LogKeyValue("p50_us", tick.p50 / 1000)
+      << LogKeyValue("p99_us", tick.p99 / 1000)
+      << LogKeyValue("max_us", tick.max / 1000));
+
+  for (int i = 0; i < NUM_PHASES; ++i)
+  {
+    PhaseStats stats = GetPhaseStats((TickPhase)i);
+    LOG_INFO("Phase stats"
+        << LogKeyValue("phase", PhaseName((TickPhase)i))
+        << LogKeyValue("count", stats.count)
+        << LogKeyValue("p50_us", stats.p50 / 1000)
+        << LogKeyValue("p99_us", stats.p99 / 1000)
+        << LogKeyValue("max_us", stats.max / 1000));
+  }
+}
+
+//-----------------------------------------------------------------------------
+const char* TickProfiler::PhaseName(TickPhase phase)
+{
+  switch (phase)
+  {
+    case TickPhase::Accept: return "accept";
+    case TickPhase::ClientInput: return "client_input";
+    case TickPhase::Attractors: return "attractors";
+    case TickPhase::Integration: return "integration";
+    case TickPhase::Collisions: return "collisions";
+    case TickPhase::Serialization: return "serialization";
+    case TickPhase::Send: return "send";
+    default: return "unknown";
+  }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include "histogram.hpp"
+
+namespace swarm
+{
+  enum class TickPhase
+  {
+    Accept,
+    ClientInput,
+    Attractors,
+    Integration,
+    Collisions,
+    Serialization,
+    Send,
+    NumPhases,
+  };
+
+  //-----------------------------------------------------------------------------
+  // Collects the time spent in each phase of the server tick. The tick thread
+  // records into one window of histograms while the previous window stays
+  // readable, so the stats can be queried from any thread without locking.
+  class TickProfiler
+  {
+  public:
+    struct PhaseStats
+    {
+      u64 count;
+      u64 p50;
+      u64 p99;
+      u64 max;
+    };
+
+    TickProfiler(time_duration tickBudget, time_duration windowLength);
+    ~TickProfiler();
+
+    void BeginTick();
+    void EndTick();
+    void AddSample(TickPhase phase, u64 ns);
+
+    // Stats (in ns) over the last complete window
+    PhaseStats GetPhaseStats(TickPhase phase) const;
+    PhaseStats GetTickStats() const;
+    void LogStats(const char* reason) const;
+
+    static const char* PhaseName(TickPhase phase);
+
+  private:
+    enum { NUM_PHASES = (int)TickPhase::NumPhases };
+
+    struct Window
+    {
+      AtomicHistogram<> phases[NUM_PHASES];
+      AtomicHistogram<> ticks;
+    };
+
+    static PhaseStats StatsFromHistogram(const AtomicHistogram<>& h);
+
+    // the histograms are a few hundred KB, so keep them off the stack
+    Window* _windows;
+    atomic<int> _currentWindow;
+
+    std::chrono::high_resolution_clock::time_point _tickStart;
+    std::chrono::high_resolution_clock::time_point _windowStart;
+    std::chrono::high_resolution_clock::time_point _lastOverrunLog;
+    u64 _tickBudgetNs;
+    u64 _windowLengthNs;
+    u64 _lastTickPhaseNs[NUM_PHASES];
+    u32 _overruns;
+
+    DISALLOW_COPY_AND_ASSIGN(TickProfiler);
+  };
+
+  //-----------------------------------------------------------------------------
+  class ScopedPhaseTimer
+  {
+  public:
+    ScopedPhaseTimer(TickProfiler* profiler, TickPhase phase)
+      : _profiler(profiler)
+      , _phase(phase)
+      , _start(std::chrono::high_resolution_clock::now())
+    {
+    }
+
+    ~ScopedPhaseTimer()
+    {
+      auto elapsed = std::chrono::high_resolution_clock::now() - _start;
+      _profiler->AddSample(_phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+  private:
+    TickProfiler* _profiler;
+    TickPhase _phase;
+    std::chrono::high_resolution_clock::time_point _start;
+  };
+}
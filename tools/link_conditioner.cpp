@@ -0,0 +1,800 @@
+#include "protocol.hpp"
+#include "datagram_socket.hpp"
+#include "udp_channel.hpp"
+#include "histogram.hpp"
+#include <random>
+
+// A proxy that sits between the clients and a server, and puts the traffic
+// through a simulated network link, so the netcode can be measured under
+// latency, jitter, loss, reordering and bandwidth limits on a single box.
+//
+// Clients connect to the conditioner as if it was the server. Every client
+// gets a connection of its own to the server, and a link of its own, with
+// separate conditions client to server (up) and server to client (down).
+// The tcp stream is conditioned a message at a time, and stays reliable and
+// in order: a lost message is resent after a retransmission timeout, and
+// holds up everything behind it. The udp port in GameStarted is replaced
+// with the conditioner's, so the datagrams go through it as well, and those
+// are lost, reordered and duplicated for real.
+//
+// The conditions are given on the command line, and apply both ways, or by
+// a LinkScript (see game.proto) that changes them over time. The steps are
+// taken in order, eg:
+//
+//   step { at : 0;  both { delay_ms : 40; jitter_ms : 10; } }
+//   step { at : 10; down { delay_ms : 40; loss : 0.05; loss_burst : 0.5; } }
+//   step { at : 20; both { delay_ms : 150; bytes_per_sec : 32000; } }
+//   repeat_after : 30;
+//
+// A summary of what was done to the traffic is printed every second, and
+// with -o, every packet is logged to a csv file.
+//
+// usage: link_conditioner [-s addr] [-p port] [-l listen port] [-f script.pb]
+//     [-d delay ms] [-j jitter ms] [-x loss] [-b bytes/sec] [-e seed] [-o events.csv]
+
+using namespace swarm;
+
+namespace
+{
+  const s32 CONNECT_TIMEOUT_MS = 2000;
+  const s32 STATS_INTERVAL_MS = 1000;
+  // a lost tcp message is resent after this long, plus the round trip
+  const s32 TCP_MIN_RTO_MS = 200;
+  // packets that are lost over and over again are let through in the end
+  const int MAX_RETRANSMITS = 5;
+
+  typedef std::mt19937 Random;
+
+  //-----------------------------------------------------------------------------
+  const char* DistributionName(game::LinkConditions::Distribution distribution)
+  {
+    switch (distribution)
+    {
+      case game::LinkConditions::UNIFORM: return "uniform";
+      case game::LinkConditions::NORMAL: return "normal";
+      case game::LinkConditions::PARETO: return "pareto";
+    }
+    return "unknown";
+  }
+
+  //-----------------------------------------------------------------------------
+  string ConditionsToString(const game::LinkConditions& c)
+  {
+    char bandwidth[32] = "unlimited";
+    if (c.bytes_per_sec() > 0)
+      snprintf(bandwidth, sizeof(bandwidth), "%.1f kB/s", c.bytes_per_sec() / 1e3);
+
+    char buf[256];
+    snprintf(buf, sizeof(buf), "delay: %u ms  jitter: %u ms (%s)  loss: %.1f%% (burst %.1f%%)  reorder: %.1f%%  dup: %.1f%%  bandwidth: %s",
+        c.delay_ms(), c.jitter_ms(), DistributionName(c.jitter_distribution()),
+        100 * c.loss(), 100 * c.loss_burst(), 100 * c.reorder(), 100 * c.duplicate(), bandwidth);
+    return buf;
+  }
+
+  //-----------------------------------------------------------------------------
+  // What a link did to its traffic since the last report
+  struct LinkStats
+  {
+    LinkStats() { Reset(); }
+
+    void Reset()
+    {
+      packets = 0;
+      bytes = 0;
+      lost = 0;
+      dropped = 0;
+      reordered = 0;
+      duplicated = 0;
+      retransmits = 0;
+      delays.Reset();
+    }
+
+    u64 packets;
+    u64 bytes;
+    // datagrams lost, or dropped because the link was full
+    u64 lost;
+    u64 dropped;
+    u64 reordered;
+    u64 duplicated;
+    // tcp messages that were held back by a simulated retransmission
+    u64 retransmits;
+    // time from when a packet was sent until it was delivered, in us
+    Histogram<> delays;
+  };
+
+  //-----------------------------------------------------------------------------
+  // A packet in flight on a link. The tcp messages include their size prefix.
+  struct Packet
+  {
+    Time deliverAt;
+    u64 order;
+    bool reliable;
+    vector<char> data;
+  };
+
+  struct PacketLater
+  {
+    bool operator()(const Packet* lhs, const Packet* rhs) const
+    {
+      return lhs->deliverAt != rhs->deliverAt ? lhs->deliverAt > rhs->deliverAt : lhs->order > rhs->order;
+    }
+  };
+
+  //-----------------------------------------------------------------------------
+  // One direction of a connection's link. Both the tcp messages and the
+  // datagrams go through it, so they share the bandwidth.
+  class Link
+  {
+  public:
+    Link(const game::LinkConditions* conditions, LinkStats* stats, Random* random);
+    ~Link();
+
+    // Puts a packet on the link. Returns what happened to it, for the log.
+    const char* Send(Time now, bool reliable, const char* data, size_t size, Time* deliverAt);
+    // Returns the next packet that has arrived by now, if any. The packet is
+    // owned by the link, and valid until the next call.
+    const Packet* Receive(Time now);
+
+  private:
+    Time SampleJitter();
+    bool SampleLoss();
+    Packet* Enqueue(Time now, Time deliverAt, bool reliable, const char* data, size_t size);
+
+    const game::LinkConditions* _conditions;
+    LinkStats* _stats;
+    Random* _random;
+    std::uniform_real_distribution<float> _uniform;
+
+    priority_queue<Packet*, vector<Packet*>, PacketLater> _inFlight;
+    Packet* _delivered;
+    u64 _nextOrder;
+
+    // when the last packet put on the link has been fully sent, for the
+    // bandwidth limit
+    Time _linkFree;
+    // tcp is delivered in order, so nothing arrives before this
+    Time _lastReliable;
+    bool _lastLost;
+  };
+
+  //-----------------------------------------------------------------------------
+  Link::Link(const game::LinkConditions* conditions, LinkStats* stats, Random* random)
+    : _conditions(conditions)
+    , _stats(stats)
+    , _random(random)
+    , _uniform(0, 1)
+    , _delivered(nullptr)
+    , _nextOrder(0)
+    , _lastLost(false)
+  {
+  }
+
+  //-----------------------------------------------------------------------------
+  Link::~Link()
+  {
+    delete _delivered;
+    while (!_inFlight.empty())
+    {
+      delete _inFlight.top();
+      _inFlight.pop();
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  Time Link::SampleJitter()
+  {
+    float jitter = (float)_conditions->jitter_ms();
+    if (jitter <= 0)
+      return Time::Zero;
+
+    float ms = 0;
+    switch (_conditions->jitter_distribution())
+    {
+      case game::LinkConditions::UNIFORM:
+        ms = jitter * _uniform(*_random);
+        break;
+
+      case game::LinkConditions::NORMAL:
+        ms = fabs(std::normal_distribution<float>(0, jitter)(*_random));
+        break;
+
+      case game::LinkConditions::PARETO:
+        // lomax with shape 2, which has a mean of the scale
+        ms = jitter * (1 / sqrtf(max(1e-6f, 1 - _uniform(*_random))) - 1);
+        break;
+    }
+
+    return sf::microseconds((s64)(ms * 1000));
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Link::SampleLoss()
+  {
+    float p = _lastLost && _conditions->loss_burst() > 0 ? _conditions->loss_burst() : _conditions->loss();
+    _lastLost = p > 0 && _uniform(*_random) < p;
+    return _lastLost;
+  }
+
+  //-----------------------------------------------------------------------------
+  const char* Link::Send(Time now, bool reliable, const char* data, size_t size, Time* deliverAt)
+  {
+    const game::LinkConditions& c = *_conditions;
+
+    // a datagram that is lost never takes up any bandwidth past this point
+    if (!reliable && SampleLoss())
+    {
+      ++_stats->lost;
+      return "lost";
+    }
+
+    // the link sends one packet at a time, at its bandwidth, and a datagram
+    // that would have to queue for too long is dropped
+    Time start = max(now, _linkFree);
+    if (c.bytes_per_sec() > 0)
+    {
+      if (!reliable && (start - now).asMilliseconds() > (s32)c.queue_ms())
+      {
+        ++_stats->dropped;
+        return "dropped";
+      }
+      _linkFree = start + sf::microseconds((s64)size * 1000000 / c.bytes_per_sec());
+    }
+    else
+    {
+      _linkFree = start;
+    }
+
+    Time latency = sf::milliseconds(c.delay_ms());
+    Time arrival = _linkFree + latency + SampleJitter();
+    const char* action = "sent";
+
+    if (reliable)
+    {
+      // tcp resends a lost segment after a timeout, and everything after it
+      // waits in the receiver's buffer until it gets there
+      int retransmits = 0;
+      while (retransmits < MAX_RETRANSMITS && SampleLoss())
+      {
+        arrival += sf::milliseconds(TCP_MIN_RTO_MS) + latency * 2.0f;
+        ++retransmits;
+      }
+
+      if (retransmits > 0)
+      {
+        _stats->retransmits += retransmits;
+        action = "retransmitted";
+      }
+
+      arrival = max(arrival, _lastReliable);
+      _lastReliable = arrival;
+    }
+    else
+    {
+      if (c.reorder() > 0 && _uniform(*_random) < c.reorder())
+      {
+        arrival += sf::milliseconds(c.reorder_ms());
+        ++_stats->reordered;
+        action = "reordered";
+      }
+
+      if (c.duplicate() > 0 && _uniform(*_random) < c.duplicate())
+      {
+        Enqueue(now, _linkFree + latency + SampleJitter(), false, data, size);
+        ++_stats->duplicated;
+        action = "duplicated";
+      }
+    }
+
+    Enqueue(now, arrival, reliable, data, size);
+    *deliverAt = arrival;
+    return action;
+  }
+
+  //-----------------------------------------------------------------------------
+  Packet* Link::Enqueue(Time now, Time deliverAt, bool reliable, const char* data, size_t size)
+  {
+    Packet* packet = new Packet();
+    packet->deliverAt = deliverAt;
+    packet->order = _nextOrder++;
+    packet->reliable = reliable;
+    packet->data.assign(data, data + size);
+    _inFlight.push(packet);
+
+    ++_stats->packets;
+    _stats->bytes += size;
+    _stats->delays.Record((u64)max((s64)0, (deliverAt - now).asMicroseconds()));
+    return packet;
+  }
+
+  //-----------------------------------------------------------------------------
+  const Packet* Link::Receive(Time now)
+  {
+    delete _delivered;
+    _delivered = nullptr;
+
+    if (_inFlight.empty() || _inFlight.top()->deliverAt > now)
+      return nullptr;
+
+    _delivered = _inFlight.top();
+    _inFlight.pop();
+    return _delivered;
+  }
+
+  //-----------------------------------------------------------------------------
+  // A client, and its own connection to the server
+  struct Session
+  {
+    Session(u32 id, TcpSocket* client, const game::LinkConditions* upConditions, const game::LinkConditions* downConditions,
+        LinkStats* upStats, LinkStats* downStats, Random* random)
+      : id(id)
+      , client(client)
+      , server(new TcpSocket())
+      , up(upConditions, upStats, random)
+      , down(downConditions, downStats, random)
+      , udpToken(0)
+      , hasUdpToken(false)
+      , disconnected(false)
+    {
+    }
+
+    ~Session()
+    {
+      delete client;
+      delete server;
+    }
+
+    u32 id;
+    TcpSocket* client;
+    TcpSocket* server;
+    MessageReader clientReader;
+    MessageReader serverReader;
+    // bytes delivered by the links, that the sockets haven't taken yet
+    vector<char> toClient;
+    vector<char> toServer;
+    Link up;
+    Link down;
+
+    // the client's datagrams are sent on to the server from a socket of
+    // their own, so the server can tell the clients apart
+    DatagramSocket udp;
+    UdpAddress clientUdpAddr;
+    u32 udpToken;
+    bool hasUdpToken;
+
+    bool disconnected;
+  };
+
+  //-----------------------------------------------------------------------------
+  class Conditioner
+  {
+  public:
+    Conditioner();
+    ~Conditioner();
+
+    bool Init(const IpAddress& addr, u16 port, u16 listenPort, const game::LinkConditions& conditions,
+        const game::LinkScript& script, u32 seed, const char* logFile);
+    void Update();
+
+  private:
+    void RunScript(Time now);
+    void AcceptClients();
+    void ReceiveTcp(Session* session, Time now);
+    void ReceiveUdp(Time now);
+    void Deliver(Session* session, Time now);
+    bool Flush(TcpSocket* socket, vector<char>* buf);
+    void LogPacket(Time now, const Session* session, const char* dir, bool reliable, size_t size,
+        const char* action, Time deliverAt);
+    void PrintStats(Time now);
+
+    IpAddress _serverAddr;
+    u16 _serverPort;
+    UdpAddress _serverUdpAddr;
+
+    TcpListener _listener;
+    DatagramSocket _udpSocket;
+    vector<Session*> _sessions;
+    TcpSocket* _nextClient;
+    u32 _nextSessionId;
+
+    game::LinkConditions _upConditions;
+    game::LinkConditions _downConditions;
+    game::LinkScript _script;
+    int _nextStep;
+    Time _scriptStart;
+
+    LinkStats _upStats;
+    LinkStats _downStats;
+    Random _random;
+    FILE* _log;
+
+    Clock _clock;
+    Time _nextStats;
+    game::ServerMessage _message;
+    vector<char> _buf;
+  };
+
+  //-----------------------------------------------------------------------------
+  Conditioner::Conditioner()
+    : _serverPort(0)
+    , _nextClient(new TcpSocket())
+    , _nextSessionId(1)
+    , _nextStep(0)
+    , _log(nullptr)
+  {
+  }
+
+  //-----------------------------------------------------------------------------
+  Conditioner::~Conditioner()
+  {
+    SeqDelete(&_sessions);
+    delete _nextClient;
+    if (_log)
+      fclose(_log);
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Conditioner::Init(const IpAddress& addr, u16 port, u16 listenPort, const game::LinkConditions& conditions,
+      const game::LinkScript& script, u32 seed, const char* logFile)
+  {
+    _serverAddr = addr;
+    _serverPort = port;
+    _upConditions = conditions;
+    _downConditions = conditions;
+    _script = script;
+    _random.seed(seed);
+
+    _listener.setBlocking(false);
+    if (_listener.listen(listenPort) != Socket::Done)
+    {
+      printf("Unable to listen on port: %d\n", listenPort);
+      return false;
+    }
+
+    if (logFile)
+    {
+      _log = fopen(logFile, "wt");
+      if (!_log)
+      {
+        printf("Unable to open log file: %s\n", logFile);
+        return false;
+      }
+      fprintf(_log, "time_ms,session,dir,proto,size,action,delay_ms\n");
+    }
+
+    // without a udp port of its own, the clients are told the server has no
+    // udp, and everything goes over tcp
+    if (_udpSocket.Open(listenPort) || _udpSocket.Open(0))
+      printf("Conditioner listening on port: %d (udp %d), server: %s:%d\n",
+          listenPort, _udpSocket.GetPort(), addr.toString().c_str(), port);
+    else
+      printf("Conditioner listening on port: %d (no udp), server: %s:%d\n", listenPort, addr.toString().c_str(), port);
+
+    printf("up:   %s\n", ConditionsToString(_upConditions).c_str());
+    printf("down: %s\n", ConditionsToString(_downConditions).c_str());
+
+    _nextStats = sf::milliseconds(STATS_INTERVAL_MS);
+    return true;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::Update()
+  {
+    Time now = _clock.getElapsedTime();
+    RunScript(now);
+    AcceptClients();
+    ReceiveUdp(now);
+
+    for (Session* session : _sessions)
+    {
+      ReceiveTcp(session, now);
+      Deliver(session, now);
+    }
+
+    // when either end goes away, the other end is closed as well
+    for (auto it = _sessions.begin(); it != _sessions.end(); )
+    {
+      if ((*it)->disconnected)
+      {
+        printf("session %u closed\n", (*it)->id);
+        delete *it;
+        it = _sessions.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    if (now >= _nextStats)
+    {
+      PrintStats(now);
+      _nextStats += sf::milliseconds(STATS_INTERVAL_MS);
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::RunScript(Time now)
+  {
+    if (_script.step_size() == 0)
+      return;
+
+    if (_script.repeat_after() > 0 && (now - _scriptStart).asSeconds() >= _script.repeat_after())
+    {
+      _scriptStart += sf::seconds(_script.repeat_after());
+      _nextStep = 0;
+    }
+
+    float t = (now - _scriptStart).asSeconds();
+    while (_nextStep < _script.step_size() && _script.step(_nextStep).at() <= t)
+    {
+      const game::LinkScriptStep& step = _script.step(_nextStep++);
+      if (step.has_both())
+        _upConditions = _downConditions = step.both();
+      if (step.has_up())
+        _upConditions = step.up();
+      if (step.has_down())
+        _downConditions = step.down();
+
+      printf("[%.1f s] step %d\n", now.asSeconds(), _nextStep - 1);
+      printf("up:   %s\n", ConditionsToString(_upConditions).c_str());
+      printf("down: %s\n", ConditionsToString(_downConditions).c_str());
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::AcceptClients()
+  {
+    while (_listener.accept(*_nextClient) == Socket::Done)
+    {
+      Session* session = new Session(_nextSessionId++, _nextClient, &_upConditions, &_downConditions,
+          &_upStats, &_downStats, &_random);
+      _nextClient = new TcpSocket();
+
+      // the server is expected to be close by, so it's fine to block on it
+      if (session->server->connect(_serverAddr, _serverPort, sf::milliseconds(CONNECT_TIMEOUT_MS)) != Socket::Done)
+      {
+        printf("session %u: unable to connect to the server\n", session->id);
+        delete session;
+        continue;
+      }
+
+      session->client->setBlocking(false);
+      session->server->setBlocking(false);
+      if (_udpSocket.IsOpen())
+        session->udp.Open(0);
+
+      printf("session %u: %s:%d\n", session->id,
+          session->client->getRemoteAddress().toString().c_str(), session->client->getRemotePort());
+      _sessions.push_back(session);
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::ReceiveTcp(Session* session, Time now)
+  {
+    size_t received;
+    const char* data;
+    u32 size;
+    Time deliverAt;
+
+    Socket::Status status = session->clientReader.Receive(session->client, &received);
+    if (status == Socket::Disconnected || status == Socket::Error)
+      session->disconnected = true;
+
+    while (session->clientReader.NextMessage(&data, &size))
+    {
+      const char* action = session->up.Send(now, true, data - sizeof(u32), size + sizeof(u32), &deliverAt);
+      LogPacket(now, session, "up", true, size + sizeof(u32), action, deliverAt);
+    }
+
+    status = session->serverReader.Receive(session->server, &received);
+    if (status == Socket::Disconnected || status == Socket::Error)
+      session->disconnected = true;
+
+    while (session->serverReader.NextMessage(&data, &size))
+    {
+      // the udp port the server hands out is swapped for the conditioner's,
+      // and the token tells which session the client's datagrams are for
+      if (_message.ParseFromArray(data, size) && _message.type() == game::ServerMessage_Type_GAME_STARTED)
+      {
+        game::GameStarted* started = _message.mutable_game_started();
+        if (started->has_udp_port() && session->udp.IsOpen())
+        {
+          _serverUdpAddr = UdpAddress(_serverAddr.toInteger(), (u16)started->udp_port());
+          started->set_udp_port(_udpSocket.GetPort());
+          session->udpToken = started->udp_token();
+          session->hasUdpToken = started->has_udp_token();
+        }
+        else
+        {
+          started->clear_udp_port();
+        }
+
+        if (PackMessage(_buf, _message))
+        {
+          const char* action = session->down.Send(now, true, _buf.data(), _buf.size(), &deliverAt);
+          LogPacket(now, session, "down", true, _buf.size(), action, deliverAt);
+          continue;
+        }
+      }
+
+      const char* action = session->down.Send(now, true, data - sizeof(u32), size + sizeof(u32), &deliverAt);
+      LogPacket(now, session, "down", true, size + sizeof(u32), action, deliverAt);
+    }
+
+    if (session->clientReader.IsCorrupt() || session->serverReader.IsCorrupt())
+      session->disconnected = true;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::ReceiveUdp(Time now)
+  {
+    char buf[MAX_DATAGRAM_SIZE];
+    size_t size;
+    UdpAddress from;
+    Time deliverAt;
+
+    // from the clients, which are told apart by their tokens
+    while (_udpSocket.ReceiveFrom(&from, buf, sizeof(buf), &size))
+    {
+      u32 token;
+      if (!UdpChannel::PeekToken(buf, size, &token))
+        continue;
+
+      for (Session* session : _sessions)
+      {
+        if (session->hasUdpToken && session->udpToken == token)
+        {
+          session->clientUdpAddr = from;
+          const char* action = session->up.Send(now, false, buf, size, &deliverAt);
+          LogPacket(now, session, "up", false, size, action, deliverAt);
+          break;
+        }
+      }
+    }
+
+    // from the server
+    for (Session* session : _sessions)
+    {
+      while (session->udp.ReceiveFrom(&from, buf, sizeof(buf), &size))
+      {
+        if (from != _serverUdpAddr || session->clientUdpAddr.port == 0)
+          continue;
+
+        const char* action = session->down.Send(now, false, buf, size, &deliverAt);
+        LogPacket(now, session, "down", false, size, action, deliverAt);
+      }
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::Deliver(Session* session, Time now)
+  {
+    while (const Packet* packet = session->up.Receive(now))
+    {
+      if (packet->reliable)
+        session->toServer.insert(session->toServer.end(), packet->data.begin(), packet->data.end());
+      else
+        session->udp.SendTo(_serverUdpAddr, packet->data.data(), packet->data.size());
+    }
+
+    while (const Packet* packet = session->down.Receive(now))
+    {
+      if (packet->reliable)
+        session->toClient.insert(session->toClient.end(), packet->data.begin(), packet->data.end());
+      else
+        _udpSocket.SendTo(session->clientUdpAddr, packet->data.data(), packet->data.size());
+    }
+
+    if (!Flush(session->server, &session->toServer) || !Flush(session->client, &session->toClient))
+      session->disconnected = true;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Conditioner::Flush(TcpSocket* socket, vector<char>* buf)
+  {
+    if (buf->empty())
+      return true;
+
+    // whatever the socket doesn't take now is sent on the next update
+    size_t sent = 0;
+    Socket::Status status = socket->send(buf->data(), buf->size(), sent);
+    if (status == Socket::Disconnected || status == Socket::Error)
+      return false;
+
+    buf->erase(buf->begin(), buf->begin() + sent);
+    return true;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::LogPacket(Time now, const Session* session, const char* dir, bool reliable, size_t size,
+      const char* action, Time deliverAt)
+  {
+    if (!_log)
+      return;
+
+    bool delivered = strcmp(action, "lost") != 0 && strcmp(action, "dropped") != 0;
+    fprintf(_log, "%.3f,%u,%s,%s,%d,%s,", now.asMicroseconds() / 1e3, session->id, dir,
+        reliable ? "tcp" : "udp", (int)size, action);
+    if (delivered)
+      fprintf(_log, "%.3f\n", (deliverAt - now).asMicroseconds() / 1e3);
+    else
+      fprintf(_log, "\n");
+  }
+
+  //-----------------------------------------------------------------------------
+  void Conditioner::PrintStats(Time now)
+  {
+    if (_sessions.empty() && _upStats.packets == 0 && _downStats.packets == 0)
+      return;
+
+    struct { const char* name; LinkStats* stats; } links[] = { { "up", &_upStats }, { "down", &_downStats } };
+    for (auto& link : links)
+    {
+      LinkStats& s = *link.stats;
+      printf("[%.1f s] %-4s  packets: %d  kB: %.1f  lost: %d  dropped: %d  reordered: %d  dup: %d  retransmits: %d  delay p50: %.1f ms  p99: %.1f ms\n",
+          now.asSeconds(), link.name, (int)s.packets, s.bytes / 1e3, (int)s.lost, (int)s.dropped,
+          (int)s.reordered, (int)s.duplicated, (int)s.retransmits,
+          s.delays.GetPercentile(0.5) / 1e3, s.delays.GetPercentile(0.99) / 1e3);
+      s.Reset();
+    }
+
+    if (_log)
+      fflush(_log);
+  }
+}
+
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  string serverAddr = "localhost";
+  u16 serverPort = 50000;
+  u16 listenPort = 50300;
+  const char* scriptFile = nullptr;
+  const char* logFile = nullptr;
+  u32 seed = 1;
+  game::LinkConditions conditions;
+
+  for (int i = 1; i < argc - 1; ++i)
+  {
+    if (strcmp(argv[i], "-s") == 0)
+      serverAddr = argv[++i];
+    else if (strcmp(argv[i], "-p") == 0)
+      serverPort = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-l") == 0)
+      listenPort = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-f") == 0)
+      scriptFile = argv[++i];
+    else if (strcmp(argv[i], "-d") == 0)
+      conditions.set_delay_ms(atoi(argv[++i]));
+    else if (strcmp(argv[i], "-j") == 0)
+      conditions.set_jitter_ms(atoi(argv[++i]));
+    else if (strcmp(argv[i], "-x") == 0)
+      conditions.set_loss((float)atof(argv[++i]));
+    else if (strcmp(argv[i], "-b") == 0)
+      conditions.set_bytes_per_sec(atoi(argv[++i]));
+    else if (strcmp(argv[i], "-e") == 0)
+      seed = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-o") == 0)
+      logFile = argv[++i];
+  }
+
+  game::LinkScript script;
+  if (scriptFile && !ProtobufFromFile(scriptFile, &script))
+  {
+    printf("Unable to load link script: %s\n", scriptFile);
+    return 1;
+  }
+
+  Conditioner conditioner;
+  if (!conditioner.Init(IpAddress(serverAddr), serverPort, listenPort, conditions, script, seed, logFile))
+    return 1;
+
+  while (true)
+  {
+    conditioner.Update();
+    sf::sleep(sf::milliseconds(1));
+  }
+
+  return 0;
+}
@@ -0,0 +1,536 @@
+#include "server_connection.hpp"
+#include "swarm_server.hpp"
+#include "histogram.hpp"
+#include <random>
+
+// Headless load-generating client. Opens a fleet of connections to a server,
+// each sending PLAYER_INPUT and PLAYER_CLICK traffic like a real player, and
+// measures snapshot inter-arrival time, click-to-effect latency, the
+// bandwidth used per connection, and how well the clocks sync.
+//
+// With -c, a server is started in-process using the given config file, and
+// the bots connect to that instead. With -l, that many of them connect
+// through a local channel, like a client hosting its own server. With -r,
+// every bot drops its connection and resumes its session about every given
+// number of seconds.
+//
+// usage: swarm_bot [-s addr] [-p port] [-c config.pb] [-n bots] [-t seconds] [-j threads] [-r seconds] [-l bots]
+
+using namespace swarm;
+
+namespace
+{
+  // A click has taken effect once the monsters inside the click radius move
+  // towards the click position this much faster than before the click
+  const float CLICK_EFFECT_THRESHOLD = 1.0f;
+  const s64 CLICK_TIMEOUT_US = 2 * 1000 * 1000;
+
+  struct BotStats
+  {
+    BotStats() : clicksSent(0), clicksMissed(0), bytesSent(0), bytesReceived(0), udpClients(0), staleDatagrams(0), serverTime(0), syncedClients(0) {}
+    Histogram<> snapshotIntervals;
+    Histogram<> clickLatencies;
+    // size of the state a bot starts from, for fresh joins (GameStarted and
+    // the initial state chunks) and resumed sessions
+    Histogram<> joinBytes;
+    Histogram<> resumeBytes;
+    // time from GameStarted until the first and the last initial state chunk
+    Histogram<> firstChunkTimes;
+    Histogram<> initialStateTimes;
+    u32 clicksSent;
+    u32 clicksMissed;
+    u64 bytesSent;
+    u64 bytesReceived;
+    u32 udpClients;
+    u64 staleDatagrams;
+    // the smoothed rtt, and the estimate of the server time when the run
+    // ended. all the bots should agree on the time
+    Histogram<> rtts;
+    double serverTime;
+    u32 syncedClients;
+  };
+
+  //-----------------------------------------------------------------------------
+  class Bot : public ServerMessageHandler
+  {
+  public:
+    Bot(u32 seed, const Clock* clock, float reconnectInterval);
+
+    bool Connect(const IpAddress& addr, u16 port);
+    bool ConnectLocal(const shared_ptr<LocalChannel>& channel);
+    void Update();
+    const BotStats& GetStats();
+
+    virtual bool HandleGameStarted(const game::GameStarted& msg);
+    virtual void HandleSwarmState(const game::SwarmState& msg);
+    virtual void HandleGameEnded(const game::GameEnded& msg);
+    virtual void HandleMonsterDied(const game::MonsterDied& msg);
+
+  private:
+    float RadialSpeed(const Vector2f& pos, float radius) const;
+    void SendInput();
+    void SendClick();
+
+    ServerConnection _connection;
+    const Clock* _clock;
+    std::mt19937 _rng;
+    // if set, the connection is dropped and resumed about this often (in secs)
+    float _reconnectInterval;
+    Time _nextReconnect;
+
+    // the level is needed to extrapolate the monsters the server doesn't send
+    Level _level;
+    ReckonedSwarm _swarm;
+    u32 _snapshotTick;
+    Vector2f _dir;
+    u32 _nextInputSeq;
+    // the last INPUT_REDUNDANCY inputs, which are resent like the real client does
+    deque<Vector2f> _recentInputs;
+    Time _lastSnapshot;
+    Time _nextInputSend;
+    Time _nextDirChange;
+    Time _nextClick;
+
+    // the click we are waiting to see the effect of
+    bool _clickPending;
+    Time _clickTime;
+    Vector2f _clickPos;
+    float _clickRadius;
+    float _clickBaseline;
+
+    // the initial state still streaming in
+    u32 _pendingChunks;
+    u32 _initialStateBytes;
+    Time _gameStartedTime;
+
+    bool _gameStarted;
+    BotStats _stats;
+  };
+
+  //-----------------------------------------------------------------------------
+  Bot::Bot(u32 seed, const Clock* clock, float reconnectInterval)
+    : _clock(clock)
+    , _rng(seed)
+    , _reconnectInterval(reconnectInterval)
+    , _snapshotTick(0)
+    , _nextInputSeq(1)
+    , _clickPending(false)
+    , _clickRadius(0)
+    , _clickBaseline(0)
+    , _pendingChunks(0)
+    , _initialStateBytes(0)
+    , _gameStarted(false)
+  {
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Bot::Connect(const IpAddress& addr, u16 port)
+  {
+    return _connection.Connect(addr, port);
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Bot::ConnectLocal(const shared_ptr<LocalChannel>& channel)
+  {
+    return _connection.ConnectLocal(channel);
+  }
+
+  //-----------------------------------------------------------------------------
+  const BotStats& Bot::GetStats()
+  {
+    _stats.bytesSent = _connection.GetBytesSent();
+    _stats.bytesReceived = _connection.GetBytesReceived();
+    _stats.udpClients = _connection.IsUdpActive() ? 1 : 0;
+    _stats.staleDatagrams = _connection.GetNumStaleDatagrams();
+
+    const ClockSync& clockSync = _connection.GetClockSync();
+    _stats.rtts.Reset();
+    _stats.syncedClients = clockSync.IsSynced() ? 1 : 0;
+    if (clockSync.IsSynced())
+    {
+      _stats.rtts.Record((u64)(clockSync.GetRtt() * 1e6));
+      _stats.serverTime = _connection.GetServerTime();
+    }
+    return _stats;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Bot::HandleGameStarted(const game::GameStarted& msg)
+  {
+    if (msg.resumed())
+    {
+      _stats.resumeBytes.Record(msg.ByteSizeLong());
+      HandleSwarmState(msg.swarm_state());
+      return true;
+    }
+
+    _pendingChunks = msg.initial_state_chunks();
+    _initialStateBytes = (u32)msg.ByteSizeLong();
+    _gameStartedTime = _clock->getElapsedTime();
+    if (!_pendingChunks)
+      _stats.joinBytes.Record(_initialStateBytes);
+
+    if (!_level.Load(msg.map_name()))
+      return false;
+
+    // the input seqs carry on, as the server keeps them for the session
+    _gameStarted = true;
+    _recentInputs.clear();
+
+    HandleSwarmState(msg.swarm_state());
+
+    Time now = _clock->getElapsedTime();
+    _lastSnapshot = Time::Zero;
+    _nextInputSend = now;
+    _nextDirChange = now;
+    _nextClick = now + sf::milliseconds(std::uniform_int_distribution<int>(500, 3000)(_rng));
+    _nextReconnect = now + sf::seconds(std::uniform_real_distribution<float>(0.5f, 1.5f)(_rng) * _reconnectInterval);
+    return true;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Bot::HandleGameEnded(const game::GameEnded& msg)
+  {
+    _gameStarted = false;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Bot::HandleMonsterDied(const game::MonsterDied& msg)
+  {
+    _swarm.Remove(msg);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Bot::HandleSwarmState(const game::SwarmState& msg)
+  {
+    Time now = _clock->getElapsedTime();
+    if (msg.has_num_chunks())
+    {
+      _swarm.Apply(_level, msg);
+      if (_pendingChunks == 0)
+        return;
+
+      s64 elapsed = (now - _gameStartedTime).asMicroseconds();
+      if (msg.chunk() == 0)
+        _stats.firstChunkTimes.Record(elapsed);
+      _initialStateBytes += (u32)msg.ByteSizeLong();
+      if (--_pendingChunks == 0)
+      {
+        _stats.initialStateTimes.Record(elapsed);
+        _stats.joinBytes.Record(_initialStateBytes);
+      }
+      return;
+    }
+
+    if (_lastSnapshot != Time::Zero)
+      _stats.snapshotIntervals.Record((now - _lastSnapshot).asMicroseconds());
+    _lastSnapshot = now;
+    _snapshotTick = msg.tick();
+
+    _swarm.Apply(_level, msg);
+
+    if (!_clickPending)
+      return;
+
+    s64 latency = (now - _clickTime).asMicroseconds();
+    if (RadialSpeed(_clickPos, _clickRadius) - _clickBaseline > CLICK_EFFECT_THRESHOLD)
+    {
+      _stats.clickLatencies.Record(latency);
+      _clickPending = false;
+    }
+    else if (latency > CLICK_TIMEOUT_US)
+    {
+      _stats.clicksMissed++;
+      _clickPending = false;
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  float Bot::RadialSpeed(const Vector2f& pos, float radius) const
+  {
+    // average speed towards pos of the monsters inside the radius
+    float sum = 0;
+    int count = 0;
+    for (const ReckonedSwarm::Monster& m : _swarm.GetMonsters())
+    {
+      Vector2f dir = pos - m.state._pos;
+      float d = Length(dir);
+      if (d < radius && d > 0)
+      {
+        sum += (dir.x * m.state._vel.x + dir.y * m.state._vel.y) / d;
+        count++;
+      }
+    }
+    return count ? sum / count : 0;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Bot::SendInput()
+  {
+    _recentInputs.push_back(PLAYER_ACCELERATION * _dir);
+    if (_recentInputs.size() > (size_t)INPUT_REDUNDANCY)
+      _recentInputs.pop_front();
+    ++_nextInputSeq;
+
+    game::PlayerMessage msg;
+    msg.set_type(game::PlayerMessage_Type_PLAYER_INPUT);
+    u32 seq = _nextInputSeq - (u32)_recentInputs.size();
+    for (const Vector2f& acc : _recentInputs)
+    {
+      game::PlayerInput* input = msg.add_input();
+      input->set_seq(seq++);
+      ToProtocol(input->mutable_acc(), acc);
+    }
+    _connection.Send(msg);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Bot::SendClick()
+  {
+    const vector<ReckonedSwarm::Monster>& monsters = _swarm.GetMonsters();
+    if (monsters.empty())
+      return;
+
+    // click on a random monster, with a radius matching a short mouse press
+    const ReckonedSwarm::Monster& monster = monsters[std::uniform_int_distribution<size_t>(0, monsters.size() - 1)(_rng)];
+    Vector2f target = monster.state._pos;
+    float radius = std::uniform_real_distribution<float>(20, 60)(_rng);
+
+    game::PlayerMessage msg;
+    msg.set_type(game::PlayerMessage_Type_PLAYER_CLICK);
+    game::PlayerClick* click = msg.mutable_click();
+    ToProtocol(click->mutable_click_pos(), target);
+    click->set_click_size(radius);
+    click->set_render_tick(_snapshotTick);
+
+    if (!_connection.Send(msg))
+      return;
+
+    _stats.clicksSent++;
+    if (!_clickPending)
+    {
+      _clickPending = true;
+      _clickTime = _clock->getElapsedTime();
+      _clickPos = target;
+      _clickRadius = radius;
+      _clickBaseline = RadialSpeed(target, radius);
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Bot::Update()
+  {
+    if (!_connection.ProcessMessages(this) && _connection.HasSession())
+      _connection.Reconnect();
+
+    if (!_gameStarted)
+      return;
+
+    Time now = _clock->getElapsedTime();
+
+    // a flaky link, which drops the connection and resumes the session
+    if (_reconnectInterval > 0 && now >= _nextReconnect)
+    {
+      _connection.Reconnect();
+      _nextReconnect = now + sf::seconds(std::uniform_real_distribution<float>(0.5f, 1.5f)(_rng) * _reconnectInterval);
+    }
+
+    // random walk, changing direction every couple of seconds
+    if (now >= _nextDirChange)
+    {
+      float angle = std::uniform_real_distribution<float>(0, 2 * 3.1415926f)(_rng);
+      _dir = Vector2f(cosf(angle), sinf(angle));
+      _nextDirChange = now + sf::milliseconds(std::uniform_int_distribution<int>(1000, 3000)(_rng));
+    }
+
+    // the real client sends an input every fixed step
+    if (now >= _nextInputSend)
+    {
+      SendInput();
+      _nextInputSend = now + sf::milliseconds((int)(TIMESTEP * 1000));
+    }
+
+    if (now >= _nextClick)
+    {
+      SendClick();
+      _nextClick = now + sf::milliseconds(std::uniform_int_distribution<int>(1000, 3000)(_rng));
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void RunBots(vector<Bot*>* bots, const Clock* clock, Time duration)
+  {
+    while (clock->getElapsedTime() < duration)
+    {
+      for (Bot* bot : *bots)
+        bot->Update();
+
+      sf::sleep(sf::milliseconds(1));
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void PrintPercentiles(const char* name, const Histogram<>& h, float scale, const char* unit)
+  {
+    if (h.GetCount() == 0)
+    {
+      printf("%-24s no samples\n", name);
+      return;
+    }
+
+    printf("%-24s p50: %8.2f %s  p99: %8.2f %s  max: %8.2f %s  (%d samples)\n",
+        name, h.GetPercentile(0.5) * scale, unit, h.GetPercentile(0.99) * scale, unit, h.GetMax() * scale, unit, (int)h.GetCount());
+  }
+}
+
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  string serverAddr = "localhost";
+  string configFile;
+  u16 serverPort = 50000;
+  int numBots = 100;
+  int numThreads = 4;
+  float seconds = 30;
+  float reconnectInterval = 0;
+  int numLocalBots = 0;
+
+  for (int i = 1; i < argc - 1; ++i)
+  {
+    if (strcmp(argv[i], "-s") == 0)
+      serverAddr = argv[++i];
+    else if (strcmp(argv[i], "-p") == 0)
+      serverPort = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-n") == 0)
+      numBots = max(1, atoi(argv[++i]));
+    else if (strcmp(argv[i], "-j") == 0)
+      numThreads = max(1, atoi(argv[++i]));
+    else if (strcmp(argv[i], "-t") == 0)
+      seconds = (float)atof(argv[++i]);
+    else if (strcmp(argv[i], "-c") == 0)
+      configFile = argv[++i];
+    else if (strcmp(argv[i], "-r") == 0)
+      reconnectInterval = (float)atof(argv[++i]);
+    else if (strcmp(argv[i], "-l") == 0)
+      numLocalBots = max(0, atoi(argv[++i]));
+  }
+
+  if (configFile.empty())
+    numLocalBots = 0;
+
+  srand(1337);
+  Server server;
+  if (!configFile.empty())
+  {
+    if (FindAppRoot().empty() || !server.Init(configFile.c_str()))
+    {
+      printf("Unable to start local server: %s\n", configFile.c_str());
+      return 1;
+    }
+    serverAddr = "localhost";
+    serverPort = server.GetPort();
+  }
+
+  Clock clock;
+  clock.restart();
+
+  // connect all the bots up front, and split them over the worker threads
+  vector<vector<Bot*>> botsPerThread(numThreads);
+  vector<Bot*> bots;
+  for (int i = 0; i < numBots; ++i)
+  {
+    Bot* bot = new Bot(1337 + i, &clock, reconnectInterval);
+    bool connected = i < numLocalBots
+        ? bot->ConnectLocal(server.ConnectLocal())
+        : bot->Connect(IpAddress(serverAddr), serverPort);
+    if (!connected)
+    {
+      printf("Bot %d unable to connect to %s:%d\n", i, serverAddr.c_str(), serverPort);
+      delete bot;
+      break;
+    }
+    bots.push_back(bot);
+    botsPerThread[i % numThreads].push_back(bot);
+  }
+
+  printf("Running %d bots for %.1f seconds\n", (int)bots.size(), seconds);
+
+  Time start = clock.getElapsedTime();
+  Time end = start + sf::seconds(seconds);
+  vector<thread*> threads;
+  for (vector<Bot*>& threadBots : botsPerThread)
+    threads.push_back(new thread(bind(RunBots, &threadBots, &clock, end)));
+
+  for (thread* t : threads)
+    t->join();
+  SeqDelete(&threads);
+
+  // merge the stats from all the bots
+  float elapsed = (clock.getElapsedTime() - start).asSeconds();
+  BotStats total;
+  Histogram<> bytesInPerSec, bytesOutPerSec;
+  double minServerTime = 0, maxServerTime = 0;
+  for (Bot* bot : bots)
+  {
+    const BotStats& stats = bot->GetStats();
+    if (stats.syncedClients)
+    {
+      minServerTime = total.syncedClients ? min(minServerTime, stats.serverTime) : stats.serverTime;
+      maxServerTime = total.syncedClients ? max(maxServerTime, stats.serverTime) : stats.serverTime;
+      total.syncedClients += stats.syncedClients;
+      total.rtts.Merge(stats.rtts);
+    }
+    total.snapshotIntervals.Merge(stats.snapshotIntervals);
+    total.clickLatencies.Merge(stats.clickLatencies);
+    total.joinBytes.Merge(stats.joinBytes);
+    total.resumeBytes.Merge(stats.resumeBytes);
+    total.firstChunkTimes.Merge(stats.firstChunkTimes);
+    total.initialStateTimes.Merge(stats.initialStateTimes);
+    total.clicksSent += stats.clicksSent;
+    total.clicksMissed += stats.clicksMissed;
+    total.udpClients += stats.udpClients;
+    total.staleDatagrams += stats.staleDatagrams;
+    bytesInPerSec.Record((u64)(stats.bytesReceived / elapsed));
+    bytesOutPerSec.Record((u64)(stats.bytesSent / elapsed));
+  }
+
+  PrintPercentiles("snapshot interval", total.snapshotIntervals, 1e-3f, "ms");
+  PrintPercentiles("click to effect", total.clickLatencies, 1e-3f, "ms");
+  printf("%-24s sent: %d  missed: %d\n", "clicks", total.clicksSent, total.clicksMissed);
+  PrintPercentiles("join state", total.joinBytes, 1e-3f, "kB");
+  PrintPercentiles("resumed state", total.resumeBytes, 1e-3f, "kB");
+  PrintPercentiles("first chunk", total.firstChunkTimes, 1e-3f, "ms");
+  PrintPercentiles("initial state complete", total.initialStateTimes, 1e-3f, "ms");
+  PrintPercentiles("bytes/s in per client", bytesInPerSec, 1e-3f, "kB");
+  PrintPercentiles("bytes/s out per client", bytesOutPerSec, 1e-3f, "kB");
+  printf("%-24s %d of %d  stale dropped: %d\n", "clients on udp",
+      total.udpClients, (int)bots.size(), (int)total.staleDatagrams);
+  PrintPercentiles("rtt", total.rtts, 1e-3f, "ms");
+  printf("%-24s %d of %d  server time spread: %.2f ms\n", "clocks synced",
+      total.syncedClients, (int)bots.size(), (maxServerTime - minServerTime) * 1e3);
+
+  // the server's side of the same traffic, when it runs in-process
+  if (!configFile.empty())
+  {
+    vector<Server::ClientStats> clientStats;
+    server.GetClientStats(&clientStats);
+    Histogram<> serverBytesPerSec, monstersDeferred, serverRtts;
+    u64 swarmStatesLost = 0;
+    for (const Server::ClientStats& stats : clientStats)
+    {
+      serverBytesPerSec.Record(stats.bytesPerSec);
+      monstersDeferred.Record(stats.monstersDeferred);
+      if (stats.rttMs > 0)
+        serverRtts.Record((u64)(stats.rttMs * 1e3));
+      swarmStatesLost += stats.swarmStatesLost;
+    }
+    PrintPercentiles("bytes/s sent by server", serverBytesPerSec, 1e-3f, "kB");
+    PrintPercentiles("monsters deferred", monstersDeferred, 1, "");
+    PrintPercentiles("rtt seen by server", serverRtts, 1e-3f, "ms");
+    printf("%-24s %d\n", "swarm states lost", (int)swarmStatesLost);
+  }
+
+  SeqDelete(&bots);
+  server.Close();
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include "shared_snapshot.hpp"
+#include "histogram.hpp"
+#include <chrono>
+
+// Reads the state a server publishes in shared memory (see shared_snapshot_name
+// in the config), the way a co-located spectator or stats collector would.
+// Polls at the given rate, and prints once a second how far the server got,
+// what the reads cost, and how often they overlapped a write.
+//
+// usage: swarm_observer [-m name] [-r reads/sec] [-t seconds]
+
+using namespace swarm;
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock ObserverClock;
+}
+
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  string name = "swarm";
+  int readsPerSec = 1000;
+  float seconds = 10;
+
+  for (int i = 1; i < argc - 1; ++i)
+  {
+    if (strcmp(argv[i], "-m") == 0)
+      name = argv[++i];
+    else if (strcmp(argv[i], "-r") == 0)
+      readsPerSec = max(1, atoi(argv[++i]));
+    else if (strcmp(argv[i], "-t") == 0)
+      seconds = (float)atof(argv[++i]);
+  }
+
+  SharedSnapshotReader reader;
+  if (!reader.Open(name))
+  {
+    printf("Unable to open shared snapshot: %s\n", name.c_str());
+    return 1;
+  }
+
+  Clock clock;
+  Time end = sf::seconds(seconds);
+  Time nextReport = sf::seconds(1);
+  Histogram<> readTimes;
+  SharedSnapshot snapshot;
+  u32 lastTick = 0;
+  u32 failedReads = 0;
+  bool hasTick = false;
+
+  while (clock.getElapsedTime() < end)
+  {
+    ObserverClock::time_point start = ObserverClock::now();
+    bool ok = reader.Read(&snapshot);
+    readTimes.Record((u64)std::chrono::duration_cast<std::chrono::nanoseconds>(ObserverClock::now() - start).count());
+    if (!ok)
+      ++failedReads;
+
+    if (clock.getElapsedTime() >= nextReport)
+    {
+      printf("tick: %u (+%u)  monsters: %d  players: %d  read p50: %.1f us  p99: %.1f us  retries: %d  failed: %u\n",
+          snapshot.tick, hasTick ? snapshot.tick - lastTick : 0,
+          (int)snapshot.monsters.size(), (int)snapshot.players.size(),
+          readTimes.GetPercentile(0.5) / 1e3, readTimes.GetPercentile(0.99) / 1e3,
+          (int)reader.GetNumRetries(), failedReads);
+
+      lastTick = snapshot.tick;
+      hasTick = true;
+      readTimes.Reset();
+      nextReport += sf::seconds(1);
+    }
+
+    sf::sleep(sf::microseconds(1000000 / readsPerSec));
+  }
+
+  return 0;
+}
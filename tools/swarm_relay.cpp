@@ -0,0 +1,496 @@
+#include "server_connection.hpp"
+#include "dead_reckoning.hpp"
+#include "level.hpp"
+
+// Fans the state stream of a game out to spectators, so the server only pays
+// for a single subscriber however many are watching. The relay connects to
+// the server (or to another relay) as a spectator, and keeps its own copy of
+// the swarm up to date from the stream.
+//
+// A viewer that connects gets the relay's copy of the swarm as a full state
+// in GameStarted, the keyframe. From then on it gets the stream exactly as
+// the relay does, and as both extrapolate the same way, the deltas apply to
+// the keyframe just like they do to the relay's copy. Every message from
+// upstream is serialized once, and the same bytes are sent to all the
+// viewers. The viewers speak the normal client protocol, so a relay can feed
+// other relays. Their pings are answered with the relay's estimate of the
+// server's clock, so they sync to the server through it. Whatever a slow
+// viewer's socket doesn't take is kept and sent before anything else, and a
+// viewer that falls too far behind is dropped, and has to start over from a
+// new keyframe.
+//
+// usage: swarm_relay [-s addr] [-p port] [-l listen port]
+
+using namespace swarm;
+
+namespace
+{
+  const s32 RECONNECT_INTERVAL_MS = 1000;
+  const s32 HELLO_TIMEOUT_MS = 5000;
+  const s32 STATS_INTERVAL_MS = 5000;
+  const size_t MAX_PENDING_BYTES = 4 * 1024 * 1024;
+
+  //-----------------------------------------------------------------------------
+  class Relay : public ServerMessageHandler
+  {
+  public:
+    Relay();
+    ~Relay();
+
+    bool Init(const IpAddress& addr, u16 port, u16 listenPort);
+    void Update();
+
+    virtual bool HandleGameStarted(const game::GameStarted& msg);
+    virtual void HandlePlayerJoined(const game::PlayerJoined& msg);
+    virtual void HandlePlayerLeft(const game::PlayerLeft& msg);
+    virtual void HandleSwarmState(const game::SwarmState& msg);
+    virtual void HandlePlayerState(const game::PlayerState& msg);
+    virtual void HandleGameEnded(const game::GameEnded& msg);
+    virtual void HandleMonsterDied(const game::MonsterDied& msg);
+    virtual void HandlePlayerDied(const game::PlayerDied& msg);
+
+  private:
+    struct Viewer
+    {
+      Viewer() : socket(new TcpSocket()), helloReceived(false), started(false), disconnected(false) {}
+      ~Viewer() { delete socket; }
+      TcpSocket* socket;
+      MessageReader reader;
+      // the part of the stream the socket hasn't taken yet
+      vector<char> pending;
+      Time connectTime;
+      bool helloReceived;
+      bool started;
+      bool disconnected;
+    };
+
+    void AcceptViewers();
+    void HandleViewers();
+    void StartViewers();
+    void Forward(const game::ServerMessage& msg);
+    void HandlePing(Viewer* viewer, const game::Ping& ping);
+    bool Send(Viewer* viewer, const vector<char>& buf);
+    void Flush(Viewer* viewer);
+    void PrintStats();
+
+    ServerConnection _upstream;
+    Clock _clock;
+    Time _lastReconnect;
+    Time _nextStats;
+
+    // the relay's copy of the game, which new viewers start from
+    Level _level;
+    ReckonedSwarm _swarm;
+    game::GameStarted _gameStarted;
+    game::PlayerState _playerState;
+    u32 _tick;
+    double _serverTime;
+    u32 _pendingChunks;
+    bool _ready;
+
+    TcpListener _listener;
+    vector<Viewer*> _viewers;
+    Viewer* _nextViewer;
+    game::ServerMessage _message;
+    vector<char> _sendBuf;
+
+    u64 _messagesForwarded;
+    u64 _bytesSent;
+  };
+
+  //-----------------------------------------------------------------------------
+  Relay::Relay()
+    : _tick(0)
+    , _serverTime(0)
+    , _pendingChunks(0)
+    , _ready(false)
+    , _nextViewer(new Viewer())
+    , _messagesForwarded(0)
+    , _bytesSent(0)
+  {
+  }
+
+  //-----------------------------------------------------------------------------
+  Relay::~Relay()
+  {
+    SeqDelete(&_viewers);
+    delete _nextViewer;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Relay::Init(const IpAddress& addr, u16 port, u16 listenPort)
+  {
+    _listener.setBlocking(false);
+    while (_listener.listen(listenPort) != Socket::Done)
+      ++listenPort;
+    printf("Relay listening on port: %d\n", listenPort);
+
+    _nextViewer->socket->setBlocking(false);
+    _upstream.SetSpectator(true);
+    _nextStats = sf::milliseconds(STATS_INTERVAL_MS);
+    return _upstream.Connect(addr, port);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::Update()
+  {
+    Time now = _clock.getElapsedTime();
+    if (!_upstream.ProcessMessages(this) && _upstream.HasSession()
+        && (now - _lastReconnect).asMilliseconds() >= RECONNECT_INTERVAL_MS)
+    {
+      _lastReconnect = now;
+      _upstream.Reconnect();
+    }
+
+    AcceptViewers();
+    HandleViewers();
+    StartViewers();
+
+    for (Viewer* viewer : _viewers)
+      Flush(viewer);
+
+    // drop the viewers that went away
+    for (auto it = _viewers.begin(); it != _viewers.end(); )
+    {
+      if ((*it)->disconnected)
+      {
+        delete *it;
+        it = _viewers.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    if (now >= _nextStats)
+    {
+      PrintStats();
+      _nextStats += sf::milliseconds(STATS_INTERVAL_MS);
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::AcceptViewers()
+  {
+    while (_listener.accept(*_nextViewer->socket) == Socket::Done)
+    {
+      _nextViewer->connectTime = _clock.getElapsedTime();
+      _viewers.push_back(_nextViewer);
+      _nextViewer = new Viewer();
+      _nextViewer->socket->setBlocking(false);
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandleViewers()
+  {
+    // viewers say hello, and ping. anything else they send is ignored
+    Time now = _clock.getElapsedTime();
+    for (Viewer* viewer : _viewers)
+    {
+      size_t received;
+      Socket::Status status = viewer->reader.Receive(viewer->socket, &received);
+
+      const char* data;
+      u32 size;
+      while (viewer->reader.NextMessage(&data, &size))
+      {
+        viewer->helloReceived = true;
+        game::PlayerMessage msg;
+        if (msg.ParseFromArray(data, size) && msg.type() == game::PlayerMessage_Type_PLAYER_PING)
+          HandlePing(viewer, msg.ping());
+      }
+
+      bool timedOut = !viewer->helloReceived && (now - viewer->connectTime).asMilliseconds() >= HELLO_TIMEOUT_MS;
+      if (status == Socket::Disconnected || status == Socket::Error || viewer->reader.IsCorrupt() || timedOut)
+        viewer->disconnected = true;
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::StartViewers()
+  {
+    if (!_ready)
+      return;
+
+    // the keyframe is only built if someone is waiting for it
+    vector<char> keyframe;
+    for (Viewer* viewer : _viewers)
+    {
+      if (viewer->started || !viewer->helloReceived || viewer->disconnected)
+        continue;
+
+      if (keyframe.empty())
+      {
+        game::ServerMessage msg;
+        msg.set_type(game::ServerMessage_Type_GAME_STARTED);
+        game::GameStarted* started = msg.mutable_game_started();
+        started->set_map_name(_gameStarted.map_name());
+        started->set_snapshot_interval_ms(_gameStarted.snapshot_interval_ms());
+        // viewers have no player
+        started->set_player_id(0);
+        started->set_health(0);
+        *started->mutable_player_state() = _playerState;
+
+        game::SwarmState* state = started->mutable_swarm_state();
+        state->set_tick(_tick);
+        state->set_server_time(_serverTime);
+        state->set_full(true);
+        for (const ReckonedSwarm::Monster& monster : _swarm.GetMonsters())
+        {
+          game::Monster* m = state->add_monster();
+          m->set_id(monster.id);
+          ToProtocol(m->mutable_vel(), monster.state._vel);
+          ToProtocol(m->mutable_pos(), monster.state._pos);
+          m->set_size(monster.size);
+        }
+
+        if (!PackMessage(keyframe, msg))
+          return;
+      }
+
+      viewer->started = Send(viewer, keyframe);
+    }
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::Forward(const game::ServerMessage& msg)
+  {
+    bool anyViewers = false;
+    for (const Viewer* viewer : _viewers)
+      anyViewers |= viewer->started;
+
+    if (!anyViewers || !PackMessage(_sendBuf, msg))
+      return;
+
+    for (Viewer* viewer : _viewers)
+    {
+      if (viewer->started)
+        Send(viewer, _sendBuf);
+    }
+    ++_messagesForwarded;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandlePing(Viewer* viewer, const game::Ping& ping)
+  {
+    if (!viewer->started || !_upstream.GetClockSync().IsSynced())
+      return;
+
+    game::ServerMessage msg;
+    msg.set_type(game::ServerMessage_Type_PONG);
+    game::Pong* pong = msg.mutable_pong();
+    pong->set_seq(ping.seq());
+    pong->set_client_time(ping.client_time());
+    pong->set_server_receive_time(_upstream.GetServerTime());
+    pong->set_server_send_time(_upstream.GetServerTime());
+
+    vector<char> buf;
+    if (PackMessage(buf, msg))
+      Send(viewer, buf);
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Relay::Send(Viewer* viewer, const vector<char>& buf)
+  {
+    if (viewer->disconnected)
+      return false;
+
+    // a message can't be sent until the ones before it are, or the stream
+    // would be misframed
+    if (viewer->pending.size() + buf.size() > MAX_PENDING_BYTES)
+    {
+      viewer->disconnected = true;
+      return false;
+    }
+
+    viewer->pending.insert(viewer->pending.end(), buf.begin(), buf.end());
+    Flush(viewer);
+    return !viewer->disconnected;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::Flush(Viewer* viewer)
+  {
+    if (viewer->disconnected || viewer->pending.empty())
+      return;
+
+    size_t sent = 0;
+    Socket::Status status = viewer->socket->send(viewer->pending.data(), viewer->pending.size(), sent);
+    if (status == Socket::Disconnected || status == Socket::Error)
+    {
+      viewer->disconnected = true;
+      return;
+    }
+
+    viewer->pending.erase(viewer->pending.begin(), viewer->pending.begin() + sent);
+    _bytesSent += sent;
+  }
+
+  //-----------------------------------------------------------------------------
+  bool Relay::HandleGameStarted(const game::GameStarted& msg)
+  {
+    // a resumed session only has what changed, which the viewers need as well
+    if (msg.resumed())
+    {
+      HandleSwarmState(msg.swarm_state());
+      HandlePlayerState(msg.player_state());
+      return true;
+    }
+
+    // a new session starts from scratch. the viewers can't follow that, so
+    // they reconnect and start over
+    if (!_level.Load(msg.map_name()))
+      return false;
+
+    for (Viewer* viewer : _viewers)
+    {
+      if (viewer->started)
+        viewer->disconnected = true;
+    }
+
+    _gameStarted = msg;
+    _gameStarted.clear_swarm_state();
+    _swarm.Clear();
+    _pendingChunks = msg.initial_state_chunks();
+    _ready = false;
+    HandlePlayerState(msg.player_state());
+    HandleSwarmState(msg.swarm_state());
+    _ready = _pendingChunks == 0;
+    return true;
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandleSwarmState(const game::SwarmState& msg)
+  {
+    _swarm.Apply(_level, msg);
+    if (msg.has_num_chunks())
+    {
+      // the initial state is complete once all its chunks are in, and no
+      // viewer has started before that
+      if (_pendingChunks > 0 && --_pendingChunks == 0)
+        _ready = true;
+      return;
+    }
+
+    if ((s32)(msg.tick() - _tick) > 0)
+    {
+      _tick = msg.tick();
+      _serverTime = msg.server_time();
+    }
+
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_SWARM_STATE);
+    *_message.mutable_swarm_state() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandlePlayerState(const game::PlayerState& msg)
+  {
+    _playerState = msg;
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_PLAYER_STATE);
+    *_message.mutable_player_state() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandleMonsterDied(const game::MonsterDied& msg)
+  {
+    _swarm.Remove(msg);
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_MONSTER_DIED);
+    *_message.mutable_monster_died() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandlePlayerJoined(const game::PlayerJoined& msg)
+  {
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_PLAYER_JOINED);
+    *_message.mutable_player_joined() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandlePlayerLeft(const game::PlayerLeft& msg)
+  {
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_PLAYER_LEFT);
+    *_message.mutable_player_left() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandleGameEnded(const game::GameEnded& msg)
+  {
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_GAME_ENDED);
+    *_message.mutable_game_ended() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::HandlePlayerDied(const game::PlayerDied& msg)
+  {
+    _message.Clear();
+    _message.set_type(game::ServerMessage_Type_PLAYER_DIED);
+    *_message.mutable_player_died() = msg;
+    Forward(_message);
+  }
+
+  //-----------------------------------------------------------------------------
+  void Relay::PrintStats()
+  {
+    int numStarted = 0;
+    for (const Viewer* viewer : _viewers)
+      numStarted += viewer->started ? 1 : 0;
+
+    printf("viewers: %d (%d waiting)  tick: %u  monsters: %d  forwarded: %d  upstream kB: %.1f  downstream kB: %.1f\n",
+        numStarted, (int)_viewers.size() - numStarted, _tick, (int)_swarm.GetMonsters().size(),
+        (int)_messagesForwarded, _upstream.GetBytesReceived() / 1e3, _bytesSent / 1e3);
+  }
+}
+
+//----------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  string serverAddr = "localhost";
+  u16 serverPort = 50000;
+  u16 listenPort = 50100;
+
+  for (int i = 1; i < argc - 1; ++i)
+  {
+    if (strcmp(argv[i], "-s") == 0)
+      serverAddr = argv[++i];
+    else if (strcmp(argv[i], "-p") == 0)
+      serverPort = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-l") == 0)
+      listenPort = atoi(argv[++i]);
+  }
+
+  // the level is loaded relative to the app root
+  if (FindAppRoot().empty())
+  {
+    printf("Unable to find the app root\n");
+    return 1;
+  }
+
+  Relay relay;
+  if (!relay.Init(IpAddress(serverAddr), serverPort, listenPort))
+  {
+    printf("Unable to connect to %s:%d\n", serverAddr.c_str(), serverPort);
+    return 1;
+  }
+
+  while (true)
+  {
+    relay.Update();
+    sf::sleep(sf::milliseconds(1));
+  }
+
+  return 0;
+}
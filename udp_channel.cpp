@@ -0,0 +1,340 @@
+#include "udp_channel.hpp"
+#include "error.hpp"
+
+using namespace swarm;
+
+namespace
+{
+  // messages that can be partly received at the same time
+  const size_t NUM_REASSEMBLY_SLOTS = 8;
+
+  // sent messages tracked for acks. this needs to cover the ack bits
+  const size_t SENT_HISTORY = 64;
+
+  // a message counts as lost once the other side has acked one this many
+  // messages newer, without acking it. a smaller gap is allowed for reordering
+  const s16 LOSS_DISTANCE = 4;
+
+  //-----------------------------------------------------------------------------
+  bool SeqGreater(u16 a, u16 b)
+  {
+    return (s16)(a - b) > 0;
+  }
+
+  //-----------------------------------------------------------------------------
+  void WriteU16(char* buf, u16 v)
+  {
+    buf[0] = (char)(v >> 8);
+    buf[1] = (char)v;
+  }
+
+  //-----------------------------------------------------------------------------
+  void WriteU32(char* buf, u32 v)
+  {
+    WriteU16(buf, (u16)(v >> 16));
+    WriteU16(buf + 2, (u16)v);
+  }
+
+  //-----------------------------------------------------------------------------
+  u16 ReadU16(const char* buf)
+  {
+    return (u16)((u8)buf[0] << 8 | (u8)buf[1]);
+  }
+
+  //-----------------------------------------------------------------------------
+  u32 ReadU32(const char* buf)
+  {
+    return (u32)ReadU16(buf) << 16 | ReadU16(buf + 2);
+  }
+}
+
+//-----------------------------------------------------------------------------
+UdpChannel::UdpChannel()
+{
+  Reset(0);
+}
+
+//-----------------------------------------------------------------------------
+void UdpChannel::Reset(u32 token)
+{
+  _token = token;
+  _nextSeq = 1;
+  _remoteSeq = 0;
+  _remoteAckBits = 0;
+  _hasRemoteSeq = false;
+
+  for (u8 i = 0; i < MAX_UDP_STREAMS; ++i)
+  {
+    _deliveredSeq[i] = 0;
+    _hasDelivered[i] = false;
+  }
+
+  _reassembly.resize(NUM_REASSEMBLY_SLOTS);
+  for (Reassembly& r : _reassembly)
+    r.inUse = false;
+
+  _sent.assign(SENT_HISTORY, SentMessage());
+  _lost.clear();
+  _numSentSinceAck = 0;
+  _numStale = 0;
+  _numLost = 0;
+}
+
+//-----------------------------------------------------------------------------
+void UdpChannel::WriteHeader(const Header& header, char* buf)
+{
+  WriteU32(buf + 0, header.token);
+  WriteU16(buf + 4, header.seq);
+  WriteU16(buf + 6, header.ack);
+  WriteU32(buf + 8, header.ackBits);
+  buf[12] = (char)header.stream;
+  buf[13] = (char)header.fragment;
+  buf[14] = (char)header.numFragments;
+}
+
+//-----------------------------------------------------------------------------
+bool UdpChannel::ReadHeader(const char* buf, size_t size, Header* header)
+{
+  if (size < UDP_HEADER_SIZE)
+    return false;
+
+  header->token = ReadU32(buf + 0);
+  header->seq = ReadU16(buf + 4);
+  header->ack = ReadU16(buf + 6);
+  header->ackBits = ReadU32(buf + 8);
+  header->stream = (u8)buf[12];
+  header->fragment = (u8)buf[13];
+  header->numFragments = (u8)buf[14];
+
+  return header->stream < MAX_UDP_STREAMS
+      && header->numFragments > 0
+      && header->fragment < header->numFragments;
+}
+
+//-----------------------------------------------------------------------------
+bool UdpChannel::PeekToken(const char* data, size_t size, u32* token)
+{
+  if (size < UDP_HEADER_SIZE)
+    return false;
+
+  *token = ReadU32(data);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool UdpChannel::Write(u8 stream, const char* data, size_t size, const UdpAddress& to,
+    vector<char>* buf, vector<Datagram>* datagrams, u16* seq)
+{
+  size_t numFragments = max<size_t>(1, (size + MAX_FRAGMENT_PAYLOAD - 1) / MAX_FRAGMENT_PAYLOAD);
+  if (numFragments > MAX_FRAGMENTS || stream >= MAX_UDP_STREAMS)
+  {
+    LOG_WARN("Message too large for udp" << LogKeyValue("size", size));
+    return false;
+  }
+
+  Header header;
+  header.token = _token;
+  header.seq = _nextSeq++;
+  // 0 means nothing has been received, so it's never used as a seq
+  if (_nextSeq == 0)
+    _nextSeq = 1;
+  header.ack = _hasRemoteSeq ? _remoteSeq : 0;
+  header.ackBits = _remoteAckBits;
+  header.stream = stream;
+  header.numFragments = (u8)numFragments;
+
+  for (size_t i = 0; i < numFragments; ++i)
+  {
+    size_t payloadOfs = i * MAX_FRAGMENT_PAYLOAD;
+    size_t payloadSize = min(MAX_FRAGMENT_PAYLOAD, size - payloadOfs);
+
+    Datagram d;
+    d.addr = to;
+    d.offset = (u32)buf->size();
+    d.size = (u32)(UDP_HEADER_SIZE + payloadSize);
+    datagrams->push_back(d);
+
+    header.fragment = (u8)i;
+    buf->resize(buf->size() + d.size);
+    WriteHeader(header, &(*buf)[d.offset]);
+    if (payloadSize)
+      memcpy(&(*buf)[d.offset + UDP_HEADER_SIZE], data + payloadOfs, payloadSize);
+  }
+
+  // a message that still hasn't been acked when its slot comes round again
+  // is long gone
+  SentMessage& sent = _sent[header.seq % SENT_HISTORY];
+  if (sent.pending)
+    AddLost(sent.seq);
+  sent.seq = header.seq;
+  sent.pending = true;
+  ++_numSentSinceAck;
+
+  if (seq)
+    *seq = header.seq;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool UdpChannel::Receive(const char* data, size_t size, u8* stream, const char** msg, size_t* msgSize)
+{
+  Header header;
+  if (!ReadHeader(data, size, &header) || header.token != _token)
+    return false;
+
+  if (header.ack != 0)
+    HandleAcks(header.ack, header.ackBits);
+
+  // only the last fragment can be short
+  size_t payloadSize = size - UDP_HEADER_SIZE;
+  bool lastFragment = header.fragment == header.numFragments - 1;
+  if (payloadSize > MAX_FRAGMENT_PAYLOAD || (!lastFragment && payloadSize != MAX_FRAGMENT_PAYLOAD))
+    return false;
+
+  u8 s = header.stream;
+  if (_hasDelivered[s] && !SeqGreater(header.seq, _deliveredSeq[s]))
+  {
+    // the fragments of a stale message are only counted once
+    if (header.fragment == 0)
+      ++_numStale;
+    return false;
+  }
+
+  const char* payload = data + UDP_HEADER_SIZE;
+  if (header.numFragments == 1)
+  {
+    *msg = payload;
+    *msgSize = payloadSize;
+  }
+  else
+  {
+    Reassembly* r = FindReassembly(header);
+    if (!r || r->received[header.fragment])
+      return false;
+
+    size_t ofs = header.fragment * MAX_FRAGMENT_PAYLOAD;
+    memcpy(&r->data[ofs], payload, payloadSize);
+    r->received[header.fragment] = true;
+    if (lastFragment)
+      r->size = ofs + payloadSize;
+
+    if (++r->numReceived < r->numFragments)
+      return false;
+
+    r->inUse = false;
+    *msg = r->data.data();
+    *msgSize = r->size;
+  }
+
+  MessageReceived(header.seq);
+  _deliveredSeq[s] = header.seq;
+  _hasDelivered[s] = true;
+  *stream = s;
+
+  // anything older on the stream still being reassembled would be stale
+  for (Reassembly& r : _reassembly)
+  {
+    if (r.inUse && r.stream == s && !SeqGreater(r.seq, header.seq))
+      r.inUse = false;
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+UdpChannel::Reassembly* UdpChannel::FindReassembly(const Header& header)
+{
+  Reassembly* slot = nullptr;
+  for (Reassembly& r : _reassembly)
+  {
+    if (r.inUse && r.seq == header.seq && r.stream == header.stream)
+      return r.numFragments == header.numFragments ? &r : nullptr;
+
+    // use a free slot, or else evict the oldest message
+    if (!slot || (slot->inUse && (!r.inUse || SeqGreater(slot->seq, r.seq))))
+      slot = &r;
+  }
+
+  slot->inUse = true;
+  slot->seq = header.seq;
+  slot->stream = header.stream;
+  slot->numFragments = header.numFragments;
+  slot->numReceived = 0;
+  slot->size = 0;
+  slot->data.resize(header.numFragments * MAX_FRAGMENT_PAYLOAD);
+  slot->received.assign(header.numFragments, false);
+  return slot;
+}
+
+//-----------------------------------------------------------------------------
+void UdpChannel::MessageReceived(u16 seq)
+{
+  if (!_hasRemoteSeq)
+  {
+    _remoteSeq = seq;
+    _remoteAckBits = 0;
+    _hasRemoteSeq = true;
+    return;
+  }
+
+  s16 diff = (s16)(seq - _remoteSeq);
+  if (diff > 0)
+  {
+    // shift in the previous newest message
+    _remoteAckBits = diff >= 32 ? 0 : _remoteAckBits << diff;
+    if (diff <= 32)
+      _remoteAckBits |= 1u << (diff - 1);
+    _remoteSeq = seq;
+  }
+  else if (diff < 0 && diff >= -32)
+  {
+    _remoteAckBits |= 1u << (-diff - 1);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void UdpChannel::HandleAcks(u16 ack, u32 ackBits)
+{
+  for (SentMessage& sent : _sent)
+  {
+    if (!sent.pending)
+      continue;
+
+    s16 diff = (s16)(ack - sent.seq);
+    if (diff < 0)
+      continue;
+
+    if (diff == 0 || (diff <= 32 && (ackBits & (1u << (diff - 1)))))
+    {
+      sent.pending = false;
+      _numSentSinceAck = 0;
+    }
+    else if (diff >= LOSS_DISTANCE)
+    {
+      sent.pending = false;
+      AddLost(sent.seq);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void UdpChannel::AddLost(u16 seq)
+{
+  ++_numLost;
+  _lost.push_back(seq);
+
+  // not every user cares about losses, so don't let them pile up
+  while (_lost.size() > SENT_HISTORY)
+    _lost.pop_front();
+}
+
+//-----------------------------------------------------------------------------
+bool UdpChannel::PopLost(u16* seq)
+{
+  if (_lost.empty())
+    return false;
+
+  *seq = _lost.front();
+  _lost.pop_front();
+  return true;
+}
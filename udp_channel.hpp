@@ -0,0 +1,128 @@
+#pragma once
+#include "datagram_socket.hpp"
+
+namespace swarm
+{
+  // Datagrams are kept under the smallest MTU commonly seen on the internet,
+  // so they're never fragmented by IP, where losing any piece loses them all
+  const size_t MAX_DATAGRAM_SIZE = 1200;
+  const size_t UDP_HEADER_SIZE = 15;
+  const size_t MAX_FRAGMENT_PAYLOAD = MAX_DATAGRAM_SIZE - UDP_HEADER_SIZE;
+  const size_t MAX_FRAGMENTS = 255;
+
+  // Messages on a stream are delivered in order, and a message that arrives
+  // after a newer one on the same stream is dropped rather than delivered late
+  const u8 MAX_UDP_STREAMS = 4;
+
+  //-----------------------------------------------------------------------------
+  // Unreliable, sequenced messages over UDP, for state that is replaced by the
+  // next update anyway, like snapshots and inputs. A lost message is never
+  // resent, so unlike TCP, one lost packet doesn't hold up all the messages
+  // behind it.
+  //
+  // Every datagram starts with a header:
+  //  u32 token       identifies the session the datagram belongs to
+  //  u16 seq         sequence number of the message
+  //  u16 ack         the newest message received from the other side
+  //  u32 ackBits     bit n is set if message ack - 1 - n was received
+  //  u8 stream
+  //  u8 fragment     index of the fragment, and the number of fragments
+  //  u8 numFragments
+  //
+  // Messages larger than a datagram are split into fragments, and delivered
+  // once they've all arrived. The channel doesn't own a socket, so the server
+  // can send to all its clients through a single one.
+  class UdpChannel
+  {
+  public:
+    UdpChannel();
+
+    void Reset(u32 token);
+    u32 GetToken() const { return _token; }
+
+    // Splits the message into datagrams, appended to buf and datagrams. Returns
+    // false if the message is too large to send.
+    bool Write(u8 stream, const char* data, size_t size, const UdpAddress& to,
+        vector<char>* buf, vector<Datagram>* datagrams, u16* seq);
+
+    // Handles a received datagram. Returns true if it completes a message
+    // that's newer than the last one delivered on its stream.
+    bool Receive(const char* data, size_t size, u8* stream, const char** msg, size_t* msgSize);
+
+    // Returns the next sent message the other side is known to have missed,
+    // ie that wasn't acked even though later ones were
+    bool PopLost(u16* seq);
+
+    // messages sent since the last time the other side acked one. if this
+    // keeps growing, nothing is getting through
+    u32 GetNumSentSinceAck() const { return _numSentSinceAck; }
+
+    u64 GetNumStale() const { return _numStale; }
+    u64 GetNumLost() const { return _numLost; }
+
+    // Reads the token of a datagram, so the receiver can find its channel
+    static bool PeekToken(const char* data, size_t size, u32* token);
+
+  private:
+    struct Header
+    {
+      u32 token;
+      u16 seq;
+      u16 ack;
+      u32 ackBits;
+      u8 stream;
+      u8 fragment;
+      u8 numFragments;
+    };
+
+    static void WriteHeader(const Header& header, char* buf);
+    static bool ReadHeader(const char* buf, size_t size, Header* header);
+
+    void HandleAcks(u16 ack, u32 ackBits);
+    void MessageReceived(u16 seq);
+    void AddLost(u16 seq);
+
+    // a message that is partly received
+    struct Reassembly
+    {
+      Reassembly() : inUse(false) {}
+      vector<char> data;
+      vector<bool> received;
+      size_t size;
+      u16 seq;
+      u8 stream;
+      u8 numFragments;
+      u8 numReceived;
+      bool inUse;
+    };
+
+    Reassembly* FindReassembly(const Header& header);
+
+    struct SentMessage
+    {
+      SentMessage() : seq(0), pending(false) {}
+      u16 seq;
+      bool pending;
+    };
+
+    u32 _token;
+    u16 _nextSeq;
+
+    // acks for the messages received from the other side
+    u16 _remoteSeq;
+    u32 _remoteAckBits;
+    bool _hasRemoteSeq;
+
+    // the newest message delivered on each stream
+    u16 _deliveredSeq[MAX_UDP_STREAMS];
+    bool _hasDelivered[MAX_UDP_STREAMS];
+
+    vector<Reassembly> _reassembly;
+    vector<SentMessage> _sent;
+    deque<u16> _lost;
+    u32 _numSentSinceAck;
+
+    u64 _numStale;
+    u64 _numLost;
+  };
+}
@@ -0,0 +1,1076 @@
+#include "wire_codec.hpp"
+#include "swarm_compression.hpp"
+
+using namespace swarm;
+using namespace swarm::wire;
+
+namespace
+{
+  enum WireType
+  {
+    WIRE_VARINT = 0,
+    WIRE_FIXED64 = 1,
+    WIRE_BYTES = 2,
+    WIRE_FIXED32 = 5,
+  };
+
+  const size_t MIN_BUFFER_SIZE = 256;
+
+  // the monster, player and input entries always fit a single byte length
+  const size_t MAX_SHORT_LENGTH = 127;
+
+  u32 ZigZag(s32 v)
+  {
+    return ((u32)v << 1) ^ (u32)(v >> 31);
+  }
+
+  s32 UnZigZag(u32 v)
+  {
+    return (s32)(v >> 1) ^ -(s32)(v & 1);
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadVector2(const char* data, size_t size, Vector2f* v)
+  {
+    Reader reader(data, size);
+    u32 field, wireType;
+    while (reader.Next(&field, &wireType))
+    {
+      if (field == game::Vector2::kXFieldNumber && wireType == WIRE_FIXED32)
+        reader.ReadFloat(&v->x);
+      else if (field == game::Vector2::kYFieldNumber && wireType == WIRE_FIXED32)
+        reader.ReadFloat(&v->y);
+      else
+        reader.Skip(wireType);
+    }
+    return !reader.IsCorrupt();
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadMonster(const char* data, size_t size, Monster* m)
+  {
+    m->pos = Vector2f(0, 0);
+    m->vel = Vector2f(0, 0);
+    m->id = 0;
+    m->size = 0;
+    m->hasFixedState = false;
+    int numFixed = 0;
+
+    Reader reader(data, size);
+    u32 field, wireType;
+    const char* bytes;
+    size_t len;
+    u64 v;
+    while (reader.Next(&field, &wireType))
+    {
+      switch (field)
+      {
+        case game::Monster::kVelFieldNumber:
+          if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len) || !ReadVector2(bytes, len, &m->vel))
+            return false;
+          break;
+
+        case game::Monster::kPosFieldNumber:
+          if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len) || !ReadVector2(bytes, len, &m->pos))
+            return false;
+          break;
+
+        case game::Monster::kSizeFieldNumber:
+          if (wireType != WIRE_FIXED32 || !reader.ReadFloat(&m->size))
+            return false;
+          break;
+
+        case game::Monster::kIdFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          m->id = (u32)v;
+          break;
+
+        case game::Monster::kFixedStateFieldNumber:
+          // packed, though a parser has to take them one at a time as well
+          if (wireType == WIRE_BYTES)
+          {
+            if (!reader.ReadBytes(&bytes, &len))
+              return false;
+            Reader packed(bytes, len);
+            while (numFixed < FIXED_STATE_SIZE && packed.ReadVarint(&v))
+              m->fixedState[numFixed++] = UnZigZag((u32)v);
+          }
+          else if (wireType == WIRE_VARINT && reader.ReadVarint(&v))
+          {
+            if (numFixed < FIXED_STATE_SIZE)
+              m->fixedState[numFixed++] = UnZigZag((u32)v);
+          }
+          else
+          {
+            return false;
+          }
+          break;
+
+        default:
+          if (!reader.Skip(wireType))
+            return false;
+      }
+    }
+
+    m->hasFixedState = numFixed == FIXED_STATE_SIZE;
+    return !reader.IsCorrupt();
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadAggregate(const char* data, size_t size, Aggregate* a)
+  {
+    a->id = 0;
+    a->pos = a->vel = Vector2f(0, 0);
+    a->extent = 0;
+    a->count = 0;
+
+    Reader reader(data, size);
+    u32 field, wireType;
+    const char* bytes;
+    size_t len;
+    u64 v;
+    while (reader.Next(&field, &wireType))
+    {
+      switch (field)
+      {
+        case game::SwarmAggregate::kIdFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          a->id = (u32)v;
+          break;
+
+        case game::SwarmAggregate::kPosFieldNumber:
+        case game::SwarmAggregate::kVelFieldNumber:
+          {
+            Vector2f* dst = field == game::SwarmAggregate::kPosFieldNumber ? &a->pos : &a->vel;
+            if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len) || !ReadVector2(bytes, len, dst))
+              return false;
+          }
+          break;
+
+        case game::SwarmAggregate::kExtentFieldNumber:
+          if (wireType != WIRE_FIXED32 || !reader.ReadFloat(&a->extent))
+            return false;
+          break;
+
+        case game::SwarmAggregate::kCountFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          a->count = (u32)v;
+          break;
+
+        default:
+          if (!reader.Skip(wireType))
+            return false;
+      }
+    }
+
+    return !reader.IsCorrupt();
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadSwarmState(const char* data, size_t size, SwarmState* state)
+  {
+    state->Clear();
+
+    Reader reader(data, size);
+    u32 field, wireType;
+    const char* bytes;
+    size_t len;
+    u64 v;
+    while (reader.Next(&field, &wireType))
+    {
+      switch (field)
+      {
+        case game::SwarmState::kMonsterFieldNumber:
+          if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len))
+            return false;
+          state->monsters.push_back(Monster());
+          if (!ReadMonster(bytes, len, &state->monsters.back()))
+            return false;
+          break;
+
+        case game::SwarmState::kTickFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          state->tick = (u32)v;
+          break;
+
+        case game::SwarmState::kServerTimeFieldNumber:
+          if (wireType != WIRE_FIXED64 || !reader.ReadDouble(&state->serverTime))
+            return false;
+          break;
+
+        case game::SwarmState::kFullFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          state->full = v != 0;
+          break;
+
+        case game::SwarmState::kRemovedIdFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          state->removedIds.push_back((u32)v);
+          break;
+
+        case game::SwarmState::kChunkFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          state->chunk = (u32)v;
+          break;
+
+        case game::SwarmState::kNumChunksFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          state->numChunks = (u32)v;
+          state->hasNumChunks = true;
+          break;
+
+        case game::SwarmState::kPackedMonstersFieldNumber:
+          if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len))
+            return false;
+          if (!DecompressMonsters(bytes, len, &state->monsters))
+            return false;
+          break;
+
+        case game::SwarmState::kAggregateFieldNumber:
+          if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len))
+            return false;
+          state->aggregates.push_back(Aggregate());
+          if (!ReadAggregate(bytes, len, &state->aggregates.back()))
+            return false;
+          break;
+
+        default:
+          if (!reader.Skip(wireType))
+            return false;
+      }
+    }
+
+    return !reader.IsCorrupt();
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadPlayer(const char* data, size_t size, Player* p)
+  {
+    p->id = 0;
+    p->acc = p->vel = p->pos = Vector2f(0, 0);
+    p->health = 0;
+    p->lastInputSeq = 0;
+
+    Reader reader(data, size);
+    u32 field, wireType;
+    const char* bytes;
+    size_t len;
+    u64 v;
+    while (reader.Next(&field, &wireType))
+    {
+      switch (field)
+      {
+        case game::Player::kIdFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          p->id = (u32)v;
+          break;
+
+        case game::Player::kAccFieldNumber:
+        case game::Player::kVelFieldNumber:
+        case game::Player::kPosFieldNumber:
+          {
+            Vector2f* dst = field == game::Player::kAccFieldNumber ? &p->acc
+                : field == game::Player::kVelFieldNumber ? &p->vel : &p->pos;
+            if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len) || !ReadVector2(bytes, len, dst))
+              return false;
+          }
+          break;
+
+        case game::Player::kHealthFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          p->health = (s32)v;
+          break;
+
+        case game::Player::kLastInputSeqFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          p->lastInputSeq = (u32)v;
+          break;
+
+        default:
+          if (!reader.Skip(wireType))
+            return false;
+      }
+    }
+
+    return !reader.IsCorrupt();
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadPlayerState(const char* data, size_t size, PlayerState* state)
+  {
+    state->Clear();
+
+    Reader reader(data, size);
+    u32 field, wireType;
+    const char* bytes;
+    size_t len;
+    u64 v;
+    while (reader.Next(&field, &wireType))
+    {
+      switch (field)
+      {
+        case game::PlayerState::kPlayerFieldNumber:
+          if (wireType != WIRE_BYTES || !reader.ReadBytes(&bytes, &len))
+            return false;
+          state->players.push_back(Player());
+          if (!ReadPlayer(bytes, len, &state->players.back()))
+            return false;
+          break;
+
+        case game::PlayerState::kTickFieldNumber:
+          if (wireType != WIRE_VARINT || !reader.ReadVarint(&v))
+            return false;
+          state->tick = (u32)v;
+          break;
+
+        case game::PlayerState::kServerTimeFieldNumber:
+          if (wireType != WIRE_FIXED64 || !reader.ReadDouble(&state->serverTime))
+            return false;
+          break;
+
+        default:
+          if (!reader.Skip(wireType))
+            return false;
+      }
+    }
+
+    return !reader.IsCorrupt();
+  }
+
+  //-----------------------------------------------------------------------------
+  bool ReadPlayerInput(const char* data, size_t size, PlayerInput* input)
+  {
+    input->seq = 0;
+    input->acc = Vector2f(0, 0);
+
+    Reader reader(data, size);
+    u32 field, wireType;
+    const char* bytes;
+    size_t len;
+    u64 v;
+    while (reader.Next(&field, &wireType))
+    {
+      if (field == game::PlayerInput::kSeqFieldNumber && wireType == WIRE_VARINT)
+      {
+        if (!reader.ReadVarint(&v))
+          return false;
+        input->seq = (u32)v;
+      }
+      else if (field == game::PlayerInput::kAccFieldNumber && wireType == WIRE_BYTES)
+      {
+        if (!reader.ReadBytes(&bytes, &len) || !ReadVector2(bytes, len, &input->acc))
+          return false;
+      }
+      else if (!reader.Skip(wireType))
+      {
+        return false;
+      }
+    }
+
+    return !reader.IsCorrupt();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void SwarmState::Clear()
+{
+  monsters.clear();
+  removedIds.clear();
+  tick = 0;
+  serverTime = 0;
+  full = false;
+  hasNumChunks = false;
+  chunk = 0;
+  numChunks = 0;
+  aggregates.clear();
+}
+
+//-----------------------------------------------------------------------------
+void PlayerState::Clear()
+{
+  players.clear();
+  tick = 0;
+  serverTime = 0;
+}
+
+//-----------------------------------------------------------------------------
+Writer::Writer(vector<char>* buf)
+  : _buf(buf)
+  , _depth(0)
+{
+  size_t used = buf->size();
+  buf->resize(max(used + MIN_BUFFER_SIZE, buf->capacity()));
+  _ptr = buf->data() + used;
+  _end = buf->data() + buf->size();
+}
+
+//-----------------------------------------------------------------------------
+Writer::~Writer()
+{
+  _buf->resize(_ptr - _buf->data());
+}
+
+//-----------------------------------------------------------------------------
+void Writer::Reserve(size_t bytes)
+{
+  if ((size_t)(_end - _ptr) >= bytes)
+    return;
+
+  size_t used = _ptr - _buf->data();
+  _buf->resize(max(2 * _buf->size(), used + bytes));
+  _ptr = _buf->data() + used;
+  _end = _buf->data() + _buf->size();
+}
+
+//-----------------------------------------------------------------------------
+void Writer::PutVarint(u64 v)
+{
+  while (v >= 0x80)
+  {
+    *_ptr++ = (char)(v | 0x80);
+    v >>= 7;
+  }
+  *_ptr++ = (char)v;
+}
+
+//-----------------------------------------------------------------------------
+void Writer::PutFixed32(u32 v)
+{
+  // little endian, whatever the host is
+  for (int i = 0; i < 4; ++i)
+    *_ptr++ = (char)(v >> (i * 8));
+}
+
+//-----------------------------------------------------------------------------
+void Writer::PutFixed64(u64 v)
+{
+  for (int i = 0; i < 8; ++i)
+    *_ptr++ = (char)(v >> (i * 8));
+}
+
+//-----------------------------------------------------------------------------
+void Writer::PutTag(u32 field, u32 wireType)
+{
+  PutVarint(field << 3 | wireType);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::BeginFrame()
+{
+  assert(_depth < MAX_DEPTH);
+  Reserve(sizeof(u32));
+  _open[_depth] = _ptr - _buf->data();
+  _frame[_depth++] = true;
+  _ptr += sizeof(u32);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::BeginNested(u32 field)
+{
+  // the length goes in front, so room is left for the longest it can be
+  assert(_depth < MAX_DEPTH);
+  Reserve(5 + LENGTH_RESERVE);
+  PutTag(field, WIRE_BYTES);
+  _open[_depth] = _ptr - _buf->data();
+  _frame[_depth++] = false;
+  _ptr += LENGTH_RESERVE;
+}
+
+//-----------------------------------------------------------------------------
+void Writer::End()
+{
+  assert(_depth > 0);
+  --_depth;
+  char* start = _buf->data() + _open[_depth];
+
+  if (_frame[_depth])
+  {
+    *(u32*)start = htonl((u32)(_ptr - start - sizeof(u32)));
+    return;
+  }
+
+  // a varint length is as short as it can be, so close the gap if the
+  // reserved room wasn't needed
+  char* body = start + LENGTH_RESERVE;
+  size_t len = _ptr - body;
+  char lenBuf[LENGTH_RESERVE];
+  char* p = lenBuf;
+  for (u64 v = len; ; v >>= 7)
+  {
+    *p++ = (char)(v >= 0x80 ? (v | 0x80) : v);
+    if (v < 0x80)
+      break;
+  }
+
+  size_t lenSize = p - lenBuf;
+  if (lenSize < LENGTH_RESERVE)
+  {
+    memmove(start + lenSize, body, len);
+    _ptr -= LENGTH_RESERVE - lenSize;
+  }
+  memcpy(start, lenBuf, lenSize);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteVarint(u32 field, u64 v)
+{
+  Reserve(15);
+  PutTag(field, WIRE_VARINT);
+  PutVarint(v);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteInt32(u32 field, s32 v)
+{
+  // negative int32s are sign extended to ten bytes
+  WriteVarint(field, (u64)(s64)v);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteFloat(u32 field, float v)
+{
+  u32 bits;
+  memcpy(&bits, &v, sizeof(bits));
+  Reserve(9);
+  PutTag(field, WIRE_FIXED32);
+  PutFixed32(bits);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteDouble(u32 field, double v)
+{
+  u64 bits;
+  memcpy(&bits, &v, sizeof(bits));
+  Reserve(13);
+  PutTag(field, WIRE_FIXED64);
+  PutFixed64(bits);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteVector2(u32 field, const Vector2f& v)
+{
+  u32 x, y;
+  memcpy(&x, &v.x, sizeof(x));
+  memcpy(&y, &v.y, sizeof(y));
+  Reserve(16);
+  PutTag(field, WIRE_BYTES);
+  *_ptr++ = 10;
+  PutTag(game::Vector2::kXFieldNumber, WIRE_FIXED32);
+  PutFixed32(x);
+  PutTag(game::Vector2::kYFieldNumber, WIRE_FIXED32);
+  PutFixed32(y);
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WritePackedSInt32(u32 field, const s32* v, size_t count)
+{
+  size_t len = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    for (u32 z = ZigZag(v[i]); ; z >>= 7)
+    {
+      ++len;
+      if (z < 0x80)
+        break;
+    }
+  }
+
+  Reserve(10 + len);
+  PutTag(field, WIRE_BYTES);
+  PutVarint(len);
+  for (size_t i = 0; i < count; ++i)
+    PutVarint(ZigZag(v[i]));
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteBytes(u32 field, const char* data, size_t size)
+{
+  Reserve(10 + size);
+  PutTag(field, WIRE_BYTES);
+  PutVarint(size);
+  memcpy(_ptr, data, size);
+  _ptr += size;
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteMonster(u32 field, u32 id, const Vector2f& pos, const Vector2f& vel, float size, const s32* fixedState)
+{
+  Reserve(5 + 1);
+  PutTag(field, WIRE_BYTES);
+  // Reserve may move the buffer, so the length byte is kept as an offset
+  size_t bodyPos = ++_ptr - _buf->data();
+
+  WriteVector2(game::Monster::kVelFieldNumber, vel);
+  WriteVector2(game::Monster::kPosFieldNumber, pos);
+  WriteFloat(game::Monster::kSizeFieldNumber, size);
+  WriteVarint(game::Monster::kIdFieldNumber, id);
+  if (fixedState)
+    WritePackedSInt32(game::Monster::kFixedStateFieldNumber, fixedState, FIXED_STATE_SIZE);
+
+  size_t len = (_ptr - _buf->data()) - bodyPos;
+  assert(len <= MAX_SHORT_LENGTH);
+  _buf->data()[bodyPos - 1] = (char)len;
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WritePlayer(u32 field, const Player& player)
+{
+  Reserve(5 + 1);
+  PutTag(field, WIRE_BYTES);
+  size_t bodyPos = ++_ptr - _buf->data();
+
+  WriteVarint(game::Player::kIdFieldNumber, player.id);
+  WriteVector2(game::Player::kAccFieldNumber, player.acc);
+  WriteVector2(game::Player::kVelFieldNumber, player.vel);
+  WriteVector2(game::Player::kPosFieldNumber, player.pos);
+  WriteInt32(game::Player::kHealthFieldNumber, player.health);
+  WriteVarint(game::Player::kLastInputSeqFieldNumber, player.lastInputSeq);
+
+  size_t len = (_ptr - _buf->data()) - bodyPos;
+  assert(len <= MAX_SHORT_LENGTH);
+  _buf->data()[bodyPos - 1] = (char)len;
+}
+
+//-----------------------------------------------------------------------------
+void Writer::WriteAggregate(u32 field, const Aggregate& aggregate)
+{
+  Reserve(5 + 1);
+  PutTag(field, WIRE_BYTES);
+  size_t bodyPos = ++_ptr - _buf->data();
+
+  WriteVarint(game::SwarmAggregate::kIdFieldNumber, aggregate.id);
+  WriteVector2(game::SwarmAggregate::kPosFieldNumber, aggregate.pos);
+  WriteVector2(game::SwarmAggregate::kVelFieldNumber, aggregate.vel);
+  WriteFloat(game::SwarmAggregate::kExtentFieldNumber, aggregate.extent);
+  WriteVarint(game::SwarmAggregate::kCountFieldNumber, aggregate.count);
+
+  size_t len = (_ptr - _buf->data()) - bodyPos;
+  assert(len <= MAX_SHORT_LENGTH);
+  _buf->data()[bodyPos - 1] = (char)len;
+}
+
+//-----------------------------------------------------------------------------
+Reader::Reader(const char* data, size_t size)
+  : _ptr((const u8*)data)
+  , _end((const u8*)data + size)
+  , _corrupt(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::Next(u32* field, u32* wireType)
+{
+  if (_corrupt || _ptr == _end)
+    return false;
+
+  u64 tag;
+  if (!ReadVarint(&tag))
+    return false;
+
+  *field = (u32)(tag >> 3);
+  *wireType = (u32)(tag & 7);
+  if (*field == 0)
+    return Fail();
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::ReadVarint(u64* v)
+{
+  u64 res = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    if (_ptr == _end)
+      return Fail();
+
+    u8 b = *_ptr++;
+    res |= (u64)(b & 0x7f) << shift;
+    if (!(b & 0x80))
+    {
+      *v = res;
+      return true;
+    }
+  }
+
+  return Fail();
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::ReadFloat(float* v)
+{
+  if (_end - _ptr < 4)
+    return Fail();
+
+  u32 bits = 0;
+  for (int i = 0; i < 4; ++i)
+    bits |= (u32)*_ptr++ << (i * 8);
+  memcpy(v, &bits, sizeof(bits));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::ReadDouble(double* v)
+{
+  if (_end - _ptr < 8)
+    return Fail();
+
+  u64 bits = 0;
+  for (int i = 0; i < 8; ++i)
+    bits |= (u64)*_ptr++ << (i * 8);
+  memcpy(v, &bits, sizeof(bits));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::ReadBytes(const char** data, size_t* size)
+{
+  u64 len;
+  if (!ReadVarint(&len))
+    return false;
+
+  if (len > (u64)(_end - _ptr))
+    return Fail();
+
+  *data = (const char*)_ptr;
+  *size = (size_t)len;
+  _ptr += len;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Reader::Skip(u32 wireType)
+{
+  u64 v;
+  const char* data;
+  size_t size;
+  switch (wireType)
+  {
+    case WIRE_VARINT:
+      return ReadVarint(&v);
+
+    case WIRE_FIXED64:
+      if (_end - _ptr < 8)
+        return Fail();
+      _ptr += 8;
+      return true;
+
+    case WIRE_BYTES:
+      return ReadBytes(&data, &size);
+
+    case WIRE_FIXED32:
+      if (_end - _ptr < 4)
+        return Fail();
+      _ptr += 4;
+      return true;
+  }
+
+  // groups aren't used by game.proto
+  return Fail();
+}
+
+//-----------------------------------------------------------------------------
+void wire::EncodeSwarmState(vector<char>* buf, const SwarmState& state)
+{
+  buf->clear();
+  Writer w(buf);
+  w.BeginFrame();
+  w.WriteVarint(game::ServerMessage::kTypeFieldNumber, game::ServerMessage_Type_SWARM_STATE);
+  w.BeginNested(game::ServerMessage::kSwarmStateFieldNumber);
+
+  for (const Monster& m : state.monsters)
+    w.WriteMonster(game::SwarmState::kMonsterFieldNumber, m.id, m.pos, m.vel, m.size, m.hasFixedState ? m.fixedState : nullptr);
+
+  w.WriteVarint(game::SwarmState::kTickFieldNumber, state.tick);
+  w.WriteDouble(game::SwarmState::kServerTimeFieldNumber, state.serverTime);
+  if (state.full)
+    w.WriteVarint(game::SwarmState::kFullFieldNumber, 1);
+  for (u32 id : state.removedIds)
+    w.WriteVarint(game::SwarmState::kRemovedIdFieldNumber, id);
+  if (state.hasNumChunks)
+  {
+    w.WriteVarint(game::SwarmState::kChunkFieldNumber, state.chunk);
+    w.WriteVarint(game::SwarmState::kNumChunksFieldNumber, state.numChunks);
+  }
+  for (const Aggregate& a : state.aggregates)
+    w.WriteAggregate(game::SwarmState::kAggregateFieldNumber, a);
+
+  w.End();
+  w.End();
+}
+
+//-----------------------------------------------------------------------------
+void wire::EncodePlayerState(vector<char>* buf, const PlayerState& state)
+{
+  buf->clear();
+  Writer w(buf);
+  w.BeginFrame();
+  w.WriteVarint(game::ServerMessage::kTypeFieldNumber, game::ServerMessage_Type_PLAYER_STATE);
+  w.BeginNested(game::ServerMessage::kPlayerStateFieldNumber);
+
+  for (const Player& p : state.players)
+    w.WritePlayer(game::PlayerState::kPlayerFieldNumber, p);
+
+  w.WriteVarint(game::PlayerState::kTickFieldNumber, state.tick);
+  w.WriteDouble(game::PlayerState::kServerTimeFieldNumber, state.serverTime);
+
+  w.End();
+  w.End();
+}
+
+//-----------------------------------------------------------------------------
+void wire::EncodePlayerInputs(vector<char>* buf, const PlayerInput* inputs, size_t count)
+{
+  buf->clear();
+  Writer w(buf);
+  w.BeginFrame();
+  w.WriteVarint(game::PlayerMessage::kTypeFieldNumber, game::PlayerMessage_Type_PLAYER_INPUT);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    w.BeginNested(game::PlayerMessage::kInputFieldNumber);
+    w.WriteVarint(game::PlayerInput::kSeqFieldNumber, inputs[i].seq);
+    w.WriteVector2(game::PlayerInput::kAccFieldNumber, inputs[i].acc);
+    w.End();
+  }
+
+  w.End();
+}
+
+//-----------------------------------------------------------------------------
+bool wire::DecodeServerMessage(const char* data, size_t size, int* type, SwarmState* swarmState, PlayerState* playerState)
+{
+  const char* swarmData = nullptr;
+  const char* playerData = nullptr;
+  size_t swarmSize = 0, playerSize = 0;
+  bool hasType = false;
+
+  Reader reader(data, size);
+  u32 field, wireType;
+  u64 v;
+  while (reader.Next(&field, &wireType))
+  {
+    if (field == game::ServerMessage::kTypeFieldNumber && wireType == WIRE_VARINT)
+    {
+      if (!reader.ReadVarint(&v))
+        return false;
+      *type = (int)v;
+      hasType = true;
+    }
+    else if (field == game::ServerMessage::kSwarmStateFieldNumber && wireType == WIRE_BYTES)
+    {
+      if (!reader.ReadBytes(&swarmData, &swarmSize))
+        return false;
+    }
+    else if (field == game::ServerMessage::kPlayerStateFieldNumber && wireType == WIRE_BYTES)
+    {
+      if (!reader.ReadBytes(&playerData, &playerSize))
+        return false;
+    }
+    else
+    {
+      // anything else is for protobuf
+      return false;
+    }
+  }
+
+  if (reader.IsCorrupt() || !hasType)
+    return false;
+
+  if (*type == game::ServerMessage_Type_SWARM_STATE)
+    return ReadSwarmState(swarmData, swarmSize, swarmState);
+
+  if (*type == game::ServerMessage_Type_PLAYER_STATE)
+    return ReadPlayerState(playerData, playerSize, playerState);
+
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+bool wire::DecodePlayerInputs(const char* data, size_t size, vector<PlayerInput>* inputs)
+{
+  inputs->clear();
+  bool isInput = false;
+
+  Reader reader(data, size);
+  u32 field, wireType;
+  const char* bytes;
+  size_t len;
+  u64 v;
+  while (reader.Next(&field, &wireType))
+  {
+    if (field == game::PlayerMessage::kTypeFieldNumber && wireType == WIRE_VARINT)
+    {
+      if (!reader.ReadVarint(&v))
+        return false;
+      isInput = v == game::PlayerMessage_Type_PLAYER_INPUT;
+    }
+    else if (field == game::PlayerMessage::kInputFieldNumber && wireType == WIRE_BYTES)
+    {
+      if (!reader.ReadBytes(&bytes, &len))
+        return false;
+      inputs->push_back(PlayerInput());
+      if (!ReadPlayerInput(bytes, len, &inputs->back()))
+        return false;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  return isInput && !reader.IsCorrupt();
+}
+
+//-----------------------------------------------------------------------------
+void swarm::ToProtocol(game::SwarmState* lhs, const wire::SwarmState& rhs)
+{
+  lhs->Clear();
+  for (const wire::Monster& m : rhs.monsters)
+  {
+    game::Monster* monster = lhs->add_monster();
+    ToProtocol(monster->mutable_vel(), m.vel);
+    ToProtocol(monster->mutable_pos(), m.pos);
+    monster->set_size(m.size);
+    monster->set_id(m.id);
+    if (m.hasFixedState)
+    {
+      for (int i = 0; i < FIXED_STATE_SIZE; ++i)
+        monster->add_fixed_state(m.fixedState[i]);
+    }
+  }
+
+  lhs->set_tick(rhs.tick);
+  lhs->set_server_time(rhs.serverTime);
+  if (rhs.full)
+    lhs->set_full(true);
+  for (u32 id : rhs.removedIds)
+    lhs->add_removed_id(id);
+  if (rhs.hasNumChunks)
+  {
+    lhs->set_chunk(rhs.chunk);
+    lhs->set_num_chunks(rhs.numChunks);
+  }
+  for (const wire::Aggregate& a : rhs.aggregates)
+    ToProtocol(lhs->add_aggregate(), a);
+}
+
+//-----------------------------------------------------------------------------
+void swarm::FromProtocol(wire::SwarmState* lhs, const game::SwarmState& rhs)
+{
+  lhs->Clear();
+  lhs->monsters.resize(rhs.monster_size());
+  for (int i = 0; i < rhs.monster_size(); ++i)
+  {
+    const game::Monster& m = rhs.monster(i);
+    wire::Monster& monster = lhs->monsters[i];
+    FromProtocol(&monster.vel, m.vel());
+    FromProtocol(&monster.pos, m.pos());
+    monster.size = m.size();
+    monster.id = m.id();
+    monster.hasFixedState = m.fixed_state_size() == FIXED_STATE_SIZE;
+    for (int j = 0; j < FIXED_STATE_SIZE && monster.hasFixedState; ++j)
+      monster.fixedState[j] = m.fixed_state(j);
+  }
+
+  if (rhs.has_packed_monsters())
+  {
+    const string& packed = rhs.packed_monsters();
+    if (!DecompressMonsters(packed.data(), packed.size(), &lhs->monsters))
+      LOG_WARN("Corrupt packed monsters");
+  }
+
+  for (int i = 0; i < rhs.removed_id_size(); ++i)
+    lhs->removedIds.push_back(rhs.removed_id(i));
+
+  lhs->tick = rhs.tick();
+  lhs->serverTime = rhs.server_time();
+  lhs->full = rhs.full();
+  lhs->hasNumChunks = rhs.has_num_chunks();
+  lhs->chunk = rhs.chunk();
+  lhs->numChunks = rhs.num_chunks();
+
+  lhs->aggregates.resize(rhs.aggregate_size());
+  for (int i = 0; i < rhs.aggregate_size(); ++i)
+    FromProtocol(&lhs->aggregates[i], rhs.aggregate(i));
+}
+
+//-----------------------------------------------------------------------------
+void swarm::ToProtocol(game::PlayerState* lhs, const wire::PlayerState& rhs)
+{
+  lhs->Clear();
+  for (const wire::Player& p : rhs.players)
+  {
+    game::Player* player = lhs->add_player();
+    player->set_id(p.id);
+    ToProtocol(player->mutable_acc(), p.acc);
+    ToProtocol(player->mutable_vel(), p.vel);
+    ToProtocol(player->mutable_pos(), p.pos);
+    player->set_health(p.health);
+    player->set_last_input_seq(p.lastInputSeq);
+  }
+
+  lhs->set_tick(rhs.tick);
+  lhs->set_server_time(rhs.serverTime);
+}
+
+//-----------------------------------------------------------------------------
+void swarm::FromProtocol(wire::PlayerState* lhs, const game::PlayerState& rhs)
+{
+  lhs->Clear();
+  lhs->players.resize(rhs.player_size());
+  for (int i = 0; i < rhs.player_size(); ++i)
+    FromProtocol(&lhs->players[i], rhs.player(i));
+
+  lhs->tick = rhs.tick();
+  lhs->serverTime = rhs.server_time();
+}
+
+//-----------------------------------------------------------------------------
+void swarm::FromProtocol(wire::Player* lhs, const game::Player& rhs)
+{
+  lhs->id = rhs.id();
+  FromProtocol(&lhs->acc, rhs.acc());
+  FromProtocol(&lhs->vel, rhs.vel());
+  FromProtocol(&lhs->pos, rhs.pos());
+  lhs->health = rhs.health();
+  lhs->lastInputSeq = rhs.last_input_seq();
+}
+
+//-----------------------------------------------------------------------------
+void swarm::ToProtocol(game::SwarmAggregate* lhs, const wire::Aggregate& rhs)
+{
+  lhs->set_id(rhs.id);
+  ToProtocol(lhs->mutable_pos(), rhs.pos);
+  ToProtocol(lhs->mutable_vel(), rhs.vel);
+  lhs->set_extent(rhs.extent);
+  lhs->set_count(rhs.count);
+}
+
+//-----------------------------------------------------------------------------
+void swarm::FromProtocol(wire::Aggregate* lhs, const game::SwarmAggregate& rhs)
+{
+  lhs->id = rhs.id();
+  FromProtocol(&lhs->pos, rhs.pos());
+  FromProtocol(&lhs->vel, rhs.vel());
+  lhs->extent = rhs.extent();
+  lhs->count = rhs.count();
+}
+
+//-----------------------------------------------------------------------------
+void swarm::FromProtocol(wire::PlayerInput* lhs, const game::PlayerInput& rhs)
+{
+  lhs->seq = rhs.seq();
+  FromProtocol(&lhs->acc, rhs.acc());
+}
@@ -0,0 +1,176 @@
+#pragma once
+#include "protocol.hpp"
+
+namespace swarm
+{
+  //-----------------------------------------------------------------------------
+  // Hand written encoder and decoder for the messages that are sent every
+  // snapshot: swarm states, player states and player inputs. They produce and
+  // accept the same bytes as the protobuf messages in game.proto, so either
+  // side can use protobuf instead, but they write straight from the
+  // simulation's arrays and read into plain structs, without building a
+  // message tree. The rare control messages stay with protobuf.
+  namespace wire
+  {
+    // pos x, y, vel x, y and size in fixed point
+    const int FIXED_STATE_SIZE = 5;
+
+    struct Monster
+    {
+      Vector2f pos;
+      Vector2f vel;
+      u32 id;
+      float size;
+      // only sent in lockstep mode
+      s32 fixedState[FIXED_STATE_SIZE];
+      bool hasFixedState;
+    };
+
+    // The far monsters of a swarm in one cell of the aggregate grid
+    struct Aggregate
+    {
+      u32 id;
+      Vector2f pos;
+      Vector2f vel;
+      float extent;
+      u32 count;
+    };
+
+    struct SwarmState
+    {
+      SwarmState() { Clear(); }
+      void Clear();
+
+      vector<Monster> monsters;
+      vector<u32> removedIds;
+      u32 tick;
+      double serverTime;
+      bool full;
+      // set on the chunks of an initial state
+      bool hasNumChunks;
+      u32 chunk;
+      u32 numChunks;
+      vector<Aggregate> aggregates;
+    };
+
+    struct Player
+    {
+      u32 id;
+      Vector2f acc;
+      Vector2f vel;
+      Vector2f pos;
+      s32 health;
+      u32 lastInputSeq;
+    };
+
+    struct PlayerState
+    {
+      PlayerState() { Clear(); }
+      void Clear();
+
+      vector<Player> players;
+      u32 tick;
+      double serverTime;
+    };
+
+    struct PlayerInput
+    {
+      u32 seq;
+      Vector2f acc;
+    };
+
+    //-----------------------------------------------------------------------------
+    // Appends protobuf encoded fields to a buffer. Messages are nested with
+    // Begin and End, which fill in the length once it's known.
+    class Writer
+    {
+    public:
+      explicit Writer(vector<char>* buf);
+      // trims the buffer to what was written
+      ~Writer();
+
+      // the u32 size in front of a message, as PackMessage writes it
+      void BeginFrame();
+      void BeginNested(u32 field);
+      void End();
+
+      void WriteVarint(u32 field, u64 v);
+      void WriteInt32(u32 field, s32 v);
+      void WriteFloat(u32 field, float v);
+      void WriteDouble(u32 field, double v);
+      void WriteVector2(u32 field, const Vector2f& v);
+      void WritePackedSInt32(u32 field, const s32* v, size_t count);
+      void WriteBytes(u32 field, const char* data, size_t size);
+
+      // SWARM_STATE and PLAYER_STATE entries, as ToProtocol fills them
+      void WriteMonster(u32 field, u32 id, const Vector2f& pos, const Vector2f& vel, float size, const s32* fixedState);
+      void WritePlayer(u32 field, const Player& player);
+      void WriteAggregate(u32 field, const Aggregate& aggregate);
+
+    private:
+      enum { MAX_DEPTH = 8, LENGTH_RESERVE = 5 };
+
+      void Reserve(size_t bytes);
+      void PutVarint(u64 v);
+      void PutFixed32(u32 v);
+      void PutFixed64(u64 v);
+      void PutTag(u32 field, u32 wireType);
+
+      vector<char>* _buf;
+      char* _ptr;
+      char* _end;
+      // where each open message starts, and whether it's a frame
+      size_t _open[MAX_DEPTH];
+      bool _frame[MAX_DEPTH];
+      int _depth;
+    };
+
+    //-----------------------------------------------------------------------------
+    class Reader
+    {
+    public:
+      Reader(const char* data, size_t size);
+
+      // Reads the next field's tag. Returns false at the end, or if the data
+      // is corrupt.
+      bool Next(u32* field, u32* wireType);
+
+      bool ReadVarint(u64* v);
+      bool ReadFloat(float* v);
+      bool ReadDouble(double* v);
+      bool ReadBytes(const char** data, size_t* size);
+      bool Skip(u32 wireType);
+
+      bool IsCorrupt() const { return _corrupt; }
+
+    private:
+      bool Fail() { _corrupt = true; return false; }
+
+      const u8* _ptr;
+      const u8* _end;
+      bool _corrupt;
+    };
+
+    // Framed messages, byte for byte what PackMessage makes of the protobuf
+    // version. The buffer is overwritten.
+    void EncodeSwarmState(vector<char>* buf, const SwarmState& state);
+    void EncodePlayerState(vector<char>* buf, const PlayerState& state);
+    void EncodePlayerInputs(vector<char>* buf, const PlayerInput* inputs, size_t count);
+
+    // Decodes a ServerMessage if it's a swarm or player state. Returns false
+    // for other messages, which are left to protobuf, and for corrupt ones.
+    bool DecodeServerMessage(const char* data, size_t size, int* type, SwarmState* swarmState, PlayerState* playerState);
+
+    // Decodes a PlayerMessage if it's just inputs. Returns false otherwise.
+    bool DecodePlayerInputs(const char* data, size_t size, vector<PlayerInput>* inputs);
+  }
+
+  void ToProtocol(game::SwarmState* lhs, const wire::SwarmState& rhs);
+  void FromProtocol(wire::SwarmState* lhs, const game::SwarmState& rhs);
+  void ToProtocol(game::PlayerState* lhs, const wire::PlayerState& rhs);
+  void FromProtocol(wire::PlayerState* lhs, const game::PlayerState& rhs);
+  void FromProtocol(wire::Player* lhs, const game::Player& rhs);
+  void ToProtocol(game::SwarmAggregate* lhs, const wire::Aggregate& rhs);
+  void FromProtocol(wire::Aggregate* lhs, const game::SwarmAggregate& rhs);
+  void FromProtocol(wire::PlayerInput* lhs, const game::PlayerInput& rhs);
+}